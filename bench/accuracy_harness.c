@@ -0,0 +1,353 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_coordinates.h"
+#include "../src/solar_time.h"
+#include "bench_utils.h"
+#include "reference_engine.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Runs a corpus of cities x days x calculation methods through every solar
+ * time engine and reports the error of each event against the reference
+ * engine, in seconds, next to the cost of the engine. The events are the
+ * unrounded hours of solar_time_t, so errors well below the minute the
+ * prayer times are rounded to still show. Any faster variant (tables,
+ * interpolation, fast math, float) is added to `engines` and must keep its
+ * error distribution, and its count of events that round to another
+ * minute, in check.
+ *
+ * Usage: accuracy_harness [days]     corpus report, 366 days by default
+ *        accuracy_harness --anchors  only check the golden anchors
+ */
+
+#define PRAYERS 7
+#define DEFAULT_DAYS 366
+
+typedef void (*engine_t)(coordinates_t *coordinates, time_t start,
+                         size_t days, solar_time_t *solar_times);
+
+static void single_days(coordinates_t *coordinates, time_t start, size_t days,
+                        solar_time_t *solar_times) {
+  for (size_t i = 0; i < days; i++) {
+    solar_times[i] = new_solar_time(add_days(start, (int)i), coordinates);
+  }
+}
+
+static void range_days(coordinates_t *coordinates, time_t start, size_t days,
+                       solar_time_t *solar_times) {
+  solar_time_days_t solar;
+  solar_time_days_init(&solar, coordinates, start);
+  for (size_t i = 0; i < days; i++) {
+    solar_times[i] = solar.today;
+    solar_time_days_next(&solar);
+  }
+}
+
+/* new_solar_time() with the other tiers of solar_coordinates_t */
+static void tier_days(solar_precision_t precision, coordinates_t *coordinates,
+                      time_t start, size_t days, solar_time_t *solar_times) {
+  const solar_precision_t previous =
+      solar_coordinates_set_precision(precision);
+  single_days(coordinates, start, days, solar_times);
+  solar_coordinates_set_precision(previous);
+}
+
+static void fast_days(coordinates_t *coordinates, time_t start, size_t days,
+                      solar_time_t *solar_times) {
+  tier_days(SOLAR_PRECISION_FAST, coordinates, start, days, solar_times);
+}
+
+static void high_days(coordinates_t *coordinates, time_t start, size_t days,
+                      solar_time_t *solar_times) {
+  tier_days(SOLAR_PRECISION_HIGH, coordinates, start, days, solar_times);
+}
+
+static const struct {
+  const char *name;
+  engine_t run;
+} engines[] = {
+    {"new_solar_time", single_days},
+    {"solar_time_days_t", range_days},
+    {"new_solar_time, fast tier", fast_days},
+    {"new_solar_time, high tier", high_days},
+};
+
+#define ENGINES (sizeof engines / sizeof engines[0])
+
+static const char *const event_names[REFERENCE_EVENTS] = {
+    "fajr", "sunrise", "transit", "asr", "sunset", "isha"};
+
+/* Events of a solar time in seconds since the epoch, for the angles of
+ * `parameters` */
+static void solar_events(solar_time_t *solar_time, time_t day,
+                         const calculation_parameters_t *parameters,
+                         double events[REFERENCE_EVENTS]) {
+  const double hours[REFERENCE_EVENTS] = {
+      hour_angle(solar_time, -parameters->fajrAngle, false),
+      solar_time->sunrise,
+      solar_time->transit,
+      afternoon(solar_time, getShadowLength(parameters->madhab)),
+      solar_time->sunset,
+      hour_angle(solar_time, -parameters->ishaAngle, true)};
+  for (int event = 0; event < REFERENCE_EVENTS; event++) {
+    events[event] = (double)day + hours[event] * 3600;
+  }
+}
+
+static const char *const prayer_names[PRAYERS] = {
+    "fajr", "sunrise", "dhuhr", "asr", "maghrib", "isha", "midnight"};
+
+static const coordinates_t cities[] = {
+    {21.4225, 39.8262},    /* Makkah */
+    {24.4672, 39.6111},    /* Madinah */
+    {30.0444, 31.2357},    /* Cairo */
+    {41.0082, 28.9784},    /* Istanbul */
+    {33.6844, 73.0479},    /* Islamabad */
+    {24.8607, 67.0011},    /* Karachi */
+    {23.8103, 90.4125},    /* Dhaka */
+    {-6.2088, 106.8456},   /* Jakarta */
+    {3.1390, 101.6869},    /* Kuala Lumpur */
+    {25.2048, 55.2708},    /* Dubai */
+    {35.6892, 51.3890},    /* Tehran */
+    {33.5731, -7.5898},    /* Casablanca */
+    {14.7167, -17.4677},   /* Dakar */
+    {9.0765, 7.3986},      /* Abuja */
+    {-1.2921, 36.8219},    /* Nairobi */
+    {-33.9249, 18.4241},   /* Cape Town */
+    {51.5074, -0.1278},    /* London */
+    {48.8566, 2.3522},     /* Paris */
+    {52.5200, 13.4050},    /* Berlin */
+    {35.7750, -78.6336},   /* Raleigh */
+    {40.7128, -74.0060},   /* New York */
+    {43.6532, -79.3832},   /* Toronto */
+    {-33.8688, 151.2093},  /* Sydney */
+    {-23.5505, -46.6333},  /* Sao Paulo */
+};
+
+#define CITIES (sizeof cities / sizeof cities[0])
+
+static time_t field(const prayer_times_t *times, int prayer) {
+  const time_t fields[PRAYERS] = {times->fajr,    times->sunrise,
+                                  times->dhuhr,   times->asr,
+                                  times->maghrib, times->isha,
+                                  times->midnight};
+  return fields[prayer];
+}
+
+/* Times of the unit tests in prayer_times_test.cpp, which the library must
+ * reproduce to the minute and the reference engine within a minute */
+typedef struct {
+  const char *name;
+  coordinates_t coordinates;
+  int year, month, day;
+  calculation_method method;
+  madhab_t madhab;
+  int utc_offset; /* Seconds */
+  const char *times[6];
+} anchor_t;
+
+static const anchor_t anchors[] = {
+    {"Raleigh, North America, Hanafi",
+     {35.7750, -78.6336},
+     2015, 7, 12,
+     NORTH_AMERICA,
+     HANAFI,
+     -4 * 3600,
+     {"04:42", "06:08", "13:21", "18:22", "20:32", "21:57"}},
+    {"Raleigh, Muslim World League",
+     {35.7750, -78.6336},
+     2015, 12, 1,
+     MUSLIM_WORLD_LEAGUE,
+     SHAFI,
+     -5 * 3600,
+     {"05:35", "07:06", "12:05", "14:42", "17:01", "18:26"}},
+    {"Raleigh, Moonsighting Committee",
+     {35.7750, -78.6336},
+     2016, 1, 31,
+     MOON_SIGHTING_COMMITTEE,
+     SHAFI,
+     -5 * 3600,
+     {"05:48", "07:16", "12:33", "15:20", "17:43", "19:04"}},
+    {"Oslo, Moonsighting Committee, Hanafi",
+     {59.9094, 10.7349},
+     2016, 1, 1,
+     MOON_SIGHTING_COMMITTEE,
+     HANAFI,
+     3600,
+     {"07:49", "09:19", "12:25", "13:36", "15:25", "17:01"}},
+};
+
+/* Seconds since the start of the local day, of the minute an anchor shows */
+static long anchor_seconds(const char *time) {
+  return (long)atoi(time) * 3600 + (long)atoi(time + 3) * 60;
+}
+
+static long local_seconds(time_t when, int utc_offset) {
+  const long local = (long)(when + utc_offset) % 86400;
+  return local < 0 ? local + 86400 : local;
+}
+
+static int check_anchors(void) {
+  int failures = 0;
+
+  for (size_t i = 0; i < sizeof anchors / sizeof anchors[0]; i++) {
+    const anchor_t *anchor = &anchors[i];
+    coordinates_t coordinates = anchor->coordinates;
+    calculation_parameters_t parameters = getParameters(anchor->method);
+    const time_t date = (time_t)days_from_civil(anchor->year, anchor->month,
+                                                anchor->day) *
+                        86400;
+    prayer_times_t library, reference;
+
+    parameters.madhab = anchor->madhab;
+    library = new_prayer_times(&coordinates, date, &parameters);
+    if (!reference_prayer_times(&coordinates, date, &parameters,
+                                &reference)) {
+      printf("FAIL %s: no reference times\n", anchor->name);
+      failures++;
+      continue;
+    }
+    for (int prayer = 0; prayer < 6; prayer++) {
+      const long expected = anchor_seconds(anchor->times[prayer]);
+      const long actual =
+          local_seconds(field(&library, prayer), anchor->utc_offset);
+      const long precise =
+          local_seconds(field(&reference, prayer), anchor->utc_offset);
+      if (actual / 60 != expected / 60 || precise < expected - 60 ||
+          precise > expected + 119) {
+        printf("FAIL %s %s: expected %s, library %02ld:%02ld, reference "
+               "%02ld:%02ld:%02ld\n",
+               anchor->name, prayer_names[prayer], anchor->times[prayer],
+               actual / 3600, actual / 60 % 60, precise / 3600,
+               precise / 60 % 60, precise % 60);
+        failures++;
+      }
+    }
+  }
+  printf("%d anchor mismatches\n", failures);
+  return failures;
+}
+
+static int compare_errors(const void *a, const void *b) {
+  const double x = *(const double *)a;
+  const double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, size_t count, double p) {
+  return count ? sorted[(size_t)(p * (double)(count - 1) + 0.5)] : 0.0;
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && strcmp(argv[1], "--anchors") == 0) {
+    return check_anchors() ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  const size_t days =
+      argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_DAYS;
+  if (days == 0) {
+    fprintf(stderr, "usage: %s [days | --anchors]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (check_anchors()) {
+    return EXIT_FAILURE;
+  }
+
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+  const size_t samples = CITIES * OTHER * days;
+  long double(*reference)[REFERENCE_EVENTS] =
+      malloc(samples * sizeof *reference);
+  double(*baseline)[REFERENCE_EVENTS] = malloc(samples * sizeof *baseline);
+  solar_time_t *solar_times = malloc(days * sizeof *solar_times);
+  double *errors[REFERENCE_EVENTS];
+  for (int event = 0; event < REFERENCE_EVENTS; event++) {
+    errors[event] = malloc(samples * sizeof *errors[event]);
+  }
+
+  size_t undefined = 0;
+  double begin = bench_now_ns();
+  for (size_t i = 0; i < samples; i++) {
+    const size_t city = i / (OTHER * days);
+    const calculation_parameters_t parameters =
+        getParameters((calculation_method)(i / days % OTHER));
+    if (!reference_solar_events(
+            &cities[city], add_days(start, (int)(i % days)),
+            parameters.fajrAngle,
+            parameters.ishaInterval > 0 ? 0 : parameters.ishaAngle,
+            getShadowLength(parameters.madhab), reference[i])) {
+      for (int event = 0; event < REFERENCE_EVENTS; event++) {
+        reference[i][event] = NAN;
+      }
+      undefined++;
+    }
+  }
+  const double reference_cost = (bench_now_ns() - begin) / (double)samples;
+
+  printf("%zu cities x %d methods x %zu days, %zu days without reference "
+         "events\n",
+         CITIES, OTHER, days, undefined);
+  printf("reference engine %10.0f ns/day\n", reference_cost);
+
+  for (size_t engine = 0; engine < ENGINES; engine++) {
+    size_t counts[REFERENCE_EVENTS] = {0};
+    size_t moved = 0;
+    double elapsed = 0;
+
+    for (size_t run = 0; run < CITIES * OTHER; run++) {
+      const calculation_parameters_t parameters =
+          getParameters((calculation_method)(run % OTHER));
+      coordinates_t coordinates = cities[run / OTHER];
+
+      begin = bench_now_ns();
+      engines[engine].run(&coordinates, start, days, solar_times);
+      elapsed += bench_now_ns() - begin;
+
+      for (size_t day = 0; day < days; day++) {
+        const size_t i = run * days + day;
+        double events[REFERENCE_EVENTS];
+        solar_events(&solar_times[day], add_days(start, (int)day),
+                     &parameters, events);
+        for (int event = 0; event < REFERENCE_EVENTS; event++) {
+          if (engine == 0) {
+            baseline[i][event] = events[event];
+          } else if (lround(events[event] / 60) !=
+                     lround(baseline[i][event] / 60)) {
+            moved++;
+          }
+          if (isnan(reference[i][event])) {
+            continue;
+          }
+          const double error =
+              (double)((long double)events[event] - reference[i][event]);
+          errors[event][counts[event]++] = fabs(error);
+        }
+      }
+    }
+
+    printf("\n%s: %.0f ns/day, %zu events round to another minute than "
+           "%s\n",
+           engines[engine].name, elapsed / (double)samples, moved,
+           engines[0].name);
+    printf("  %-9s %8s %8s %8s %8s  (|error| in seconds)\n", "event", "p50",
+           "p95", "p99", "max");
+    for (int event = 0; event < REFERENCE_EVENTS; event++) {
+      qsort(errors[event], counts[event], sizeof(double), compare_errors);
+      printf("  %-9s %8.2f %8.2f %8.2f %8.2f\n", event_names[event],
+             percentile(errors[event], counts[event], 0.50),
+             percentile(errors[event], counts[event], 0.95),
+             percentile(errors[event], counts[event], 0.99),
+             percentile(errors[event], counts[event], 1.0));
+    }
+  }
+
+  for (int event = 0; event < REFERENCE_EVENTS; event++) {
+    free(errors[event]);
+  }
+  free(solar_times);
+  free(baseline);
+  free(reference);
+  return EXIT_SUCCESS;
+}
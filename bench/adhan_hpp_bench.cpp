@@ -0,0 +1,76 @@
+#include "../src/adhan.hpp"
+#include "bench_utils.h"
+#include <cstdio>
+
+extern "C" {
+#include "../src/timetable.h"
+}
+
+#define DAYS 365
+#define LOCATIONS 50
+
+static prayer_times_t timetable[DAYS];
+
+int main() {
+  using namespace std::chrono;
+  const calculation_method method = MUSLIM_WORLD_LEAGUE;
+  calculation_parameters_t c_params = getParameters(method);
+  const adhan::Params params(method);
+  const sys_days start_day = 2024y / January / 1;
+  const time_t start = adhan::to_time_t(start_day);
+  coordinates_t locations[LOCATIONS];
+
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = coordinates_t{-40.0 + 1.6 * i, -170.0 + 6.8 * i};
+  }
+
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int day = 0; day < DAYS; day++) {
+      prayer_times_t times = new_prayer_times(&locations[location],
+                                              add_days(start, day), &c_params);
+      bench_consume((unsigned long)times.isha);
+    }
+  }
+  double c_single = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    const adhan::Observer observer{locations[location].latitude,
+                                   locations[location].longitude};
+    for (int day = 0; day < DAYS; day++) {
+      adhan::Times times = adhan::times(observer, start_day + days(day),
+                                        params);
+      bench_consume((unsigned long)times.isha.time_since_epoch().count());
+    }
+  }
+  double cpp_single = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_times_range(&locations[location], start, DAYS, &c_params, NULL,
+                           timetable);
+    for (int day = 0; day < DAYS; day++) {
+      bench_consume((unsigned long)timetable[day].isha);
+    }
+  }
+  double c_range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    const adhan::Observer observer{locations[location].latitude,
+                                   locations[location].longitude};
+    for (const adhan::Times &times :
+         adhan::days(observer, params, start_day, DAYS)) {
+      bench_consume((unsigned long)times.isha.time_since_epoch().count());
+    }
+  }
+  double cpp_range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  std::printf("%d locations x %d days\n", LOCATIONS, DAYS);
+  std::printf("new_prayer_times loop   %8.0f ns/day\n", c_single);
+  std::printf("adhan::times loop       %8.0f ns/day\n", cpp_single);
+  std::printf("new_prayer_times_range  %8.0f ns/day\n", c_range);
+  std::printf("adhan::days             %8.0f ns/day\n", cpp_range);
+  return 0;
+}
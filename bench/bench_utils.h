@@ -0,0 +1,23 @@
+#ifndef ADHAN_BENCH_UTILS_H
+#define ADHAN_BENCH_UTILS_H
+
+#include <time.h>
+
+/**
+ * @brief Monotonic-enough wall clock in nanoseconds for micro benchmarks
+ */
+static inline double bench_now_ns(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/**
+ * @brief Sink that keeps the optimizer from discarding benchmarked work
+ */
+static inline void bench_consume(unsigned long value) {
+  static volatile unsigned long sink;
+  sink = sink + value;
+}
+
+#endif /* ADHAN_BENCH_UTILS_H */
@@ -0,0 +1,57 @@
+#include "../src/crescent_visibility.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ROUNDS 3
+
+int main(int argc, char **argv) {
+  /* 1 degree world map, the evening after the new moon of 2024-03-10 */
+  const crescent_grid_t grid = {-90, -180, 1, 181, 360};
+  const size_t cells = (size_t)grid.latitudes * grid.longitudes;
+  const time_t date = 1710028800;
+  const unsigned threads = argc > 1 ? (unsigned)atoi(argv[1]) : 4;
+  float *values = malloc(cells * sizeof(*values));
+  uint8_t *zones = malloc(cells);
+
+  if (!values || !zones) {
+    return 1;
+  }
+
+  double begin = bench_now_ns();
+  for (int round = 0; round < ROUNDS; round++) {
+    crescent_visibility_raster(date, &grid, CRESCENT_YALLOP, 1, values,
+                               zones);
+    bench_consume(zones[round]);
+  }
+  const double single = (bench_now_ns() - begin) / ROUNDS;
+
+  begin = bench_now_ns();
+  for (int round = 0; round < ROUNDS; round++) {
+    crescent_visibility_raster(date, &grid, CRESCENT_YALLOP, threads, values,
+                               zones);
+    bench_consume(zones[round]);
+  }
+  const double threaded = (bench_now_ns() - begin) / ROUNDS;
+
+  /* One crescent_visibility() per cell, each with its own lunar ephemeris */
+  begin = bench_now_ns();
+  for (unsigned column = 0; column < grid.longitudes; column++) {
+    const coordinates_t coordinates = {30, grid.first_longitude + column};
+    crescent_visibility_t visibility;
+    crescent_visibility(&coordinates, date, CRESCENT_YALLOP, &visibility);
+    bench_consume(visibility.zone);
+  }
+  const double location = (bench_now_ns() - begin) / grid.longitudes;
+
+  printf("%zu cells, threads %s\n", cells,
+         crescent_visibility_threads_enabled() ? "enabled" : "disabled");
+  printf("raster, 1 thread        %8.2f ms (%6.1f ns/cell)\n", single / 1e6,
+         single / cells);
+  printf("raster, %u threads       %8.2f ms (%6.1f ns/cell)\n", threads,
+         threaded / 1e6, threaded / cells);
+  printf("crescent_visibility()   %8.1f ns/cell\n", location);
+  free(zones);
+  free(values);
+  return 0;
+}
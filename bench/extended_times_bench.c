@@ -0,0 +1,66 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/extended_times.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_time.h"
+#include "../src/timetable.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 365
+#define LOCATIONS 50
+
+static prayer_times_t timetable[DAYS];
+static extended_times_t extended_timetable[DAYS];
+
+int main(void) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  const extended_parameters_t extended = default_extended_parameters();
+  coordinates_t locations[LOCATIONS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (coordinates_t){-40.0 + 1.6 * i, -170.0 + 6.8 * i};
+  }
+
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_times_range(&locations[location], start, DAYS, &params, NULL,
+                           timetable);
+    bench_consume((unsigned long)timetable[location % DAYS].isha);
+  }
+  double range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_extended_times_range(&locations[location], start, DAYS, &params,
+                             NULL, &extended, timetable, extended_timetable);
+    bench_consume((unsigned long)extended_timetable[location % DAYS].duha);
+  }
+  double extended_range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  /* The extended times computed on their own, each with its own solar time
+   * on top of the prayer times */
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_times_range(&locations[location], start, DAYS, &params, NULL,
+                           timetable);
+    for (int day = 0; day < DAYS; day++) {
+      const time_t date = add_days(start, day);
+      solar_time_t solar = new_solar_time(date, &locations[location]);
+      const prayer_day_t prayer_day = new_prayer_day(date);
+      extended_timetable[day] = extended_times_from_solar_time(
+          &solar, &prayer_day, &params, &timetable[day], &extended);
+    }
+    bench_consume((unsigned long)extended_timetable[location % DAYS].duha);
+  }
+  double separate = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  printf("%d locations x %d days\n", LOCATIONS, DAYS);
+  printf("new_prayer_times_range         %8.1f ns/day\n", range);
+  printf("new_extended_times_range       %8.1f ns/day (+%.1f)\n",
+         extended_range, extended_range - range);
+  printf("range + separate solar times   %8.1f ns/day (+%.1f)\n", separate,
+         separate - range);
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/time_format.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 365
+#define ROUNDS 200
+
+static char buffer[DAYS * TIME_FORMAT_FIELDS_PER_DAY][TIME_FORMAT_MAX_LENGTH];
+
+static void bench_strftime(const prayer_times_t *timetable) {
+  double start = bench_now_ns();
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int day = 0; day < DAYS; day++) {
+      const time_t *fields = &timetable[day].fajr;
+      for (int i = 0; i < TIME_FORMAT_FIELDS_PER_DAY; i++) {
+        strftime(buffer[day * TIME_FORMAT_FIELDS_PER_DAY + i],
+                 TIME_FORMAT_MAX_LENGTH, "%I:%M %p", localtime(&fields[i]));
+      }
+    }
+    bench_consume((unsigned long)buffer[round % DAYS][0]);
+  }
+  double elapsed = (bench_now_ns() - start) / ROUNDS;
+  printf("localtime+strftime  %10.1f us/year  %6.1f ns/field\n",
+         elapsed / 1e3, elapsed / (DAYS * TIME_FORMAT_FIELDS_PER_DAY));
+}
+
+static void bench_format(const prayer_times_t *timetable,
+                         const utc_offset_table_t *offsets,
+                         time_format_t format, const char *name) {
+  double start = bench_now_ns();
+  for (int round = 0; round < ROUNDS; round++) {
+    format_timetable(timetable, DAYS, offsets, format, &buffer[0][0],
+                     TIME_FORMAT_MAX_LENGTH);
+    bench_consume((unsigned long)buffer[round % DAYS][0]);
+  }
+  double elapsed = (bench_now_ns() - start) / ROUNDS;
+  printf("format_timetable %-6s %7.1f us/year  %6.1f ns/field\n", name,
+         elapsed / 1e3, elapsed / (DAYS * TIME_FORMAT_FIELDS_PER_DAY));
+}
+
+int main(void) {
+  static prayer_times_t timetable[DAYS];
+  coordinates_t coordinates = {48.866667, 2.333333};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+
+  struct tm start_tm = {0};
+  start_tm.tm_year = 2024 - 1900;
+  start_tm.tm_mday = 1;
+  start_tm.tm_isdst = -1;
+  time_t start = mktime(&start_tm);
+
+  for (int day = 0; day < DAYS; day++) {
+    timetable[day] = new_prayer_times(&coordinates, add_days(start, day),
+                                      &params);
+  }
+
+  /* Paris in 2024: CET, CEST from 31 March 01:00 UTC to 27 October */
+  const utc_offset_entry_t entries[] = {
+      {0, 3600}, {1711846800, 7200}, {1729990800, 3600}};
+  const utc_offset_table_t offsets = {entries, 3};
+
+  printf("Formatting %d days x %d fields, %d rounds\n", DAYS,
+         TIME_FORMAT_FIELDS_PER_DAY, ROUNDS);
+  bench_strftime(timetable);
+  bench_format(timetable, &offsets, TIME_FORMAT_12H, "12h");
+  bench_format(timetable, &offsets, TIME_FORMAT_24H, "24h");
+  bench_format(timetable, &offsets, TIME_FORMAT_ISO8601, "iso");
+  bench_format(timetable, &offsets, TIME_FORMAT_MINUTES, "min");
+  return 0;
+}
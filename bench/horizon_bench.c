@@ -0,0 +1,90 @@
+#include "../src/calendrical_helper.h"
+#include "../src/horizon.h"
+#include "../src/solar_time.h"
+#include "bench_utils.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DAYS 365
+#define LOCATIONS 20
+
+/* 1 arcsecond cells of a 0.4 degree square */
+static const horizon_grid_t GRID = {21.2, 39.6, 1.0 / 3600, 1441, 1441};
+
+/* Hills up to about 1500 m a few kilometers across */
+static int16_t terrain(double latitude, double longitude) {
+  return (int16_t)lround(
+      700 + 500 * sin(latitude * 157) * cos(longitude * 131) +
+      250 * sin(latitude * 613 + 1) * sin(longitude * 587) +
+      40 * cos(latitude * 2903) * sin(longitude * 3119));
+}
+
+/* Solar times of each location and day, corrected with `horizon` when it is
+ * not NULL, in ns per day */
+static double run(solar_time_t solar_times[LOCATIONS][DAYS],
+                  const horizon_t *horizon) {
+  const double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int day = 0; day < DAYS; day++) {
+      solar_time_t solar_time = solar_times[location][day];
+      if (horizon) {
+        horizon_solar_time(&solar_time, horizon);
+      }
+      bench_consume((unsigned long)(solar_time.sunrise * 3600));
+    }
+  }
+  return (bench_now_ns() - begin) / ((double)LOCATIONS * DAYS);
+}
+
+int main(void) {
+  const char *path = "horizon_bench.dem";
+  int16_t *elevations = malloc((size_t)GRID.rows * GRID.columns * 2);
+  if (!elevations) {
+    return 1;
+  }
+  for (uint32_t row = 0; row < GRID.rows; row++) {
+    for (uint32_t column = 0; column < GRID.columns; column++) {
+      elevations[(size_t)row * GRID.columns + column] =
+          terrain(GRID.south + row * GRID.spacing,
+                  GRID.west + column * GRID.spacing);
+    }
+  }
+  horizon_tile_t tile;
+  if (!horizon_tile_write(path, &GRID, elevations) ||
+      !horizon_tile_open(path, 0, &tile)) {
+    return 1;
+  }
+  free(elevations);
+  printf("Tile of %u x %u cells: %.2f bytes a cell\n", GRID.rows,
+         GRID.columns, (double)tile.file.size / GRID.rows / GRID.columns);
+
+  static coordinates_t locations[LOCATIONS];
+  static solar_time_t solar_times[LOCATIONS][DAYS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+  for (int location = 0; location < LOCATIONS; location++) {
+    locations[location] =
+        (coordinates_t){21.35 + 0.005 * location, 39.75 + 0.0052 * location};
+    for (int day = 0; day < DAYS; day++) {
+      solar_times[location][day] =
+          new_solar_time(add_days(start, day), &locations[location]);
+    }
+  }
+
+  const horizon_t height = {50, NULL, 0};
+  const horizon_t terrain_horizon = {2, &tile, 0};
+  printf("%d locations x %d days, ns/day\n", LOCATIONS, DAYS);
+  printf("%-24s %10.0f\n", "flat horizon", run(solar_times, NULL));
+  printf("%-24s %10.0f\n", "observer height", run(solar_times, &height));
+  const double cold = run(solar_times, &terrain_horizon);
+  const size_t misses = tile.misses;
+  printf("%-24s %10.0f  (%zu blocks decoded)\n", "terrain, first pass", cold,
+         misses);
+  const double warm = run(solar_times, &terrain_horizon);
+  printf("%-24s %10.0f  (%zu blocks decoded, %.1f%% hits)\n",
+         "terrain, second pass", warm, tile.misses - misses,
+         100.0 * tile.hits / (tile.hits + tile.misses));
+  horizon_tile_close(&tile);
+  remove(path);
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/method_comparison.h"
+#include "../src/prayer_times.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 365
+#define LOCATIONS 20
+
+static method_comparison_t results[DAYS * COMPARISON_METHODS];
+
+int main(void) {
+  calculation_parameters_t methods[COMPARISON_METHODS][2];
+  coordinates_t locations[LOCATIONS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  for (size_t m = 0; m < COMPARISON_METHODS; m++) {
+    methods[m][SHAFI] = getParameters((calculation_method)m);
+    methods[m][HANAFI] = methods[m][SHAFI];
+    methods[m][HANAFI].madhab = HANAFI;
+  }
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (coordinates_t){-40.0 + 4.0 * i, -170.0 + 17.0 * i};
+  }
+
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int day = 0; day < DAYS; day++) {
+      for (size_t m = 0; m < COMPARISON_METHODS; m++) {
+        for (int madhab = 0; madhab < 2; madhab++) {
+          prayer_times_t times = new_prayer_times(
+              &locations[location], add_days(start, day), &methods[m][madhab]);
+          bench_consume((unsigned long)times.isha);
+        }
+      }
+    }
+  }
+  double single = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    compare_methods_range(&locations[location], start, DAYS, NULL,
+                          COMPARISON_METHODS, results);
+    bench_consume((unsigned long)results[location % DAYS].hanafi.isha);
+  }
+  double comparison = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  printf("%d locations x %d days x %zu methods x 2 madhabs\n", LOCATIONS,
+         DAYS, COMPARISON_METHODS);
+  printf("new_prayer_times loop  %8.0f ns/day\n", single);
+  printf("compare_methods_range  %8.0f ns/day (%.1fx)\n", comparison,
+         single / comparison);
+  return 0;
+}
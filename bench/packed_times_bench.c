@@ -0,0 +1,87 @@
+#include "../src/calculation_parameters.h"
+#include "../src/packed_times.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DAYS 366
+/* Caches of LOCATIONS, computed for COMPUTED locations and repeated */
+#define LOCATIONS 1000
+#define COMPUTED 100
+#define LOOKUPS 10000000
+#define MONTH 30
+
+int main(void) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+  const size_t entries = (size_t)LOCATIONS * DAYS;
+  prayer_times_t *cache = malloc(entries * sizeof(*cache));
+  packed_prayer_times_t *packed = malloc(entries * sizeof(*packed));
+  prayer_times_t month[MONTH];
+
+  if (!cache || !packed) {
+    return 1;
+  }
+  for (int location = 0; location < COMPUTED; location++) {
+    coordinates_t coordinates = {-50.0 + 1.0 * location,
+                                 -179.0 + 3.58 * location};
+    new_prayer_times_range(&coordinates, start, DAYS, &params, NULL,
+                           &cache[(size_t)location * DAYS]);
+  }
+  for (size_t i = (size_t)COMPUTED * DAYS; i < entries; i++) {
+    cache[i] = cache[i % ((size_t)COMPUTED * DAYS)];
+  }
+
+  double begin = bench_now_ns();
+  size_t valid = pack_prayer_times_batch(cache, entries, packed);
+  double pack = (bench_now_ns() - begin) / entries;
+
+  begin = bench_now_ns();
+  for (size_t i = 0; i + MONTH <= entries; i += MONTH) {
+    unpack_prayer_times_batch(&packed[i], MONTH, month);
+    bench_consume((unsigned long)month[i % MONTH].isha);
+  }
+  double unpack = (bench_now_ns() - begin) / entries;
+
+  /* Random location-day lookups, as a server answering many clients */
+  unsigned long state = 12345;
+  unsigned long prayers = 0;
+  begin = bench_now_ns();
+  for (long i = 0; i < LOOKUPS; i++) {
+    state = state * 6364136223846793005UL + 1442695040888963407UL;
+    const size_t entry = (state >> 17) % entries;
+    const time_t when = start + (time_t)(entry % DAYS) * 86400 +
+                        (time_t)(state % 86400);
+    prayers += currentPrayer(&cache[entry], when);
+  }
+  double unpacked_lookup = (bench_now_ns() - begin) / LOOKUPS;
+  bench_consume(prayers);
+
+  state = 12345;
+  prayers = 0;
+  begin = bench_now_ns();
+  for (long i = 0; i < LOOKUPS; i++) {
+    state = state * 6364136223846793005UL + 1442695040888963407UL;
+    const size_t entry = (state >> 17) % entries;
+    const time_t when = start + (time_t)(entry % DAYS) * 86400 +
+                        (time_t)(state % 86400);
+    prayers += packed_current_prayer(&packed[entry], when);
+  }
+  double packed_lookup = (bench_now_ns() - begin) / LOOKUPS;
+  bench_consume(prayers);
+
+  printf("%d locations x %d days, %zu valid\n", LOCATIONS, DAYS, valid);
+  printf("prayer_times_t cache        %8.1f MB\n",
+         entries * sizeof(*cache) / 1e6);
+  printf("packed_prayer_times_t cache %8.1f MB\n",
+         entries * sizeof(*packed) / 1e6);
+  printf("pack_prayer_times_batch     %8.2f ns/day\n", pack);
+  printf("unpack_prayer_times_batch   %8.2f ns/day, by months\n", unpack);
+  printf("currentPrayer lookup        %8.2f ns\n", unpacked_lookup);
+  printf("packed_current_prayer       %8.2f ns\n", packed_lookup);
+  free(cache);
+  free(packed);
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include "../src/calculation_parameters.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 366
+#define LOCATIONS 50
+#define SETTINGS 8
+
+static prayer_base_t bases[LOCATIONS][DAYS];
+static prayer_times_t timetable[DAYS];
+
+/* Settings changes an administrator could make to a mosque's timetable */
+static calculation_parameters_t settings(int i) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  params.madhab = (i & 1) ? HANAFI : SHAFI;
+  params.ishaInterval = (i & 2) ? 90 : 0;
+  params.highLatitudeRule = (i & 4) ? MIDDLE_OF_THE_NIGHT : TWILIGHT_ANGLE;
+  params.adjustments.fajr = i;
+  params.adjustments.isha = -i;
+  return params;
+}
+
+int main(void) {
+  calculation_parameters_t base_params = getParameters(MUSLIM_WORLD_LEAGUE);
+  coordinates_t locations[LOCATIONS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (coordinates_t){-40.0 + 1.6 * i, -170.0 + 6.8 * i};
+  }
+
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int i = 0; i < SETTINGS; i++) {
+      calculation_parameters_t params = settings(i);
+      new_prayer_times_range(&locations[location], start, DAYS, &params, NULL,
+                             timetable);
+      bench_consume((unsigned long)timetable[i].isha);
+    }
+  }
+  double full = (bench_now_ns() - begin) / (LOCATIONS * SETTINGS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_base_range(&locations[location], start, DAYS, &base_params,
+                          bases[location]);
+  }
+  double base = (bench_now_ns() - begin) / LOCATIONS;
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int i = 0; i < SETTINGS; i++) {
+      calculation_parameters_t params = settings(i);
+      prayer_times_from_base_range(bases[location], DAYS, &params, NULL,
+                                   timetable);
+      bench_consume((unsigned long)timetable[i].isha);
+    }
+  }
+  double policy = (bench_now_ns() - begin) / (LOCATIONS * SETTINGS);
+
+  printf("%d locations x %d settings x %d days\n", LOCATIONS, SETTINGS, DAYS);
+  printf("new_prayer_times_range       %8.1f us/year\n", full / 1e3);
+  printf("new_prayer_base_range        %8.1f us/year, once per location\n",
+         base / 1e3);
+  printf("prayer_times_from_base_range %8.1f us/year (%.0fx)\n",
+         policy / 1e3, full / policy);
+  return 0;
+}
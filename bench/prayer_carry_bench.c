@@ -0,0 +1,88 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_time.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 366
+#define LOCATIONS 20
+#define REPEATS 5
+
+/* Solar times and dates of each day and of the day after the last */
+static solar_time_t solar_times[LOCATIONS][DAYS + 1];
+static prayer_day_t dates[DAYS + 1];
+static coordinates_t locations[LOCATIONS];
+
+typedef enum { PER_DAY, CARRY } path_t;
+
+/* Best ns per day of the batches of a path, the solar times being shared */
+static double run(path_t path, calculation_parameters_t *params) {
+  double best = 0;
+  for (int repeat = 0; repeat < REPEATS; repeat++) {
+    const double begin = bench_now_ns();
+    for (int location = 0; location < LOCATIONS; location++) {
+      coordinates_t *coordinates = &locations[location];
+      solar_time_t *solar = solar_times[location];
+      prayer_carry_t carry = {false, 0, {0, 0, 0, 0, {0, 0}}};
+      for (int day = 0; day < DAYS; day++) {
+        const prayer_times_t times =
+            path == PER_DAY
+                ? prayer_times_from_prayer_day(coordinates, &dates[day],
+                                               params, &solar[day],
+                                               &dates[day + 1],
+                                               &solar[day + 1])
+                : prayer_times_with_carry(coordinates, &dates[day], params,
+                                          &solar[day], &dates[day + 1],
+                                          &solar[day + 1], &carry);
+        bench_consume((unsigned long)times.isha);
+      }
+    }
+    const double elapsed =
+        (bench_now_ns() - begin) / ((double)LOCATIONS * DAYS);
+    if (repeat == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+int main(void) {
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+  for (int day = 0; day <= DAYS; day++) {
+    dates[day] = new_prayer_day(add_days(start, day));
+  }
+
+  const struct {
+    const char *name;
+    calculation_method method;
+    high_latitude_rule_t rule;
+    double latitude;
+  } batches[] = {
+      {"Muslim World League", MUSLIM_WORLD_LEAGUE, TWILIGHT_ANGLE, -40},
+      {"Umm al-Qura, Isha interval", UMM_AL_QURA, TWILIGHT_ANGLE, -40},
+      {"Moonsighting above 55N", MOON_SIGHTING_COMMITTEE, TWILIGHT_ANGLE, 55},
+      {"Nearest latitude above 60N", MUSLIM_WORLD_LEAGUE, NEAREST_LATITUDE,
+       60},
+  };
+
+  printf("%d locations x %d days, ns/day without the solar times\n",
+         LOCATIONS, DAYS);
+  printf("%-28s %8s %8s\n", "", "per day", "carry");
+  for (size_t b = 0; b < sizeof(batches) / sizeof(batches[0]); b++) {
+    calculation_parameters_t params = getParameters(batches[b].method);
+    params.highLatitudeRule = batches[b].rule;
+    for (int i = 0; i < LOCATIONS; i++) {
+      locations[i] = (coordinates_t){batches[b].latitude + 0.5 * i,
+                                     -170.0 + 17 * i};
+      for (int day = 0; day <= DAYS; day++) {
+        solar_times[i][day] =
+            new_solar_time(add_days(start, day), &locations[i]);
+      }
+    }
+    const double per_day = run(PER_DAY, &params);
+    const double carry = run(CARRY, &params);
+    printf("%-28s %8.0f %8.0f\n", batches[b].name, per_day, carry);
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+#include "../src/calculation_parameters.h"
+#include "../src/prayer_classifier.h"
+#include "../src/timetable.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DAYS 366
+#define COUNT 10000000
+
+/* Baseline: the day by linear scan, then currentPrayer() */
+static prayer_t scan(prayer_times_t *timetable, time_t when) {
+  size_t day = 0;
+  while (day + 1 < DAYS && timetable[day + 1].fajr <= when) {
+    day++;
+  }
+  return currentPrayer(&timetable[day], when);
+}
+
+int main(void) {
+  coordinates_t coordinates = {51.5074, -0.1278};
+  calculation_parameters_t params = getParameters(MOON_SIGHTING_COMMITTEE);
+  prayer_times_t *timetable = malloc(DAYS * sizeof(*timetable));
+  time_t *timestamps = malloc(COUNT * sizeof(*timestamps));
+  uint8_t *labels = malloc(COUNT);
+  int32_t *seconds = malloc(COUNT * sizeof(*seconds));
+  prayer_classifier_t classifier;
+
+  if (!timetable || !timestamps || !labels || !seconds ||
+      new_prayer_times_range(&coordinates, 1704067200, DAYS, &params, NULL,
+                             timetable) != DAYS ||
+      !prayer_classifier_init(&classifier, timetable, DAYS)) {
+    return 1;
+  }
+
+  /* Random instants over the year, then the same in increasing order */
+  const time_t first = timetable[0].fajr;
+  const time_t span = timetable[DAYS - 1].midnight - first;
+  srand(1);
+  for (size_t i = 0; i < COUNT; i++) {
+    const long long r = ((long long)rand() << 16) ^ rand();
+    timestamps[i] = first + (time_t)(r % span);
+  }
+
+  double begin = bench_now_ns();
+  unsigned long sum = 0;
+  for (size_t i = 0; i < COUNT / 100; i++) {
+    sum += scan(timetable, timestamps[i]);
+  }
+  const double baseline = (bench_now_ns() - begin) / (COUNT / 100);
+  bench_consume(sum);
+
+  begin = bench_now_ns();
+  prayer_classifier_classify(&classifier, timestamps, COUNT, false, labels,
+                             seconds);
+  const double unsorted = (bench_now_ns() - begin) / COUNT;
+  bench_consume(labels[COUNT / 2] + (unsigned long)seconds[COUNT / 3]);
+
+  /* Spread evenly over the year, in increasing order */
+  for (size_t i = 0; i < COUNT; i++) {
+    timestamps[i] = first + (time_t)((double)span * i / COUNT);
+  }
+  begin = bench_now_ns();
+  prayer_classifier_classify(&classifier, timestamps, COUNT, true, labels,
+                             seconds);
+  const double sorted = (bench_now_ns() - begin) / COUNT;
+  bench_consume(labels[COUNT / 2] + (unsigned long)seconds[COUNT / 3]);
+
+  printf("%d timestamps over %d days\n", COUNT, DAYS);
+  printf("scan + currentPrayer %8.1f ns/timestamp %8.1f M/s\n", baseline,
+         1e3 / baseline);
+  printf("classify unsorted    %8.1f ns/timestamp %8.1f M/s\n", unsorted,
+         1e3 / unsorted);
+  printf("classify sorted      %8.1f ns/timestamp %8.1f M/s\n", sorted,
+         1e3 / sorted);
+
+  prayer_classifier_free(&classifier);
+  free(seconds);
+  free(labels);
+  free(timestamps);
+  free(timetable);
+  return 0;
+}
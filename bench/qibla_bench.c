@@ -0,0 +1,51 @@
+#include "../src/qibla.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Quarter degree world grid */
+#define ROWS 721
+#define COLUMNS 1440
+#define COUNT (ROWS * COLUMNS)
+
+int main(void) {
+  double *latitudes = malloc(COUNT * sizeof(double));
+  double *longitudes = malloc(COUNT * sizeof(double));
+  double *bearings = malloc(COUNT * sizeof(double));
+  double *distances = malloc(COUNT * sizeof(double));
+
+  if (!latitudes || !longitudes || !bearings || !distances) {
+    return 1;
+  }
+
+  for (int row = 0; row < ROWS; row++) {
+    for (int column = 0; column < COLUMNS; column++) {
+      latitudes[row * COLUMNS + column] = -90.0 + 0.25 * row;
+      longitudes[row * COLUMNS + column] = -180.0 + 0.25 * column;
+    }
+  }
+
+  double start = bench_now_ns();
+  for (int i = 0; i < COUNT; i++) {
+    coordinates_t coordinates = {latitudes[i], longitudes[i]};
+    bearings[i] = qibla(&coordinates);
+    distances[i] = qibla_distance(&coordinates);
+  }
+  double scalar = (bench_now_ns() - start) / COUNT;
+  bench_consume((unsigned long)bearings[COUNT / 3]);
+
+  start = bench_now_ns();
+  qibla_batch(latitudes, longitudes, COUNT, bearings, distances);
+  double batch = (bench_now_ns() - start) / COUNT;
+  bench_consume((unsigned long)bearings[COUNT / 3]);
+
+  printf("%d grid cells\n", COUNT);
+  printf("qibla + qibla_distance %6.1f ns/cell\n", scalar);
+  printf("qibla_batch            %6.1f ns/cell\n", batch);
+
+  free(latitudes);
+  free(longitudes);
+  free(bearings);
+  free(distances);
+  return 0;
+}
@@ -0,0 +1,309 @@
+#include "reference_engine.h"
+#include <math.h>
+
+#define DAY_SECONDS 86400.0L
+#define SIDEREAL_RATE 360.985647L /* Degrees per day */
+#define MAX_ITERATIONS 50
+#define TOLERANCE 1e-3L /* Seconds */
+
+static const long double PI = 3.141592653589793238462643383279502884L;
+
+typedef struct {
+  long double declination;
+  long double rightAscension;
+  long double siderealTime;
+} reference_sun_t;
+
+static long double radians(long double degrees) { return degrees * PI / 180; }
+
+static long double degrees(long double radians) { return radians * 180 / PI; }
+
+static long double unwind(long double angle) {
+  angle = fmodl(angle, 360);
+  return angle < 0 ? angle + 360 : angle;
+}
+
+/* Angle in (-180, 180] */
+static long double closest(long double angle) {
+  angle = unwind(angle);
+  return angle > 180 ? angle - 360 : angle;
+}
+
+/* Apparent solar coordinates at an instant, Astronomical Algorithms
+ * chapters 12, 22 and 25 */
+static reference_sun_t sun_at(long double when) {
+  const long double JD = 2440587.5L + when / DAY_SECONDS;
+  const long double T = (JD - 2451545) / 36525;
+  const long double T2 = T * T;
+  const long double T3 = T2 * T;
+
+  const long double L0 = unwind(280.4664567L + 36000.76983L * T +
+                                0.0003032L * T2);
+  const long double Lp = unwind(218.3165L + 481267.8813L * T);
+  const long double omega =
+      unwind(125.04452L - 1934.136261L * T + 0.0020708L * T2 + T3 / 450000);
+  const long double M =
+      radians(unwind(357.52911L + 35999.05029L * T - 0.0001537L * T2));
+  const long double C =
+      (1.914602L - 0.004817L * T - 0.000014L * T2) * sinl(M) +
+      (0.019993L - 0.000101L * T) * sinl(2 * M) + 0.000289L * sinl(3 * M);
+  const long double O = radians(125.04L - 1934.136L * T);
+  const long double lambda = radians(L0 + C - 0.00569L - 0.00478L * sinl(O));
+
+  const long double deltaPsi =
+      (-17.2L * sinl(radians(omega)) - 1.32L * sinl(2 * radians(L0)) -
+       0.23L * sinl(2 * radians(Lp)) + 0.21L * sinl(2 * radians(omega))) /
+      3600;
+  const long double deltaEpsilon =
+      (9.2L * cosl(radians(omega)) + 0.57L * cosl(2 * radians(L0)) +
+       0.10L * cosl(2 * radians(Lp)) - 0.09L * cosl(2 * radians(omega))) /
+      3600;
+  const long double epsilon0 =
+      23.439291L - 0.013004167L * T - 0.0000001639L * T2 +
+      0.0000005036L * T3;
+  const long double epsilon = radians(epsilon0 + 0.00256L * cosl(O));
+  const long double theta0 = unwind(280.46061837L +
+                                    360.98564736629L * (JD - 2451545) +
+                                    0.000387933L * T2 - T3 / 38710000);
+
+  reference_sun_t sun;
+  sun.declination = degrees(asinl(sinl(epsilon) * sinl(lambda)));
+  sun.rightAscension =
+      unwind(degrees(atan2l(cosl(epsilon) * sinl(lambda), cosl(lambda))));
+  sun.siderealTime =
+      theta0 + deltaPsi * cosl(radians(epsilon0 + deltaEpsilon));
+  return sun;
+}
+
+static long double hour_angle_at(const coordinates_t *coordinates,
+                                 const reference_sun_t *sun) {
+  return closest(sun->siderealTime + coordinates->longitude -
+                 sun->rightAscension);
+}
+
+/* Transit of the UTC day starting at `day`, iterated from the approximate
+ * transit of Astronomical Algorithms page 102 */
+static bool transit_of(const coordinates_t *coordinates, long double day,
+                       long double *transit) {
+  reference_sun_t sun = sun_at(day);
+  long double m = (sun.rightAscension - coordinates->longitude -
+                   sun.siderealTime) /
+                  360;
+  m -= floorl(m);
+  long double when = day + m * DAY_SECONDS;
+
+  for (int i = 0; i < MAX_ITERATIONS; i++) {
+    sun = sun_at(when);
+    const long double step =
+        -hour_angle_at(coordinates, &sun) / SIDEREAL_RATE * DAY_SECONDS;
+    when += step;
+    if (fabsl(step) < TOLERANCE) {
+      *transit = when;
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Crossing of `altitude` on one side of a transit, by Newton iteration on
+ * the altitude at the instant */
+static bool crossing_of(const coordinates_t *coordinates,
+                        long double transit, long double altitude,
+                        bool after_transit, long double *crossing) {
+  const long double phi = radians(coordinates->latitude);
+  reference_sun_t sun = sun_at(transit);
+  long double delta = radians(sun.declination);
+  const long double cosH0 =
+      (sinl(radians(altitude)) - sinl(phi) * sinl(delta)) /
+      (cosl(phi) * cosl(delta));
+  if (fabsl(cosH0) > 1) {
+    return false;
+  }
+
+  const long double H0 = degrees(acosl(cosH0));
+  long double when = transit + (after_transit ? H0 : -H0) / SIDEREAL_RATE *
+                                   DAY_SECONDS;
+
+  for (int i = 0; i < MAX_ITERATIONS; i++) {
+    sun = sun_at(when);
+    delta = radians(sun.declination);
+    const long double H = hour_angle_at(coordinates, &sun);
+    const long double sinh =
+        sinl(phi) * sinl(delta) + cosl(phi) * cosl(delta) * cosl(radians(H));
+    const long double h = degrees(asinl(sinh));
+    /* dh/dt in degrees per second, ignoring the motion of the sun */
+    const long double slope = -cosl(phi) * cosl(delta) * sinl(radians(H)) /
+                              cosl(radians(h)) * SIDEREAL_RATE /
+                              DAY_SECONDS;
+    if (fabsl(slope) < 1e-12L) {
+      return false;
+    }
+    const long double step = -(h - altitude) / slope;
+    when += step;
+    if (fabsl(step) < TOLERANCE) {
+      if ((H > 0) != after_transit) {
+        return false;
+      }
+      *crossing = when;
+      return true;
+    }
+  }
+  return false;
+}
+
+typedef struct {
+  long double transit;
+  long double sunrise;
+  long double sunset;
+  int year;
+  int dayOfYear;
+} reference_day_t;
+
+static bool day_of(const coordinates_t *coordinates, long double day,
+                   reference_day_t *result) {
+  const long double horizon = -50.0L / 60.0L;
+  const time_t when = (time_t)day;
+  const struct tm *tm_date = gmtime(&when);
+
+  result->year = tm_date->tm_year + 1900;
+  result->dayOfYear = tm_date->tm_yday + 1;
+  return transit_of(coordinates, day, &result->transit) &&
+         crossing_of(coordinates, result->transit, horizon, false,
+                     &result->sunrise) &&
+         crossing_of(coordinates, result->transit, horizon, true,
+                     &result->sunset);
+}
+
+/* Fajr of a day with the safe value rules of fajr_from_solar_time() */
+static bool fajr_of(const coordinates_t *coordinates,
+                    const calculation_parameters_t *parameters,
+                    const reference_day_t *day, long double *fajr) {
+  calculation_parameters_t copy = *parameters;
+  const night_portions_t portions = get_night_portions(&copy);
+  const long double night = day->sunrise + DAY_SECONDS - day->sunset;
+  bool found = crossing_of(coordinates, day->transit, -parameters->fajrAngle,
+                           false, fajr);
+
+  if (parameters->method == MOON_SIGHTING_COMMITTEE &&
+      coordinates->latitude >= 55) {
+    *fajr = day->sunrise - 90 * 60;
+    found = true;
+  }
+
+  long double safe;
+  if (parameters->method == MOON_SIGHTING_COMMITTEE) {
+    safe = (long double)seasonAdjustedMorningTwilight(
+               coordinates->latitude, day->dayOfYear, day->year, 0) +
+           day->sunrise;
+  } else {
+    safe = day->sunrise - portions.fajr * night;
+  }
+  if (!found || *fajr > day->sunrise) {
+    *fajr = safe;
+  }
+  return true;
+}
+
+/* Asr of a day, with the declination at transit for the shadow */
+static bool asr_of(const coordinates_t *coordinates, const reference_day_t *day,
+                   shadow_length shadow, long double *asr) {
+  const reference_sun_t noon = sun_at(day->transit);
+  const long double altitude = degrees(atanl(
+      1 / (shadow +
+           tanl(radians(fabsl(coordinates->latitude - noon.declination))))));
+  return crossing_of(coordinates, day->transit, altitude, true, asr);
+}
+
+static time_t rounded(long double when, int adjustment) {
+  return (time_t)llroundl(when) + adjustment * 60;
+}
+
+bool reference_prayer_times(const coordinates_t *coordinates, time_t date,
+                            const calculation_parameters_t *parameters,
+                            prayer_times_t *prayer_times) {
+  const long double start = floorl((long double)date / DAY_SECONDS) *
+                            DAY_SECONDS;
+  reference_day_t today, tomorrow;
+  long double asr, fajr, tomorrowFajr, isha;
+
+  if (!day_of(coordinates, start, &today) ||
+      !day_of(coordinates, start + DAY_SECONDS, &tomorrow)) {
+    return false;
+  }
+
+  if (!asr_of(coordinates, &today, getShadowLength(parameters->madhab),
+              &asr)) {
+    return false;
+  }
+
+  fajr_of(coordinates, parameters, &today, &fajr);
+  fajr_of(coordinates, parameters, &tomorrow, &tomorrowFajr);
+
+  if (parameters->ishaInterval > 0) {
+    isha = today.sunset + parameters->ishaInterval * 60;
+  } else {
+    calculation_parameters_t copy = *parameters;
+    const night_portions_t portions = get_night_portions(&copy);
+    const long double night = today.sunrise + DAY_SECONDS - today.sunset;
+    bool found = crossing_of(coordinates, today.transit,
+                             -parameters->ishaAngle, true, &isha);
+    long double safe;
+
+    if (parameters->method == MOON_SIGHTING_COMMITTEE &&
+        coordinates->latitude >= 55) {
+      isha = today.sunset + night * 0.4L;
+      found = true;
+    }
+    if (parameters->method == MOON_SIGHTING_COMMITTEE) {
+      safe = (long double)seasonAdjustedEveningTwilight(
+                 coordinates->latitude, today.dayOfYear, today.year, 0) +
+             today.sunset;
+    } else {
+      safe = today.sunset + portions.isha * night;
+    }
+    if (!found || isha > safe) {
+      isha = safe;
+    }
+  }
+
+  const prayer_adjustments_t *adjustments = &parameters->adjustments;
+  const long double midnight =
+      (today.sunset + adjustments->maghrib * 60 + tomorrowFajr) / 2;
+  *prayer_times = (prayer_times_t){rounded(fajr, adjustments->fajr),
+                                   rounded(today.sunrise, adjustments->sunrise),
+                                   rounded(today.transit, adjustments->dhuhr),
+                                   rounded(asr, adjustments->asr),
+                                   rounded(today.sunset, adjustments->maghrib),
+                                   rounded(isha, adjustments->isha),
+                                   rounded(midnight, adjustments->midnight)};
+  return true;
+}
+
+bool reference_solar_events(const coordinates_t *coordinates, time_t date,
+                            double fajr_angle, double isha_angle,
+                            shadow_length shadow,
+                            long double events[REFERENCE_EVENTS]) {
+  const long double start = floorl((long double)date / DAY_SECONDS) *
+                            DAY_SECONDS;
+  reference_day_t today;
+
+  if (!day_of(coordinates, start, &today)) {
+    return false;
+  }
+  events[REFERENCE_SUNRISE] = today.sunrise;
+  events[REFERENCE_TRANSIT] = today.transit;
+  events[REFERENCE_SUNSET] = today.sunset;
+  if (!asr_of(coordinates, &today, shadow, &events[REFERENCE_ASR])) {
+    events[REFERENCE_ASR] = NAN;
+  }
+  if (!crossing_of(coordinates, today.transit, -fajr_angle, false,
+                   &events[REFERENCE_FAJR])) {
+    events[REFERENCE_FAJR] = NAN;
+  }
+  if (isha_angle <= 0 ||
+      !crossing_of(coordinates, today.transit, -isha_angle, true,
+                   &events[REFERENCE_ISHA])) {
+    events[REFERENCE_ISHA] = NAN;
+  }
+  return true;
+}
@@ -0,0 +1,59 @@
+#ifndef ADHAN_REFERENCE_ENGINE_H
+#define ADHAN_REFERENCE_ENGINE_H
+
+#include "../src/calculation_parameters.h"
+#include "../src/coordinates.h"
+#include "../src/prayer_times.h"
+#include <stdbool.h>
+#include <time.h>
+
+/**
+ * @brief Prayer times from the high precision reference engine
+ *
+ * Evaluates the same Meeus chain as the library in long double, with the
+ * solar coordinates computed at each event instead of interpolated from 0h
+ * UT, and every event iterated until it moves by less than a millisecond.
+ * The night portion, Moonsighting Committee and adjustment rules are those
+ * of new_prayer_times(), applied to unrounded times; the result is rounded
+ * to the second.
+ *
+ * @return false when an event the parameters need does not occur on that
+ * day, e.g. a twilight angle the sun never reaches
+ */
+bool reference_prayer_times(const coordinates_t *coordinates, time_t date,
+                            const calculation_parameters_t *parameters,
+                            prayer_times_t *prayer_times);
+
+/**
+ * @brief Events of reference_solar_events(), in day order
+ */
+typedef enum {
+  REFERENCE_FAJR,
+  REFERENCE_SUNRISE,
+  REFERENCE_TRANSIT,
+  REFERENCE_ASR,
+  REFERENCE_SUNSET,
+  REFERENCE_ISHA,
+  REFERENCE_EVENTS
+} reference_event_t;
+
+/**
+ * @brief Unrounded solar events of a UTC day from the reference engine
+ *
+ * The events new_prayer_times() starts from, before any night portion,
+ * Moonsighting Committee or adjustment rule: the sun at `fajr_angle` and
+ * `isha_angle` below the horizon, sunrise and sunset at -50 arcminutes, the
+ * transit and the Asr of `shadow`. Accurate to a millisecond, so the error
+ * of an engine is measured below the minute its times are rounded to.
+ *
+ * @param isha_angle 0 when only the other events are needed
+ * @param[out] events Seconds since the epoch, NAN when the sun does not
+ * reach the altitude of the event
+ * @return false when the day has no transit, sunrise or sunset
+ */
+bool reference_solar_events(const coordinates_t *coordinates, time_t date,
+                            double fajr_angle, double isha_angle,
+                            shadow_length shadow,
+                            long double events[REFERENCE_EVENTS]);
+
+#endif /* ADHAN_REFERENCE_ENGINE_H */
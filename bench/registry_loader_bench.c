@@ -0,0 +1,64 @@
+#include "../src/registry_loader.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ROWS 1000000
+#define ROUNDS 3
+
+int main(void) {
+  /* Mosques with 7 decimal coordinates and a few adjustments */
+  char *csv = malloc((size_t)ROWS * 64);
+  coordinates_t *coordinates = malloc(ROWS * sizeof(*coordinates));
+  calculation_parameters_t *parameters = malloc(ROWS * sizeof(*parameters));
+  if (!csv || !coordinates || !parameters) {
+    return 1;
+  }
+  size_t size = 0;
+  srand(1);
+  for (int i = 0; i < ROWS; i++) {
+    size += (size_t)sprintf(csv + size,
+                            "%.7f,%.7f,%d,%d,%d,%d,0,%d,0,%d,%d,0\n",
+                            (rand() % 1800000000) / 1e7 - 90,
+                            (rand() % 2000000000) / 1e7 * 1.8 - 180, i % 9,
+                            i % 2, i % 5, i % 3 - 1, i % 4, i % 3, i % 7 * 5);
+  }
+
+  double begin = bench_now_ns();
+  size_t rows = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    rows = registry_parse(csv, size, coordinates, parameters, ROWS, NULL, 0,
+                          NULL);
+  }
+  const double text = (bench_now_ns() - begin) / ROUNDS;
+  if (rows != ROWS) {
+    return 1;
+  }
+
+  const char *path = "registry_loader_bench.bin";
+  registry_file_t file;
+  if (!registry_write_binary(path, coordinates, parameters, ROWS) ||
+      !registry_file_open(path, &file)) {
+    return 1;
+  }
+  begin = bench_now_ns();
+  for (int round = 0; round < ROUNDS; round++) {
+    rows = registry_parse(file.data, file.size, coordinates, parameters,
+                          ROWS, NULL, 0, NULL);
+  }
+  const double binary = (bench_now_ns() - begin) / ROUNDS;
+  bench_consume(rows + (unsigned long)parameters[ROWS / 2].method);
+
+  printf("%d rows\n", ROWS);
+  printf("csv    %6.1f MB %8.1f ms %8.2f M rows/s\n", size / 1e6, text / 1e6,
+         ROWS / text * 1e3);
+  printf("binary %6.1f MB %8.1f ms %8.2f M rows/s\n", file.size / 1e6,
+         binary / 1e6, ROWS / binary * 1e3);
+
+  registry_file_close(&file);
+  remove(path);
+  free(parameters);
+  free(coordinates);
+  free(csv);
+  return 0;
+}
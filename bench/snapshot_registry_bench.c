@@ -0,0 +1,65 @@
+#include "../src/calculation_parameters.h"
+#include "../src/snapshot_registry.h"
+#include "bench_utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/* 200k locations on a grid from 60S to 60N, two methods */
+#define LATITUDES 400
+#define LONGITUDES 500
+#define LOCATIONS (LATITUDES * LONGITUDES)
+#define LOOKUPS 10000000
+
+int main(void) {
+  registry_location_t *locations = malloc(LOCATIONS * sizeof(*locations));
+  const calculation_parameters_t parameters[2] = {
+      getParameters(MUSLIM_WORLD_LEAGUE), getParameters(UMM_AL_QURA)};
+  const time_t day = 1717200000; /* 2024-06-01T00:00:00Z */
+
+  if (!locations) {
+    return 1;
+  }
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (registry_location_t){
+        {-60.0 + 0.3 * (i / LONGITUDES), -180.0 + 0.72 * (i % LONGITUDES)},
+        (uint32_t)(i % 2)};
+  }
+
+  double begin = bench_now_ns();
+  snapshot_registry_t *registry =
+      snapshot_registry_new(locations, LOCATIONS, parameters, 2, 1, day);
+  const double create = (bench_now_ns() - begin) / 1e6;
+  if (!registry) {
+    return 1;
+  }
+
+  begin = bench_now_ns();
+  snapshot_registry_prewarm(registry, day + 86400);
+  const double prewarm = (bench_now_ns() - begin) / 1e6;
+  begin = bench_now_ns();
+  snapshot_registry_publish(registry);
+  const double publish = (bench_now_ns() - begin) / 1e3;
+
+  /* What a request thread does: acquire, look up a location, release */
+  unsigned long sum = 0;
+  begin = bench_now_ns();
+  for (long i = 0; i < LOOKUPS; i++) {
+    const daily_snapshot_t *snapshot = snapshot_registry_acquire(registry, 0);
+    const prayer_times_t *times = daily_snapshot_times(
+        snapshot, (size_t)(i * 7919) % LOCATIONS, day + 86400 + i % 86400);
+    sum += (unsigned long)times->maghrib;
+    snapshot_registry_release(registry, 0);
+  }
+  const double lookup = (bench_now_ns() - begin) / LOOKUPS;
+  bench_consume(sum);
+
+  printf("%d locations\n", LOCATIONS);
+  printf("new (2 days)           %10.1f ms\n", create);
+  printf("prewarm (1 new day)    %10.1f ms\n", prewarm);
+  printf("publish                %10.1f us\n", publish);
+  printf("acquire+lookup+release %10.1f ns\n", lookup);
+
+  snapshot_registry_free(registry);
+  free(locations);
+  return 0;
+}
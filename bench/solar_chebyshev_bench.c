@@ -0,0 +1,45 @@
+#include "../src/calendrical_helper.h"
+#include "../src/solar_chebyshev.h"
+#include "../src/solar_coordinates.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+/* Hourly instants over 20 years, from 2020-01-01 */
+#define FIRST_JULIAN_DAY 2458849.5
+#define STEPS (20 * 366 * 24)
+
+int main(void) {
+  double sum = 0;
+
+  solar_coordinates_cache_reset();
+  double begin = bench_now_ns();
+  for (long i = 0; i < STEPS; i++) {
+    const solar_coordinates_t coordinates =
+        new_solar_coordinates(FIRST_JULIAN_DAY + i / 24.0);
+    sum += coordinates.declination + coordinates.apparentSiderealTime;
+  }
+  double series = (bench_now_ns() - begin) / STEPS;
+
+  begin = bench_now_ns();
+  for (long i = 0; i < STEPS; i++) {
+    solar_coordinates_t coordinates;
+    chebyshev_solar_coordinates(FIRST_JULIAN_DAY + i / 24.0, &coordinates);
+    sum += coordinates.declination + coordinates.apparentSiderealTime;
+  }
+  double chebyshev = (bench_now_ns() - begin) / STEPS;
+  bench_consume((unsigned long)sum);
+
+  double first, last;
+  chebyshev_solar_range(&first, &last);
+  const double segments = (last - first) / SOLAR_CHEBYSHEV_SEGMENT_DAYS;
+  printf("hourly solar coordinates over 20 years%s\n",
+         solar_coordinates_chebyshev_enabled()
+             ? ", new_solar_coordinates() built with ADHAN_SOLAR_CHEBYSHEV"
+             : "");
+  printf("new_solar_coordinates       %8.1f ns/lookup\n", series);
+  printf("chebyshev_solar_coordinates %8.1f ns/lookup\n", chebyshev);
+  printf("table                       %8.1f KB for %.0f years\n",
+         segments * SOLAR_CHEBYSHEV_COEFFICIENTS * sizeof(float) / 1e3,
+         (last - first) / 365.25);
+  return 0;
+}
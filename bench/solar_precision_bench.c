@@ -0,0 +1,99 @@
+#include "../src/calendrical_helper.h"
+#include "../src/solar_coordinates.h"
+#include "../src/solar_time.h"
+#include "bench_utils.h"
+#include <math.h>
+#include <stdio.h>
+
+/* Hourly instants over 2 years, from 2024-01-01 */
+#define FIRST_JULIAN_DAY 2460310.5
+#define STEPS (2 * 366 * 24)
+
+/* Every 5 days from 1950 to 2050 for the errors of the coordinates */
+#define FIRST_ERROR_DAY 2433282.5
+#define ERROR_DAYS (100 * 365 / 5)
+
+#define TIERS 3
+#define DAYS 365
+#define LOCATIONS 24
+
+static const char *const names[TIERS] = {"standard", "fast", "high"};
+static const solar_precision_t tiers[TIERS] = {
+    SOLAR_PRECISION_STANDARD, SOLAR_PRECISION_FAST, SOLAR_PRECISION_HIGH};
+
+static double max(double a, double b) { return a > b ? a : b; }
+
+/* Arcseconds between two angles in degrees */
+static double arcseconds(double a, double b) {
+  return fabs(remainder(a - b, 360)) * 3600;
+}
+
+int main(void) {
+  double cost[TIERS], declination[TIERS] = {0}, rightAscension[TIERS] = {0},
+                      siderealTime[TIERS] = {0}, events[TIERS] = {0};
+  double sum = 0;
+
+  for (int tier = 0; tier < TIERS; tier++) {
+    solar_coordinates_cache_reset();
+    const double begin = bench_now_ns();
+    for (long i = 0; i < STEPS; i++) {
+      const solar_coordinates_t coordinates = solar_coordinates_with_precision(
+          FIRST_JULIAN_DAY + i / 24.0, tiers[tier]);
+      sum += coordinates.declination + coordinates.apparentSiderealTime;
+    }
+    cost[tier] = (bench_now_ns() - begin) / STEPS;
+  }
+  bench_consume((unsigned long)sum);
+
+  /* Errors against the high tier */
+  for (long i = 0; i < ERROR_DAYS; i++) {
+    const double jd = FIRST_ERROR_DAY + i * 5.0;
+    const solar_coordinates_t high =
+        solar_coordinates_with_precision(jd, SOLAR_PRECISION_HIGH);
+    for (int tier = 0; tier < TIERS; tier++) {
+      const solar_coordinates_t coordinates =
+          solar_coordinates_with_precision(jd, tiers[tier]);
+      declination[tier] = max(declination[tier],
+                              arcseconds(coordinates.declination,
+                                         high.declination));
+      rightAscension[tier] = max(rightAscension[tier],
+                                 arcseconds(coordinates.rightAscension,
+                                            high.rightAscension));
+      siderealTime[tier] = max(siderealTime[tier],
+                               arcseconds(coordinates.apparentSiderealTime,
+                                          high.apparentSiderealTime));
+    }
+  }
+
+  /* Unrounded transit, sunrise and sunset, in seconds, from 60S to 60N */
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+  for (int location = 0; location < LOCATIONS; location++) {
+    coordinates_t coordinates = {-60.0 + 5.0 * location,
+                                 -170.0 + 14.5 * location};
+    for (int day = 0; day < DAYS; day++) {
+      const time_t date = add_days(start, day);
+      solar_coordinates_set_precision(SOLAR_PRECISION_HIGH);
+      const solar_time_t high = new_solar_time(date, &coordinates);
+      for (int tier = 0; tier < TIERS; tier++) {
+        solar_coordinates_set_precision(tiers[tier]);
+        const solar_time_t solar = new_solar_time(date, &coordinates);
+        events[tier] = max(events[tier],
+                           3600 * max(fabs(solar.transit - high.transit),
+                                      max(fabs(solar.sunrise - high.sunrise),
+                                          fabs(solar.sunset - high.sunset))));
+      }
+    }
+  }
+  solar_coordinates_set_precision(SOLAR_PRECISION_STANDARD);
+
+  printf("tier      ns/lookup  max error against high, 1950-2050 (arcsec)"
+         "  events 2024\n");
+  printf("                     declination  right ascension  sidereal time"
+         "  (seconds)\n");
+  for (int tier = 0; tier < TIERS; tier++) {
+    printf("%-9s %9.1f  %11.2f  %15.2f  %13.2f  %9.2f\n", names[tier],
+           cost[tier], declination[tier], rightAscension[tier],
+           siderealTime[tier], events[tier]);
+  }
+  return 0;
+}
@@ -0,0 +1,47 @@
+#include "../src/sun_position.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+/* One sample every 10 seconds */
+#define SAMPLES 8640
+#define STEP_HOURS (24.0 / SAMPLES)
+
+int main(void) {
+  static double altitudes[SAMPLES];
+  static double azimuths[SAMPLES];
+  coordinates_t coordinates = {51.5074, -0.1278};
+  const time_t day = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  double start = bench_now_ns();
+  for (int i = 0; i < SAMPLES; i++) {
+    sun_position_t position =
+        sun_position(&coordinates, day + (time_t)(i * 10));
+    altitudes[i] = position.altitude;
+    azimuths[i] = position.azimuth;
+  }
+  double instant = (bench_now_ns() - start) / SAMPLES;
+  bench_consume((unsigned long)(altitudes[SAMPLES / 2] + 90));
+
+  solar_time_t solar_time = new_solar_time(day, &coordinates);
+  start = bench_now_ns();
+  for (int i = 0; i < SAMPLES; i++) {
+    sun_position_t position =
+        solar_time_sun_position(&solar_time, i * STEP_HOURS);
+    altitudes[i] = position.altitude;
+    azimuths[i] = position.azimuth;
+  }
+  double interpolated = (bench_now_ns() - start) / SAMPLES;
+  bench_consume((unsigned long)(altitudes[SAMPLES / 2] + 90));
+
+  start = bench_now_ns();
+  sun_position_curve(&solar_time, 0, STEP_HOURS, SAMPLES, altitudes,
+                     azimuths);
+  double curve = (bench_now_ns() - start) / SAMPLES;
+  bench_consume((unsigned long)(altitudes[SAMPLES / 2] + 90));
+
+  printf("%d samples\n", SAMPLES);
+  printf("sun_position            %8.1f ns/sample\n", instant);
+  printf("solar_time_sun_position %8.1f ns/sample\n", interpolated);
+  printf("sun_position_curve      %8.1f ns/sample\n", curve);
+  return 0;
+}
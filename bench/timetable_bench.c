@@ -0,0 +1,75 @@
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_coordinates.h"
+#include "../src/timetable.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+#define DAYS 365
+#define LOCATIONS 50
+
+static prayer_times_t timetable[DAYS];
+
+int main(void) {
+  calculation_parameters_t params = getParameters(UMM_AL_QURA);
+  hijri_month_adjustments_t ramadan = umm_al_qura_ramadan_adjustments(&params);
+  coordinates_t locations[LOCATIONS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (coordinates_t){-40.0 + 1.6 * i, -170.0 + 6.8 * i};
+  }
+
+  solar_coordinates_cache_reset();
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int day = 0; day < DAYS; day++) {
+      timetable[day] = new_prayer_times(&locations[location],
+                                        add_days(start, day), &params);
+    }
+    bench_consume((unsigned long)timetable[location % DAYS].isha);
+  }
+  double single = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+  double hit_rate = solar_coordinates_cache_hit_rate();
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_times_range(&locations[location], start, DAYS, &params, NULL,
+                           timetable);
+    bench_consume((unsigned long)timetable[location % DAYS].isha);
+  }
+  double range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    new_prayer_times_range(&locations[location], start, DAYS, &params,
+                           &ramadan, timetable);
+    bench_consume((unsigned long)timetable[location % DAYS].isha);
+  }
+  double ramadan_range = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  /* Nordic locations with the polar rules, where most days of the year are
+   * missing a sunrise, a sunset or a twilight */
+  calculation_parameters_t polar = getParameters(MUSLIM_WORLD_LEAGUE);
+  double polar_rules[2];
+  for (int rule = 0; rule < 2; rule++) {
+    polar.highLatitudeRule = rule == 0 ? NEAREST_DAY : NEAREST_LATITUDE;
+    begin = bench_now_ns();
+    for (int location = 0; location < LOCATIONS; location++) {
+      coordinates_t nordic = {60.0 + 0.4 * location, 5.0 + 0.5 * location};
+      new_prayer_times_range(&nordic, start, DAYS, &polar, NULL, timetable);
+      bench_consume((unsigned long)timetable[location % DAYS].isha);
+    }
+    polar_rules[rule] = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+  }
+
+  printf("%d locations x %d days\n", LOCATIONS, DAYS);
+  printf("new_prayer_times loop        %8.0f ns/day (%.0f%% cache hits)\n",
+         single, 100 * hit_rate);
+  printf("new_prayer_times_range       %8.0f ns/day\n", range);
+  printf("range with Ramadan overrides %8.0f ns/day\n", ramadan_range);
+  printf("range above 60N, nearest day %8.0f ns/day\n", polar_rules[0]);
+  printf("range above 60N, nearest lat %8.0f ns/day\n", polar_rules[1]);
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include "../src/calendrical_helper.h"
+#include "../src/solar_time.h"
+#include "../src/twilight_profile.h"
+#include "bench_utils.h"
+#include <stdio.h>
+
+/* Depressions from 0 to 20 degrees in quarter degree steps */
+#define ANGLES 81
+#define STEP 0.25
+#define DAYS 365
+#define LOCATIONS 10
+
+static double morning[DAYS * ANGLES];
+static double evening[DAYS * ANGLES];
+
+int main(void) {
+  coordinates_t locations[LOCATIONS];
+  const time_t start = 1704067200; /* 2024-01-01T00:00:00Z */
+
+  for (int i = 0; i < LOCATIONS; i++) {
+    locations[i] = (coordinates_t){-45.0 + 10.0 * i, -170.0 + 34.0 * i};
+  }
+
+  double begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    for (int day = 0; day < DAYS; day++) {
+      solar_time_t solar_time =
+          new_solar_time(add_days(start, day), &locations[location]);
+      for (int i = 0; i < ANGLES; i++) {
+        morning[day * ANGLES + i] = hour_angle(&solar_time, -STEP * i, false);
+        evening[day * ANGLES + i] = hour_angle(&solar_time, -STEP * i, true);
+      }
+    }
+    bench_consume((unsigned long)morning[location]);
+  }
+  double hour_angles = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  twilight_profile_t profile = {start, DAYS, 0.0, STEP, ANGLES, morning,
+                                evening};
+  begin = bench_now_ns();
+  for (int location = 0; location < LOCATIONS; location++) {
+    twilight_profile(&locations[location], &profile);
+    bench_consume((unsigned long)morning[location]);
+  }
+  double sweep = (bench_now_ns() - begin) / (LOCATIONS * DAYS);
+
+  printf("%d locations x %d days x %d angles\n", LOCATIONS, DAYS, ANGLES);
+  printf("hour_angle loop    %8.0f ns/day\n", hour_angles);
+  printf("twilight_profile   %8.0f ns/day (%.1fx)\n", sweep,
+         hour_angles / sweep);
+  return 0;
+}
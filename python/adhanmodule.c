@@ -0,0 +1,441 @@
+/*
+ * CPython extension over the library for batch calls from Python.
+ *
+ * Arrays are passed through the buffer protocol, so NumPy arrays,
+ * array.array and memoryviews are read and written in place without copies
+ * and without building against NumPy. The batch loops run with the GIL
+ * released, split over threads.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include "../src/calculation_parameters.h"
+#include "../src/prayer_times.h"
+#include "../src/qibla.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define PRAYER_FIELDS 7
+#define MAX_THREADS 64
+/* Rows below which an extra thread costs more than it saves */
+#define MIN_ROWS_PER_THREAD 256
+
+/* A column of a batch, either a buffer or a scalar broadcast to every row */
+typedef struct {
+  Py_buffer view;
+  bool has_view;
+  const char *data;
+  Py_ssize_t itemsize;
+  Py_ssize_t length;
+  char kind; /* 'f' floating point, 'i' signed integer */
+  long scalar;
+} column_t;
+
+static void release_column(column_t *column) {
+  if (column->has_view) {
+    PyBuffer_Release(&column->view);
+    column->has_view = false;
+  }
+}
+
+/* Format character of a native buffer, skipping the byte order prefix */
+static char format_kind(const Py_buffer *view) {
+  const char *format = view->format ? view->format : "B";
+  if (*format == '@' || *format == '=' ||
+      (*format == '<' && PY_LITTLE_ENDIAN) ||
+      (*format == '>' && !PY_LITTLE_ENDIAN)) {
+    format++;
+  }
+  if (format[0] == '\0' || format[1] != '\0') {
+    return 0;
+  }
+  switch (format[0]) {
+  case 'd':
+    return 'f';
+  case 'b':
+  case 'h':
+  case 'i':
+  case 'l':
+  case 'q':
+    return 'i';
+  default:
+    return 0;
+  }
+}
+
+/*
+ * Gets a C contiguous buffer of float64 (kind 'f') or signed integers (kind
+ * 'i'). Integer columns may also be a Python int when `scalar_ok` is set.
+ */
+static bool get_column(PyObject *object, char kind, bool writable,
+                       bool scalar_ok, const char *name, column_t *column) {
+  memset(column, 0, sizeof *column);
+  column->kind = kind;
+
+  if (scalar_ok && PyLong_Check(object)) {
+    column->scalar = PyLong_AsLong(object);
+    column->length = -1;
+    return !PyErr_Occurred();
+  }
+
+  const int flags =
+      PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+  if (PyObject_GetBuffer(object, &column->view, flags) < 0) {
+    PyErr_Format(PyExc_TypeError,
+                 "%s must be a C contiguous%s buffer, such as a NumPy array",
+                 name, writable ? " writable" : "");
+    return false;
+  }
+  column->has_view = true;
+
+  if (format_kind(&column->view) != kind ||
+      (kind == 'f' && column->view.itemsize != 8)) {
+    PyErr_Format(PyExc_TypeError, "%s must hold %s", name,
+                 kind == 'f' ? "float64 values" : "signed integers");
+    release_column(column);
+    return false;
+  }
+  column->data = column->view.buf;
+  column->itemsize = column->view.itemsize;
+  column->length = column->view.len / column->view.itemsize;
+  return true;
+}
+
+static double column_double(const column_t *column, Py_ssize_t row) {
+  double value;
+  memcpy(&value, column->data + row * 8, sizeof value);
+  return value;
+}
+
+static int64_t column_integer(const column_t *column, Py_ssize_t row) {
+  const char *item;
+
+  if (column->length < 0) {
+    return column->scalar;
+  }
+  item = column->data + row * column->itemsize;
+  switch (column->itemsize) {
+  case 1:
+    return *(const int8_t *)item;
+  case 2: {
+    int16_t value;
+    memcpy(&value, item, sizeof value);
+    return value;
+  }
+  case 4: {
+    int32_t value;
+    memcpy(&value, item, sizeof value);
+    return value;
+  }
+  default: {
+    int64_t value;
+    memcpy(&value, item, sizeof value);
+    return value;
+  }
+  }
+}
+
+typedef struct {
+  const column_t *latitudes;
+  const column_t *longitudes;
+  const column_t *dates;
+  const column_t *methods;
+  const column_t *madhabs;
+  const column_t *rules;
+  int64_t *out;
+  Py_ssize_t begin;
+  Py_ssize_t end;
+  Py_ssize_t valid;
+} prayer_batch_t;
+
+static void *run_prayer_batch(void *argument) {
+  prayer_batch_t *batch = argument;
+
+  for (Py_ssize_t row = batch->begin; row < batch->end; row++) {
+    const int64_t method = column_integer(batch->methods, row);
+    const int64_t madhab = column_integer(batch->madhabs, row);
+    const int64_t rule = column_integer(batch->rules, row);
+    int64_t *out = batch->out + row * PRAYER_FIELDS;
+    prayer_times_t times = NULL_PRAYER_TIMES;
+
+    if (method >= MUSLIM_WORLD_LEAGUE && method <= OTHER && madhab >= SHAFI &&
+        madhab <= HANAFI && rule >= MIDDLE_OF_THE_NIGHT &&
+        rule <= NEAREST_LATITUDE) {
+      calculation_parameters_t parameters =
+          getParameters((calculation_method)method);
+      coordinates_t coordinates = {column_double(batch->latitudes, row),
+                                   column_double(batch->longitudes, row)};
+      parameters.madhab = (madhab_t)madhab;
+      parameters.highLatitudeRule = (high_latitude_rule_t)rule;
+      times = new_prayer_times(&coordinates,
+                               (time_t)column_integer(batch->dates, row),
+                               &parameters);
+    }
+
+    out[0] = times.fajr;
+    out[1] = times.sunrise;
+    out[2] = times.dhuhr;
+    out[3] = times.asr;
+    out[4] = times.maghrib;
+    out[5] = times.isha;
+    out[6] = times.midnight;
+    batch->valid += times.fajr != 0;
+  }
+  return NULL;
+}
+
+static Py_ssize_t thread_count(Py_ssize_t requested, Py_ssize_t rows) {
+  Py_ssize_t threads = requested;
+
+  if (threads <= 0) {
+    threads = (Py_ssize_t)sysconf(_SC_NPROCESSORS_ONLN);
+  }
+  if (threads > rows / MIN_ROWS_PER_THREAD) {
+    threads = rows / MIN_ROWS_PER_THREAD;
+  }
+  if (threads > MAX_THREADS) {
+    threads = MAX_THREADS;
+  }
+  return threads < 1 ? 1 : threads;
+}
+
+PyDoc_STRVAR(prayer_times_doc,
+             "prayer_times(latitudes, longitudes, dates, out, method=0, "
+             "madhab=0, high_latitude_rule=2, threads=0)\n"
+             "--\n\n"
+             "Compute the prayer times of every row into `out`.\n\n"
+             "latitudes and longitudes are float64 arrays in degrees, dates "
+             "an integer array of UTC days as seconds since the epoch (e.g. "
+             "datetime64[s] viewed as int64). method, madhab and "
+             "high_latitude_rule are ints or integer arrays with one value "
+             "per row. out is a writable int64 array of rows x 7 seconds "
+             "since the epoch: fajr, sunrise, dhuhr, asr, maghrib, isha and "
+             "midnight, all 0 where the times cannot be computed.\n\n"
+             "Runs without the GIL on `threads` threads, 0 for one per CPU.\n"
+             "Returns the number of rows with prayer times.");
+
+static PyObject *adhan_prayer_times(PyObject *self, PyObject *args,
+                                    PyObject *kwargs) {
+  static char *keywords[] = {"latitudes", "longitudes", "dates",
+                             "out",       "method",     "madhab",
+                             "high_latitude_rule",      "threads",
+                             NULL};
+  PyObject *latitudes_object, *longitudes_object, *dates_object, *out_object;
+  PyObject *method_object = NULL, *madhab_object = NULL, *rule_object = NULL;
+  Py_ssize_t requested_threads = 0;
+  column_t columns[7];
+  column_t *latitudes = &columns[0], *longitudes = &columns[1],
+           *dates = &columns[2], *out = &columns[3], *methods = &columns[4],
+           *madhabs = &columns[5], *rules = &columns[6];
+  PyObject *result = NULL;
+  (void)self;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO|OOOn", keywords,
+                                   &latitudes_object, &longitudes_object,
+                                   &dates_object, &out_object, &method_object,
+                                   &madhab_object, &rule_object,
+                                   &requested_threads)) {
+    return NULL;
+  }
+  memset(columns, 0, sizeof columns);
+  methods->length = madhabs->length = rules->length = -1;
+  rules->scalar = TWILIGHT_ANGLE;
+
+  if (!get_column(latitudes_object, 'f', false, false, "latitudes",
+                  latitudes) ||
+      !get_column(longitudes_object, 'f', false, false, "longitudes",
+                  longitudes) ||
+      !get_column(dates_object, 'i', false, false, "dates", dates) ||
+      !get_column(out_object, 'i', true, false, "out", out) ||
+      (method_object && !get_column(method_object, 'i', false, true,
+                                    "method", methods)) ||
+      (madhab_object && !get_column(madhab_object, 'i', false, true,
+                                    "madhab", madhabs)) ||
+      (rule_object && !get_column(rule_object, 'i', false, true,
+                                  "high_latitude_rule", rules))) {
+    goto done;
+  }
+
+  const Py_ssize_t rows = latitudes->length;
+  if (longitudes->length != rows || dates->length != rows ||
+      (methods->length >= 0 && methods->length != rows) ||
+      (madhabs->length >= 0 && madhabs->length != rows) ||
+      (rules->length >= 0 && rules->length != rows)) {
+    PyErr_SetString(PyExc_ValueError,
+                    "all input arrays must have the same length");
+    goto done;
+  }
+  if (out->itemsize != 8 || out->length != rows * PRAYER_FIELDS) {
+    PyErr_SetString(PyExc_ValueError,
+                    "out must be an int64 array of rows x 7 values");
+    goto done;
+  }
+
+  const Py_ssize_t threads = thread_count(requested_threads, rows);
+  prayer_batch_t batches[MAX_THREADS];
+  pthread_t workers[MAX_THREADS];
+  Py_ssize_t started = 1;
+  Py_ssize_t valid = 0;
+
+  for (Py_ssize_t i = 0; i < threads; i++) {
+    batches[i] = (prayer_batch_t){latitudes,
+                                  longitudes,
+                                  dates,
+                                  methods,
+                                  madhabs,
+                                  rules,
+                                  (int64_t *)out->view.buf,
+                                  rows * i / threads,
+                                  rows * (i + 1) / threads,
+                                  0};
+  }
+
+  Py_BEGIN_ALLOW_THREADS;
+  while (started < threads &&
+         pthread_create(&workers[started], NULL, run_prayer_batch,
+                        &batches[started]) == 0) {
+    started++;
+  }
+  /* The calling thread runs the first batch, and those of the threads that
+   * could not be started */
+  run_prayer_batch(&batches[0]);
+  for (Py_ssize_t i = started; i < threads; i++) {
+    run_prayer_batch(&batches[i]);
+  }
+  for (Py_ssize_t i = 1; i < started; i++) {
+    pthread_join(workers[i], NULL);
+  }
+  Py_END_ALLOW_THREADS;
+
+  for (Py_ssize_t i = 0; i < threads; i++) {
+    valid += batches[i].valid;
+  }
+  result = PyLong_FromSsize_t(valid);
+
+done:
+  for (int i = 0; i < 7; i++) {
+    release_column(&columns[i]);
+  }
+  return result;
+}
+
+PyDoc_STRVAR(qibla_doc,
+             "qibla(latitudes, longitudes, bearings, distances=None)\n"
+             "--\n\n"
+             "Qibla bearing in degrees from true north and great circle "
+             "distance in kilometers of every row, written into the writable "
+             "float64 arrays `bearings` and `distances` (which may be None).");
+
+static PyObject *adhan_qibla(PyObject *self, PyObject *args,
+                             PyObject *kwargs) {
+  static char *keywords[] = {"latitudes", "longitudes", "bearings",
+                             "distances", NULL};
+  PyObject *latitudes_object, *longitudes_object, *bearings_object;
+  PyObject *distances_object = Py_None;
+  column_t columns[4];
+  PyObject *result = NULL;
+  (void)self;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO|O", keywords,
+                                   &latitudes_object, &longitudes_object,
+                                   &bearings_object, &distances_object)) {
+    return NULL;
+  }
+  memset(columns, 0, sizeof columns);
+
+  if (!get_column(latitudes_object, 'f', false, false, "latitudes",
+                  &columns[0]) ||
+      !get_column(longitudes_object, 'f', false, false, "longitudes",
+                  &columns[1]) ||
+      !get_column(bearings_object, 'f', true, false, "bearings",
+                  &columns[2]) ||
+      (distances_object != Py_None &&
+       !get_column(distances_object, 'f', true, false, "distances",
+                   &columns[3]))) {
+    goto done;
+  }
+
+  const Py_ssize_t rows = columns[0].length;
+  if (columns[1].length != rows || columns[2].length != rows ||
+      (columns[3].has_view && columns[3].length != rows)) {
+    PyErr_SetString(PyExc_ValueError, "all arrays must have the same length");
+    goto done;
+  }
+
+  Py_BEGIN_ALLOW_THREADS;
+  qibla_batch((const double *)columns[0].data,
+              (const double *)columns[1].data, (size_t)rows,
+              (double *)columns[2].view.buf,
+              columns[3].has_view ? (double *)columns[3].view.buf : NULL);
+  Py_END_ALLOW_THREADS;
+  Py_INCREF(Py_None);
+  result = Py_None;
+
+done:
+  for (int i = 0; i < 4; i++) {
+    release_column(&columns[i]);
+  }
+  return result;
+}
+
+static PyMethodDef adhan_methods[] = {
+    {"prayer_times", (PyCFunction)(void (*)(void))adhan_prayer_times,
+     METH_VARARGS | METH_KEYWORDS, prayer_times_doc},
+    {"qibla", (PyCFunction)(void (*)(void))adhan_qibla,
+     METH_VARARGS | METH_KEYWORDS, qibla_doc},
+    {NULL, NULL, 0, NULL}};
+
+static int add_constants(PyObject *module) {
+  static const struct {
+    const char *name;
+    long value;
+  } constants[] = {
+      {"MUSLIM_WORLD_LEAGUE", MUSLIM_WORLD_LEAGUE},
+      {"EGYPTIAN", EGYPTIAN},
+      {"KARACHI", KARACHI},
+      {"UMM_AL_QURA", UMM_AL_QURA},
+      {"GULF", GULF},
+      {"MOON_SIGHTING_COMMITTEE", MOON_SIGHTING_COMMITTEE},
+      {"NORTH_AMERICA", NORTH_AMERICA},
+      {"KUWAIT", KUWAIT},
+      {"QATAR", QATAR},
+      {"OTHER", OTHER},
+      {"SHAFI", SHAFI},
+      {"HANAFI", HANAFI},
+      {"MIDDLE_OF_THE_NIGHT", MIDDLE_OF_THE_NIGHT},
+      {"SEVENTH_OF_THE_NIGHT", SEVENTH_OF_THE_NIGHT},
+      {"TWILIGHT_ANGLE", TWILIGHT_ANGLE},
+      {"NEAREST_DAY", NEAREST_DAY},
+      {"NEAREST_LATITUDE", NEAREST_LATITUDE},
+      {"PRAYER_FIELDS", PRAYER_FIELDS},
+  };
+
+  for (size_t i = 0; i < sizeof constants / sizeof constants[0]; i++) {
+    if (PyModule_AddIntConstant(module, constants[i].name,
+                                constants[i].value) < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static struct PyModuleDef adhan_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "adhan",
+    .m_doc = "Batch prayer times and Qibla directions over NumPy arrays.",
+    .m_size = -1,
+    .m_methods = adhan_methods,
+};
+
+PyMODINIT_FUNC PyInit_adhan(void);
+
+PyMODINIT_FUNC PyInit_adhan(void) {
+  PyObject *module = PyModule_Create(&adhan_module);
+  if (module && add_constants(module) < 0) {
+    Py_DECREF(module);
+    return NULL;
+  }
+  return module;
+}
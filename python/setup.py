@@ -0,0 +1,33 @@
+"""Build the adhan extension with the library sources compiled in.
+
+    python setup.py build_ext --inplace
+
+Needs only a C compiler and the CPython headers, not NumPy or network
+access.
+"""
+import glob
+import os
+
+from setuptools import Extension, setup
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCES = sorted(
+    os.path.relpath(path, HERE)
+    for path in glob.glob(os.path.join(HERE, "..", "src", "*.c"))
+    if os.path.basename(path) != "example.c"
+)
+
+setup(
+    name="adhan",
+    version="1.0.1",
+    description="Batch prayer times and Qibla directions over NumPy arrays",
+    ext_modules=[
+        Extension(
+            "adhan",
+            sources=["adhanmodule.c"] + SOURCES,
+            define_macros=[("ADHAN_SOLAR_CACHE", None)],
+            extra_compile_args=["-std=c17", "-O3"],
+            libraries=["m", "pthread"],
+        )
+    ],
+)
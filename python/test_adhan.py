@@ -0,0 +1,110 @@
+"""Tests of the adhan extension, with array.array or NumPy when installed."""
+import array
+import unittest
+
+import adhan
+
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
+# Raleigh, 2015-07-12, North America, Hanafi, as in prayer_times_test.cpp
+RALEIGH = (35.7750, -78.6336)
+JULY_12_2015 = 1436659200
+RALEIGH_TIMES = ("08:42", "10:08", "17:21", "22:22", "00:32", "01:57")
+
+
+def hhmm(seconds):
+    return "%02d:%02d" % (seconds // 3600 % 24, seconds // 60 % 60)
+
+
+class PrayerTimesTest(unittest.TestCase):
+    def test_matches_unit_test_times(self):
+        out = array.array("q", [0] * adhan.PRAYER_FIELDS)
+        count = adhan.prayer_times(
+            array.array("d", [RALEIGH[0]]),
+            array.array("d", [RALEIGH[1]]),
+            array.array("q", [JULY_12_2015]),
+            out,
+            method=adhan.NORTH_AMERICA,
+            madhab=adhan.HANAFI,
+        )
+        self.assertEqual(count, 1)
+        self.assertEqual(tuple(hhmm(t) for t in out[:6]), RALEIGH_TIMES)
+
+    def test_threads_match_single_thread(self):
+        rows = 5000
+        latitudes = array.array("d", (-50 + (i % 100) for i in range(rows)))
+        longitudes = array.array("d", (-170 + (i % 340) for i in range(rows)))
+        dates = array.array("q", (JULY_12_2015 + 86400 * (i % 365)
+                                  for i in range(rows)))
+        methods = array.array("i", (i % adhan.OTHER for i in range(rows)))
+        madhabs = array.array("b", (i % 2 for i in range(rows)))
+        single = array.array("q", [0] * (rows * adhan.PRAYER_FIELDS))
+        threaded = array.array("q", [0] * (rows * adhan.PRAYER_FIELDS))
+
+        self.assertEqual(
+            adhan.prayer_times(latitudes, longitudes, dates, single,
+                               methods, madhabs, threads=1), rows)
+        self.assertEqual(
+            adhan.prayer_times(latitudes, longitudes, dates, threaded,
+                               methods, madhabs, threads=4), rows)
+        self.assertEqual(single, threaded)
+
+    def test_marks_invalid_rows(self):
+        out = array.array("q", [1] * (2 * adhan.PRAYER_FIELDS))
+        count = adhan.prayer_times(
+            array.array("d", [RALEIGH[0], 95.0]),
+            array.array("d", [RALEIGH[1], 0.0]),
+            array.array("q", [JULY_12_2015] * 2),
+            out,
+            method=array.array("i", [42, adhan.MUSLIM_WORLD_LEAGUE]),
+        )
+        self.assertEqual(count, 0)
+        self.assertEqual(list(out), [0] * (2 * adhan.PRAYER_FIELDS))
+
+    def test_rejects_bad_arrays(self):
+        latitudes = array.array("d", [RALEIGH[0]])
+        longitudes = array.array("d", [RALEIGH[1]])
+        dates = array.array("q", [JULY_12_2015])
+        with self.assertRaises(TypeError):
+            adhan.prayer_times(latitudes, longitudes, dates,
+                               bytes(8 * adhan.PRAYER_FIELDS))
+        with self.assertRaises(TypeError):
+            adhan.prayer_times(array.array("f", [1.0]), longitudes, dates,
+                               array.array("q", [0] * adhan.PRAYER_FIELDS))
+        with self.assertRaises(ValueError):
+            adhan.prayer_times(latitudes, longitudes, dates,
+                               array.array("q", [0] * 6))
+        with self.assertRaises(ValueError):
+            adhan.prayer_times(latitudes, longitudes,
+                               array.array("q", [JULY_12_2015] * 2),
+                               array.array("q", [0] * adhan.PRAYER_FIELDS))
+
+    @unittest.skipIf(numpy is None, "NumPy is not installed")
+    def test_fills_numpy_output_in_place(self):
+        out = numpy.zeros((3, adhan.PRAYER_FIELDS), dtype=numpy.int64)
+        dates = numpy.array(["2015-07-12"] * 3, dtype="datetime64[s]")
+        count = adhan.prayer_times(
+            numpy.full(3, RALEIGH[0]), numpy.full(3, RALEIGH[1]),
+            dates.view(numpy.int64), out, method=adhan.NORTH_AMERICA,
+            madhab=numpy.array([0, 1, 1], dtype=numpy.int32))
+        self.assertEqual(count, 3)
+        self.assertEqual(hhmm(out[1, 3]), RALEIGH_TIMES[3])
+        self.assertLess(out[0, 3], out[1, 3])
+
+
+class QiblaTest(unittest.TestCase):
+    def test_matches_known_bearings(self):
+        bearings = array.array("d", [0.0, 0.0])
+        distances = array.array("d", [0.0, 0.0])
+        adhan.qibla(array.array("d", [40.7128, 21.4225241]),
+                    array.array("d", [-74.0059, 39.8261818]),
+                    bearings, distances)
+        self.assertAlmostEqual(bearings[0], 58.4818, places=3)
+        self.assertAlmostEqual(distances[1], 0.0, places=6)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,269 @@
+#ifndef ADHAN_ADHAN_HPP
+#define ADHAN_ADHAN_HPP
+
+/**
+ * @file adhan.hpp
+ * @brief Header-only C++20 interface to the prayer time calculation
+ *
+ * Value types for the observer and the calculation parameters, times as
+ * std::chrono::sys_seconds, and a lazy range of consecutive days. Everything
+ * forwards to the C functions, so results are identical to the C API.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <iterator>
+#include <ranges>
+
+extern "C" {
+#include "calculation_parameters.h"
+#include "calendrical_helper.h"
+#include "coordinates.h"
+#include "prayer.h"
+#include "prayer_times.h"
+#include "solar_time.h"
+}
+
+namespace adhan {
+
+/**
+ * @brief Geographic position of the observer in degrees
+ */
+struct Observer {
+  double latitude = 0;  /**< Latitude in degrees (-90 to 90) */
+  double longitude = 0; /**< Longitude in degrees (-180 to 180) */
+
+  constexpr coordinates_t coordinates() const { return {latitude, longitude}; }
+
+  constexpr bool valid() const {
+    return latitude >= -90.0 && latitude <= 90.0 && longitude >= -180.0 &&
+           longitude <= 180.0;
+  }
+};
+
+/**
+ * @brief Calculation parameters as a value type
+ *
+ * Starts from the parameters of a calculation method, see getParameters(),
+ * and is adjusted with the chainable setters:
+ * `Params(MUSLIM_WORLD_LEAGUE).madhab(HANAFI)`.
+ */
+class Params {
+public:
+  Params() : parameters_(getParameters(OTHER)) {}
+  explicit Params(calculation_method method)
+      : parameters_(getParameters(method)) {}
+  explicit Params(const calculation_parameters_t &parameters)
+      : parameters_(parameters) {}
+
+  Params &fajr_angle(double angle) {
+    parameters_.fajrAngle = angle;
+    return *this;
+  }
+  Params &isha_angle(double angle) {
+    parameters_.ishaAngle = angle;
+    return *this;
+  }
+  /** Minutes after Maghrib, replaces the Isha angle when not 0 */
+  Params &isha_interval(int minutes) {
+    parameters_.ishaInterval = minutes;
+    return *this;
+  }
+  Params &madhab(madhab_t madhab) {
+    parameters_.madhab = madhab;
+    return *this;
+  }
+  Params &high_latitude_rule(high_latitude_rule_t rule) {
+    parameters_.highLatitudeRule = rule;
+    return *this;
+  }
+  Params &adjustments(const prayer_adjustments_t &adjustments) {
+    parameters_.adjustments = adjustments;
+    return *this;
+  }
+
+  const calculation_parameters_t &c_params() const { return parameters_; }
+
+private:
+  calculation_parameters_t parameters_;
+};
+
+/**
+ * @brief Prayer times of one day
+ *
+ * All times are the epoch when the calculation failed, as for
+ * NULL_PRAYER_TIMES in the C API, which valid() tests.
+ */
+struct Times {
+  std::chrono::sys_seconds fajr;
+  std::chrono::sys_seconds sunrise;
+  std::chrono::sys_seconds dhuhr;
+  std::chrono::sys_seconds asr;
+  std::chrono::sys_seconds maghrib;
+  std::chrono::sys_seconds isha;
+  std::chrono::sys_seconds midnight;
+
+  static Times from_c(const prayer_times_t &times) {
+    return {to_sys(times.fajr),    to_sys(times.sunrise),
+            to_sys(times.dhuhr),   to_sys(times.asr),
+            to_sys(times.maghrib), to_sys(times.isha),
+            to_sys(times.midnight)};
+  }
+
+  bool valid() const {
+    return fajr.time_since_epoch().count() != 0 ||
+           dhuhr.time_since_epoch().count() != 0;
+  }
+
+  /** Time of `prayer`, the epoch for NONE */
+  std::chrono::sys_seconds operator[](prayer_t prayer) const {
+    switch (prayer) {
+    case FAJR:
+      return fajr;
+    case SUNRISE:
+      return sunrise;
+    case DHUHR:
+      return dhuhr;
+    case ASR:
+      return asr;
+    case MAGHRIB:
+      return maghrib;
+    case ISHA:
+      return isha;
+    case MIDNIGHT:
+      return midnight;
+    default:
+      return std::chrono::sys_seconds{};
+    }
+  }
+
+  friend bool operator==(const Times &, const Times &) = default;
+
+private:
+  static std::chrono::sys_seconds to_sys(time_t time) {
+    return std::chrono::sys_seconds{std::chrono::seconds{time}};
+  }
+};
+
+inline time_t to_time_t(std::chrono::sys_days day) {
+  return static_cast<time_t>(
+      std::chrono::sys_seconds{day}.time_since_epoch().count());
+}
+
+/**
+ * @brief Prayer times of the UTC day `date`, same as new_prayer_times()
+ */
+inline Times times(const Observer &observer, std::chrono::sys_days date,
+                   const Params &params) {
+  coordinates_t coordinates = observer.coordinates();
+  calculation_parameters_t parameters = params.c_params();
+  return Times::from_c(
+      new_prayer_times(&coordinates, to_time_t(date), &parameters));
+}
+
+/**
+ * @brief Lazy input range of the prayer times of consecutive days
+ *
+ * Each day is computed when the iterator advances to it, sharing solar
+ * coordinates and events between days through the same solar_time_days_t
+ * and prayer_carry_t as new_prayer_times_range(), so the times are the same
+ * without storing the timetable. The state lives in the view, which does not allocate; like
+ * other input views it is iterated once and must not be moved while
+ * iterating.
+ */
+class DayRange : public std::ranges::view_interface<DayRange> {
+public:
+  class iterator {
+  public:
+    using value_type = Times;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::input_iterator_tag;
+
+    iterator() = default;
+    explicit iterator(DayRange *range) : range_(range) {}
+
+    const Times &operator*() const { return range_->current_; }
+    const Times *operator->() const { return &range_->current_; }
+
+    iterator &operator++() {
+      range_->advance();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const iterator &it, std::default_sentinel_t) {
+      return it.at_end();
+    }
+
+  private:
+    bool at_end() const { return range_->index_ >= range_->days_; }
+
+    DayRange *range_ = nullptr;
+  };
+
+  DayRange() = default;
+  DayRange(const Observer &observer, const Params &params,
+           std::chrono::sys_days start, std::size_t days)
+      : coordinates_(observer.coordinates()), parameters_(params.c_params()),
+        start_(to_time_t(start)), days_(days) {}
+
+  /** Starts computing from the first day, the range is iterated once */
+  iterator begin() {
+    index_ = 0;
+    if (days_ > 0) {
+      solar_time_days_init(&solar_, &coordinates_, start_);
+      today_date_ = new_prayer_day(start_);
+      carry_ = {};
+      compute();
+    }
+    return iterator(this);
+  }
+  std::default_sentinel_t end() const { return std::default_sentinel; }
+
+  std::size_t size() const { return days_; }
+
+private:
+  /* Computes the times of day index_, with solar_ and today_date_ on it */
+  void compute() {
+    tomorrow_date_ =
+        new_prayer_day(add_days(start_, static_cast<int>(index_) + 1));
+    current_ = Times::from_c(prayer_times_with_carry(
+        &coordinates_, &today_date_, &parameters_, &solar_.today,
+        &tomorrow_date_, &solar_.tomorrow, &carry_));
+  }
+
+  void advance() {
+    if (++index_ >= days_) {
+      return;
+    }
+    today_date_ = tomorrow_date_;
+    solar_time_days_next(&solar_);
+    compute();
+  }
+
+  coordinates_t coordinates_ = {0, 0};
+  calculation_parameters_t parameters_ = getParameters(OTHER);
+  time_t start_ = 0;
+  std::size_t days_ = 0;
+  std::size_t index_ = 0;
+  solar_time_days_t solar_ = {};
+  prayer_day_t today_date_ = {};
+  prayer_day_t tomorrow_date_ = {};
+  prayer_carry_t carry_ = {};
+  Times current_ = {};
+};
+
+/**
+ * @brief Prayer times of `count` consecutive UTC days from `start`
+ *
+ * `for (const adhan::Times &day : adhan::days(observer, params, start, 30))`
+ */
+inline DayRange days(const Observer &observer, const Params &params,
+                     std::chrono::sys_days start, std::size_t count) {
+  return DayRange(observer, params, start, count);
+}
+
+} // namespace adhan
+
+#endif /* ADHAN_ADHAN_HPP */
@@ -0,0 +1,226 @@
+#include "altitude_events.h"
+#include "double_utils.h"
+#include <math.h>
+
+#define SIDEREAL_DEGREES_PER_DAY 360.985647
+
+/* Interpolated ephemeris of a solar time, see interpolate_value() and
+ * interpolate_angles() */
+typedef struct {
+  double sinPhi;
+  double cosPhi;
+  double sinAltitude;
+  double theta0;
+  double alpha2, alphaA, alphaB, alphaC;
+  double delta2, deltaA, deltaB, deltaC;
+} ephemeris_t;
+
+static ephemeris_t new_ephemeris(const solar_time_t *solar_time,
+                                 double altitude) {
+  const double phi = to_radians(solar_time->observer->latitude);
+  ephemeris_t ephemeris;
+
+  ephemeris.sinPhi = sin(phi);
+  ephemeris.cosPhi = cos(phi);
+  ephemeris.sinAltitude = sin(to_radians(altitude));
+  ephemeris.theta0 = solar_time->solar.apparentSiderealTime +
+                     solar_time->observer->longitude;
+  ephemeris.alpha2 = solar_time->solar.rightAscension;
+  ephemeris.alphaA = unwind_angle(ephemeris.alpha2 -
+                                  solar_time->prevSolar.rightAscension);
+  ephemeris.alphaB = unwind_angle(solar_time->nextSolar.rightAscension -
+                                  ephemeris.alpha2);
+  ephemeris.alphaC = ephemeris.alphaB - ephemeris.alphaA;
+  ephemeris.delta2 = solar_time->solar.declination;
+  ephemeris.deltaA = ephemeris.delta2 - solar_time->prevSolar.declination;
+  ephemeris.deltaB = solar_time->nextSolar.declination - ephemeris.delta2;
+  ephemeris.deltaC = ephemeris.deltaB - ephemeris.deltaA;
+  return ephemeris;
+}
+
+/*
+ * Difference between the sine of the sun's altitude and the sine of the
+ * target altitude, and its derivative per hour. Working with sines keeps the
+ * derivative finite at the culminations.
+ */
+static double evaluate(const ephemeris_t *ephemeris, double hours,
+                       double *derivative) {
+  const double m = hours / 24;
+  const double alpha =
+      ephemeris->alpha2 +
+      (m / 2) * (ephemeris->alphaA + ephemeris->alphaB + m * ephemeris->alphaC);
+  const double delta =
+      ephemeris->delta2 +
+      (m / 2) * (ephemeris->deltaA + ephemeris->deltaB + m * ephemeris->deltaC);
+  const double dAlpha =
+      (ephemeris->alphaA + ephemeris->alphaB) / 2 + m * ephemeris->alphaC;
+  const double dDelta =
+      (ephemeris->deltaA + ephemeris->deltaB) / 2 + m * ephemeris->deltaC;
+  const double H =
+      to_radians(ephemeris->theta0 + SIDEREAL_DEGREES_PER_DAY * m - alpha);
+  const double sinDelta = sin(to_radians(delta));
+  const double cosDelta = cos(to_radians(delta));
+  const double cosH = cos(H);
+
+  if (derivative) {
+    /* Derivatives of H and delta per day, in radians */
+    const double dH = to_radians(SIDEREAL_DEGREES_PER_DAY - dAlpha);
+    *derivative =
+        ((ephemeris->sinPhi * cosDelta - ephemeris->cosPhi * sinDelta * cosH) *
+             to_radians(dDelta) -
+         ephemeris->cosPhi * cosDelta * sin(H) * dH) /
+        24;
+  }
+  return ephemeris->sinPhi * sinDelta + ephemeris->cosPhi * cosDelta * cosH -
+         ephemeris->sinAltitude;
+}
+
+/*
+ * Safeguarded Newton iteration inside [low, high], where the function changes
+ * sign. `guess` may lie outside the bracket.
+ */
+static altitude_crossing_t refine(const ephemeris_t *ephemeris, double low,
+                                  double high, double lowValue, double guess,
+                                  const altitude_solver_t *solver,
+                                  int *evaluations) {
+  altitude_crossing_t crossing = {guess, false, false, 0};
+  double x = guess;
+
+  while (crossing.iterations < solver->max_iterations) {
+    if (!(x > low && x < high)) {
+      x = (low + high) / 2;
+    }
+
+    double derivative;
+    const double value = evaluate(ephemeris, x, &derivative);
+    (*evaluations)++;
+    crossing.iterations++;
+
+    if (value == 0) {
+      crossing.time = x;
+      crossing.converged = true;
+      return crossing;
+    }
+    if ((value < 0) == (lowValue < 0)) {
+      low = x;
+      lowValue = value;
+    } else {
+      high = x;
+    }
+
+    double next = derivative != 0 ? x - value / derivative : NAN;
+    if (!(next > low && next < high)) {
+      next = (low + high) / 2;
+    }
+    crossing.time = next;
+    if (fabs(next - x) <= solver->tolerance ||
+        high - low <= solver->tolerance) {
+      crossing.converged = true;
+      return crossing;
+    }
+    x = next;
+  }
+  return crossing;
+}
+
+static bool valid_solver(const altitude_solver_t *solver) {
+  return solver->tolerance > 0 && solver->max_iterations > 0;
+}
+
+/* First guess from the hour angle at the declination of transit */
+static double closed_form_guess(const solar_time_t *solar_time,
+                                const ephemeris_t *ephemeris,
+                                bool after_transit) {
+  const double delta = to_radians(solar_time->solar.declination);
+  const double ratio =
+      (ephemeris->sinAltitude - ephemeris->sinPhi * sin(delta)) /
+      (ephemeris->cosPhi * cos(delta));
+  const double H0 = to_degrees(safe_acos(ratio));
+  const double hours = H0 / SIDEREAL_DEGREES_PER_DAY * 24;
+  return after_transit ? solar_time->transit + hours
+                       : solar_time->transit - hours;
+}
+
+altitude_events_t altitude_events(const solar_time_t *solar_time,
+                                  double altitude,
+                                  const altitude_solver_t *solver) {
+  const altitude_solver_t defaults = {ALTITUDE_SOLVER_DEFAULT_TOLERANCE,
+                                      ALTITUDE_SOLVER_DEFAULT_MAX_ITERATIONS};
+  altitude_events_t events = {ALTITUDE_SOLVER_CONVERGED, 0, {{0}}, false, 0};
+
+  solver = solver ? solver : &defaults;
+  if (!solar_time || !solar_time->observer || !valid_solver(solver)) {
+    events.status = ALTITUDE_SOLVER_INVALID;
+    return events;
+  }
+
+  const ephemeris_t ephemeris = new_ephemeris(solar_time, altitude);
+  const double transit = solar_time->transit;
+  const double before = evaluate(&ephemeris, transit - 12, NULL);
+  const double noon = evaluate(&ephemeris, transit, NULL);
+  const double after = evaluate(&ephemeris, transit + 12, NULL);
+  events.evaluations = 3;
+
+  if ((before < 0) != (noon < 0)) {
+    altitude_crossing_t crossing =
+        refine(&ephemeris, transit - 12, transit, before,
+               closed_form_guess(solar_time, &ephemeris, false), solver,
+               &events.evaluations);
+    crossing.rising = true;
+    events.crossings[events.count++] = crossing;
+  }
+  if ((noon < 0) != (after < 0)) {
+    altitude_crossing_t crossing =
+        refine(&ephemeris, transit, transit + 12, noon,
+               closed_form_guess(solar_time, &ephemeris, true), solver,
+               &events.evaluations);
+    events.crossings[events.count++] = crossing;
+  }
+
+  for (size_t i = 0; i < events.count; i++) {
+    if (!events.crossings[i].converged) {
+      events.status = ALTITUDE_SOLVER_NOT_CONVERGED;
+    }
+  }
+  if (events.count == 0) {
+    events.status = ALTITUDE_SOLVER_NO_CROSSING;
+    events.above = noon >= 0;
+  }
+  return events;
+}
+
+altitude_solver_status_t altitude_crossing(const solar_time_t *solar_time,
+                                           double altitude, bool after_transit,
+                                           const altitude_solver_t *solver,
+                                           double *time) {
+  const altitude_solver_t defaults = {ALTITUDE_SOLVER_DEFAULT_TOLERANCE,
+                                      ALTITUDE_SOLVER_DEFAULT_MAX_ITERATIONS};
+
+  solver = solver ? solver : &defaults;
+  if (!solar_time || !solar_time->observer || !time ||
+      !valid_solver(solver)) {
+    return ALTITUDE_SOLVER_INVALID;
+  }
+
+  const ephemeris_t ephemeris = new_ephemeris(solar_time, altitude);
+  const double transit = solar_time->transit;
+  const double culmination = after_transit ? transit + 12 : transit - 12;
+  const double noon = evaluate(&ephemeris, transit, NULL);
+  const double other = evaluate(&ephemeris, culmination, NULL);
+  int evaluations = 2;
+
+  if ((noon < 0) == (other < 0)) {
+    return ALTITUDE_SOLVER_NO_CROSSING;
+  }
+
+  const double low = after_transit ? transit : culmination;
+  const double high = after_transit ? culmination : transit;
+  const altitude_crossing_t crossing = refine(
+      &ephemeris, low, high, after_transit ? noon : other,
+      closed_form_guess(solar_time, &ephemeris, after_transit), solver,
+      &evaluations);
+
+  *time = crossing.time;
+  return crossing.converged ? ALTITUDE_SOLVER_CONVERGED
+                            : ALTITUDE_SOLVER_NOT_CONVERGED;
+}
@@ -0,0 +1,89 @@
+#ifndef ADHAN_ALTITUDE_EVENTS_H
+#define ADHAN_ALTITUDE_EVENTS_H
+
+#include "solar_time.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Default tolerance of the solver, in hours (about 0.4 seconds) */
+#define ALTITUDE_SOLVER_DEFAULT_TOLERANCE 1e-4
+
+/** Default iteration budget of the solver, per crossing */
+#define ALTITUDE_SOLVER_DEFAULT_MAX_ITERATIONS 10
+
+typedef enum {
+  ALTITUDE_SOLVER_CONVERGED,     /**< Every crossing is within tolerance */
+  ALTITUDE_SOLVER_NOT_CONVERGED, /**< The iteration budget ran out */
+  ALTITUDE_SOLVER_NO_CROSSING,   /**< The sun stays above or below it */
+  ALTITUDE_SOLVER_INVALID        /**< Invalid arguments */
+} altitude_solver_status_t;
+
+/**
+ * @brief Convergence control of the altitude solver
+ */
+typedef struct {
+  double tolerance;   /**< Maximum error of the crossing times, in hours */
+  int max_iterations; /**< Maximum Newton or bisection steps per crossing */
+} altitude_solver_t;
+
+/**
+ * @brief Time the sun crosses an altitude
+ */
+typedef struct {
+  double time;     /**< Hours after the solar time's instant, like transit */
+  bool rising;     /**< Before transit, with the altitude increasing */
+  bool converged;  /**< Whether the time is within the solver's tolerance */
+  int iterations;  /**< Steps taken after bracketing the crossing */
+} altitude_crossing_t;
+
+/**
+ * @brief Every crossing of an altitude during a solar day
+ */
+typedef struct {
+  altitude_solver_status_t status;
+  size_t count;                     /**< Number of crossings, 0 to 2 */
+  altitude_crossing_t crossings[2]; /**< In time order */
+  bool above; /**< Without crossings, whether the sun stays above */
+  int evaluations; /**< Number of times the altitude was evaluated */
+} altitude_events_t;
+
+/**
+ * @brief Find the times the sun crosses an altitude
+ *
+ * Searches the solar day from the lower culmination before transit to the
+ * one after it, where the altitude increases until transit and decreases
+ * after it. Each crossing found in either half is bracketed, then refined
+ * with Newton steps on the interpolated ephemeris of the solar time, falling
+ * back to bisection whenever a step leaves the bracket. The first step
+ * starts from the closed form hour angle, so a crossing usually takes two
+ * or three evaluations.
+ *
+ * Unlike hour_angle(), which takes a single correction step, the result is
+ * within `solver->tolerance` of the crossing of the interpolated ephemeris
+ * whenever `converged` is set.
+ *
+ * @param altitude Altitude of the sun's center in degrees, such as -0.8333
+ * for sunrise and sunset or -18 for astronomical twilight
+ * @param solver Convergence control, or NULL for the defaults
+ */
+altitude_events_t altitude_events(const solar_time_t *solar_time,
+                                  double altitude,
+                                  const altitude_solver_t *solver);
+
+/**
+ * @brief Find the rising or setting crossing of an altitude
+ *
+ * Same as altitude_events() for the half of the solar day before or after
+ * transit, as a drop in replacement for hour_angle() when the number of
+ * iterations matters more than its single correction step.
+ *
+ * @param[out] time Hours after the solar time's instant. Set to the best
+ * estimate when the solver does not converge, left untouched when there is
+ * no crossing.
+ */
+altitude_solver_status_t altitude_crossing(const solar_time_t *solar_time,
+                                           double altitude, bool after_transit,
+                                           const altitude_solver_t *solver,
+                                           double *time);
+
+#endif /* ADHAN_ALTITUDE_EVENTS_H */
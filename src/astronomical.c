@@ -115,6 +115,15 @@ double altitude_of_celestial_body(double phi, double delta, double H) {
   return to_degrees(safe_asin(term1 + term2));
 }
 
+double azimuth_of_celestial_body(double phi, double delta, double H) {
+  /* Equation from Astronomical Algorithms page 93, which measures the
+   * azimuth westward from the south; returned from the north, eastward. */
+  const double term1 = sin(to_radians(H));
+  const double term2 = cos(to_radians(H)) * sin(to_radians(phi)) -
+                       tan(to_radians(delta)) * cos(to_radians(phi));
+  return unwind_angle(to_degrees(safe_atan2(term1, term2)) + 180.0);
+}
+
 /**
  * Estimates the fractional day (m) of the approximate transit (meridian
  * crossing) of a celestial body.
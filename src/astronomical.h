@@ -36,6 +36,9 @@ double nutation_in_obliquity(double julian_century, double solar_longitude,
 double altitude_of_celestial_body(double observer_latitude, double declination,
                                   double local_hour_angle);
 
+double azimuth_of_celestial_body(double observer_latitude, double declination,
+                                 double local_hour_angle);
+
 double get_approximate_transit(double longitude, double sidereal_time,
                                double right_ascension);
 
@@ -1,21 +1,14 @@
 #include "calculation_parameters.h"
+#include "prayer_rules.h"
 
 night_portions_t new_night_portions(double fajr, double isha) {
   return (night_portions_t){fajr, isha};
 }
 
 night_portions_t get_night_portions(calculation_parameters_t *params) {
-  switch (params->highLatitudeRule) {
-  case MIDDLE_OF_THE_NIGHT:
-    return new_night_portions(0.5, 0.5);
-  case SEVENTH_OF_THE_NIGHT:
-    return new_night_portions(1.0 / 7.0, 1.0 / 7.0);
-  case TWILIGHT_ANGLE:
-    return new_night_portions(params->fajrAngle / 60.0,
-                              params->ishaAngle / 60.0);
-  default:
-    return new_night_portions(0.5, 0.5);
-  }
+  return new_night_portions(
+      night_portion(params->highLatitudeRule, params->fajrAngle),
+      night_portion(params->highLatitudeRule, params->ishaAngle));
 }
 
 calculation_parameters_t getParameters(calculation_method method) {
@@ -22,11 +22,20 @@ double julian_day(int year, int month, int day) {
   return _julian_day(year, month, day, 0.0);
 }
 
+/* Days since 1970-01-01 of the UTC day containing `when` */
+static long epoch_days(const time_t when) {
+  return (long)floor_div((int64_t)when, SECONDS_PER_DAY);
+}
+
 double julian_day_from_time_t(const time_t when) {
-  struct tm *date = gmtime(&when);
-  return _julian_day(date->tm_year + 1900, date->tm_mon + 1, date->tm_mday,
-                     date->tm_hour + date->tm_min / 60.0 +
-                         date->tm_sec / 3600.0);
+  int year, month, day;
+  const long days = epoch_days(when);
+  const int seconds = (int)(when - (time_t)days * SECONDS_PER_DAY);
+
+  civil_from_days(days, &year, &month, &day);
+  return _julian_day(year, month, day,
+                     seconds / 3600 + (seconds / 60 % 60) / 60.0 +
+                         (seconds % 60) / 3600.0);
 }
 
 double julian_century(double JD) {
@@ -34,10 +43,6 @@ double julian_century(double JD) {
   return (JD - 2451545.0) / 36525;
 }
 
-bool is_leap_year(int year) {
-  return year % 4 == 0 && !(year % 100 == 0 && year % 400 != 0);
-}
-
 time_t add_seconds(const time_t when, int amount) { return when + amount; }
 
 time_t add_minutes(const time_t when, int amount) {
@@ -53,14 +58,35 @@ time_t add_days(const time_t when, int amount) {
 }
 
 time_t date_from_time(const time_t time) {
-  struct tm tm_date = *gmtime(&time);
-  tm_date.tm_hour = 0;
-  tm_date.tm_min = 0;
-  tm_date.tm_sec = 0;
-  // Portable UTC time conversion - avoid timegm which isn't available everywhere
-  time_t result = mktime(&tm_date);
-  // mktime assumes local time, so we need to adjust for the difference
-  struct tm *gmt = gmtime(&result);
-  time_t offset = mktime(gmt) - result;
-  return result - offset;
+  return (time_t)epoch_days(time) * SECONDS_PER_DAY;
+}
+
+int day_of_year(const time_t when, int *year) {
+  int day;
+  *year = year_and_day_of_year(epoch_days(when), &day);
+  return day;
+}
+
+/*
+ * Day counting without gmtime()/mktime(). Algorithms from Howard Hinnant,
+ * "chrono-Compatible Low-Level Date Algorithms".
+ */
+long days_from_civil(int year, int month, int day) {
+  const long y = month <= 2 ? year - 1 : year;
+  const long era = (y >= 0 ? y : y - 399) / 400;
+  const long yoe = y - era * 400;
+  const long mp = month > 2 ? month - 3 : month + 9;
+  const long doy = (153 * mp + 2) / 5 + day - 1;
+  const long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+void civil_from_days(long days, int *year, int *month, int *day) {
+  int doy;
+  const long y = march_year_from_days(days, &doy);
+  const long mp = (5 * doy + 2) / 153;
+  const long m = mp < 10 ? mp + 3 : mp - 9;
+  *day = (int)(doy - (153 * mp + 2) / 5 + 1);
+  *month = (int)m;
+  *year = (int)(y + (m <= 2));
 }
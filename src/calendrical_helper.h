@@ -2,19 +2,61 @@
 #define ADHAN_CALENDRICAL_HELPER_H
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <time.h>
 
+#define SECONDS_PER_DAY 86400
+
+// Division rounding towards negative infinity, for a positive divisor
+static inline int64_t floor_div(int64_t value, int64_t divisor) {
+  const int64_t quotient = value / divisor;
+  return (value % divisor < 0) ? quotient - 1 : quotient;
+}
+
 double _julian_day(int year, int month, int day, double hours);
 double julian_day(int year, int month, int day);
 double julian_day_from_time_t(const time_t when);
 double julian_century(double JD);
 
 // CalendarUtil
-bool is_leap_year(int year);
+static inline bool is_leap_year(int year) {
+  return year % 4 == 0 && !(year % 100 == 0 && year % 400 != 0);
+}
+
 time_t add_seconds(const time_t when, int amount);
 time_t add_minutes(const time_t when, int amount);
 time_t add_hours(const time_t when, int amount);
 time_t add_days(const time_t when, int amount);
 time_t date_from_time(const time_t time);
 
+// Year that starts on March 1 and day in it in [0, 365] of days since
+// 1970-01-01, from Howard Hinnant, "chrono-Compatible Low-Level Date
+// Algorithms". Inline for the minimal profile, which does not link the rest.
+static inline long march_year_from_days(long days, int *march_day) {
+  days += 719468;
+  const long era = (days >= 0 ? days : days - 146096) / 146097;
+  const long doe = days - era * 146097;
+  const long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  *march_day = (int)(doe - (365 * yoe + yoe / 4 - yoe / 100));
+  return yoe + era * 400;
+}
+
+// Year and day of the year in [1, 366] of days since 1970-01-01
+static inline int year_and_day_of_year(long days, int *day_of_year) {
+  int march_day;
+  const int year =
+      (int)(march_year_from_days(days, &march_day) + (march_day >= 306));
+  // March 1 is day 60, or 61 in a leap year
+  *day_of_year = march_day >= 306 ? march_day - 305
+                                  : march_day + 60 + is_leap_year(year);
+  return year;
+}
+
+// Day of the year in [1, 366] of the UTC date of `when`, and its year
+int day_of_year(const time_t when, int *year);
+
+// Proleptic Gregorian dates as days since 1970-01-01
+long days_from_civil(int year, int month, int day);
+void civil_from_days(long days, int *year, int *month, int *day);
+
 #endif // ADHAN_CALENDRICAL_HELPER_H
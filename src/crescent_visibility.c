@@ -0,0 +1,382 @@
+#include "crescent_visibility.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+#include "lunar_coordinates.h"
+#include "solar_time.h"
+#include "sun_position.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef ADHAN_THREADS
+#include <pthread.h>
+#endif
+
+#define SYNODIC_MONTH 29.530588861
+
+/* Hourly lunar ephemeris from 12 hours before the UTC day to the end of the
+ * next one, which covers the sunsets and moonsets of every longitude */
+#define FIRST_HOUR (-12)
+#define HOURS 61
+
+/* Sunset altitude of the prayer times */
+#define SUNSET_ALTITUDE (-50.0 / 60.0)
+
+/* Mean hourly motion of the moon's hour angle, degrees */
+#define MOON_HOUR_ANGLE_RATE ((360.985647 - 13.176358) / 24)
+
+/* Special zone of a cell, 0 when the criterion applies */
+#define NO_SPECIAL_ZONE 0
+
+/* What every cell of an evening shares: times are in hours after the start
+ * of the UTC day, in UT */
+typedef struct {
+  time_t start;
+  double newMoon;
+  solar_coordinates_t prevSolar;
+  solar_coordinates_t solar;
+  solar_coordinates_t nextSolar;
+  double rightAscensions[HOURS];
+  double declinations[HOURS];
+  double distances[HOURS];
+} evening_t;
+
+typedef struct {
+  double rightAscension;
+  double declination;
+  double distance;
+} moon_t;
+
+/* Geometry of the crescent of a cell, times in hours like evening_t */
+typedef struct {
+  double sunset;
+  double moonset; /* NaN when the moon does not set after sunset */
+  double bestTime;
+  double arcl;
+  double arcv;
+  double topocentricArcv;
+  double daz;
+  double width;
+  uint8_t zone; /* Special zone, or NO_SPECIAL_ZONE */
+} crescent_cell_t;
+
+static void new_evening(time_t date, evening_t *evening) {
+  const time_t start =
+      (time_t)floor_div((int64_t)date, SECONDS_PER_DAY) * SECONDS_PER_DAY;
+  const double jd = julian_day_from_time_t(start);
+  const double dt = delta_t(2000 + (jd - 2451545) / 365.25) / SECONDS_PER_DAY;
+  const double k = round((jd + 0.5 - 2451550.09766) / SYNODIC_MONTH);
+
+  evening->start = start;
+  evening->newMoon = (new_moon_julian_ephemeris_day(k) - dt - jd) * 24;
+  /* The same coordinates as new_solar_time(), for the same sunset */
+  evening->solar = new_solar_coordinates(jd);
+  evening->prevSolar =
+      new_solar_coordinates(julian_day_from_time_t(add_days(start, -1)));
+  evening->nextSolar =
+      new_solar_coordinates(julian_day_from_time_t(add_days(start, 1)));
+  for (int i = 0; i < HOURS; i++) {
+    const lunar_coordinates_t moon =
+        new_lunar_coordinates(jd + dt + (FIRST_HOUR + i) / 24.0);
+    evening->rightAscensions[i] = moon.rightAscension;
+    evening->declinations[i] = moon.declination;
+    evening->distances[i] = moon.distance;
+  }
+}
+
+/* Quadratic interpolation around the nearest hour of the ephemeris */
+static moon_t moon_at(const evening_t *evening, double hours) {
+  long i = lround(hours) - FIRST_HOUR;
+  i = i < 1 ? 1 : (i > HOURS - 2 ? HOURS - 2 : i);
+  const double n = hours - (double)(i + FIRST_HOUR);
+
+  return (moon_t){
+      unwind_angle(interpolate_angles(evening->rightAscensions[i],
+                                      evening->rightAscensions[i - 1],
+                                      evening->rightAscensions[i + 1], n)),
+      interpolate_value(evening->declinations[i], evening->declinations[i - 1],
+                        evening->declinations[i + 1], n),
+      interpolate_value(evening->distances[i], evening->distances[i - 1],
+                        evening->distances[i + 1], n)};
+}
+
+static double moon_hour_angle(const evening_t *evening,
+                              const coordinates_t *observer,
+                              const moon_t *moon, double hours) {
+  return closest_angle(evening->solar.apparentSiderealTime +
+                       360.985647 * hours / 24 + observer->longitude -
+                       moon->rightAscension);
+}
+
+/* Cosine of the hour angle of a body at `altitude`, beyond [-1, 1] when it
+ * stays above or below it */
+static double cos_hour_angle(double latitude, double declination,
+                             double altitude) {
+  const double phi = to_radians(latitude);
+  const double delta = to_radians(declination);
+  return (sin(to_radians(altitude)) - sin(phi) * sin(delta)) /
+         (cos(phi) * cos(delta));
+}
+
+/* Horizontal parallax of the moon, degrees */
+static double moon_parallax(const moon_t *moon) {
+  return to_degrees(asin(6378.14 / moon->distance));
+}
+
+/* Astronomical Algorithms page 102, h0 for the moon */
+static double moonset_altitude(const moon_t *moon) {
+  return 0.7275 * moon_parallax(moon) - 0.5667;
+}
+
+static crescent_cell_t crescent_cell(const evening_t *evening,
+                                     coordinates_t *observer) {
+  crescent_cell_t cell = {NAN, NAN, NAN, 0, 0, 0, 0, 0, NO_SPECIAL_ZONE};
+
+  if (fabs(cos_hour_angle(observer->latitude, evening->solar.declination,
+                          SUNSET_ALTITUDE)) > 1) {
+    cell.zone = CRESCENT_NO_SUNSET;
+    return cell;
+  }
+  solar_time_t solar_time =
+      solar_time_from_coordinates(observer, &evening->prevSolar,
+                                  &evening->solar, &evening->nextSolar);
+  cell.sunset = solar_time.sunset;
+  if (cell.sunset <= evening->newMoon) {
+    cell.zone = CRESCENT_BEFORE_CONJUNCTION;
+    return cell;
+  }
+
+  /* Moonset from the moon's hour angle at sunset, refined twice */
+  moon_t moon = moon_at(evening, cell.sunset);
+  double cosH0 = cos_hour_angle(observer->latitude, moon.declination,
+                                moonset_altitude(&moon));
+  double H = moon_hour_angle(evening, observer, &moon, cell.sunset);
+  if (cosH0 > 1 || (cosH0 >= -1 && fabs(H) >= to_degrees(acos(cosH0)))) {
+    cell.zone = CRESCENT_MOON_SETS_FIRST;
+    return cell;
+  }
+  if (cosH0 >= -1) {
+    double moonset =
+        cell.sunset + (to_degrees(acos(cosH0)) - H) / MOON_HOUR_ANGLE_RATE;
+    for (int i = 0; i < 2; i++) {
+      moon = moon_at(evening, moonset);
+      cosH0 = cos_hour_angle(observer->latitude, moon.declination,
+                             moonset_altitude(&moon));
+      H = moon_hour_angle(evening, observer, &moon, moonset);
+      moonset += closest_angle(to_degrees(safe_acos(cosH0)) - H) /
+                 MOON_HOUR_ANGLE_RATE;
+    }
+    cell.moonset = moonset;
+  }
+  /* A moon that does not set is judged at sunset */
+  cell.bestTime = isnan(cell.moonset)
+                      ? cell.sunset
+                      : cell.sunset + 4.0 / 9.0 * (cell.moonset - cell.sunset);
+
+  /* Yallop's geometry at the best time, from airless geocentric altitudes */
+  const sun_position_t sun =
+      solar_time_sun_position(&solar_time, cell.bestTime);
+  moon = moon_at(evening, cell.bestTime);
+  H = moon_hour_angle(evening, observer, &moon, cell.bestTime);
+  const double h =
+      altitude_of_celestial_body(observer->latitude, moon.declination, H);
+  const double azimuth =
+      azimuth_of_celestial_body(observer->latitude, moon.declination, H);
+  const double parallax = moon_parallax(&moon);
+
+  cell.arcv = h - sun.altitude;
+  cell.daz = closest_angle(sun.azimuth - azimuth);
+  cell.arcl = to_degrees(safe_acos(
+      sin(to_radians(h)) * sin(to_radians(sun.altitude)) +
+      cos(to_radians(h)) * cos(to_radians(sun.altitude)) *
+          cos(to_radians(cell.daz))));
+  cell.topocentricArcv = cell.arcv - parallax * cos(to_radians(h));
+
+  /* Topocentric semi-diameter and width, arcminutes */
+  const double semiDiameter = 0.27245 * parallax * 60 *
+                              (1 + sin(to_radians(h)) *
+                                       sin(to_radians(parallax)));
+  cell.width = semiDiameter * (1 - cos(to_radians(cell.arcl)));
+  return cell;
+}
+
+/* Yallop's and Odeh's fit of the ARCV of first sightings against the
+ * width, which only differ by their constant */
+static inline double crescent_value(crescent_criterion_t criterion,
+                                    double arcv, double width) {
+  const double fit =
+      width * (-6.3226 + width * (0.7319 - 0.1018 * width));
+  return criterion == CRESCENT_ODEH ? arcv - (7.1651 + fit)
+                                    : (arcv - (11.8371 + fit)) / 10;
+}
+
+static inline uint8_t crescent_zone(crescent_criterion_t criterion,
+                                    double value) {
+  if (criterion == CRESCENT_ODEH) {
+    return (uint8_t)((value < 5.65) + (value < 2.0) + (value < -0.96));
+  }
+  return (uint8_t)((value <= 0.216) + (value <= -0.014) +
+                   (value <= -0.160) + (value <= -0.232) +
+                   (value <= -0.293));
+}
+
+bool crescent_visibility(const coordinates_t *coordinates, time_t date,
+                         crescent_criterion_t criterion,
+                         crescent_visibility_t *visibility) {
+  coordinates_t observer;
+  if (!coordinates || !visibility ||
+      !init_coordinates(&observer, coordinates->latitude,
+                        coordinates->longitude)) {
+    return false;
+  }
+
+  evening_t evening;
+  new_evening(date, &evening);
+  const crescent_cell_t cell = crescent_cell(&evening, &observer);
+
+  memset(visibility, 0, sizeof(*visibility));
+  if (isfinite(cell.sunset)) {
+    visibility->sunset = evening.start + (time_t)lround(cell.sunset * 60) * 60;
+  }
+  if (cell.zone != NO_SPECIAL_ZONE) {
+    visibility->zone = (crescent_zone_t)cell.zone;
+    return true;
+  }
+  if (isfinite(cell.moonset)) {
+    visibility->moonset =
+        evening.start + (time_t)lround(cell.moonset * 60) * 60;
+  }
+  visibility->bestTime =
+      evening.start + (time_t)lround(cell.bestTime * 60) * 60;
+  visibility->age = cell.bestTime - evening.newMoon;
+  visibility->arcl = cell.arcl;
+  visibility->arcv = cell.arcv;
+  visibility->daz = cell.daz;
+  visibility->width = cell.width;
+  visibility->value = crescent_value(
+      criterion, criterion == CRESCENT_ODEH ? cell.topocentricArcv : cell.arcv,
+      cell.width);
+  visibility->zone = (crescent_zone_t)crescent_zone(criterion,
+                                                    visibility->value);
+  return true;
+}
+
+typedef struct {
+  const evening_t *evening;
+  const crescent_grid_t *grid;
+  crescent_criterion_t criterion;
+  unsigned first_row;
+  unsigned row_step;
+  float *values;
+  uint8_t *zones;
+  bool ok;
+} raster_job_t;
+
+/* Rows first_row, first_row + row_step, ... of a raster. The geometry of a
+ * row goes to arrays, then the criterion runs over them without branches so
+ * that the compiler can vectorize it. */
+static void *raster_rows(void *argument) {
+  raster_job_t *job = argument;
+  const crescent_grid_t *grid = job->grid;
+  const size_t columns = grid->longitudes;
+  double *arcv = malloc(columns * sizeof(*arcv));
+  double *width = malloc(columns * sizeof(*width));
+  uint8_t *special = malloc(columns);
+
+  job->ok = arcv && width && special;
+  for (unsigned row = job->first_row; job->ok && row < grid->latitudes;
+       row += job->row_step) {
+    const size_t offset = (size_t)row * columns;
+    for (size_t column = 0; column < columns; column++) {
+      coordinates_t observer = {
+          grid->first_latitude + row * grid->step,
+          grid->first_longitude + (double)column * grid->step};
+      const crescent_cell_t cell = crescent_cell(job->evening, &observer);
+      arcv[column] = job->criterion == CRESCENT_ODEH ? cell.topocentricArcv
+                                                     : cell.arcv;
+      width[column] = cell.width;
+      special[column] = cell.zone;
+    }
+    for (size_t column = 0; column < columns; column++) {
+      const double value =
+          crescent_value(job->criterion, arcv[column], width[column]);
+      const uint8_t zone = crescent_zone(job->criterion, value);
+      if (job->values) {
+        job->values[offset + column] =
+            special[column] ? NAN : (float)value;
+      }
+      if (job->zones) {
+        job->zones[offset + column] = special[column] ? special[column] : zone;
+      }
+    }
+  }
+  free(special);
+  free(width);
+  free(arcv);
+  return NULL;
+}
+
+bool crescent_visibility_raster(time_t date, const crescent_grid_t *grid,
+                                crescent_criterion_t criterion,
+                                unsigned threads, float *values,
+                                uint8_t *zones) {
+  if (!grid || !(grid->step > 0) || grid->latitudes == 0 ||
+      grid->longitudes == 0 || grid->first_latitude < -90 ||
+      grid->first_latitude + (grid->latitudes - 1) * grid->step > 90 ||
+      grid->first_longitude < -180 ||
+      grid->first_longitude + (grid->longitudes - 1) * grid->step > 180) {
+    return false;
+  }
+
+  evening_t evening;
+  new_evening(date, &evening);
+  raster_job_t job = {&evening, grid, criterion, 0, 1, values, zones, false};
+
+#ifdef ADHAN_THREADS
+  if (threads > grid->latitudes) {
+    threads = grid->latitudes;
+  }
+  if (threads > 1) {
+    pthread_t *ids = malloc((threads - 1) * sizeof(*ids));
+    raster_job_t *jobs = malloc(threads * sizeof(*jobs));
+    unsigned started = 0;
+    bool ok = ids && jobs;
+
+    /* Interleaved rows, since the polar rows are cheaper */
+    for (unsigned i = 0; ok && i < threads; i++) {
+      jobs[i] = job;
+      jobs[i].first_row = i;
+      jobs[i].row_step = threads;
+    }
+    while (ok && started < threads - 1) {
+      ok = pthread_create(&ids[started], NULL, raster_rows,
+                          &jobs[started + 1]) == 0;
+      started += ok;
+    }
+    if (ok) {
+      raster_rows(&jobs[0]);
+    }
+    for (unsigned i = 0; i < started; i++) {
+      pthread_join(ids[i], NULL);
+    }
+    for (unsigned i = 0; ok && i < threads; i++) {
+      ok = jobs[i].ok;
+    }
+    free(jobs);
+    free(ids);
+    return ok;
+  }
+#else
+  (void)threads;
+#endif
+  raster_rows(&job);
+  return job.ok;
+}
+
+bool crescent_visibility_threads_enabled(void) {
+#ifdef ADHAN_THREADS
+  return true;
+#else
+  return false;
+#endif
+}
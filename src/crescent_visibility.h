@@ -0,0 +1,107 @@
+#ifndef ADHAN_CRESCENT_VISIBILITY_H
+#define ADHAN_CRESCENT_VISIBILITY_H
+
+#include "coordinates.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * @brief Criteria of new crescent visibility
+ */
+typedef enum {
+  CRESCENT_YALLOP, /**< Yallop (1997) q test, geocentric ARCV */
+  CRESCENT_ODEH    /**< Odeh (2004) V test, topocentric ARCV */
+} crescent_criterion_t;
+
+/**
+ * @brief Zones of the criteria, from the best visibility
+ *
+ * Yallop uses A to F: easily visible, visible under perfect conditions, may
+ * need optical aid to find the crescent, needs optical aid, not visible
+ * with a telescope, below the Danjon limit. Odeh uses A to D: visible by
+ * naked eye, visible by optical aid and could be seen by naked eye, visible
+ * by optical aid only, not visible.
+ *
+ * The last zones apply to both criteria and have no value.
+ */
+typedef enum {
+  CRESCENT_ZONE_A,
+  CRESCENT_ZONE_B,
+  CRESCENT_ZONE_C,
+  CRESCENT_ZONE_D,
+  CRESCENT_ZONE_E,
+  CRESCENT_ZONE_F,
+  CRESCENT_NO_SUNSET,          /**< The sun does not set on that day */
+  CRESCENT_BEFORE_CONJUNCTION, /**< Sunset before the new moon */
+  CRESCENT_MOON_SETS_FIRST     /**< The moon is not up at sunset */
+} crescent_zone_t;
+
+/**
+ * @brief Crescent of the evening of a location
+ *
+ * The geometry is evaluated at Yallop's best time, four ninths of the lag
+ * after sunset, from airless positions of the centers of the sun and moon.
+ * Fields that do not apply to the zone are 0.
+ */
+typedef struct {
+  time_t sunset;   /**< Same sunset as the prayer times */
+  time_t moonset;  /**< 0 when the moon does not set after sunset */
+  time_t bestTime; /**< Sunset plus 4/9 of the lag */
+  double age;      /**< Hours since the new moon at the best time */
+  double arcl;     /**< Geocentric sun-moon elongation, degrees */
+  double arcv;     /**< Geocentric moon minus sun altitude, degrees */
+  double daz;      /**< Sun minus moon azimuth, degrees */
+  double width;    /**< Topocentric crescent width, arcminutes */
+  double value;    /**< q for Yallop, V for Odeh */
+  crescent_zone_t zone;
+} crescent_visibility_t;
+
+/**
+ * @brief Crescent visibility on the evening of the UTC day of `date`
+ *
+ * The sunset is the one of new_prayer_times() on `date`, and the new moon
+ * is the one nearest that day, so evenings before it are
+ * CRESCENT_BEFORE_CONJUNCTION.
+ *
+ * @return false when `coordinates` is invalid
+ */
+bool crescent_visibility(const coordinates_t *coordinates, time_t date,
+                         crescent_criterion_t criterion,
+                         crescent_visibility_t *visibility);
+
+/**
+ * @brief Latitude/longitude grid of a visibility map
+ */
+typedef struct {
+  double first_latitude;  /**< Southernmost row, degrees */
+  double first_longitude; /**< Westernmost column, degrees */
+  double step;            /**< Degrees between rows and between columns */
+  unsigned latitudes;     /**< Rows */
+  unsigned longitudes;    /**< Columns */
+} crescent_grid_t;
+
+/**
+ * @brief Crescent visibility map of an evening
+ *
+ * Same results as crescent_visibility() for every cell, from one lunar
+ * ephemeris of the evening that all cells interpolate. Rows are computed by
+ * `threads` threads when the library is built with ADHAN_THREADS, and by
+ * the calling thread otherwise or when `threads` is 0 or 1.
+ *
+ * @param[out] values latitudes * longitudes values, row by row from the
+ * first latitude, NaN when the zone has no value; may be NULL
+ * @param[out] zones Zones of the cells in the same order; may be NULL
+ * @return false when the grid is invalid or a thread cannot be started
+ */
+bool crescent_visibility_raster(time_t date, const crescent_grid_t *grid,
+                                crescent_criterion_t criterion,
+                                unsigned threads, float *values,
+                                uint8_t *zones);
+
+/**
+ * @brief Whether the library was built with ADHAN_THREADS
+ */
+bool crescent_visibility_threads_enabled(void);
+
+#endif /* ADHAN_CRESCENT_VISIBILITY_H */
@@ -0,0 +1,85 @@
+#include "extended_times.h"
+#include <math.h>
+
+extended_parameters_t default_extended_parameters(void) {
+  return (extended_parameters_t){4.0, 15.0, 10};
+}
+
+/* Nearest minute of `hours` after the start of the UTC day, 0 if invalid */
+static time_t time_from_hours(double hours, const prayer_day_t *date) {
+  if (!isfinite(hours) || date->start == 0) {
+    return 0;
+  }
+  return date->start + (time_t)lround(hours * 60) * 60;
+}
+
+/* Morning time of the sun at `altitude`, halfway between `previous` and the
+ * transit when the sun does not reach it */
+static double morning_altitude(solar_time_t *solar_time, double altitude,
+                               double previous) {
+  const double highest =
+      90 - fabs(solar_time->observer->latitude -
+                solar_time->solar.declination);
+  if (altitude > highest) {
+    return (previous + solar_time->transit) / 2;
+  }
+  return hour_angle(solar_time, altitude, /* afterTransit */ false);
+}
+
+extended_times_t extended_times_from_solar_time(
+    solar_time_t *solar_time, const prayer_day_t *date,
+    const calculation_parameters_t *parameters, const prayer_times_t *times,
+    const extended_parameters_t *extended) {
+  const extended_times_t null_times = {0, 0, 0, 0};
+  if (!solar_time || !date || !parameters || !times || !extended ||
+      times->fajr == 0) {
+    return null_times;
+  }
+
+  const double ishraq = morning_altitude(solar_time, extended->ishraqAltitude,
+                                         solar_time->sunrise);
+  const double duha =
+      morning_altitude(solar_time, extended->duhaAltitude, ishraq);
+  /* The midnight before its adjustment halves the night from Maghrib to
+   * the next Fajr */
+  const time_t midnight =
+      times->midnight - (time_t)parameters->adjustments.midnight * 60;
+  const double night = 2 * difftime(midnight, times->maghrib);
+  const double last_third = (double)times->maghrib + night * 2 / 3;
+
+  extended_times_t extended_times = {
+      time_from_hours(ishraq, date), time_from_hours(duha, date),
+      time_from_hours(solar_time->transit, date) -
+          (time_t)extended->duhaEndMinutes * 60,
+      (time_t)lround(last_third / 60) * 60};
+  if (!extended_times.ishraq || !extended_times.duha) {
+    return null_times;
+  }
+  return extended_times;
+}
+
+extended_times_t new_extended_times(coordinates_t *coordinates, time_t date,
+                                    calculation_parameters_t *parameters,
+                                    const extended_parameters_t *extended,
+                                    prayer_times_t *times) {
+  const extended_times_t null_times = {0, 0, 0, 0};
+  const prayer_times_t null_prayer_times = NULL_PRAYER_TIMES;
+  if (times) {
+    *times = null_prayer_times;
+  }
+  if (!coordinates || !parameters || !extended) {
+    return null_times;
+  }
+
+  const prayer_day_t day = new_prayer_day(date);
+  const prayer_day_t tomorrow_date = new_prayer_day(add_days(date, 1));
+  solar_time_t solar_time = new_solar_time(date, coordinates);
+  solar_time_t tomorrow = new_solar_time(tomorrow_date.date, coordinates);
+  const prayer_times_t prayer_times = prayer_times_from_prayer_day(
+      coordinates, &day, parameters, &solar_time, &tomorrow_date, &tomorrow);
+  if (times) {
+    *times = prayer_times;
+  }
+  return extended_times_from_solar_time(&solar_time, &day, parameters,
+                                        &prayer_times, extended);
+}
@@ -0,0 +1,68 @@
+#ifndef ADHAN_EXTENDED_TIMES_H
+#define ADHAN_EXTENDED_TIMES_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include "prayer_times.h"
+#include "solar_time.h"
+#include <time.h>
+
+/**
+ * @brief Voluntary prayer times derived from the day of the prayer times
+ *
+ * All times are 0 when the prayer times of the day are NULL_PRAYER_TIMES.
+ */
+typedef struct {
+  time_t ishraq;    /**< Sun at ishraqAltitude after sunrise */
+  time_t duha;      /**< Sun at duhaAltitude in the morning */
+  time_t duhaEnd;   /**< duhaEndMinutes before the transit (zawal) */
+  time_t lastThird; /**< Start of the last third of the night (Tahajjud) */
+} extended_times_t;
+
+/**
+ * @brief Definitions of the extended times
+ */
+typedef struct {
+  double ishraqAltitude; /**< Altitude of the sun at Ishraq, degrees */
+  double duhaAltitude;   /**< Altitude of the sun at Duha, degrees */
+  int duhaEndMinutes;    /**< Minutes before the transit that end Duha */
+} extended_parameters_t;
+
+/**
+ * @brief Ishraq at 4 degrees, about 20 minutes after sunrise at moderate
+ * latitudes, Duha at 15 degrees and its end 10 minutes before the transit
+ */
+extended_parameters_t default_extended_parameters(void);
+
+/**
+ * @brief Extended times of the day of `solar_time` and `times`
+ *
+ * Ishraq and Duha come from hour_angle() on the same solar time as the
+ * prayer times, so they cost two hour angles. When the sun does not reach
+ * one of their altitudes, the time is halfway between the previous event
+ * (sunrise, then Ishraq) and the transit. The last third of the night
+ * starts two thirds of the way from Maghrib to the next Fajr, using the
+ * night that the midnight of `times` halves before its adjustment, so the
+ * midnight adjustment does not move it. Times are rounded to the minute
+ * like the prayer times.
+ *
+ * @param parameters Parameters `times` were computed with
+ * @param times Prayer times computed from `solar_time` and `date`
+ */
+extended_times_t extended_times_from_solar_time(
+    solar_time_t *solar_time, const prayer_day_t *date,
+    const calculation_parameters_t *parameters, const prayer_times_t *times,
+    const extended_parameters_t *extended);
+
+/**
+ * @brief Prayer times and extended times of a day
+ *
+ * Same prayer times as new_prayer_times(), written to `times` when it is not
+ * NULL, with the extended times from the same solar time.
+ */
+extended_times_t new_extended_times(coordinates_t *coordinates, time_t date,
+                                    calculation_parameters_t *parameters,
+                                    const extended_parameters_t *extended,
+                                    prayer_times_t *times);
+
+#endif /* ADHAN_EXTENDED_TIMES_H */
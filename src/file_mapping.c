@@ -0,0 +1,76 @@
+#if defined(__unix__) || defined(__APPLE__)
+/* mmap() with the C17 standard library */
+#define _POSIX_C_SOURCE 200809L
+#define FILE_MAPPING_MMAP
+#endif
+
+#include "file_mapping.h"
+#include <stdio.h>
+#include <stdlib.h>
+#ifdef FILE_MAPPING_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool file_mapping_open(const char *path, bool sequential,
+                       file_mapping_t *file) {
+  if (!path || !file) {
+    return false;
+  }
+  *file = (file_mapping_t){"", 0, NULL};
+#ifdef FILE_MAPPING_MMAP
+  const int descriptor = open(path, O_RDONLY);
+  struct stat status;
+  if (descriptor < 0) {
+    return false;
+  }
+  bool ok = fstat(descriptor, &status) == 0;
+  if (ok && status.st_size > 0) {
+    void *mapping = mmap(NULL, (size_t)status.st_size, PROT_READ,
+                         MAP_PRIVATE, descriptor, 0);
+    ok = mapping != MAP_FAILED;
+    if (ok) {
+      posix_madvise(mapping, (size_t)status.st_size,
+                    sequential ? POSIX_MADV_SEQUENTIAL : POSIX_MADV_RANDOM);
+      *file = (file_mapping_t){mapping, (size_t)status.st_size, mapping};
+    }
+  }
+  close(descriptor);
+  return ok;
+#else
+  (void)sequential;
+  FILE *stream = fopen(path, "rb");
+  long size = -1;
+  if (stream && fseek(stream, 0, SEEK_END) == 0) {
+    size = ftell(stream);
+  }
+  char *buffer = size >= 0 ? malloc((size_t)size + 1) : NULL;
+  bool ok = buffer && fseek(stream, 0, SEEK_SET) == 0 &&
+            fread(buffer, 1, (size_t)size, stream) == (size_t)size;
+  if (stream) {
+    fclose(stream);
+  }
+  if (!ok) {
+    free(buffer);
+    return false;
+  }
+  *file = (file_mapping_t){buffer, (size_t)size, buffer};
+  return true;
+#endif
+}
+
+void file_mapping_close(file_mapping_t *file) {
+  if (!file) {
+    return;
+  }
+#ifdef FILE_MAPPING_MMAP
+  if (file->mapping) {
+    munmap(file->mapping, file->size);
+  }
+#else
+  free(file->mapping);
+#endif
+  *file = (file_mapping_t){"", 0, NULL};
+}
@@ -0,0 +1,28 @@
+#ifndef ADHAN_FILE_MAPPING_H
+#define ADHAN_FILE_MAPPING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief File mapped into memory, or read on systems without mmap
+ */
+typedef struct {
+  const char *data;
+  size_t size;
+  void *mapping; /**< What file_mapping_close() releases */
+} file_mapping_t;
+
+/**
+ * @brief Map a file read only
+ *
+ * @param sequential Whether the file is read from start to end, which
+ * lets the system read ahead; false for lookups anywhere in it
+ * @return false when the file cannot be read
+ */
+bool file_mapping_open(const char *path, bool sequential,
+                       file_mapping_t *file);
+
+void file_mapping_close(file_mapping_t *file);
+
+#endif /* ADHAN_FILE_MAPPING_H */
@@ -19,7 +19,24 @@ typedef enum {
    * Similar to {@link HighLatitudeRule#SEVENTH_OF_THE_NIGHT}, but instead of
    * 1/7th, the faction of the night used is fajrAngle / 60 and ishaAngle/60.
    */
-  TWILIGHT_ANGLE
+  TWILIGHT_ANGLE,
+
+  /**
+   * When the sun does not reach an angle, such as during the polar day or
+   * night, use the time of day of the closest date when it does, and the
+   * length of the twilight of that date for Fajr and Isha. Otherwise like
+   * MIDDLE_OF_THE_NIGHT. Close to the poles, where the closest date is
+   * around an equinox, prefer NEAREST_LATITUDE.
+   */
+  NEAREST_DAY,
+
+  /**
+   * When the sun does not reach an angle, use the time of day it does at the
+   * closest latitude where it does all year, such as 48.5 degrees for an 18
+   * degree twilight or about 65.7 degrees for sunrise, and the length of the
+   * twilight there for Fajr and Isha. Otherwise like MIDDLE_OF_THE_NIGHT.
+   */
+  NEAREST_LATITUDE
 } high_latitude_rule_t;
 
 static inline const char *
@@ -31,6 +48,10 @@ get_high_latitude_rule_name(high_latitude_rule_t high_latitude_rule) {
     return (const char *)"Seventh of the night";
   case TWILIGHT_ANGLE:
     return (const char *)"Twilight angle";
+  case NEAREST_DAY:
+    return (const char *)"Nearest day";
+  case NEAREST_LATITUDE:
+    return (const char *)"Nearest latitude";
   default:
     return (const char *)"Unknow rule";
   }
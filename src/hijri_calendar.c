@@ -0,0 +1,133 @@
+#include "hijri_calendar.h"
+#include "calendrical_helper.h"
+#include <stdint.h>
+
+/* Defined in the generated umm_al_qura_table.c */
+extern const int umm_al_qura_first_year;
+extern const int umm_al_qura_last_year;
+extern const long umm_al_qura_epoch;
+extern const uint16_t umm_al_qura_month_starts[];
+
+/* 1 Muharram 1 AH of the arithmetical calendar (16 July 622, Julian), in days
+ * since 1970-01-01 */
+#define TABULAR_EPOCH (-492148L)
+
+static int table_months(void) {
+  return (umm_al_qura_last_year - umm_al_qura_first_year + 1) * 12;
+}
+
+static long table_month_start(int index) {
+  return umm_al_qura_epoch + umm_al_qura_month_starts[index];
+}
+
+/*
+ * Arithmetical Islamic calendar with leap years 2, 5, 7, 10, 13, 16, 18, 21,
+ * 24, 26 and 29 of each 30 year cycle.
+ */
+static long tabular_days_from_hijri(int year, int month, int day) {
+  return TABULAR_EPOCH + (long)(year - 1) * 354 +
+         floor_div(3 + 11L * year, 30) + (59L * (month - 1) + 1) / 2 + day -
+         1;
+}
+
+static hijri_date_t tabular_hijri_from_days(long days) {
+  hijri_date_t hijri;
+  hijri.year = (int)floor_div(30 * (days - TABULAR_EPOCH) + 10646, 10631);
+  hijri.month = 12;
+  while (hijri.month > 1 &&
+         tabular_days_from_hijri(hijri.year, hijri.month, 1) > days) {
+    hijri.month--;
+  }
+  hijri.day = (int)(days - tabular_days_from_hijri(hijri.year, hijri.month,
+                                                   1)) +
+              1;
+  return hijri;
+}
+
+bool is_umm_al_qura_year(int year) {
+  return year >= umm_al_qura_first_year && year <= umm_al_qura_last_year;
+}
+
+int hijri_month_length(int year, int month) {
+  if (month < 1 || month > 12) {
+    return 0;
+  }
+  if (is_umm_al_qura_year(year)) {
+    const int index = (year - umm_al_qura_first_year) * 12 + month - 1;
+    return (int)(umm_al_qura_month_starts[index + 1] -
+                 umm_al_qura_month_starts[index]);
+  }
+  const int next_year = month == 12 ? year + 1 : year;
+  const int next_month = month == 12 ? 1 : month + 1;
+  return (int)(tabular_days_from_hijri(next_year, next_month, 1) -
+               tabular_days_from_hijri(year, month, 1));
+}
+
+hijri_date_t hijri_from_days(long days) {
+  const int months = table_months();
+  if (days < umm_al_qura_epoch || days >= table_month_start(months)) {
+    return tabular_hijri_from_days(days);
+  }
+
+  /* Estimate the month from the mean synodic month, then correct the
+   * estimate which is never more than one month off. */
+  int index = (int)((days - umm_al_qura_epoch) / 29.530588853);
+  if (index >= months) {
+    index = months - 1;
+  }
+  while (index > 0 && table_month_start(index) > days) {
+    index--;
+  }
+  while (index + 1 < months && table_month_start(index + 1) <= days) {
+    index++;
+  }
+
+  return (hijri_date_t){umm_al_qura_first_year + index / 12, index % 12 + 1,
+                        (int)(days - table_month_start(index)) + 1};
+}
+
+long days_from_hijri(const hijri_date_t *hijri) {
+  if (is_umm_al_qura_year(hijri->year)) {
+    const int index =
+        (hijri->year - umm_al_qura_first_year) * 12 + hijri->month - 1;
+    return table_month_start(index) + hijri->day - 1;
+  }
+  return tabular_days_from_hijri(hijri->year, hijri->month, hijri->day);
+}
+
+bool hijri_from_gregorian(int year, int month, int day, hijri_date_t *hijri) {
+  if (!hijri || month < 1 || month > 12 || day < 1 || day > 31) {
+    return false;
+  }
+  *hijri = hijri_from_days(days_from_civil(year, month, day));
+  return true;
+}
+
+bool gregorian_from_hijri(const hijri_date_t *hijri, int *year, int *month,
+                          int *day) {
+  if (!hijri || !year || !month || !day || hijri->month < 1 ||
+      hijri->month > 12 || hijri->day < 1 ||
+      hijri->day > hijri_month_length(hijri->year, hijri->month)) {
+    return false;
+  }
+  civil_from_days(days_from_hijri(hijri), year, month, day);
+  return true;
+}
+
+hijri_date_t hijri_date_from_time(time_t when) {
+  return hijri_from_days(floor_div((int64_t)when, SECONDS_PER_DAY));
+}
+
+hijri_date_t next_hijri_day(hijri_date_t hijri) {
+  if (hijri.day < hijri_month_length(hijri.year, hijri.month)) {
+    hijri.day++;
+  } else if (hijri.month < 12) {
+    hijri.month++;
+    hijri.day = 1;
+  } else {
+    hijri.year++;
+    hijri.month = 1;
+    hijri.day = 1;
+  }
+  return hijri;
+}
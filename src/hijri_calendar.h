@@ -0,0 +1,78 @@
+#ifndef ADHAN_HIJRI_CALENDAR_H
+#define ADHAN_HIJRI_CALENDAR_H
+
+#include <stdbool.h>
+#include <time.h>
+
+typedef enum {
+  MUHARRAM = 1,
+  SAFAR = 2,
+  RABI_AL_AWWAL = 3,
+  RABI_AL_THANI = 4,
+  JUMADA_AL_ULA = 5,
+  JUMADA_AL_THANI = 6,
+  RAJAB = 7,
+  SHABAN = 8,
+  RAMADAN = 9,
+  SHAWWAL = 10,
+  DHU_AL_QIDAH = 11,
+  DHU_AL_HIJJAH = 12
+} hijri_month_t;
+
+/**
+ * @brief Date in the Hijri calendar
+ */
+typedef struct {
+  int year;  /**< Hijri year */
+  int month; /**< Month in [1, 12], see hijri_month_t */
+  int day;   /**< Day of the month in [1, 30] */
+} hijri_date_t;
+
+/**
+ * @brief Whether a Hijri year is covered by the Umm al-Qura table
+ *
+ * Years outside the table (before 1423 AH, when the current Umm al-Qura rule
+ * was adopted, or after 1500 AH) use the arithmetical (tabular) Islamic
+ * calendar instead, which may differ by a day or two.
+ */
+bool is_umm_al_qura_year(int year);
+
+/**
+ * @brief Number of days in a Hijri month, 29 or 30
+ */
+int hijri_month_length(int year, int month);
+
+/**
+ * @brief Convert days since 1970-01-01 to a Hijri date in O(1)
+ */
+hijri_date_t hijri_from_days(long days);
+
+/**
+ * @brief Convert a Hijri date to days since 1970-01-01 in O(1)
+ */
+long days_from_hijri(const hijri_date_t *hijri);
+
+/**
+ * @brief Convert a Gregorian date to the Umm al-Qura calendar
+ * @return false if the Gregorian date is invalid
+ */
+bool hijri_from_gregorian(int year, int month, int day, hijri_date_t *hijri);
+
+/**
+ * @brief Convert an Umm al-Qura date to the Gregorian calendar
+ * @return false if the Hijri date is invalid
+ */
+bool gregorian_from_hijri(const hijri_date_t *hijri, int *year, int *month,
+                          int *day);
+
+/**
+ * @brief Hijri date of the UTC calendar day containing an instant
+ */
+hijri_date_t hijri_date_from_time(time_t when);
+
+/**
+ * @brief Advance a Hijri date by one day
+ */
+hijri_date_t next_hijri_day(hijri_date_t hijri);
+
+#endif /* ADHAN_HIJRI_CALENDAR_H */
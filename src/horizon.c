@@ -0,0 +1,443 @@
+#include "horizon.h"
+#include "astronomical.h"
+#include "sun_position.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOCK HORIZON_TILE_BLOCK
+#define COORDINATE_UNITS 1e7
+#define EARTH_RADIUS 6371000.0
+/* Share of the curvature of the earth that terrestrial refraction hides */
+#define TERRESTRIAL_REFRACTION 0.13
+/* Sampling step along an azimuth, as a share of the distance */
+#define STEP_RATIO 0.01
+
+/* Binary layout, fixed width fields without padding. The header is followed
+ * by the offsets of the blocks and of the end of the last block, from the
+ * end of the offsets, then by the blocks. */
+static const char MAGIC[8] = {'A', 'D', 'H', 'A', 'N', 'D', 'E', 'M'};
+#define VERSION 1
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t rows;
+  uint32_t columns;
+  uint32_t block;   /* HORIZON_TILE_BLOCK */
+  int32_t south;    /* 1e-7 degrees */
+  int32_t west;     /* 1e-7 degrees */
+  int32_t spacing;  /* 1e-7 degrees */
+  uint32_t reserved;
+} tile_header_t;
+
+static bool valid_grid(const horizon_grid_t *grid) {
+  return grid->rows >= 2 && grid->columns >= 2 && grid->spacing > 0 &&
+         grid->spacing * COORDINATE_UNITS <= INT32_MAX &&
+         fabs(grid->south) <= 90 && fabs(grid->west) <= 180 &&
+         (double)grid->rows * grid->columns <= INT32_MAX;
+}
+
+static uint32_t blocks_of(uint32_t cells) {
+  return (cells + BLOCK - 1) / BLOCK;
+}
+
+/* Prediction of a cell of a block from its west, south and south-west
+ * neighbours, which follows slopes as well as flat ground */
+static int32_t predict(const int32_t *cells, int row, int column) {
+  if (row == 0 && column == 0) {
+    return 0;
+  }
+  if (row == 0) {
+    return cells[column - 1];
+  }
+  if (column == 0) {
+    return cells[(row - 1) * BLOCK];
+  }
+  return cells[row * BLOCK + column - 1] + cells[(row - 1) * BLOCK + column] -
+         cells[(row - 1) * BLOCK + column - 1];
+}
+
+/* Codes a block of a grid, its cells past the grid repeating its last row
+ * and column, and returns its size. `out` holds at least 3 bytes a cell. */
+static size_t encode_block(const horizon_grid_t *grid,
+                           const int16_t *elevations, uint32_t block_row,
+                           uint32_t block_column, unsigned char *out) {
+  int32_t cells[BLOCK * BLOCK];
+  size_t size = 0;
+  for (int row = 0; row < BLOCK; row++) {
+    uint32_t r = block_row * BLOCK + (uint32_t)row;
+    r = r < grid->rows ? r : grid->rows - 1;
+    for (int column = 0; column < BLOCK; column++) {
+      uint32_t c = block_column * BLOCK + (uint32_t)column;
+      c = c < grid->columns ? c : grid->columns - 1;
+      const int32_t value = elevations[(size_t)r * grid->columns + c];
+      cells[row * BLOCK + column] = value;
+      const int32_t delta = value - predict(cells, row, column);
+      /* Zigzag, then 7 bits a byte */
+      uint32_t code = delta < 0 ? ((uint32_t)-delta << 1) - 1
+                                : (uint32_t)delta << 1;
+      while (code >= 0x80) {
+        out[size++] = (unsigned char)(code | 0x80);
+        code >>= 7;
+      }
+      out[size++] = (unsigned char)code;
+    }
+  }
+  return size;
+}
+
+static bool decode_block(const unsigned char *data, size_t size,
+                         int16_t *decoded) {
+  int32_t cells[BLOCK * BLOCK];
+  size_t position = 0;
+  for (int row = 0; row < BLOCK; row++) {
+    for (int column = 0; column < BLOCK; column++) {
+      uint32_t code = 0;
+      for (int shift = 0;; shift += 7) {
+        if (position == size || shift > 14) {
+          return false;
+        }
+        const unsigned char byte = data[position++];
+        code |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+          break;
+        }
+      }
+      const int32_t delta =
+          (code & 1) ? -(int32_t)((code + 1) >> 1) : (int32_t)(code >> 1);
+      const int32_t value = predict(cells, row, column) + delta;
+      if (value < INT16_MIN || value > INT16_MAX) {
+        return false;
+      }
+      cells[row * BLOCK + column] = value;
+      decoded[row * BLOCK + column] = (int16_t)value;
+    }
+  }
+  return position == size;
+}
+
+bool horizon_tile_write(const char *path, const horizon_grid_t *grid,
+                        const int16_t *elevations) {
+  if (!path || !grid || !elevations || !valid_grid(grid)) {
+    return false;
+  }
+  const uint32_t block_rows = blocks_of(grid->rows);
+  const uint32_t block_columns = blocks_of(grid->columns);
+  const size_t blocks = (size_t)block_rows * block_columns;
+  uint32_t *offsets = malloc((blocks + 1) * sizeof(uint32_t));
+  unsigned char *payload = NULL;
+  size_t size = 0, capacity = 0;
+  bool ok = offsets != NULL;
+  for (size_t i = 0; ok && i < blocks; i++) {
+    if (capacity - size < 3 * BLOCK * BLOCK) {
+      capacity = 2 * capacity + 3 * BLOCK * BLOCK;
+      unsigned char *grown = realloc(payload, capacity);
+      ok = grown != NULL;
+      payload = ok ? grown : payload;
+    }
+    if (ok) {
+      offsets[i] = (uint32_t)size;
+      size += encode_block(grid, elevations, (uint32_t)(i / block_columns),
+                           (uint32_t)(i % block_columns), payload + size);
+      ok = size <= UINT32_MAX;
+    }
+  }
+
+  FILE *file = ok ? fopen(path, "wb") : NULL;
+  if (file) {
+    tile_header_t header = {{0},
+                            VERSION,
+                            grid->rows,
+                            grid->columns,
+                            BLOCK,
+                            (int32_t)lround(grid->south * COORDINATE_UNITS),
+                            (int32_t)lround(grid->west * COORDINATE_UNITS),
+                            (int32_t)lround(grid->spacing * COORDINATE_UNITS),
+                            0};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    offsets[blocks] = (uint32_t)size;
+    ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+         fwrite(offsets, sizeof(uint32_t), blocks + 1, file) == blocks + 1 &&
+         fwrite(payload, 1, size, file) == size;
+    ok = fclose(file) == 0 && ok;
+  } else {
+    ok = false;
+  }
+  free(offsets);
+  free(payload);
+  return ok;
+}
+
+bool horizon_tile_open(const char *path, size_t cache_blocks,
+                       horizon_tile_t *tile) {
+  if (!path || !tile) {
+    return false;
+  }
+  memset(tile, 0, sizeof(*tile));
+  if (!file_mapping_open(path, false, &tile->file)) {
+    return false;
+  }
+
+  tile_header_t header;
+  bool ok = tile->file.size >= sizeof(header) &&
+            memcmp(tile->file.data, MAGIC, sizeof(MAGIC)) == 0;
+  if (ok) {
+    memcpy(&header, tile->file.data, sizeof(header));
+    tile->grid = (horizon_grid_t){header.south / COORDINATE_UNITS,
+                                  header.west / COORDINATE_UNITS,
+                                  header.spacing / COORDINATE_UNITS,
+                                  header.rows, header.columns};
+    ok = header.version == VERSION && header.block == BLOCK &&
+         valid_grid(&tile->grid);
+  }
+  size_t blocks = 0;
+  if (ok) {
+    tile->block_rows = blocks_of(header.rows);
+    tile->block_columns = blocks_of(header.columns);
+    blocks = (size_t)tile->block_rows * tile->block_columns;
+    ok = (tile->file.size - sizeof(header)) / sizeof(uint32_t) > blocks;
+  }
+  if (ok) {
+    /* Offsets increase up to the end of the file */
+    const size_t payload = tile->file.size - sizeof(header) -
+                           (blocks + 1) * sizeof(uint32_t);
+    uint32_t previous = 0;
+    for (size_t i = 0; ok && i <= blocks; i++) {
+      uint32_t offset;
+      memcpy(&offset, tile->file.data + sizeof(header) + i * sizeof(offset),
+             sizeof(offset));
+      ok = offset >= previous && (i > 0 || offset == 0) &&
+           (i < blocks || offset == payload);
+      previous = offset;
+    }
+  }
+  if (ok) {
+    tile->capacity = cache_blocks ? cache_blocks : HORIZON_TILE_CACHE_BLOCKS;
+    tile->capacity = tile->capacity < blocks ? tile->capacity : blocks;
+    tile->blocks = malloc(tile->capacity * sizeof(horizon_block_t));
+    tile->slots = malloc(blocks * sizeof(int32_t));
+    ok = tile->blocks && tile->slots;
+  }
+  if (!ok) {
+    horizon_tile_close(tile);
+    return false;
+  }
+  for (size_t i = 0; i < tile->capacity; i++) {
+    tile->blocks[i].block = UINT32_MAX;
+    tile->blocks[i].used = 0;
+  }
+  for (size_t i = 0; i < blocks; i++) {
+    tile->slots[i] = -1;
+  }
+  return true;
+}
+
+void horizon_tile_close(horizon_tile_t *tile) {
+  if (!tile) {
+    return;
+  }
+  file_mapping_close(&tile->file);
+  free(tile->blocks);
+  free(tile->slots);
+  memset(tile, 0, sizeof(*tile));
+}
+
+/* Decoded cells of a block, through the cache */
+static const int16_t *tile_block(horizon_tile_t *tile, uint32_t block) {
+  tile->clock++;
+  const int32_t slot = tile->slots[block];
+  if (slot >= 0) {
+    tile->hits++;
+    tile->blocks[slot].used = tile->clock;
+    return tile->blocks[slot].cells;
+  }
+
+  /* Replace an unused block, else the least recently used, found by a scan
+   * of the whole cache. That is O(capacity) a miss, but misses are a small
+   * fraction of the lookups once a location's horizon is warm, and a list
+   * would cost two links a lookup to save it. */
+  size_t victim = 0;
+  for (size_t i = 0; i < tile->capacity; i++) {
+    if (tile->blocks[i].used < tile->blocks[victim].used) {
+      victim = i;
+    }
+  }
+  horizon_block_t *entry = &tile->blocks[victim];
+  if (entry->block != UINT32_MAX) {
+    tile->slots[entry->block] = -1;
+  }
+  entry->block = UINT32_MAX;
+  entry->used = 0;
+
+  const size_t blocks = (size_t)tile->block_rows * tile->block_columns;
+  const char *offsets = tile->file.data + sizeof(tile_header_t);
+  uint32_t begin, end;
+  memcpy(&begin, offsets + block * sizeof(uint32_t), sizeof(begin));
+  memcpy(&end, offsets + (block + 1) * sizeof(uint32_t), sizeof(end));
+  const unsigned char *data = (const unsigned char *)offsets +
+                              (blocks + 1) * sizeof(uint32_t) + begin;
+  tile->misses++;
+  if (!decode_block(data, end - begin, entry->cells)) {
+    return NULL;
+  }
+  entry->block = block;
+  entry->used = tile->clock;
+  tile->slots[block] = (int32_t)victim;
+  return entry->cells;
+}
+
+static bool tile_cell(horizon_tile_t *tile, uint32_t row, uint32_t column,
+                      double *elevation) {
+  const int16_t *cells = tile_block(
+      tile, (row / BLOCK) * tile->block_columns + column / BLOCK);
+  if (!cells) {
+    return false;
+  }
+  *elevation = cells[(row % BLOCK) * BLOCK + column % BLOCK];
+  return true;
+}
+
+/* Cells at `(row, column)` and north and east of it, from one block unless
+ * they straddle two */
+static bool tile_corners(horizon_tile_t *tile, uint32_t row, uint32_t column,
+                         double *sw, double *se, double *nw, double *ne) {
+  if (row % BLOCK == BLOCK - 1 || column % BLOCK == BLOCK - 1) {
+    return tile_cell(tile, row, column, sw) &&
+           tile_cell(tile, row, column + 1, se) &&
+           tile_cell(tile, row + 1, column, nw) &&
+           tile_cell(tile, row + 1, column + 1, ne);
+  }
+  const int16_t *cells = tile_block(
+      tile, (row / BLOCK) * tile->block_columns + column / BLOCK);
+  if (!cells) {
+    return false;
+  }
+  const int16_t *cell = &cells[(row % BLOCK) * BLOCK + column % BLOCK];
+  *sw = cell[0];
+  *se = cell[1];
+  *nw = cell[BLOCK];
+  *ne = cell[BLOCK + 1];
+  return true;
+}
+
+bool horizon_tile_elevation(horizon_tile_t *tile, double latitude,
+                            double longitude, double *elevation) {
+  if (!tile || !tile->blocks || !elevation) {
+    return false;
+  }
+  const horizon_grid_t *grid = &tile->grid;
+  const double y = (latitude - grid->south) / grid->spacing;
+  const double x = (longitude - grid->west) / grid->spacing;
+  if (!(y >= 0 && y <= grid->rows - 1 && x >= 0 && x <= grid->columns - 1)) {
+    return false;
+  }
+  uint32_t row = (uint32_t)y, column = (uint32_t)x;
+  row = row < grid->rows - 1 ? row : grid->rows - 2;
+  column = column < grid->columns - 1 ? column : grid->columns - 2;
+  const double fy = y - row, fx = x - column;
+
+  double sw, se, nw, ne;
+  if (!tile_corners(tile, row, column, &sw, &se, &nw, &ne)) {
+    return false;
+  }
+  *elevation = (1 - fy) * ((1 - fx) * sw + fx * se) +
+               fy * ((1 - fx) * nw + fx * ne);
+  return true;
+}
+
+double horizon_dip(double height) {
+  return height > 0 ? 0.0347 * sqrt(height) : 0;
+}
+
+double horizon_altitude(const horizon_t *horizon,
+                        const coordinates_t *coordinates, double azimuth) {
+  const double dip = -horizon_dip(horizon->height);
+  double ground;
+  if (!horizon->tile ||
+      !horizon_tile_elevation(horizon->tile, coordinates->latitude,
+                              coordinates->longitude, &ground)) {
+    return dip;
+  }
+  const double eye = ground + (horizon->height > 0 ? horizon->height : 0);
+  const double distance =
+      horizon->distance > 0 ? horizon->distance : HORIZON_DEFAULT_DISTANCE;
+  /* One cell apart near the observer, then further apart as the terrain
+   * shrinks with the distance */
+  const double cell = horizon->tile->grid.spacing * to_radians(EARTH_RADIUS);
+  const double north = cos(to_radians(azimuth)) / EARTH_RADIUS;
+  const double east = sin(to_radians(azimuth)) /
+                      (EARTH_RADIUS * cos(to_radians(coordinates->latitude)));
+
+  /* Steepest slope from the eye, the tangent of the altitude */
+  double best = -INFINITY;
+  for (double d = cell; d <= distance; d += fmax(cell, STEP_RATIO * d)) {
+    double elevation;
+    if (!horizon_tile_elevation(horizon->tile,
+                                coordinates->latitude + to_degrees(d * north),
+                                coordinates->longitude + to_degrees(d * east),
+                                &elevation)) {
+      break;
+    }
+    const double drop =
+        d * d / (2 * EARTH_RADIUS) * (1 - TERRESTRIAL_REFRACTION);
+    const double slope = (elevation - eye - drop) / d;
+    best = slope > best ? slope : best;
+  }
+  return best > -INFINITY ? to_degrees(atan(best)) : dip;
+}
+
+/* Bennett's refraction in arcminutes at an apparent altitude */
+static double refraction(double altitude) {
+  const double h = altitude > -1 ? altitude : -1;
+  return 1 / tan(to_radians(h + 7.31 / (h + 4.4)));
+}
+
+double horizon_sunrise_altitude(double altitude) {
+  /* Scaled to the 34 arcminutes of refraction at the horizon of the -50/60
+   * degrees, with 16 arcminutes of semidiameter */
+  const double scaled = 34 * (refraction(altitude) / refraction(0));
+  return altitude - (scaled + 16) / 60.0;
+}
+
+/* Whether the sun reaches an altitude on the day of a solar time, as in
+ * corrected_hour_angle() */
+static bool reaches(const solar_time_t *solar_time, double altitude) {
+  const double latitude = to_radians(solar_time->observer->latitude);
+  const double declination = to_radians(solar_time->solar.declination);
+  const double term2 = cos(latitude) * cos(declination);
+  return fabs(term2) >= 1e-10 &&
+         fabs((sin(to_radians(altitude)) - sin(latitude) * sin(declination)) /
+              term2) <= 1.0;
+}
+
+static double horizon_event(solar_time_t *solar_time, const horizon_t *horizon,
+                            double time, bool after_transit) {
+  if (!reaches(solar_time, -50.0 / 60.0)) {
+    return time;
+  }
+  /* Without terrain the horizon is the same at every azimuth */
+  const int refinements = horizon->tile ? 2 : 1;
+  for (int i = 0; i < refinements; i++) {
+    const double azimuth =
+        horizon->tile ? solar_time_sun_position(solar_time, time).azimuth : 0;
+    const double altitude = horizon_sunrise_altitude(
+        horizon_altitude(horizon, solar_time->observer, azimuth));
+    if (!reaches(solar_time, altitude)) {
+      break;
+    }
+    time = hour_angle(solar_time, altitude, after_transit);
+  }
+  return time;
+}
+
+void horizon_solar_time(solar_time_t *solar_time, const horizon_t *horizon) {
+  if (!solar_time || !horizon) {
+    return;
+  }
+  solar_time->sunrise =
+      horizon_event(solar_time, horizon, solar_time->sunrise, false);
+  solar_time->sunset =
+      horizon_event(solar_time, horizon, solar_time->sunset, true);
+}
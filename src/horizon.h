@@ -0,0 +1,159 @@
+#ifndef ADHAN_HORIZON_H
+#define ADHAN_HORIZON_H
+
+#include "coordinates.h"
+#include "file_mapping.h"
+#include "solar_time.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Cells per side of the blocks a tile is stored and cached in */
+#define HORIZON_TILE_BLOCK 32
+
+/**
+ * Default number of decoded blocks a tile keeps, 2 KB each. The sunrise and
+ * sunset azimuths of a year sweep about a thousand blocks of 1 arcsecond
+ * cells around a location.
+ */
+#define HORIZON_TILE_CACHE_BLOCKS 1024
+
+/** Default distance a horizon is searched to, in meters */
+#define HORIZON_DEFAULT_DISTANCE 40000.0
+
+/**
+ * @brief Grid of an elevation tile
+ *
+ * Cell `(row, column)` is the elevation at latitude `south + row * spacing`
+ * and longitude `west + column * spacing`. The corners and spacing are
+ * stored in 1e-7 degrees.
+ */
+typedef struct {
+  double south;     /**< Latitude of the first row, degrees */
+  double west;      /**< Longitude of the first column, degrees */
+  double spacing;   /**< Degrees between rows and between columns */
+  uint32_t rows;    /**< At least 2 */
+  uint32_t columns; /**< At least 2 */
+} horizon_grid_t;
+
+/**
+ * @brief Decoded block of a tile
+ */
+typedef struct {
+  uint32_t block; /**< Index of the block, UINT32_MAX when unused */
+  uint64_t used;  /**< Lookup count of the last use */
+  int16_t cells[HORIZON_TILE_BLOCK * HORIZON_TILE_BLOCK];
+} horizon_block_t;
+
+/**
+ * @brief Elevation tile mapped into memory, with an LRU of decoded blocks
+ *
+ * Lookups update the cache, so a tile must not be shared between threads;
+ * each thread opens its own, and the mapping shares the pages of the file.
+ * A miss scans the `capacity` entries for the least recently used one.
+ */
+typedef struct {
+  horizon_grid_t grid;
+  file_mapping_t file;
+  uint32_t block_rows;
+  uint32_t block_columns;
+  size_t capacity;         /**< Blocks the cache holds */
+  horizon_block_t *blocks; /**< The cache */
+  int32_t *slots;          /**< Cache entry of each block, or -1 */
+  uint64_t clock;
+  size_t hits;   /**< Block lookups found decoded */
+  size_t misses; /**< Blocks decoded */
+} horizon_tile_t;
+
+/**
+ * @brief Write an elevation tile
+ *
+ * Each block of the grid is stored as its first elevation followed by the
+ * varint coded differences from a planar prediction of the others, about
+ * one byte a cell for terrain instead of two.
+ *
+ * @param elevations `grid->rows * grid->columns` elevations in meters, row
+ * major from the south-west corner
+ * @return false on an invalid grid or a write error
+ */
+bool horizon_tile_write(const char *path, const horizon_grid_t *grid,
+                        const int16_t *elevations);
+
+/**
+ * @brief Map an elevation tile
+ *
+ * @param cache_blocks Decoded blocks to keep, or 0 for
+ * HORIZON_TILE_CACHE_BLOCKS
+ * @return false when the file cannot be read or is not a valid tile
+ */
+bool horizon_tile_open(const char *path, size_t cache_blocks,
+                       horizon_tile_t *tile);
+
+void horizon_tile_close(horizon_tile_t *tile);
+
+/**
+ * @brief Elevation at a point, interpolated between the four nearest cells
+ *
+ * @param[out] elevation Meters
+ * @return false outside the grid or in a corrupt block
+ */
+bool horizon_tile_elevation(horizon_tile_t *tile, double latitude,
+                            double longitude, double *elevation);
+
+/**
+ * @brief Observer of a horizon
+ */
+typedef struct {
+  double height;        /**< Meters of the eye above the ground */
+  horizon_tile_t *tile; /**< Terrain around the observer, or NULL */
+  double distance; /**< Meters searched along an azimuth, 0 for the default */
+} horizon_t;
+
+/**
+ * @brief Dip of the sea level horizon below the horizontal, in degrees
+ *
+ * 0.0347 * sqrt(height) degrees for an eye `height` meters above the
+ * surroundings, the correction most prayer time tables use.
+ */
+double horizon_dip(double height);
+
+/**
+ * @brief Altitude of the visible horizon toward an azimuth, in degrees
+ *
+ * Without a tile, or when the observer is outside it, the horizon is the
+ * sea level horizon seen from `height`. With a tile, the observer stands on
+ * the terrain, and the horizon is the highest terrain along the azimuth up
+ * to `distance`, lowered by the curvature of the earth and raised by
+ * terrestrial refraction.
+ *
+ * @param azimuth Degrees from true north, eastward
+ */
+double horizon_altitude(const horizon_t *horizon,
+                        const coordinates_t *coordinates, double azimuth);
+
+/**
+ * @brief Altitude of the sun's center at sunrise or sunset over a horizon
+ *
+ * The altitude of the horizon less the refraction at that altitude and the
+ * sun's semidiameter, so a horizon at 0 degrees gives the -50/60 degrees of
+ * new_solar_time().
+ */
+double horizon_sunrise_altitude(double altitude);
+
+/**
+ * @brief Move the sunrise and sunset of a solar time to a visible horizon
+ *
+ * Replaces the fixed -50/60 degrees of new_solar_time() with the sunrise
+ * altitude of the horizon toward the sun's azimuth at each event, so
+ * prayer_times_from_solar_time() returns the sunrise and Maghrib seen by
+ * the observer. The azimuth and the time are refined twice. Sunrise and
+ * sunset of polar days and nights are kept.
+ *
+ * The range APIs compute their own solar times over a flat horizon. The
+ * NEAREST_DAY and NEAREST_LATITUDE rules search other days or latitudes for
+ * the sun at -50/60 degrees, so their sunrise and sunset ignore the
+ * correction.
+ */
+void horizon_solar_time(solar_time_t *solar_time, const horizon_t *horizon);
+
+#endif /* ADHAN_HORIZON_H */
@@ -0,0 +1,174 @@
+#include "lunar_coordinates.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+#include <math.h>
+#include <stdlib.h>
+
+/* NASA Five Millennium Canon of Solar Eclipses expressions */
+double delta_t(double year) {
+  if (year < 1941 || year >= 2150) {
+    const double u = (year - 1820) / 100;
+    return -20 + 32 * u * u;
+  }
+  if (year < 1961) {
+    const double t = year - 1950;
+    return 29.07 + 0.407 * t - t * t / 233 + t * t * t / 2547;
+  }
+  if (year < 1986) {
+    const double t = year - 1975;
+    return 45.45 + 1.067 * t - t * t / 260 - t * t * t / 718;
+  }
+  if (year < 2005) {
+    const double t = year - 2000;
+    return 63.86 + t * (0.3345 + t * (-0.060374 +
+                                      t * (0.0017275 +
+                                           t * (0.000651814 +
+                                                t * 0.00002373599))));
+  }
+  if (year < 2050) {
+    const double t = year - 2000;
+    return 62.92 + 0.32217 * t + 0.005589 * t * t;
+  }
+  const double u = (year - 1820) / 100;
+  return -20 + 32 * u * u - 0.5628 * (2150 - year);
+}
+
+/* Astronomical Algorithms chapter 49, mean phase plus new moon corrections */
+double new_moon_julian_ephemeris_day(double k) {
+  const double T = k / 1236.85;
+  const double E = 1 - 0.002516 * T - 0.0000074 * T * T;
+  const double M = to_radians(2.5534 + 29.10535670 * k - 0.0000014 * T * T -
+                              0.00000011 * T * T * T);
+  const double Mp =
+      to_radians(201.5643 + 385.81693528 * k + 0.0107582 * T * T +
+                 0.00001238 * T * T * T - 0.000000058 * T * T * T * T);
+  const double F =
+      to_radians(160.7108 + 390.67050284 * k - 0.0016118 * T * T -
+                 0.00000227 * T * T * T + 0.000000011 * T * T * T * T);
+  const double O = to_radians(124.7746 - 1.56375588 * k + 0.0020672 * T * T +
+                              0.00000215 * T * T * T);
+
+  double jde = 2451550.09766 + 29.530588861 * k + 0.00015437 * T * T -
+               0.000000150 * T * T * T + 0.00000000073 * T * T * T * T;
+
+  jde += -0.40720 * sin(Mp) + 0.17241 * E * sin(M) + 0.01608 * sin(2 * Mp) +
+         0.01039 * sin(2 * F) + 0.00739 * E * sin(Mp - M) -
+         0.00514 * E * sin(Mp + M) + 0.00208 * E * E * sin(2 * M) -
+         0.00111 * sin(Mp - 2 * F) - 0.00057 * sin(Mp + 2 * F) +
+         0.00056 * E * sin(2 * Mp + M) - 0.00042 * sin(3 * Mp) +
+         0.00042 * E * sin(M + 2 * F) + 0.00038 * E * sin(M - 2 * F) -
+         0.00024 * E * sin(2 * Mp - M) - 0.00017 * sin(O) -
+         0.00007 * sin(Mp + 2 * M) + 0.00004 * sin(2 * Mp - 2 * F) +
+         0.00004 * sin(3 * M) + 0.00003 * sin(Mp + M - 2 * F) +
+         0.00003 * sin(2 * Mp + 2 * F) - 0.00003 * sin(Mp + M + 2 * F) +
+         0.00003 * sin(Mp - M + 2 * F) - 0.00002 * sin(Mp - M - 2 * F) -
+         0.00002 * sin(3 * Mp + M) + 0.00002 * sin(4 * Mp);
+
+  static const double A0[14] = {299.77, 251.88, 251.83, 349.42, 84.66,
+                                141.74, 207.14, 154.84, 34.52,  207.19,
+                                291.34, 161.72, 239.56, 331.55};
+  static const double A1[14] = {0.107408,  0.016321,  26.651886, 36.412478,
+                                18.206239, 53.303771, 2.453732,  7.306860,
+                                27.261239, 0.121824,  1.844379,  24.198154,
+                                25.513099, 3.592518};
+  static const double coefficient[14] = {325, 165, 164, 126, 110, 62, 60,
+                                         56,  47,  42,  40,  37,  35, 23};
+  for (int i = 0; i < 14; i++) {
+    double A = A0[i] + A1[i] * k;
+    if (i == 0) {
+      A -= 0.009173 * T * T;
+    }
+    jde += coefficient[i] * 1e-6 * sin(to_radians(A));
+  }
+  return jde;
+}
+
+/* Main terms of Astronomical Algorithms tables 47.A and 47.B:
+ * multiples of D, M, M', F and the sine (longitude, latitude) coefficient
+ * in 1e-6 degrees. */
+static const int LONGITUDE_TERMS[][5] = {
+    {0, 0, 1, 0, 6288774}, {2, 0, -1, 0, 1274027}, {2, 0, 0, 0, 658314},
+    {0, 0, 2, 0, 213618},  {0, 1, 0, 0, -185116},  {0, 0, 0, 2, -114332},
+    {2, 0, -2, 0, 58793},  {2, -1, -1, 0, 57066},  {2, 0, 1, 0, 53322},
+    {2, -1, 0, 0, 45758},  {0, 1, -1, 0, -40923},  {1, 0, 0, 0, -34720},
+    {0, 1, 1, 0, -30383},  {2, 0, 0, -2, 15327},   {0, 0, 1, 2, -12528},
+    {0, 0, 1, -2, 10980},  {4, 0, -1, 0, 10675},   {0, 0, 3, 0, 10034},
+    {4, 0, -2, 0, 8548},   {2, 1, -1, 0, -7888},   {2, 1, 0, 0, -6766},
+    {1, 0, -1, 0, -5163},  {1, 1, 0, 0, 4987},     {2, -1, 1, 0, 4036},
+    {2, 0, 2, 0, 3994},    {4, 0, 0, 0, 3861},     {2, 0, -3, 0, 3665},
+    {0, 1, -2, 0, -2689},  {2, 0, -1, 2, -2602},   {2, -1, -2, 0, 2390},
+    {1, 0, 1, 0, -2348},   {2, -2, 0, 0, 2236},    {0, 1, 2, 0, -2120},
+    {0, 2, 0, 0, -2069},   {2, -2, -1, 0, 2048},   {2, 0, 1, -2, -1773},
+    {2, 0, 0, 2, -1595},   {4, -1, -1, 0, 1215},   {0, 0, 2, 2, -1110}};
+
+static const int LATITUDE_TERMS[][5] = {
+    {0, 0, 0, 1, 5128122}, {0, 0, 1, 1, 280602},   {0, 0, 1, -1, 277693},
+    {2, 0, 0, -1, 173237}, {2, 0, -1, 1, 55413},   {2, 0, -1, -1, 46271},
+    {2, 0, 0, 1, 32573},   {0, 0, 2, 1, 17198},    {2, 0, 1, -1, 9266},
+    {0, 0, 2, -1, 8822},   {2, -1, 0, -1, 8216},   {2, 0, -2, -1, 4324},
+    {2, 0, 1, 1, 4200},    {2, 1, 0, -1, -3359},   {2, -1, -1, 1, 2463},
+    {2, -1, 0, 1, 2211},   {2, -1, -1, -1, 2065},  {0, 1, -1, -1, -1870},
+    {4, 0, -1, -1, 1828},  {0, 1, 0, 1, -1794},   {0, 0, 0, 3, -1749}};
+
+lunar_coordinates_t new_lunar_coordinates(double julian_ephemeris_day) {
+  const double jde = julian_ephemeris_day;
+  const double T = julian_century(jde);
+  const double Lp = 218.3164477 + 481267.88123421 * T - 0.0015786 * T * T;
+  const double D = 297.8501921 + 445267.1114034 * T - 0.0018819 * T * T;
+  const double M = 357.5291092 + 35999.0502909 * T - 0.0001536 * T * T;
+  const double Mp = 134.9633964 + 477198.8675055 * T + 0.0087414 * T * T;
+  const double F = 93.2720950 + 483202.0175233 * T - 0.0036539 * T * T;
+  const double E = 1 - 0.002516 * T - 0.0000074 * T * T;
+  const double A1 = 119.75 + 131.849 * T;
+  const double A2 = 53.09 + 479264.290 * T;
+  const double A3 = 313.45 + 481266.484 * T;
+
+  double sl = 3958 * sin(to_radians(A1)) + 1962 * sin(to_radians(Lp - F)) +
+              318 * sin(to_radians(A2));
+  double sb = -2235 * sin(to_radians(Lp)) + 382 * sin(to_radians(A3)) +
+              175 * sin(to_radians(A1 - F)) + 175 * sin(to_radians(A1 + F)) +
+              127 * sin(to_radians(Lp - Mp)) - 115 * sin(to_radians(Lp + Mp));
+  double sr;
+
+  for (size_t i = 0; i < sizeof(LONGITUDE_TERMS) / sizeof(*LONGITUDE_TERMS);
+       i++) {
+    const int *t = LONGITUDE_TERMS[i];
+    const double e = t[1] == 0 ? 1 : (abs(t[1]) == 1 ? E : E * E);
+    sl += t[4] * e *
+          sin(to_radians(t[0] * D + t[1] * M + t[2] * Mp + t[3] * F));
+  }
+  for (size_t i = 0; i < sizeof(LATITUDE_TERMS) / sizeof(*LATITUDE_TERMS);
+       i++) {
+    const int *t = LATITUDE_TERMS[i];
+    const double e = t[1] == 0 ? 1 : (abs(t[1]) == 1 ? E : E * E);
+    sb += t[4] * e *
+          sin(to_radians(t[0] * D + t[1] * M + t[2] * Mp + t[3] * F));
+  }
+  /* Distance: the two dominant terms are enough for the parallax */
+  sr = -20905355 * cos(to_radians(Mp)) -
+       3699111 * cos(to_radians(2 * D - Mp)) -
+       2955968 * cos(to_radians(2 * D)) - 569925 * cos(to_radians(2 * Mp));
+
+  const double L0 = mean_solar_longitude(T);
+  const double Lm = mean_lunar_longitude(T);
+  const double omega = ascending_lunar_node_longitude(T);
+  const double lambda = to_radians(Lp + sl / 1e6 +
+                                   nutation_in_longitude(T, L0, Lm, omega));
+  const double beta = to_radians(sb / 1e6);
+  const double epsilon = to_radians(apparent_obliquity_of_the_ecliptic(
+      T, mean_obliquity_of_the_ecliptic(T)));
+
+  /* Equations from Astronomical Algorithms page 93 */
+  lunar_coordinates_t coordinates;
+  coordinates.longitude = unwind_angle(to_degrees(lambda));
+  coordinates.latitude = sb / 1e6;
+  coordinates.rightAscension = unwind_angle(to_degrees(
+      safe_atan2(sin(lambda) * cos(epsilon) - tan(beta) * sin(epsilon),
+                 cos(lambda))));
+  coordinates.declination =
+      to_degrees(safe_asin(sin(beta) * cos(epsilon) +
+                           cos(beta) * sin(epsilon) * sin(lambda)));
+  coordinates.distance = 385000.56 + sr / 1000;
+  return coordinates;
+}
@@ -0,0 +1,36 @@
+#ifndef ADHAN_LUNAR_COORDINATES_H
+#define ADHAN_LUNAR_COORDINATES_H
+
+typedef struct {
+  double longitude;      /**< Apparent ecliptic longitude, degrees */
+  double latitude;       /**< Ecliptic latitude, degrees */
+  double rightAscension; /**< Apparent geocentric, degrees */
+  double declination;    /**< Apparent geocentric, degrees */
+  double distance;       /**< Earth-moon distance, kilometers */
+} lunar_coordinates_t;
+
+/**
+ * @brief Geocentric coordinates of the moon at a Julian ephemeris day
+ *
+ * Main terms of the lunar theory of Astronomical Algorithms chapter 47, good
+ * to about 10 arcseconds in longitude and 4 arcseconds in latitude, with the
+ * same nutation and obliquity as new_solar_coordinates().
+ */
+lunar_coordinates_t new_lunar_coordinates(double julian_ephemeris_day);
+
+/**
+ * @brief Julian ephemeris day of the new moon of lunation `k`
+ *
+ * Astronomical Algorithms chapter 49, with k = 0 the new moon of 2000-01-06.
+ */
+double new_moon_julian_ephemeris_day(double k);
+
+/**
+ * @brief Dynamical minus universal time in seconds at a decimal year
+ *
+ * Espenak and Meeus polynomial expressions for 1941 to 2150, and their long
+ * term parabola outside that range.
+ */
+double delta_t(double year);
+
+#endif // ADHAN_LUNAR_COORDINATES_H
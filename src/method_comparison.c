@@ -0,0 +1,116 @@
+#include "method_comparison.h"
+#include "calendrical_helper.h"
+#include "solar_time.h"
+#include <stdlib.h>
+
+/* Methods that share the astronomy of a day: the same Fajr angle, and the
+ * same Isha angle unless they use an Isha interval */
+typedef struct {
+  const calculation_parameters_t *parameters; /* Angles of the base */
+  unsigned groups; /* Rule groups of the methods, see prayer_base_t */
+} shared_base_t;
+
+/* Groups the methods by shared base, writing the base of each method to
+ * `base_of`, and returns the number of bases */
+static size_t share_bases(const calculation_parameters_t *methods,
+                          size_t method_count, shared_base_t *bases,
+                          size_t *base_of) {
+  size_t count = 0;
+  /* Methods with an Isha angle first, so those with an interval join them */
+  for (int interval = 0; interval < 2; interval++) {
+    for (size_t m = 0; m < method_count; m++) {
+      const calculation_parameters_t *method = &methods[m];
+      if ((method->ishaInterval > 0) != interval) {
+        continue;
+      }
+      size_t b = 0;
+      while (b < count &&
+             !(bases[b].parameters->fajrAngle == method->fajrAngle &&
+               (interval ||
+                bases[b].parameters->ishaAngle == method->ishaAngle))) {
+        b++;
+      }
+      if (b == count) {
+        bases[count++] = (shared_base_t){method, 0};
+      }
+      bases[b].groups |= prayer_base_rule_group(method->highLatitudeRule);
+      base_of[m] = b;
+    }
+  }
+  return count;
+}
+
+size_t compare_methods_range(coordinates_t *coordinates, time_t start,
+                             size_t days,
+                             const calculation_parameters_t *methods,
+                             size_t method_count,
+                             method_comparison_t *results) {
+  calculation_parameters_t predefined[COMPARISON_METHODS];
+
+  if (!coordinates || !results || days == 0 || method_count == 0 ||
+      (!methods && method_count > COMPARISON_METHODS)) {
+    return 0;
+  }
+  if (!methods) {
+    for (size_t i = 0; i < method_count; i++) {
+      predefined[i] = getParameters((calculation_method)i);
+    }
+    methods = predefined;
+  }
+
+  shared_base_t *shared = malloc(method_count * sizeof(shared_base_t));
+  prayer_base_t *bases = malloc(method_count * sizeof(prayer_base_t));
+  size_t *base_of = malloc(method_count * sizeof(size_t));
+  if (!shared || !bases || !base_of) {
+    free(shared);
+    free(bases);
+    free(base_of);
+    return 0;
+  }
+  const size_t base_count =
+      share_bases(methods, method_count, shared, base_of);
+
+  /* Same solar times as new_prayer_times_range(), shared by every method */
+  solar_time_days_t solar;
+  solar_time_days_init(&solar, coordinates, start);
+  prayer_day_t today_date = new_prayer_day(start);
+
+  for (size_t i = 0; i < days; i++) {
+    const prayer_day_t tomorrow_date =
+        new_prayer_day(add_days(start, (int)i + 1));
+
+    /* The astronomy of each shared base, with both Asr shadows, then the
+     * policy of each method and madhab */
+    bool computed = true;
+    for (size_t b = 0; b < base_count; b++) {
+      if (!prayer_base_for_rule_groups(coordinates, &today_date,
+                                       shared[b].parameters, shared[b].groups,
+                                       &solar.today, &tomorrow_date,
+                                       &solar.tomorrow, &bases[b])) {
+        computed = false;
+      }
+    }
+    method_comparison_t *row = results + i * method_count;
+    for (size_t m = 0; m < method_count; m++) {
+      /* Invalid coordinates, for which new_prayer_times() fails too */
+      if (!computed) {
+        row[m].shafi = (prayer_times_t)NULL_PRAYER_TIMES;
+        row[m].hanafi = (prayer_times_t)NULL_PRAYER_TIMES;
+        continue;
+      }
+      calculation_parameters_t parameters = methods[m];
+
+      parameters.madhab = SHAFI;
+      row[m].shafi = prayer_times_from_base(&bases[base_of[m]], &parameters);
+      parameters.madhab = HANAFI;
+      row[m].hanafi = prayer_times_from_base(&bases[base_of[m]], &parameters);
+    }
+
+    today_date = tomorrow_date;
+    solar_time_days_next(&solar);
+  }
+  free(shared);
+  free(bases);
+  free(base_of);
+  return days;
+}
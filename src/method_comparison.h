@@ -0,0 +1,48 @@
+#ifndef ADHAN_METHOD_COMPARISON_H
+#define ADHAN_METHOD_COMPARISON_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include "prayer_times.h"
+#include <stddef.h>
+#include <time.h>
+
+/** Number of predefined methods, MUSLIM_WORLD_LEAGUE to QATAR */
+#define COMPARISON_METHODS ((size_t)OTHER)
+
+/**
+ * @brief Prayer times of one method for both Asr shadow lengths
+ */
+typedef struct {
+  prayer_times_t shafi;  /**< Asr at a shadow length of one */
+  prayer_times_t hanafi; /**< Asr at a shadow length of two */
+} method_comparison_t;
+
+/**
+ * @brief Compare calculation methods over consecutive days
+ *
+ * Produces the same times as calling new_prayer_times() for every method,
+ * madhab and day, but computes the solar time and the date conversions of
+ * each day once for all methods, and its Fajr, Isha and both Asr times once
+ * per pair of Fajr and Isha angles, then applies the policy of each method
+ * and madhab with prayer_times_from_base(). Each method keeps its own
+ * angles, Isha interval, high latitude rule, adjustments and Moonsighting
+ * Committee seasonal rules; only its madhab is replaced by SHAFI and HANAFI.
+ * The nine predefined methods share seven pairs of angles.
+ *
+ * @param[in] methods Parameters of the methods to compare, or NULL for the
+ * first `method_count` predefined methods from getParameters()
+ * @param[in] method_count Number of methods, at most COMPARISON_METHODS when
+ * `methods` is NULL
+ * @param[out] results Array of `days * method_count` entries, the methods of
+ * the first day followed by those of the next days, NULL_PRAYER_TIMES for
+ * coordinates that new_prayer_times() rejects
+ * @return Number of days written, 0 on invalid arguments
+ */
+size_t compare_methods_range(coordinates_t *coordinates, time_t start,
+                             size_t days,
+                             const calculation_parameters_t *methods,
+                             size_t method_count,
+                             method_comparison_t *results);
+
+#endif /* ADHAN_METHOD_COMPARISON_H */
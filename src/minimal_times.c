@@ -0,0 +1,217 @@
+#include "minimal_times.h"
+#include "calendrical_helper.h"
+#include "astronomical.h"
+#include "double_utils.h"
+#include "prayer_rules.h"
+#include "solar_coordinates.h"
+#include <math.h>
+
+#define SECONDS_PER_HOUR 3600
+
+/* Julian day of 1970-01-01T00:00Z */
+#define EPOCH_JULIAN_DAY 2440587.5
+
+/* The day before, the day, the next day for midnight and the one after */
+#define CONTEXT_DAYS 4
+#define TODAY 1
+#define TOMORROW 2
+
+typedef struct {
+  solar_coordinates_t days[CONTEXT_DAYS];
+} solar_context_t;
+
+/* The standard tier of new_solar_coordinates(), without its cache, and
+ * julian_century() inline to keep calendrical_helper.c out of the profile */
+static solar_coordinates_t standard_solar_coordinates(double julian_day) {
+  const double T = (julian_day - 2451545.0) / 36525;
+  const double L0 = mean_solar_longitude(T);
+  const double Lp = mean_lunar_longitude(T);
+  const double omega = ascending_lunar_node_longitude(T);
+  const double lambda = to_radians(apparent_solar_longitude(T, L0));
+  const double theta0 = mean_sidereal_time(T);
+  const double delta_psi = nutation_in_longitude(T, L0, Lp, omega);
+  const double delta_epsilon = nutation_in_obliquity(T, L0, Lp, omega);
+  const double epsilon0 = mean_obliquity_of_the_ecliptic(T);
+  const double epsilonapp =
+      to_radians(apparent_obliquity_of_the_ecliptic(T, epsilon0));
+
+  const double declination =
+      to_degrees(safe_asin(sin(epsilonapp) * sin(lambda)));
+  const double rightAscension = unwind_angle(
+      to_degrees(safe_atan2(cos(epsilonapp) * sin(lambda), cos(lambda))));
+  const double apparentSiderealTime =
+      theta0 +
+      (((delta_psi * 3600) * cos(to_radians(epsilon0 + delta_epsilon))) / 3600);
+  return (solar_coordinates_t){declination, rightAscension,
+                               apparentSiderealTime};
+}
+
+static double approximate_transit(const solar_context_t *context, int day,
+                                  const coordinates_t *coordinates) {
+  const solar_coordinates_t *solar = &context->days[day];
+  return get_approximate_transit(coordinates->longitude,
+                                 solar->apparentSiderealTime,
+                                 solar->rightAscension);
+}
+
+/* hour_angle() of a day of the context, in hours after its start */
+static double event_hours(const solar_context_t *context, int day,
+                          const coordinates_t *coordinates, double angle,
+                          bool after_transit) {
+  const solar_coordinates_t *solar = &context->days[day];
+  return corrected_hour_angle(
+      approximate_transit(context, day, coordinates), angle, coordinates,
+      after_transit, solar->apparentSiderealTime, solar->rightAscension,
+      solar[-1].rightAscension, solar[1].rightAscension, solar->declination,
+      solar[-1].declination, solar[1].declination);
+}
+
+/* Hours after the start of a day to seconds, rounded to the minute like
+ * new_prayer_times(); false when there is no such time */
+static bool seconds_from_hours(double value, int32_t *seconds) {
+  if (!isfinite(value) || value < -24.0 || value > 48.0) {
+    return false;
+  }
+  const int32_t hours = (int32_t)floor(value);
+  const int32_t minutes = (int32_t)round((value - hours) * 60.0);
+  *seconds = hours * SECONDS_PER_HOUR + minutes * 60;
+  return true;
+}
+
+/* Sunrise, sunset and Fajr of a day of the context, in seconds after its
+ * start, like fajr_from_sun_times() */
+static bool sun_and_fajr(const solar_context_t *context, int index,
+                         int32_t day, const coordinates_t *coordinates,
+                         const calculation_parameters_t *parameters,
+                         int32_t *sunrise, int32_t *sunset, int32_t *fajr) {
+  const double altitude = -50.0 / 60.0;
+  if (!seconds_from_hours(
+          event_hours(context, index, coordinates, altitude, false),
+          sunrise) ||
+      !seconds_from_hours(
+          event_hours(context, index, coordinates, altitude, true), sunset)) {
+    return false;
+  }
+
+  const bool moonsighting = parameters->method == MOON_SIGHTING_COMMITTEE;
+  const int32_t night = *sunrise + SECONDS_PER_DAY - *sunset;
+  int32_t time;
+  bool found = seconds_from_hours(event_hours(context, index, coordinates,
+                                              -parameters->fajrAngle, false),
+                                  &time);
+  if (moonsighting && moonsighting_high_latitude(coordinates->latitude)) {
+    time = *sunrise - MOONSIGHTING_HIGH_LATITUDE_FAJR;
+    found = true;
+  }
+
+  int32_t safe;
+  if (moonsighting) {
+    int day_of_year;
+    const int year = year_and_day_of_year(day, &day_of_year);
+    safe = *sunrise -
+           (int32_t)round(seasonal_morning_twilight(coordinates->latitude,
+                                                    day_of_year, year) *
+                          60.0);
+  } else {
+    safe = *sunrise - (int32_t)(night_portion(parameters->highLatitudeRule,
+                                              parameters->fajrAngle) *
+                                night);
+  }
+  *fajr = !found || time > *sunrise ? safe : time;
+  return true;
+}
+
+bool minimal_prayer_times(const coordinates_t *coordinates, int32_t day,
+                          const calculation_parameters_t *parameters,
+                          minimal_times_t *times) {
+  if (!coordinates || !parameters || !times ||
+      !(coordinates->latitude >= -90.0 && coordinates->latitude <= 90.0 &&
+        coordinates->longitude >= -180.0 &&
+        coordinates->longitude <= 180.0) ||
+      parameters->highLatitudeRule == NEAREST_DAY ||
+      parameters->highLatitudeRule == NEAREST_LATITUDE) {
+    return false;
+  }
+
+  solar_context_t context;
+  for (int i = 0; i < CONTEXT_DAYS; i++) {
+    context.days[i] =
+        standard_solar_coordinates(EPOCH_JULIAN_DAY + (day - TODAY + i));
+  }
+  const solar_coordinates_t *today = &context.days[TODAY];
+  const double latitude = coordinates->latitude;
+
+  /* Times in seconds after the start of the day */
+  int32_t transit, sunrise, sunset, fajr, asr, isha = 0, midnight;
+  const double tangent = fabs(latitude - today->declination);
+  const double inverse =
+      getShadowLength(parameters->madhab) + safe_tan(to_radians(tangent));
+  const double asr_altitude = to_degrees(safe_atan(1.0 / inverse));
+  if (!seconds_from_hours(
+          corrected_transit(approximate_transit(&context, TODAY, coordinates),
+                            coordinates->longitude,
+                            today->apparentSiderealTime,
+                            today->rightAscension, today[-1].rightAscension,
+                            today[1].rightAscension),
+          &transit) ||
+      !sun_and_fajr(&context, TODAY, day, coordinates, parameters, &sunrise,
+                    &sunset, &fajr) ||
+      !seconds_from_hours(
+          event_hours(&context, TODAY, coordinates, asr_altitude, true),
+          &asr)) {
+    return false;
+  }
+
+  const bool moonsighting = parameters->method == MOON_SIGHTING_COMMITTEE;
+  const int32_t night = sunrise + SECONDS_PER_DAY - sunset;
+  if (parameters->ishaInterval > 0) {
+    isha = sunset + parameters->ishaInterval * 60;
+  } else {
+    bool found = seconds_from_hours(
+        event_hours(&context, TODAY, coordinates, -parameters->ishaAngle,
+                    true),
+        &isha);
+    if (moonsighting && moonsighting_high_latitude(latitude)) {
+      isha = sunset + moonsighting_high_latitude_isha(night);
+      found = true;
+    }
+    int32_t safe;
+    if (moonsighting) {
+      int day_of_year;
+      const int year = year_and_day_of_year(day, &day_of_year);
+      safe = sunset + (int32_t)round(seasonal_evening_twilight(
+                                         latitude, day_of_year, year) *
+                                     60.0);
+    } else {
+      safe = sunset + (int32_t)(night_portion(parameters->highLatitudeRule,
+                                              parameters->ishaAngle) *
+                                night);
+    }
+    if (!found || isha > safe) {
+      isha = safe;
+    }
+  }
+
+  /* Halfway between the adjusted Maghrib and the next Fajr, whose day
+   * starts SECONDS_PER_DAY later */
+  const prayer_adjustments_t *adjustments = &parameters->adjustments;
+  int32_t next_sunrise, next_sunset, next_fajr;
+  if (sun_and_fajr(&context, TOMORROW, day + 1, coordinates, parameters,
+                   &next_sunrise, &next_sunset, &next_fajr)) {
+    const int32_t maghrib = sunset + adjustments->maghrib * 60;
+    midnight = SECONDS_PER_DAY / 2 + floor_div(maghrib + next_fajr, 2);
+  } else {
+    midnight = sunset + 6 * SECONDS_PER_HOUR;
+  }
+
+  const epoch_minutes_t start = day * 1440;
+  *times = (minimal_times_t){
+      start + floor_div(fajr, 60) + adjustments->fajr,
+      start + floor_div(sunrise, 60) + adjustments->sunrise,
+      start + floor_div(transit, 60) + adjustments->dhuhr,
+      start + floor_div(asr, 60) + adjustments->asr,
+      start + floor_div(sunset, 60) + adjustments->maghrib,
+      start + floor_div(isha, 60) + adjustments->isha,
+      start + floor_div(midnight, 60) + adjustments->midnight};
+  return true;
+}
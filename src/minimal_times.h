@@ -0,0 +1,47 @@
+#ifndef ADHAN_MINIMAL_TIMES_H
+#define ADHAN_MINIMAL_TIMES_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Minutes since 1970-01-01T00:00Z, which spans the years -2113 to 6053 */
+typedef int32_t epoch_minutes_t;
+
+/**
+ * @brief Prayer times of a day in epoch minutes
+ */
+typedef struct {
+  epoch_minutes_t fajr;
+  epoch_minutes_t sunrise;
+  epoch_minutes_t dhuhr;
+  epoch_minutes_t asr;
+  epoch_minutes_t maghrib;
+  epoch_minutes_t isha;
+  epoch_minutes_t midnight;
+} minimal_times_t;
+
+/**
+ * @brief Prayer times of a UTC day for microcontrollers
+ *
+ * Same times as new_prayer_times() at 0h UTC of the day, truncated to the
+ * minute, under the MIDDLE_OF_THE_NIGHT, SEVENTH_OF_THE_NIGHT and
+ * TWILIGHT_ANGLE rules and the standard solar coordinates. Times are kept
+ * as 32-bit seconds from the start of the day, without time_t or the time
+ * functions of the C library, and the solar coordinates of the four days
+ * the day and its midnight need are computed once into one context.
+ *
+ * Together with astronomical.c, calculation_parameters.c and the policy
+ * rules it shares with new_prayer_times() in prayer_rules.c, this is what
+ * the adhan_minimal library of the ADHAN_MINIMAL build holds.
+ *
+ * @param day Days since 1970-01-01
+ * @return false when the coordinates are invalid, the rule is NEAREST_DAY
+ * or NEAREST_LATITUDE, or new_prayer_times() would be NULL_PRAYER_TIMES
+ */
+bool minimal_prayer_times(const coordinates_t *coordinates, int32_t day,
+                          const calculation_parameters_t *parameters,
+                          minimal_times_t *times);
+
+#endif /* ADHAN_MINIMAL_TIMES_H */
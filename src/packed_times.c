@@ -0,0 +1,92 @@
+#include "packed_times.h"
+#include "calendrical_helper.h"
+
+/* Nearest unit of an instant, halves rounding up */
+static int64_t to_units(time_t time) {
+  return floor_div((int64_t)time + PACKED_TIME_UNIT / 2, PACKED_TIME_UNIT);
+}
+
+bool pack_prayer_times(const prayer_times_t *times,
+                       packed_prayer_times_t *packed) {
+  const packed_prayer_times_t null_packed = {0, {0, 0, 0, 0, 0, 0}};
+  *packed = null_packed;
+  if (!times || times->fajr == 0) {
+    return false;
+  }
+
+  const time_t others[6] = {times->sunrise, times->dhuhr,   times->asr,
+                            times->maghrib, times->isha, times->midnight};
+  const int64_t fajr = to_units(times->fajr);
+  if (fajr < INT32_MIN || fajr > INT32_MAX) {
+    return false;
+  }
+  packed->fajr = (int32_t)fajr;
+
+  for (int i = 0; i < 6; i++) {
+    const int64_t offset = to_units(others[i]) - fajr;
+    if (offset < INT16_MIN || offset > INT16_MAX) {
+      *packed = null_packed;
+      return false;
+    }
+    packed->offsets[i] = (int16_t)offset;
+  }
+  return true;
+}
+
+prayer_times_t unpack_prayer_times(const packed_prayer_times_t *packed) {
+  prayer_times_t times;
+  unpack_prayer_times_batch(packed, 1, &times);
+  return times;
+}
+
+size_t pack_prayer_times_batch(const prayer_times_t *times, size_t count,
+                               packed_prayer_times_t *packed) {
+  size_t packed_count = 0;
+  if (!times || !packed) {
+    return 0;
+  }
+  for (size_t i = 0; i < count; i++) {
+    packed_count += pack_prayer_times(&times[i], &packed[i]);
+  }
+  return packed_count;
+}
+
+void unpack_prayer_times_batch(const packed_prayer_times_t *restrict packed,
+                               size_t count, prayer_times_t *restrict times) {
+  for (size_t i = 0; i < count; i++) {
+    const int64_t fajr = (int64_t)packed[i].fajr;
+    const int16_t *offsets = packed[i].offsets;
+    times[i].fajr = (time_t)(fajr * PACKED_TIME_UNIT);
+    times[i].sunrise = (time_t)((fajr + offsets[0]) * PACKED_TIME_UNIT);
+    times[i].dhuhr = (time_t)((fajr + offsets[1]) * PACKED_TIME_UNIT);
+    times[i].asr = (time_t)((fajr + offsets[2]) * PACKED_TIME_UNIT);
+    times[i].maghrib = (time_t)((fajr + offsets[3]) * PACKED_TIME_UNIT);
+    times[i].isha = (time_t)((fajr + offsets[4]) * PACKED_TIME_UNIT);
+    times[i].midnight = (time_t)((fajr + offsets[5]) * PACKED_TIME_UNIT);
+  }
+}
+
+/*
+ * Compares `when` against each time the same way as currentPrayer(), after
+ * removing Fajr from both sides. The latest prayer whose time has passed is
+ * selected without branches, as lookups at arbitrary instants would
+ * mispredict them.
+ */
+prayer_t packed_current_prayer(const packed_prayer_times_t *packed,
+                               time_t when) {
+  const int64_t elapsed =
+      (int64_t)when - (int64_t)packed->fajr * PACKED_TIME_UNIT;
+  int prayer = elapsed >= 0 ? FAJR : NONE;
+
+  for (int i = 0; i < 6; i++) {
+    const bool passed =
+        (int64_t)packed->offsets[i] * PACKED_TIME_UNIT - elapsed <= 0;
+    prayer = passed ? SUNRISE + i : prayer;
+  }
+  return (prayer_t)prayer;
+}
+
+prayer_t packed_next_prayer(const packed_prayer_times_t *packed, time_t when) {
+  const prayer_t current = packed_current_prayer(packed, when);
+  return current == MIDNIGHT ? NONE : (prayer_t)(current + 1);
+}
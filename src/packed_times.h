@@ -0,0 +1,70 @@
+#ifndef ADHAN_PACKED_TIMES_H
+#define ADHAN_PACKED_TIMES_H
+
+#include "prayer.h"
+#include "prayer_times.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/** Resolution of packed prayer times in seconds */
+#define PACKED_TIME_UNIT 30
+
+/**
+ * @brief Prayer times of a day in 16 bytes instead of 56
+ *
+ * Fajr is stored in units of PACKED_TIME_UNIT since the epoch, which covers
+ * about 2000 years on either side of 1970, and the other times as offsets
+ * from Fajr in the same unit, up to 11 days either way. Times computed from
+ * rounded minutes, with a midnight halfway between two of them, are stored
+ * exactly; safe values and seasonal adjustments that fall on other seconds
+ * are rounded to the nearest unit. NULL_PRAYER_TIMES is all zeros.
+ */
+typedef struct {
+  int32_t fajr;        /**< Fajr in units since the epoch */
+  int16_t offsets[6];  /**< Sunrise to midnight in units after Fajr */
+} packed_prayer_times_t;
+
+/**
+ * @brief Pack prayer times
+ * @return false, with `packed` set to all zeros, when the times are
+ * NULL_PRAYER_TIMES or out of the range of the packed form
+ */
+bool pack_prayer_times(const prayer_times_t *times,
+                       packed_prayer_times_t *packed);
+
+/**
+ * @brief Unpack prayer times, NULL_PRAYER_TIMES for all zeros
+ */
+prayer_times_t unpack_prayer_times(const packed_prayer_times_t *packed);
+
+/**
+ * @brief Pack consecutive prayer times, such as a timetable
+ * @return Number of entries packed, entries that cannot be packed are all
+ * zeros
+ */
+size_t pack_prayer_times_batch(const prayer_times_t *times, size_t count,
+                               packed_prayer_times_t *packed);
+
+/**
+ * @brief Unpack consecutive prayer times, such as a month of a cache
+ *
+ * Same as unpack_prayer_times() for each entry, with a branch free loop of
+ * shifts and adds that is bound by the stores of the unpacked times.
+ */
+void unpack_prayer_times_batch(const packed_prayer_times_t *packed,
+                               size_t count, prayer_times_t *times);
+
+/**
+ * @brief currentPrayer() on packed prayer times, without unpacking them
+ */
+prayer_t packed_current_prayer(const packed_prayer_times_t *packed,
+                               time_t when);
+
+/**
+ * @brief next_prayer() on packed prayer times, without unpacking them
+ */
+prayer_t packed_next_prayer(const packed_prayer_times_t *packed, time_t when);
+
+#endif /* ADHAN_PACKED_TIMES_H */
@@ -0,0 +1,346 @@
+#include "polar_rules.h"
+#include "altitude_events.h"
+#include "calendrical_helper.h"
+#include "solar_coordinates.h"
+#include <math.h>
+#include <stdlib.h>
+
+/* Days on either side of a solstice kept in a cache, a little more than half
+ * a year so each side covers a whole monotonic segment */
+#define SOLSTICE_WINDOW 190
+#define HALF_YEAR 182
+
+#define SUNRISE_ALTITUDE (-50.0 / 60.0)
+
+/* Obliquity of the ecliptic rounded up, so that events at the limiting
+ * latitudes still occur at the solstices */
+#define MAX_DECLINATION 23.5
+
+typedef struct {
+  long solstice; /* Approximate solstice, days since 1970-01-01 */
+  double declinations[2 * SOLSTICE_WINDOW + 1];
+} declination_cache_t;
+
+#ifdef ADHAN_SOLAR_CACHE
+/* One window per solstice, so walking a year alternates between the two
+ * without refilling them */
+static _Thread_local declination_cache_t caches[2];
+#endif
+
+static double hour_angle_ratio(double latitude, double declination,
+                               double angle) {
+  const double term1 =
+      sin(to_radians(angle)) -
+      sin(to_radians(latitude)) * sin(to_radians(declination));
+  const double term2 = cos(to_radians(latitude)) * cos(to_radians(declination));
+  return fabs(term2) < 1e-10 ? copysign(INFINITY, term1) : term1 / term2;
+}
+
+bool hour_angle_occurs(double latitude, double declination, double angle) {
+  return fabs(hour_angle_ratio(latitude, declination, angle)) <= 1.0;
+}
+
+/* Latitudes where the sun crosses an altitude at a declination: the lower
+ * culmination, at |phi + delta| - 90, must be below the altitude and the
+ * upper culmination, at 90 - |phi - delta|, above it. */
+static double lowest_latitude(double declination, double angle) {
+  return fmax(-(90 + angle) - declination, declination - 90 + angle);
+}
+
+static double highest_latitude(double declination, double angle) {
+  return fmin(90 + angle - declination, declination + 90 - angle);
+}
+
+double nearest_latitude(double latitude, double angle) {
+  const double low = fmax(lowest_latitude(MAX_DECLINATION, angle),
+                          lowest_latitude(-MAX_DECLINATION, angle));
+  const double high = fmin(highest_latitude(MAX_DECLINATION, angle),
+                           highest_latitude(-MAX_DECLINATION, angle));
+
+  if (low > high) {
+    return latitude;
+  }
+  return fmin(fmax(latitude, low), high);
+}
+
+/* Declination at midnight of a day, from the cache when there is one */
+static double cached_declination(declination_cache_t *cache, long day) {
+#ifdef ADHAN_SOLAR_CACHE
+  double *declination =
+      &cache->declinations[day - cache->solstice + SOLSTICE_WINDOW];
+  if (isnan(*declination)) {
+    *declination =
+        new_solar_coordinates(
+            julian_day_from_time_t((time_t)day * SECONDS_PER_DAY))
+            .declination;
+  }
+  return *declination;
+#else
+  (void)cache;
+  return new_solar_coordinates(
+             julian_day_from_time_t((time_t)day * SECONDS_PER_DAY))
+      .declination;
+#endif
+}
+
+/* June or December 21 closest to a day, days since 1970-01-01 */
+static long nearest_solstice(long today, bool june) {
+  int year, month, day;
+  long solstice = 0;
+  long distance = 0;
+
+  civil_from_days(today, &year, &month, &day);
+  for (int y = year - 1; y <= year + 1; y++) {
+    const long candidate = days_from_civil(y, june ? 6 : 12, 21);
+    if (y == year - 1 || labs(candidate - today) < distance) {
+      solstice = candidate;
+      distance = labs(candidate - today);
+    }
+  }
+  return solstice;
+}
+
+/* Cache of the declinations around a solstice, NULL without
+ * ADHAN_SOLAR_CACHE, which also builds for targets without thread-local
+ * storage */
+static declination_cache_t *solstice_cache(long solstice, bool june) {
+#ifdef ADHAN_SOLAR_CACHE
+  declination_cache_t *cache = &caches[june ? 0 : 1];
+  if (cache->solstice != solstice) {
+    cache->solstice = solstice;
+    for (int i = 0; i <= 2 * SOLSTICE_WINDOW; i++) {
+      cache->declinations[i] = NAN;
+    }
+  }
+  return cache;
+#else
+  (void)solstice;
+  (void)june;
+  return NULL;
+#endif
+}
+
+/* Whether the event fails on a day the same way it fails today */
+static bool fails(double ratio, double latitude, double declination,
+                  double angle) {
+  const double other = hour_angle_ratio(latitude, declination, angle);
+  return ratio > 1.0 ? other > 1.0 : other < -1.0;
+}
+
+bool nearest_day(time_t date, double latitude, double angle, time_t *nearest) {
+  if (!nearest) {
+    return false;
+  }
+
+  const long today = floor_div((int64_t)date, SECONDS_PER_DAY);
+  const long offset = (long)date - today * SECONDS_PER_DAY;
+  const double declination =
+      new_solar_coordinates(julian_day_from_time_t(date)).declination;
+  const double ratio = hour_angle_ratio(latitude, declination, angle);
+  if (fabs(ratio) <= 1.0) {
+    *nearest = date;
+    return true;
+  }
+
+  /* The failures are centered on the solstice whose declination makes the
+   * ratio more extreme */
+  const double june = hour_angle_ratio(latitude, 23.44, angle);
+  const double december = hour_angle_ratio(latitude, -23.44, angle);
+  const bool is_june = ratio > 1.0 ? june > december : june < december;
+  const long approximate = nearest_solstice(today, is_june);
+  declination_cache_t *cache = solstice_cache(approximate, is_june);
+
+  /* Refine the calendar date of the solstice */
+  long solstice = approximate;
+  for (long day = approximate - 3; day <= approximate + 3; day++) {
+    const double value = cached_declination(cache, day);
+    const double best = cached_declination(cache, solstice);
+    if (is_june ? value > best : value < best) {
+      solstice = day;
+    }
+  }
+
+  /* The declination is monotonic on each side of the solstice, so the
+   * failures form one interval around it with valid days on both ends. */
+  long before = solstice - HALF_YEAR;
+  long after = solstice + HALF_YEAR;
+  if (fails(ratio, latitude, cached_declination(cache, before), angle) ||
+      fails(ratio, latitude, cached_declination(cache, after), angle)) {
+    return false;
+  }
+
+  long low = before;
+  long high = solstice;
+  while (high - low > 1) {
+    const long middle = low + (high - low) / 2;
+    if (fails(ratio, latitude, cached_declination(cache, middle), angle)) {
+      high = middle;
+    } else {
+      low = middle;
+    }
+  }
+  before = low;
+
+  low = solstice;
+  high = after;
+  while (high - low > 1) {
+    const long middle = low + (high - low) / 2;
+    if (fails(ratio, latitude, cached_declination(cache, middle), angle)) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  after = high;
+
+  const long best = (today - before <= after - today) ? before : after;
+  /* Only at the poles, where failing one way flips to failing the other */
+  if (!hour_angle_occurs(latitude, cached_declination(cache, best), angle)) {
+    return false;
+  }
+  *nearest = (time_t)(best * SECONDS_PER_DAY + offset);
+  return true;
+}
+
+/* An event computed with the polar rules */
+typedef struct {
+  double angle;         /* Altitude of the event, 0 for Asr */
+  bool after_transit;
+  shadow_length shadow; /* Asr with this shadow length when not 0 */
+} event_t;
+
+/*
+ * Time of an event on the day of a solar time, false if it does not occur.
+ * Close to a culmination, where the single correction step of hour_angle()
+ * is unreliable, the crossing is refined with altitude_crossing().
+ */
+static bool solve_event(solar_time_t *solar_time, const event_t *event,
+                        double *time) {
+  double angle = event->angle;
+
+  if (event->shadow) {
+    /* Shadows are defined as long as the sun culminates above the horizon,
+     * where the Asr altitude is between 0 and the altitude at transit */
+    if (fabs(solar_time->observer->latitude -
+             solar_time->solar.declination) >= 90) {
+      return false;
+    }
+    angle = afternoon_altitude(solar_time, event->shadow);
+  }
+
+  const altitude_solver_status_t status = altitude_crossing(
+      solar_time, angle, event->after_transit, NULL, time);
+  return status == ALTITUDE_SOLVER_CONVERGED ||
+         status == ALTITUDE_SOLVER_NOT_CONVERGED;
+}
+
+/* Solves an event on the nearest day or at the nearest latitude where it
+ * occurs, returning the solar time it was solved on in `substitute` */
+static bool substitute_event(const solar_time_t *solar_time, time_t date,
+                             high_latitude_rule_t rule, const event_t *event,
+                             solar_time_t *substitute, coordinates_t *observer,
+                             double *time) {
+  const double limit = event->shadow ? SUNRISE_ALTITUDE : event->angle;
+  time_t day;
+
+  *observer = *solar_time->observer;
+  if (rule == NEAREST_DAY &&
+      nearest_day(date, observer->latitude, limit, &day)) {
+    /* The search samples the declination at 0h UT, so the event may still
+     * be missing from the interpolated ephemeris of the day it found. Look
+     * a few days further, both ways when it found today. */
+    const int step = day < date ? -1 : 1;
+    for (int i = 0; i <= 3; i++) {
+      for (int sign = 1; sign >= -1; sign -= 2) {
+        if (sign < 0 && (i == 0 || day != date)) {
+          continue;
+        }
+        *substitute = new_solar_time(add_days(day, sign * step * i), observer);
+        if (solve_event(substitute, event, time)) {
+          return true;
+        }
+      }
+    }
+  }
+
+  /* Also the fallback of NEAREST_DAY where the sun never crosses the
+   * altitude, such as twilight near the poles */
+  *substitute = *solar_time;
+  observer->latitude = nearest_latitude(observer->latitude, limit);
+  substitute->observer = observer;
+  return solve_event(substitute, event, time);
+}
+
+static double high_latitude_event(solar_time_t *solar_time, time_t date,
+                                  high_latitude_rule_t rule,
+                                  const event_t *event) {
+  solar_time_t substitute;
+  coordinates_t observer;
+  double time;
+
+  if (solve_event(solar_time, event, &time)) {
+    return time;
+  }
+  const bool substituted = substitute_event(solar_time, date, rule, event,
+                                            &substitute, &observer, &time);
+
+  if (event->shadow) {
+    /* Keep the fraction of the afternoon, between transit and sunset, or
+     * take the middle of it when shadows are not defined anywhere close */
+    const event_t sunset = {SUNRISE_ALTITUDE, true, 0};
+    double substitute_sunset;
+    const double today_sunset =
+        high_latitude_event(solar_time, date, rule, &sunset);
+    double fraction = 0.5;
+    if (substituted && solve_event(&substitute, &sunset, &substitute_sunset) &&
+        substitute_sunset > time) {
+      fraction = (time - substitute.transit) /
+                 (substitute_sunset - substitute.transit);
+    }
+    time = solar_time->transit +
+           fraction * (today_sunset - solar_time->transit);
+  } else if (!substituted) {
+    time = hour_angle(solar_time, event->angle, event->after_transit);
+  } else if (event->angle < SUNRISE_ALTITUDE) {
+    /* Keep the length of the twilight, from today's sunrise or sunset, so
+     * that Fajr and Isha stay on the right side of them */
+    const event_t horizon = {SUNRISE_ALTITUDE, event->after_transit, 0};
+    double reference;
+    if (solve_event(&substitute, &horizon, &reference)) {
+      time += high_latitude_event(solar_time, date, rule, &horizon) - reference;
+    }
+  }
+  return time;
+}
+
+double high_latitude_hour_angle(solar_time_t *solar_time, time_t date,
+                                high_latitude_rule_t rule, double angle,
+                                bool after_transit) {
+  if (rule != NEAREST_DAY && rule != NEAREST_LATITUDE) {
+    return hour_angle(solar_time, angle, after_transit);
+  }
+
+  const event_t event = {angle, after_transit, 0};
+  return high_latitude_event(solar_time, date, rule, &event);
+}
+
+double high_latitude_afternoon(solar_time_t *solar_time, time_t date,
+                               high_latitude_rule_t rule,
+                               shadow_length shadow_length) {
+  if (rule != NEAREST_DAY && rule != NEAREST_LATITUDE) {
+    return afternoon(solar_time, shadow_length);
+  }
+
+  const event_t event = {0, true, shadow_length};
+  const event_t sunset = {SUNRISE_ALTITUDE, true, 0};
+  const double time = high_latitude_event(solar_time, date, rule, &event);
+  const double sunset_time =
+      high_latitude_event(solar_time, date, rule, &sunset);
+
+  /* Close to the poles the altitude barely changes during the day, and the
+   * crossing found may be anywhere */
+  if (time > sunset_time) {
+    return (solar_time->transit + sunset_time) / 2;
+  }
+  return time;
+}
@@ -0,0 +1,72 @@
+#ifndef ADHAN_POLAR_RULES_H
+#define ADHAN_POLAR_RULES_H
+
+#include "high_latitude_rule.h"
+#include "solar_time.h"
+#include <stdbool.h>
+#include <time.h>
+
+/**
+ * @brief Whether the sun crosses an altitude on a day
+ *
+ * False during polar day and polar night for sunrise and sunset, and during
+ * the summer at high latitudes for twilight angles.
+ *
+ * @param declination Declination of the sun in degrees
+ * @param angle Altitude of the sun in degrees, negative below the horizon
+ */
+bool hour_angle_occurs(double latitude, double declination, double angle);
+
+/**
+ * @brief Closest latitude to `latitude` where the sun crosses an altitude
+ * every day of the year
+ *
+ * Closed form from the altitudes of the upper and lower culminations at the
+ * solstices, such as 48.5 degrees for an 18 degree twilight or about 65.7
+ * degrees for sunrise.
+ *
+ * @return `latitude` when the sun crosses the altitude there all year
+ */
+double nearest_latitude(double latitude, double angle);
+
+/**
+ * @brief Closest day to `date` when the sun crosses an altitude
+ *
+ * The event fails on an interval of days around one of the solstices, where
+ * the declination is monotonic. Both ends of the interval are found by
+ * bisection on a per-thread cache of daily declinations around that
+ * solstice, so a year of timetable rows computes each declination once.
+ *
+ * @param[out] nearest `date` moved by whole days, set to `date` when the sun
+ * already crosses the altitude on that day
+ * @return false if the sun does not cross the altitude at all that year
+ */
+bool nearest_day(time_t date, double latitude, double angle, time_t *nearest);
+
+/**
+ * @brief Hour angle of an altitude with a polar region fallback
+ *
+ * Same as hour_angle() for rules other than NEAREST_DAY and
+ * NEAREST_LATITUDE. With those, crossings close to a culmination are refined
+ * with altitude_crossing(), and when the sun does not cross the altitude,
+ * the time of day of the crossing at the nearest day or latitude where it
+ * does is used.
+ *
+ * @param date Date the solar time was computed for
+ */
+double high_latitude_hour_angle(solar_time_t *solar_time, time_t date,
+                                high_latitude_rule_t rule, double angle,
+                                bool after_transit);
+
+/**
+ * @brief Asr with a polar region fallback
+ *
+ * Same as afternoon() for rules other than NEAREST_DAY and NEAREST_LATITUDE.
+ * With those, Asr during the polar night comes from the nearest day or
+ * latitude where the sun rises, with the shadow length there.
+ */
+double high_latitude_afternoon(solar_time_t *solar_time, time_t date,
+                               high_latitude_rule_t rule,
+                               shadow_length shadow_length);
+
+#endif /* ADHAN_POLAR_RULES_H */
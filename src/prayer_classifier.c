@@ -0,0 +1,133 @@
+#include "prayer_classifier.h"
+#include <stdlib.h>
+
+/* Label of the last boundary of a day, in the order of currentPrayer(), at
+ * or before a timestamp, plus one */
+static const uint8_t LABELS[PRAYER_CLASSIFIER_BOUNDARIES + 1] = {
+    NONE, FAJR, SUNRISE, DHUHR, ASR, MAGHRIB, ISHA, MIDNIGHT, NONE};
+
+bool prayer_classifier_init(prayer_classifier_t *classifier,
+                            const prayer_times_t *timetable, size_t days) {
+  if (!classifier) {
+    return false;
+  }
+  *classifier = (prayer_classifier_t){0, 0, NULL, NULL};
+  if (!timetable || days == 0 || timetable[0].fajr == 0) {
+    return false;
+  }
+
+  int32_t *fajrs = malloc(days * sizeof(*fajrs));
+  int32_t(*boundaries)[PRAYER_CLASSIFIER_BOUNDARIES] =
+      malloc(days * sizeof(*boundaries));
+  const int64_t base = (int64_t)timetable[0].fajr;
+  int64_t previous_fajr = 0;
+  bool valid = fajrs && boundaries;
+
+  for (size_t day = 0; valid && day < days; day++) {
+    const prayer_times_t *times = &timetable[day];
+    /* The last day ends at an estimate of the next Fajr */
+    const time_t next =
+        day + 1 < days
+            ? timetable[day + 1].fajr
+            : times->midnight + (times->midnight - times->maghrib);
+    const time_t events[PRAYER_CLASSIFIER_BOUNDARIES] = {
+        times->fajr,    times->sunrise, times->dhuhr,
+        times->asr,     times->maghrib, times->isha,
+        times->midnight, next};
+
+    valid = times->fajr != 0 && times->fajr - base >= previous_fajr;
+    for (int i = 0; valid && i < PRAYER_CLASSIFIER_BOUNDARIES; i++) {
+      const int64_t offset = (int64_t)events[i] - base;
+      /* INT32_MAX is left for the timestamps after the timetable */
+      valid = offset > INT32_MIN && offset < INT32_MAX;
+      boundaries[day][i] = (int32_t)offset;
+    }
+    if (valid) {
+      fajrs[day] = boundaries[day][0];
+      previous_fajr = fajrs[day];
+    }
+  }
+  if (!valid) {
+    free(boundaries);
+    free(fajrs);
+    return false;
+  }
+
+  classifier->base = base;
+  classifier->days = days;
+  classifier->fajrs = fajrs;
+  classifier->boundaries = boundaries;
+  return true;
+}
+
+void prayer_classifier_free(prayer_classifier_t *classifier) {
+  if (classifier) {
+    free(classifier->boundaries);
+    free(classifier->fajrs);
+    *classifier = (prayer_classifier_t){0, 0, NULL, NULL};
+  }
+}
+
+/* Last day whose Fajr is at or before `offset`, the first day if none,
+ * with a conditional move instead of a branch at each step */
+static size_t find_day(const int32_t *fajrs, size_t days, int32_t offset) {
+  const int32_t *first = fajrs;
+  size_t length = days;
+  while (length > 1) {
+    const size_t half = length / 2;
+    first = first[half] <= offset ? first + half : first;
+    length -= half;
+  }
+  return (size_t)(first - fajrs);
+}
+
+void prayer_classifier_classify(const prayer_classifier_t *classifier,
+                                const time_t *restrict timestamps,
+                                size_t count, bool sorted,
+                                uint8_t *restrict labels,
+                                int32_t *restrict seconds) {
+  if (!classifier || classifier->days == 0 || !timestamps) {
+    return;
+  }
+  const int32_t *fajrs = classifier->fajrs;
+  const size_t days = classifier->days;
+  size_t day = 0;
+  int32_t previous = INT32_MIN;
+
+  for (size_t i = 0; i < count; i++) {
+    const int64_t elapsed = (int64_t)timestamps[i] - classifier->base;
+    const int32_t offset =
+        elapsed < INT32_MIN
+            ? INT32_MIN
+            : (elapsed > INT32_MAX ? INT32_MAX : (int32_t)elapsed);
+
+    if (sorted && offset >= previous) {
+      while (day + 1 < days && fajrs[day + 1] <= offset) {
+        day++;
+      }
+    } else {
+      day = find_day(fajrs, days, offset);
+    }
+    previous = offset;
+
+    /* Latest boundary that has passed, in the order of currentPrayer(),
+     * which also holds for days whose times are not in order */
+    const int32_t *row = classifier->boundaries[day];
+    int last = 0;
+    for (int b = 0; b < PRAYER_CLASSIFIER_BOUNDARIES; b++) {
+      const int passed = row[b] <= offset ? b + 1 : 0;
+      last = passed > last ? passed : last;
+    }
+    if (labels) {
+      labels[i] = LABELS[last];
+    }
+    if (seconds) {
+      const int64_t until =
+          (int64_t)row[last % PRAYER_CLASSIFIER_BOUNDARIES] - offset;
+      const bool known =
+          last < PRAYER_CLASSIFIER_BOUNDARIES - (day + 1 == days) &&
+          until <= INT32_MAX;
+      seconds[i] = known ? (int32_t)until : -1;
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#ifndef ADHAN_PRAYER_CLASSIFIER_H
+#define ADHAN_PRAYER_CLASSIFIER_H
+
+#include "prayer.h"
+#include "prayer_times.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/** Events of a day in a classifier: the seven prayer times and next Fajr */
+#define PRAYER_CLASSIFIER_BOUNDARIES 8
+
+/**
+ * @brief Timetable of a location prepared for classifying timestamps
+ *
+ * The prayer times of each day, followed by the Fajr of the next day, are
+ * packed as seconds after the first Fajr, one 32 byte row per day.
+ */
+typedef struct {
+  int64_t base;    /**< First Fajr of the timetable */
+  size_t days;     /**< Days of the timetable */
+  int32_t *fajrs;  /**< Fajr of each day, for the search across days */
+  int32_t (*boundaries)[PRAYER_CLASSIFIER_BOUNDARIES];
+} prayer_classifier_t;
+
+/**
+ * @brief Prepare consecutive days of prayer times, such as the result of
+ * new_prayer_times_range(), for prayer_classifier_classify()
+ *
+ * The next Fajr of the last day is not known; it is estimated as far after
+ * its midnight as the midnight is after Maghrib.
+ *
+ * @return false, with `classifier` empty, when a day is NULL_PRAYER_TIMES,
+ * the Fajr times are not in order, the timetable spans more than 68 years
+ * or memory runs out
+ */
+bool prayer_classifier_init(prayer_classifier_t *classifier,
+                            const prayer_times_t *timetable, size_t days);
+
+/**
+ * @brief Release the memory of a classifier
+ */
+void prayer_classifier_free(prayer_classifier_t *classifier);
+
+/**
+ * @brief Prayer period of each timestamp and the seconds until the next one
+ *
+ * The label is what currentPrayer() returns on the day of the latest Fajr
+ * before the timestamp, so the night until the next Fajr is ISHA or
+ * MIDNIGHT, and the seconds are those until the time of next_prayer() on
+ * that day, or until the next Fajr after MIDNIGHT. Timestamps before the
+ * first Fajr are NONE, with the seconds until it; those after the timetable
+ * are NONE and -1, as are the seconds after the last midnight and those
+ * that do not fit in an int32_t.
+ *
+ * Days are found by a branch free binary search, or by walking forward from
+ * the previous timestamp when `sorted` is true and the timestamps are in
+ * increasing order (others fall back to the search). The eight boundaries
+ * of the day are then compared at once, without branches, which compilers
+ * vectorize.
+ *
+ * @param[out] labels prayer_t of each timestamp, may be NULL
+ * @param[out] seconds Seconds until the next prayer time, may be NULL
+ */
+void prayer_classifier_classify(const prayer_classifier_t *classifier,
+                                const time_t *timestamps, size_t count,
+                                bool sorted, uint8_t *labels,
+                                int32_t *seconds);
+
+#endif /* ADHAN_PRAYER_CLASSIFIER_H */
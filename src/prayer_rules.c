@@ -0,0 +1,66 @@
+#include "prayer_rules.h"
+#include "calendrical_helper.h"
+#include <math.h>
+
+int days_since_solstice(int day_of_year, int year, double latitude) {
+  const bool leap = is_leap_year(year);
+  const int days_in_year = leap ? 366 : 365;
+  if (latitude >= 0) {
+    const int days = day_of_year + 10;
+    return days >= days_in_year ? days - days_in_year : days;
+  }
+  const int days = day_of_year - (leap ? 173 : 172);
+  return days < 0 ? days + days_in_year : days;
+}
+
+/* Minutes of a seasonal twilight whose coefficients are `slopes`,
+ * interpolated between the solstices and the equinoxes */
+static double seasonal_twilight(const double slopes[4], double latitude,
+                                int day_of_year, int year) {
+  const double a = 75 + ((slopes[0] / 55.0) * fabs(latitude));
+  const double b = 75 + ((slopes[1] / 55.0) * fabs(latitude));
+  const double c = 75 + ((slopes[2] / 55.0) * fabs(latitude));
+  const double d = 75 + ((slopes[3] / 55.0) * fabs(latitude));
+  const int dyy = days_since_solstice(day_of_year, year, latitude);
+
+  if (dyy < 91) {
+    return a + (b - a) / 91.0 * dyy;
+  } else if (dyy < 137) {
+    return b + (c - b) / 46.0 * (dyy - 91);
+  } else if (dyy < 183) {
+    return c + (d - c) / 46.0 * (dyy - 137);
+  } else if (dyy < 229) {
+    return d + (c - d) / 46.0 * (dyy - 183);
+  } else if (dyy < 275) {
+    return c + (b - c) / 46.0 * (dyy - 229);
+  }
+  return b + (a - b) / 91.0 * (dyy - 275);
+}
+
+static const double MORNING_SLOPES[4] = {28.65, 19.44, 32.74, 48.10};
+static const double EVENING_SLOPES[4] = {25.60, 2.050, -9.210, 6.140};
+
+double seasonal_morning_twilight(double latitude, int day_of_year, int year) {
+  return seasonal_twilight(MORNING_SLOPES, latitude, day_of_year, year);
+}
+
+double seasonal_evening_twilight(double latitude, int day_of_year, int year) {
+  return seasonal_twilight(EVENING_SLOPES, latitude, day_of_year, year);
+}
+
+bool moonsighting_high_latitude(double latitude) { return latitude >= 55; }
+
+int32_t moonsighting_high_latitude_isha(int32_t night) {
+  return (int32_t)(night / 60 * 0.4) * 60;
+}
+
+double night_portion(high_latitude_rule_t rule, double angle) {
+  switch (rule) {
+  case SEVENTH_OF_THE_NIGHT:
+    return 1.0 / 7.0;
+  case TWILIGHT_ANGLE:
+    return angle / 60.0;
+  default:
+    return 0.5;
+  }
+}
@@ -0,0 +1,53 @@
+#ifndef ADHAN_PRAYER_RULES_H
+#define ADHAN_PRAYER_RULES_H
+
+#include "high_latitude_rule.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Rules of the policy stage that new_prayer_times() and
+ * minimal_prayer_times() share. They work on days since the epoch and
+ * seconds, without time_t or the time functions of the C library, so the
+ * minimal profile links them as they are.
+ */
+
+/** Seconds before sunrise of the Fajr of MOON_SIGHTING_COMMITTEE at high
+ * latitudes */
+#define MOONSIGHTING_HIGH_LATITUDE_FAJR (90 * 60)
+
+/**
+ * @brief Days since the winter solstice of the hemisphere, as the seasonal
+ * twilights count them
+ */
+int days_since_solstice(int day_of_year, int year, double latitude);
+
+/**
+ * @brief Minutes before sunrise of the safe Fajr of MOON_SIGHTING_COMMITTEE
+ */
+double seasonal_morning_twilight(double latitude, int day_of_year, int year);
+
+/**
+ * @brief Minutes after sunset of the safe Isha of MOON_SIGHTING_COMMITTEE
+ */
+double seasonal_evening_twilight(double latitude, int day_of_year, int year);
+
+/**
+ * @brief Whether MOON_SIGHTING_COMMITTEE takes Fajr and Isha from the
+ * sunrise and sunset instead of the twilight angles, from 55 degrees
+ */
+bool moonsighting_high_latitude(double latitude);
+
+/**
+ * @brief Seconds after sunset of the Isha of MOON_SIGHTING_COMMITTEE at high
+ * latitudes, 0.4 of a night of `night` seconds in whole minutes
+ */
+int32_t moonsighting_high_latitude_isha(int32_t night);
+
+/**
+ * @brief Portion of the night that bounds a twilight of `angle` degrees
+ * under a high latitude rule
+ */
+double night_portion(high_latitude_rule_t rule, double angle);
+
+#endif /* ADHAN_PRAYER_RULES_H */
@@ -1,6 +1,8 @@
 #include "prayer_times.h"
 #include "calculation_parameters.h"
 #include "calendrical_helper.h"
+#include "polar_rules.h"
+#include "prayer_rules.h"
 #include "solar_time.h"
 #include <errno.h>
 #include <float.h>
@@ -8,7 +10,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
-static time_t time_from_double(double value, time_t date) {
+static time_t time_from_double(double value, const prayer_day_t *date) {
   // Check for invalid double values (NaN, infinity, or extreme values)
   if (value != value || value == DBL_MAX || value == DBL_MIN ||
       !isfinite(value)) {
@@ -21,7 +23,7 @@ static time_t time_from_double(double value, time_t date) {
     return 0;
   }
 
-  time_t day = date_from_time(date);
+  time_t day = date->start;
   if (day == 0) {
     return 0; // date_from_time failed
   }
@@ -72,12 +74,196 @@ static bool validate_coordinates(const coordinates_t *coordinates) {
           coordinates->longitude >= -180.0 && coordinates->longitude <= 180.0);
 }
 
-prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
-                                calculation_parameters_t *parameters) {
-  if (!validate_coordinates(coordinates) || !parameters) {
-    return (prayer_times_t)NULL_PRAYER_TIMES;
+/*
+ * What the policy stage branches on besides the angles and adjustments,
+ * fixed for a batch of days.
+ */
+typedef struct {
+  high_latitude_rule_t rule;
+  shadow_length shadow;
+  bool ishaInterval; /* Isha a fixed time after Maghrib */
+  bool moonsighting; /* Seasonal safe values of MOON_SIGHTING_COMMITTEE */
+  bool highLatitude; /* MOON_SIGHTING_COMMITTEE at 55 degrees or more */
+} prayer_policy_t;
+
+static prayer_policy_t policy_of(const calculation_parameters_t *parameters,
+                                 double latitude) {
+  const bool moonsighting = parameters->method == MOON_SIGHTING_COMMITTEE;
+  return (prayer_policy_t){parameters->highLatitudeRule,
+                           getShadowLength(parameters->madhab),
+                           parameters->ishaInterval > 0, moonsighting,
+                           moonsighting &&
+                               moonsighting_high_latitude(latitude)};
+}
+
+/* get_night_portions() under the rule of a policy */
+static inline night_portions_t
+policy_night_portions(prayer_policy_t policy,
+                      const calculation_parameters_t *parameters) {
+  return new_night_portions(night_portion(policy.rule, parameters->fajrAngle),
+                            night_portion(policy.rule, parameters->ishaAngle));
+}
+
+static inline time_t fajr_from_events(const solar_events_t *events,
+                                      const prayer_day_t *date,
+                                      double latitude,
+                                      calculation_parameters_t *parameters,
+                                      prayer_policy_t policy);
+static inline time_t fajr_from_sun_times(time_t sunriseComponents,
+                                         time_t sunsetComponents, double fajr,
+                                         const prayer_day_t *date,
+                                         double latitude,
+                                         calculation_parameters_t *parameters,
+                                         prayer_policy_t policy);
+
+prayer_day_t new_prayer_day(time_t date) {
+  prayer_day_t day = {date, date_from_time(date), 0, 0};
+  day.dayOfYear = day_of_year(date, &day.year);
+  return day;
+}
+
+/* Index in prayer_base_t of the events used by a high latitude rule */
+static int rule_group(high_latitude_rule_t rule) {
+  switch (rule) {
+  case NEAREST_DAY:
+    return 1;
+  case NEAREST_LATITUDE:
+    return 2;
+  default:
+    return 0;
+  }
+}
+
+static const high_latitude_rule_t group_rules[PRAYER_BASE_RULE_GROUPS] = {
+    TWILIGHT_ANGLE, NEAREST_DAY, NEAREST_LATITUDE};
+
+/* Events computed beside the sunrise and sunset, which always are */
+enum {
+  ISHA_EVENT = 1,
+  SINGLE_ASR_EVENT = 2,
+  DOUBLE_ASR_EVENT = 4,
+  FAJR_EVENT = 8,
+  ALL_EVENTS = ISHA_EVENT | SINGLE_ASR_EVENT | DOUBLE_ASR_EVENT | FAJR_EVENT
+};
+
+/*
+ * Replaces the sunrise and sunset of polar days and nights, and refines them
+ * close to a culmination, according to the NEAREST_DAY and NEAREST_LATITUDE
+ * rules. Other rules keep the estimates of corrected_hour_angle().
+ */
+static inline solar_time_t
+resolve_polar_solar_time(const solar_time_t *solar_time, time_t date,
+                         high_latitude_rule_t rule) {
+  const double solarAltitude = -50.0 / 60.0;
+  solar_time_t resolved = *solar_time;
+
+  if (rule == NEAREST_DAY || rule == NEAREST_LATITUDE) {
+    resolved.sunrise = high_latitude_hour_angle(&resolved, date, rule,
+                                                solarAltitude, false);
+    resolved.sunset = high_latitude_hour_angle(&resolved, date, rule,
+                                               solarAltitude, true);
+  }
+  return resolved;
+}
+
+/*
+ * Computes the events of a day under `rule`, the ones not in `wanted` are
+ * NAN. The midnight of the previous day only needs the sunrise, sunset and
+ * Fajr. When `known` is not NULL, its sunrise, sunset and Fajr, computed for
+ * that midnight, are taken instead of computed again.
+ */
+static inline void compute_solar_events(const solar_time_t *solar_time,
+                                        time_t date, high_latitude_rule_t rule,
+                                        double fajrAngle, double ishaAngle,
+                                        unsigned wanted,
+                                        const solar_events_t *known,
+                                        solar_events_t *events) {
+  solar_time_t resolved = *solar_time;
+  if (known) {
+    resolved.sunrise = known->sunrise;
+    resolved.sunset = known->sunset;
+  } else {
+    resolved = resolve_polar_solar_time(solar_time, date, rule);
+  }
+
+  events->sunrise = resolved.sunrise;
+  events->sunset = resolved.sunset;
+  events->fajr = known                  ? known->fajr
+                 : (wanted & FAJR_EVENT) ? high_latitude_hour_angle(
+                                               &resolved, date, rule,
+                                               -fajrAngle, false)
+                                         : NAN;
+  events->isha = (wanted & ISHA_EVENT) ? high_latitude_hour_angle(
+                                             &resolved, date, rule,
+                                             -ishaAngle, true)
+                                       : NAN;
+  events->asr[0] = (wanted & SINGLE_ASR_EVENT)
+                       ? high_latitude_afternoon(&resolved, date, rule, SINGLE)
+                       : NAN;
+  events->asr[1] = (wanted & DOUBLE_ASR_EVENT)
+                       ? high_latitude_afternoon(&resolved, date, rule, DOUBLE)
+                       : NAN;
+}
+
+/*
+ * Astronomical stage of the rule groups in `groups`, with the `wanted`
+ * events of today. `tomorrow` is the solar time of the following day; when
+ * it is NULL it is computed here.
+ */
+static void compute_base(coordinates_t *coordinates, const prayer_day_t *date,
+                         const calculation_parameters_t *parameters,
+                         unsigned groups, unsigned wanted, solar_time_t *today,
+                         const prayer_day_t *tomorrow_date,
+                         solar_time_t *tomorrow, prayer_base_t *base) {
+  solar_time_t next_solar_time;
+  bool has_tomorrow = true;
+
+  base->date = *date;
+  base->latitude = coordinates->latitude;
+  base->fajrAngle = parameters->fajrAngle;
+  base->ishaAngle = parameters->ishaAngle;
+  base->transit = today->transit;
+  base->ruleGroups = groups;
+
+  if (tomorrow) {
+    base->tomorrowDate = *tomorrow_date;
+  } else {
+    base->tomorrowDate = new_prayer_day(add_days(date->date, 1));
+    has_tomorrow = base->tomorrowDate.date > 0;
+    if (has_tomorrow) {
+      next_solar_time = new_solar_time(base->tomorrowDate.date, coordinates);
+      tomorrow = &next_solar_time;
+    }
+  }
+
+  for (int group = 0; group < PRAYER_BASE_RULE_GROUPS; group++) {
+    if (!(groups & (1u << group))) {
+      continue;
+    }
+    compute_solar_events(today, date->date, group_rules[group],
+                         parameters->fajrAngle, parameters->ishaAngle,
+                         wanted, NULL, &base->today[group]);
+    if (has_tomorrow) {
+      compute_solar_events(tomorrow, base->tomorrowDate.date,
+                           group_rules[group], parameters->fajrAngle,
+                           parameters->ishaAngle, FAJR_EVENT, NULL,
+                           &base->tomorrow[group]);
+    } else {
+      base->tomorrow[group] = (solar_events_t){NAN, NAN, NAN, NAN, {NAN, NAN}};
+    }
   }
+}
 
+/*
+ * Policy stage: applies the high latitude rule, the Isha interval, the safe
+ * values and the adjustments of `parameters` to the events of a day, whose
+ * midnight needs the `tomorrow` events of the following day.
+ */
+static inline prayer_times_t
+apply_policy(const prayer_day_t *date, double transit_time, double latitude,
+             const solar_events_t *today, const prayer_day_t *tomorrow_date,
+             const solar_events_t *tomorrow,
+             calculation_parameters_t *parameters, prayer_policy_t policy) {
   time_t tempFajr = 0;
   time_t tempSunrise = 0;
   time_t tempDhuhr = 0;
@@ -86,15 +272,9 @@ prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
   time_t tempIsha = 0;
   time_t tempMidnight = 0;
 
-  struct tm *tm_date = gmtime(&date);
-  const int year = tm_date->tm_year + 1900;
-  const int dayOfYear = tm_date->tm_yday + 1;
-
-  solar_time_t solar_time = new_solar_time(date, coordinates);
-
-  time_t transit = time_from_double(solar_time.transit, date);
-  time_t sunriseComponents = time_from_double(solar_time.sunrise, date);
-  time_t sunsetComponents = time_from_double(solar_time.sunset, date);
+  time_t transit = time_from_double(transit_time, date);
+  time_t sunriseComponents = time_from_double(today->sunrise, date);
+  time_t sunsetComponents = time_from_double(today->sunset, date);
 
   bool error =
       (transit == 0 || sunriseComponents == 0 || sunsetComponents == 0);
@@ -104,43 +284,44 @@ prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
     tempSunrise = sunriseComponents;
     tempMaghrib = sunsetComponents;
 
-    time_t asr_time = time_from_double(
-        afternoon(&solar_time, getShadowLength(parameters->madhab)), date);
+    time_t asr_time =
+        time_from_double(today->asr[policy.shadow - SINGLE], date);
     if (asr_time != 0) {
       tempAsr = asr_time;
     } else {
       error = true; // Asr calculation failed
     }
 
-    // Use the new function for Fajr calculation
-    tempFajr = calculate_fajr_time(coordinates, date, parameters);
+    tempFajr = fajr_from_sun_times(sunriseComponents, sunsetComponents,
+                                   today->fajr, date, latitude, parameters,
+                                   policy);
     if (tempFajr == 0) {
       error = true; // Fajr calculation failed
     }
 
     // Isha calculation with check against safe value
-    if (parameters->ishaInterval > 0) {
+    if (policy.ishaInterval) {
       tempIsha = add_minutes(tempMaghrib, parameters->ishaInterval);
     } else {
-      time_t isha_time = time_from_double(
-          hour_angle(&solar_time, -parameters->ishaAngle, true), date);
+      time_t isha_time = time_from_double(today->isha, date);
       if (isha_time != 0) {
         tempIsha = isha_time;
       }
 
-      if (parameters->method == MOON_SIGHTING_COMMITTEE &&
-          coordinates->latitude >= 55) {
-        long night_length =
-            (add_days(sunriseComponents, 1) - sunsetComponents) / 60;
-        tempIsha = add_minutes(sunsetComponents, night_length * 0.4);
+      if (policy.highLatitude) {
+        tempIsha = add_seconds(
+            sunsetComponents,
+            moonsighting_high_latitude_isha((int32_t)(
+                add_days(sunriseComponents, 1) - sunsetComponents)));
       }
 
-      const night_portions_t nightPortions = get_night_portions(parameters);
+      const night_portions_t nightPortions =
+          policy_night_portions(policy, parameters);
 
       time_t safeIsha;
-      if (parameters->method == MOON_SIGHTING_COMMITTEE) {
+      if (policy.moonsighting) {
         safeIsha = seasonAdjustedEveningTwilight(
-            coordinates->latitude, dayOfYear, year, sunsetComponents);
+            latitude, date->dayOfYear, date->year, sunsetComponents);
       } else {
         long night = add_days(sunriseComponents, 1) - sunsetComponents;
         long portion = (long)(nightPortions.isha * night);
@@ -155,37 +336,24 @@ prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
 
   // Midnight calculation - halfway between maghrib and next day's fajr
   if (!error && tempMaghrib > 0) {
-    struct tm date_tm = *gmtime(&date);
-    date_tm.tm_mday += 1;
-    // Use portable UTC conversion instead of mktime (which assumes local time)
-    time_t temp_result = mktime(&date_tm);
-    struct tm *gmt = gmtime(&temp_result);
-    time_t offset = mktime(gmt) - temp_result;
-    time_t next_date = temp_result - offset;
-
-    if (next_date > 0) {
-      time_t tomorrowFajr =
-          calculate_fajr_time(coordinates, next_date, parameters);
-
-      if (tomorrowFajr > 0) {
-        time_t adjusted_maghrib =
-            add_minutes(tempMaghrib, parameters->adjustments.maghrib);
-        double midnight_seconds =
-            ((double)adjusted_maghrib + (double)tomorrowFajr) / 2.0;
-
-        // Validate the calculated midnight time
-        if (isfinite(midnight_seconds) && midnight_seconds > 0) {
-          tempMidnight = (time_t)midnight_seconds;
-        } else {
-          // Fallback: set midnight to 6 hours after maghrib
-          tempMidnight = add_hours(tempMaghrib, 6);
-        }
+    time_t tomorrowFajr = fajr_from_events(tomorrow, tomorrow_date, latitude,
+                                           parameters, policy);
+
+    if (tomorrowFajr > 0) {
+      time_t adjusted_maghrib =
+          add_minutes(tempMaghrib, parameters->adjustments.maghrib);
+      double midnight_seconds =
+          ((double)adjusted_maghrib + (double)tomorrowFajr) / 2.0;
+
+      // Validate the calculated midnight time
+      if (isfinite(midnight_seconds) && midnight_seconds > 0) {
+        tempMidnight = (time_t)midnight_seconds;
       } else {
-        // Fallback if tomorrow's fajr calculation fails
+        // Fallback: set midnight to 6 hours after maghrib
         tempMidnight = add_hours(tempMaghrib, 6);
       }
     } else {
-      // Fallback if date calculation fails
+      // Fallback if tomorrow's fajr calculation fails
       tempMidnight = add_hours(tempMaghrib, 6);
     }
   }
@@ -207,6 +375,168 @@ prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
   }
 }
 
+static prayer_times_t apply_parameters(const prayer_base_t *base,
+                                       calculation_parameters_t *parameters) {
+  const int group = rule_group(parameters->highLatitudeRule);
+  return apply_policy(&base->date, base->transit, base->latitude,
+                      &base->today[group], &base->tomorrowDate,
+                      &base->tomorrow[group], parameters,
+                      policy_of(parameters, base->latitude));
+}
+
+/*
+ * Computes the prayer times of a day from its solar time. `tomorrow` is the
+ * solar time of the following day, used for midnight; when it is NULL it is
+ * computed here.
+ */
+static prayer_times_t compute_prayer_times(
+    coordinates_t *coordinates, const prayer_day_t *date,
+    calculation_parameters_t *parameters, solar_time_t *today_solar_time,
+    const prayer_day_t *tomorrow_date, solar_time_t *tomorrow) {
+  const unsigned wanted =
+      FAJR_EVENT | (parameters->ishaInterval > 0 ? 0 : ISHA_EVENT) |
+      (getShadowLength(parameters->madhab) == DOUBLE ? DOUBLE_ASR_EVENT
+                                                     : SINGLE_ASR_EVENT);
+  prayer_base_t base;
+  compute_base(coordinates, date, parameters,
+               1u << rule_group(parameters->highLatitudeRule), wanted,
+               today_solar_time, tomorrow_date, tomorrow, &base);
+  return apply_parameters(&base, parameters);
+}
+prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
+                                calculation_parameters_t *parameters) {
+  if (!validate_coordinates(coordinates) || !parameters) {
+    return (prayer_times_t)NULL_PRAYER_TIMES;
+  }
+
+  const prayer_day_t day = new_prayer_day(date);
+  solar_time_t solar_time = new_solar_time(date, coordinates);
+  return compute_prayer_times(coordinates, &day, parameters, &solar_time,
+                              NULL, NULL);
+}
+
+prayer_times_t prayer_times_from_solar_time(
+    coordinates_t *coordinates, time_t date,
+    calculation_parameters_t *parameters, solar_time_t *today,
+    solar_time_t *tomorrow) {
+  if (!validate_coordinates(coordinates) || !parameters || !today ||
+      !tomorrow) {
+    return (prayer_times_t)NULL_PRAYER_TIMES;
+  }
+
+  const prayer_day_t today_date = new_prayer_day(date);
+  const prayer_day_t tomorrow_date = new_prayer_day(add_days(date, 1));
+  return compute_prayer_times(coordinates, &today_date, parameters, today,
+                              &tomorrow_date, tomorrow);
+}
+
+prayer_times_t prayer_times_from_prayer_day(
+    coordinates_t *coordinates, const prayer_day_t *date,
+    calculation_parameters_t *parameters, solar_time_t *today,
+    const prayer_day_t *tomorrow_date, solar_time_t *tomorrow) {
+  if (!validate_coordinates(coordinates) || !parameters || !date || !today ||
+      !tomorrow_date || !tomorrow) {
+    return (prayer_times_t)NULL_PRAYER_TIMES;
+  }
+
+  return compute_prayer_times(coordinates, date, parameters, today,
+                              tomorrow_date, tomorrow);
+}
+
+bool prayer_base_from_prayer_day(coordinates_t *coordinates,
+                                 const prayer_day_t *date,
+                                 const calculation_parameters_t *parameters,
+                                 solar_time_t *today,
+                                 const prayer_day_t *tomorrow_date,
+                                 solar_time_t *tomorrow, prayer_base_t *base) {
+  if (!validate_coordinates(coordinates) || !parameters || !date || !today ||
+      !tomorrow_date || !tomorrow || !base) {
+    return false;
+  }
+
+  compute_base(coordinates, date, parameters,
+               (1u << PRAYER_BASE_RULE_GROUPS) - 1, ALL_EVENTS, today,
+               tomorrow_date, tomorrow, base);
+  return true;
+}
+
+unsigned prayer_base_rule_group(high_latitude_rule_t rule) {
+  return 1u << rule_group(rule);
+}
+
+bool prayer_base_for_rule_groups(coordinates_t *coordinates,
+                                 const prayer_day_t *date,
+                                 const calculation_parameters_t *parameters,
+                                 unsigned groups, solar_time_t *today,
+                                 const prayer_day_t *tomorrow_date,
+                                 solar_time_t *tomorrow, prayer_base_t *base) {
+  groups &= (1u << PRAYER_BASE_RULE_GROUPS) - 1;
+  if (!validate_coordinates(coordinates) || !parameters || !date || !today ||
+      !tomorrow_date || !tomorrow || !base || !groups) {
+    return false;
+  }
+
+  compute_base(coordinates, date, parameters, groups, ALL_EVENTS, today,
+               tomorrow_date, tomorrow, base);
+  return true;
+}
+
+bool prayer_base_matches(const prayer_base_t *base,
+                         const calculation_parameters_t *parameters) {
+  return base && parameters &&
+         (base->ruleGroups &
+          (1u << rule_group(parameters->highLatitudeRule))) &&
+         parameters->fajrAngle == base->fajrAngle &&
+         (parameters->ishaInterval > 0 ||
+          parameters->ishaAngle == base->ishaAngle);
+}
+
+prayer_times_t prayer_times_from_base(const prayer_base_t *base,
+                                      calculation_parameters_t *parameters) {
+  if (!prayer_base_matches(base, parameters)) {
+    return (prayer_times_t)NULL_PRAYER_TIMES;
+  }
+
+  return apply_parameters(base, parameters);
+}
+
+prayer_times_t prayer_times_with_carry(coordinates_t *coordinates,
+                                      const prayer_day_t *date,
+                                      calculation_parameters_t *parameters,
+                                      solar_time_t *today,
+                                      const prayer_day_t *tomorrow_date,
+                                      solar_time_t *tomorrow,
+                                      prayer_carry_t *carry) {
+  if (!validate_coordinates(coordinates) || !parameters || !date || !today ||
+      !tomorrow_date || !tomorrow || !carry) {
+    return (prayer_times_t)NULL_PRAYER_TIMES;
+  }
+  const prayer_policy_t policy = policy_of(parameters, coordinates->latitude);
+
+  /* The Moonsighting Committee replaces both twilights above 55 degrees */
+  const unsigned twilight = policy.highLatitude ? 0 : FAJR_EVENT;
+  const unsigned wanted =
+      twilight |
+      (policy.ishaInterval || policy.highLatitude ? 0 : ISHA_EVENT) |
+      (policy.shadow == DOUBLE ? DOUBLE_ASR_EVENT : SINGLE_ASR_EVENT);
+  const bool carried = carry->valid && carry->date == date->date;
+
+  solar_events_t events;
+  solar_events_t next;
+  compute_solar_events(today, date->date, policy.rule, parameters->fajrAngle,
+                       parameters->ishaAngle, wanted,
+                       carried ? &carry->events : NULL, &events);
+  compute_solar_events(tomorrow, tomorrow_date->date, policy.rule,
+                       parameters->fajrAngle, parameters->ishaAngle, twilight,
+                       NULL, &next);
+  carry->valid = true;
+  carry->date = tomorrow_date->date;
+  carry->events = next;
+
+  return apply_policy(date, today->transit, coordinates->latitude, &events,
+                      tomorrow_date, &next, parameters, policy);
+}
+
 prayer_t currentPrayer(prayer_times_t *prayer_times, time_t when) {
   if (prayer_times->midnight - when <= 0) {
     return MIDNIGHT;
@@ -272,88 +602,51 @@ time_t timeForPrayer(prayer_times_t *prayer_times, prayer_t prayer) {
 
 time_t seasonAdjustedMorningTwilight(double latitude, int day, int year,
                                      time_t sunrise) {
-  const double a = 75 + ((28.65 / 55.0) * fabs(latitude));
-  const double b = 75 + ((19.44 / 55.0) * fabs(latitude));
-  const double c = 75 + ((32.74 / 55.0) * fabs(latitude));
-  const double d = 75 + ((48.10 / 55.0) * fabs(latitude));
-
-  double adjustment;
-  const int dyy = daysSinceSolstice(day, year, latitude);
-  if (dyy < 91) {
-    adjustment = a + (b - a) / 91.0 * dyy;
-  } else if (dyy < 137) {
-    adjustment = b + (c - b) / 46.0 * (dyy - 91);
-  } else if (dyy < 183) {
-    adjustment = c + (d - c) / 46.0 * (dyy - 137);
-  } else if (dyy < 229) {
-    adjustment = d + (c - d) / 46.0 * (dyy - 183);
-  } else if (dyy < 275) {
-    adjustment = c + (b - c) / 46.0 * (dyy - 229);
-  } else {
-    adjustment = b + (a - b) / 91.0 * (dyy - 275);
-  }
-
-  return add_seconds(sunrise, -(int)round(adjustment * 60.0));
+  return add_seconds(
+      sunrise,
+      -(int)round(seasonal_morning_twilight(latitude, day, year) * 60.0));
 }
 
 time_t seasonAdjustedEveningTwilight(double latitude, int day, int year,
                                      time_t sunset) {
-  const double a = 75 + ((25.60 / 55.0) * fabs(latitude));
-  const double b = 75 + ((2.050 / 55.0) * fabs(latitude));
-  const double c = 75 - ((9.210 / 55.0) * fabs(latitude));
-  const double d = 75 + ((6.140 / 55.0) * fabs(latitude));
-
-  double adjustment;
-  int dyy = daysSinceSolstice(day, year, latitude);
-  if (dyy < 91) {
-    adjustment = a + (b - a) / 91.0 * dyy;
-  } else if (dyy < 137) {
-    adjustment = b + (c - b) / 46.0 * (dyy - 91);
-  } else if (dyy < 183) {
-    adjustment = c + (d - c) / 46.0 * (dyy - 137);
-  } else if (dyy < 229) {
-    adjustment = d + (c - d) / 46.0 * (dyy - 183);
-  } else if (dyy < 275) {
-    adjustment = c + (b - c) / 46.0 * (dyy - 229);
-  } else {
-    adjustment = b + (a - b) / 91.0 * (dyy - 275);
-  }
-
-  return add_seconds(sunset, (int)round(adjustment * 60.0));
+  return add_seconds(
+      sunset,
+      (int)round(seasonal_evening_twilight(latitude, day, year) * 60.0));
 }
 
 int daysSinceSolstice(int dayOfYear, int year, double latitude) {
-  int daysSinceSolistice;
-  const bool isLeapYear = is_leap_year(year);
-  const int northernOffset = 10;
-  const int southernOffset = isLeapYear ? 173 : 172;
-  const int daysInYear = isLeapYear ? 366 : 365;
-
-  if (latitude >= 0) {
-    daysSinceSolistice = dayOfYear + northernOffset;
-    if (daysSinceSolistice >= daysInYear) {
-      daysSinceSolistice = daysSinceSolistice - daysInYear;
-    }
-  } else {
-    daysSinceSolistice = dayOfYear - southernOffset;
-    if (daysSinceSolistice < 0) {
-      daysSinceSolistice = daysSinceSolistice + daysInYear;
-    }
-  }
-  return daysSinceSolistice;
+  return days_since_solstice(dayOfYear, year, latitude);
 }
 
 time_t calculate_fajr_time(coordinates_t *coordinates, time_t date,
                            calculation_parameters_t *parameters) {
-  struct tm *tm_date = gmtime(&date);
-  const int year = tm_date->tm_year + 1900;
-  const int dayOfYear = tm_date->tm_yday + 1;
-
+  const prayer_day_t day = new_prayer_day(date);
   solar_time_t solar_time = new_solar_time(date, coordinates);
+  solar_events_t events;
+  compute_solar_events(&solar_time, date, parameters->highLatitudeRule,
+                       parameters->fajrAngle, parameters->ishaAngle,
+                       FAJR_EVENT, NULL, &events);
+  return fajr_from_events(&events, &day, coordinates->latitude, parameters,
+                          policy_of(parameters, coordinates->latitude));
+}
 
-  time_t sunriseComponents = time_from_double(solar_time.sunrise, date);
-  time_t sunsetComponents = time_from_double(solar_time.sunset, date);
+static inline time_t fajr_from_events(const solar_events_t *events,
+                                      const prayer_day_t *date,
+                                      double latitude,
+                                      calculation_parameters_t *parameters,
+                                      prayer_policy_t policy) {
+  return fajr_from_sun_times(time_from_double(events->sunrise, date),
+                             time_from_double(events->sunset, date),
+                             events->fajr, date, latitude, parameters,
+                             policy);
+}
 
+static inline time_t fajr_from_sun_times(time_t sunriseComponents,
+                                         time_t sunsetComponents, double fajr,
+                                         const prayer_day_t *date,
+                                         double latitude,
+                                         calculation_parameters_t *parameters,
+                                         prayer_policy_t policy) {
   bool error = (sunriseComponents == 0 || sunsetComponents == 0);
 
   if (error)
@@ -363,20 +656,20 @@ time_t calculate_fajr_time(coordinates_t *coordinates, time_t date,
   time_t tomorrowSunrise = add_days(sunriseComponents, 1);
   long night = tomorrowSunrise - sunsetComponents;
 
-  time_t fajr_time = time_from_double(
-      hour_angle(&solar_time, -parameters->fajrAngle, false), date);
+  time_t fajr_time = time_from_double(fajr, date);
 
-  if (parameters->method == MOON_SIGHTING_COMMITTEE &&
-      coordinates->latitude >= 55) {
-    fajr_time = add_seconds(sunriseComponents, -90 * 60);
+  if (policy.highLatitude) {
+    fajr_time =
+        add_seconds(sunriseComponents, -MOONSIGHTING_HIGH_LATITUDE_FAJR);
   }
 
-  const night_portions_t nightPortions = get_night_portions(parameters);
+  const night_portions_t nightPortions =
+      policy_night_portions(policy, parameters);
 
   time_t safeFajr;
-  if (parameters->method == MOON_SIGHTING_COMMITTEE) {
-    safeFajr = seasonAdjustedMorningTwilight(coordinates->latitude, dayOfYear,
-                                             year, sunriseComponents);
+  if (policy.moonsighting) {
+    safeFajr = seasonAdjustedMorningTwilight(latitude, date->dayOfYear,
+                                             date->year, sunriseComponents);
   } else {
     long portion = (long)(nightPortions.fajr * night);
     safeFajr = add_seconds(sunriseComponents, -portion);
@@ -387,5 +680,11 @@ time_t calculate_fajr_time(coordinates_t *coordinates, time_t date,
     fajr_time = safeFajr;
   }
 
+  // Twilights taken from another day or latitude may overlap the night
+  if ((policy.rule == NEAREST_DAY || policy.rule == NEAREST_LATITUDE) &&
+      difftime(fajr_time, safeFajr) < 0) {
+    fajr_time = safeFajr;
+  }
+
   return fajr_time;
 }
@@ -4,6 +4,8 @@
 #include "calculation_parameters.h"
 #include "coordinates.h"
 #include "prayer.h"
+#include "solar_time.h"
+#include <stdbool.h>
 #include <time.h>
 
 typedef struct {
@@ -21,6 +23,175 @@ typedef struct {
 prayer_times_t new_prayer_times(coordinates_t *coordinates, time_t date,
                                 calculation_parameters_t *parameters);
 
+/**
+ * @brief Compute prayer times from precomputed solar times
+ *
+ * Same result as new_prayer_times() when `today` and `tomorrow` are the solar
+ * times of `date` and of the following day, for callers that share solar
+ * coordinates across consecutive days.
+ */
+prayer_times_t prayer_times_from_solar_time(
+    coordinates_t *coordinates, time_t date,
+    calculation_parameters_t *parameters, solar_time_t *today,
+    solar_time_t *tomorrow);
+
+/**
+ * @brief Calendar fields of a date used by the prayer time calculation
+ *
+ * Converting a date is a large part of the cost of the prayer times, so
+ * callers computing several sets of prayer times for the same date convert
+ * it once with new_prayer_day().
+ */
+typedef struct {
+  time_t date;   /**< Date the prayer times are computed for */
+  time_t start;  /**< Start of the UTC day of `date`, 0 if out of range */
+  int year;      /**< Gregorian year of `date` */
+  int dayOfYear; /**< Day of the year of `date` in [1, 366] */
+} prayer_day_t;
+
+prayer_day_t new_prayer_day(time_t date);
+
+/**
+ * @brief Compute prayer times from a precomputed day and solar times
+ *
+ * Same result as prayer_times_from_solar_time() when `date` and
+ * `tomorrow_date` come from new_prayer_day() for the date and for the
+ * following day.
+ */
+prayer_times_t prayer_times_from_prayer_day(
+    coordinates_t *coordinates, const prayer_day_t *date,
+    calculation_parameters_t *parameters, solar_time_t *today,
+    const prayer_day_t *tomorrow_date, solar_time_t *tomorrow);
+
+/**
+ * @brief Number of groups of high latitude rules with different astronomy
+ *
+ * MIDDLE_OF_THE_NIGHT, SEVENTH_OF_THE_NIGHT and TWILIGHT_ANGLE share the
+ * same solar events and only differ in their safe values, while NEAREST_DAY
+ * and NEAREST_LATITUDE each replace the events the sun does not reach.
+ */
+#define PRAYER_BASE_RULE_GROUPS 3
+
+/**
+ * @brief Unrounded times of the solar events of a day, in hours from the
+ * start of its UTC day, under one group of high latitude rules
+ */
+typedef struct {
+  double sunrise;
+  double sunset;
+  double fajr;   /**< Sun at -fajrAngle before transit */
+  double isha;   /**< Sun at -ishaAngle after transit */
+  double asr[2]; /**< Asr with SINGLE and DOUBLE shadow lengths */
+} solar_events_t;
+
+/**
+ * @brief Astronomical stage of the prayer times of a day
+ *
+ * Holds everything prayer_times_from_base() needs to apply the policy of a
+ * set of calculation parameters: the madhab, the Isha interval, the high
+ * latitude rule, the safe values and the adjustments. Only the Fajr and Isha
+ * angles are fixed by the parameters the base was computed with.
+ */
+typedef struct {
+  prayer_day_t date;
+  prayer_day_t tomorrowDate;
+  double latitude;
+  double fajrAngle;
+  double ishaAngle;
+  double transit;
+  unsigned ruleGroups; /**< Bit set of the rule groups of `today` computed */
+  solar_events_t today[PRAYER_BASE_RULE_GROUPS];
+  /** Only sunrise, sunset and fajr, for the midnight of `today` */
+  solar_events_t tomorrow[PRAYER_BASE_RULE_GROUPS];
+} prayer_base_t;
+
+/**
+ * @brief Compute the astronomical stage of the prayer times of a day
+ *
+ * Computes the events of every high latitude rule, with the Fajr and Isha
+ * angles of `parameters`. `today`, `tomorrow` and the dates are the same as
+ * for prayer_times_from_prayer_day().
+ *
+ * @return false on invalid arguments
+ */
+bool prayer_base_from_prayer_day(coordinates_t *coordinates,
+                                 const prayer_day_t *date,
+                                 const calculation_parameters_t *parameters,
+                                 solar_time_t *today,
+                                 const prayer_day_t *tomorrow_date,
+                                 solar_time_t *tomorrow, prayer_base_t *base);
+
+/**
+ * @brief Bit of the rule group of a high latitude rule in
+ * prayer_base_t::ruleGroups
+ */
+unsigned prayer_base_rule_group(high_latitude_rule_t rule);
+
+/**
+ * @brief Compute the astronomical stage of some rule groups of a day
+ *
+ * Same as prayer_base_from_prayer_day() for the rule groups in `groups`, a
+ * non-empty bit set of prayer_base_rule_group(), for callers that know the
+ * rules they will apply. The NEAREST_DAY and NEAREST_LATITUDE groups cost
+ * several times the others.
+ *
+ * @return false on invalid arguments
+ */
+bool prayer_base_for_rule_groups(coordinates_t *coordinates,
+                                 const prayer_day_t *date,
+                                 const calculation_parameters_t *parameters,
+                                 unsigned groups, solar_time_t *today,
+                                 const prayer_day_t *tomorrow_date,
+                                 solar_time_t *tomorrow, prayer_base_t *base);
+
+/**
+ * @brief Whether prayer_times_from_base() can apply `parameters` to `base`
+ *
+ * True when the parameters use the Fajr angle of the base, its Isha angle
+ * unless they use an Isha interval, and a high latitude rule it holds.
+ */
+bool prayer_base_matches(const prayer_base_t *base,
+                         const calculation_parameters_t *parameters);
+
+/**
+ * @brief Apply calculation parameters to the astronomical stage of a day
+ *
+ * Same result as new_prayer_times() with `parameters`, in a small fraction
+ * of its time, so changing the madhab, Isha interval, high latitude rule or
+ * adjustments does not need the astronomy again.
+ *
+ * @return NULL_PRAYER_TIMES when prayer_base_matches() is false
+ */
+prayer_times_t prayer_times_from_base(const prayer_base_t *base,
+                                      calculation_parameters_t *parameters);
+
+/**
+ * @brief Sunrise, sunset and Fajr that prayer_times_with_carry() computed
+ * for the midnight of a day, which the next day reuses as its own
+ */
+typedef struct {
+  bool valid;
+  time_t date; /**< Date of the day the events are for */
+  solar_events_t events;
+} prayer_carry_t;
+
+/**
+ * @brief Prayer times of a day of a batch of consecutive days
+ *
+ * Same result as prayer_times_from_prayer_day(). Called for consecutive
+ * days, with the `tomorrow` of a day as the `today` of the next and the same
+ * `carry`, zeroed before the first day, it computes each day's sunrise,
+ * sunset and Fajr only once, and skips the twilights that the Moonsighting
+ * Committee replaces above 55 degrees.
+ */
+prayer_times_t prayer_times_with_carry(coordinates_t *coordinates,
+                                      const prayer_day_t *date,
+                                      calculation_parameters_t *parameters,
+                                      solar_time_t *today,
+                                      const prayer_day_t *tomorrow_date,
+                                      solar_time_t *tomorrow,
+                                      prayer_carry_t *carry);
+
 prayer_t currentPrayer(prayer_times_t *prayer_times, time_t when);
 
 prayer_t next_prayer(prayer_times_t *prayer_times, time_t when);
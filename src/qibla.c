@@ -0,0 +1,86 @@
+#include "qibla.h"
+#include "astronomical.h"
+#include "double_utils.h"
+#include <math.h>
+
+/*
+ * Both the bearing and the distance derive from the same terms of the
+ * spherical triangle observer - pole - Kaaba:
+ *   y = cos(phiK) sin(dL)
+ *   x = cos(phi) sin(phiK) - sin(phi) cos(phiK) cos(dL)
+ *   z = sin(phi) sin(phiK) + cos(phi) cos(phiK) cos(dL)
+ * bearing = atan2(y, x) and central angle = atan2(sqrt(y^2 + x^2), z), which
+ * stays accurate for nearby and antipodal points alike.
+ */
+static void qibla_terms(double latitude, double longitude, double *y,
+                        double *x, double *z) {
+  const double phi = to_radians(latitude);
+  const double phiK = to_radians(KAABA_LATITUDE);
+  const double dL = to_radians(KAABA_LONGITUDE - longitude);
+  *y = cos(phiK) * sin(dL);
+  *x = cos(phi) * sin(phiK) - sin(phi) * cos(phiK) * cos(dL);
+  *z = sin(phi) * sin(phiK) + cos(phi) * cos(phiK) * cos(dL);
+}
+
+double qibla(const coordinates_t *coordinates) {
+  double y, x, z;
+  qibla_terms(coordinates->latitude, coordinates->longitude, &y, &x, &z);
+  return unwind_angle(to_degrees(safe_atan2(y, x)));
+}
+
+double qibla_distance(const coordinates_t *coordinates) {
+  double y, x, z;
+  qibla_terms(coordinates->latitude, coordinates->longitude, &y, &x, &z);
+  return EARTH_MEAN_RADIUS_KM * safe_atan2(sqrt(y * y + x * x), z);
+}
+
+/* qibla_terms() with the Kaaba's terms precomputed, for the batch loops */
+static inline void batch_terms(double latitude, double longitude, double sinK,
+                               double cosK, double *y, double *x, double *z) {
+  const double radians = M_PI / 180.0;
+  const double phi = latitude * radians;
+  const double dL = (KAABA_LONGITUDE - longitude) * radians;
+  const double sinPhi = sin(phi);
+  const double cosPhi = cos(phi);
+  const double cosDL = cos(dL);
+  *y = cosK * sin(dL);
+  *x = cosPhi * sinK - sinPhi * cosK * cosDL;
+  *z = sinPhi * sinK + cosPhi * cosK * cosDL;
+}
+
+void qibla_batch(const double *restrict latitudes,
+                 const double *restrict longitudes, size_t count,
+                 double *restrict bearings, double *restrict distances) {
+  const double degrees = 180.0 / M_PI;
+  const double radians = M_PI / 180.0;
+  const double sinK = sin(KAABA_LATITUDE * radians);
+  const double cosK = cos(KAABA_LATITUDE * radians);
+
+  if (!latitudes || !longitudes) {
+    return;
+  }
+
+  /* One loop per set of outputs, so none of them tests which to write */
+  if (bearings && distances) {
+    for (size_t i = 0; i < count; i++) {
+      double y, x, z;
+      batch_terms(latitudes[i], longitudes[i], sinK, cosK, &y, &x, &z);
+      const double bearing = atan2(y, x) * degrees;
+      bearings[i] = bearing < 0 ? bearing + 360.0 : bearing;
+      distances[i] = EARTH_MEAN_RADIUS_KM * atan2(sqrt(y * y + x * x), z);
+    }
+  } else if (bearings) {
+    for (size_t i = 0; i < count; i++) {
+      double y, x, z;
+      batch_terms(latitudes[i], longitudes[i], sinK, cosK, &y, &x, &z);
+      const double bearing = atan2(y, x) * degrees;
+      bearings[i] = bearing < 0 ? bearing + 360.0 : bearing;
+    }
+  } else if (distances) {
+    for (size_t i = 0; i < count; i++) {
+      double y, x, z;
+      batch_terms(latitudes[i], longitudes[i], sinK, cosK, &y, &x, &z);
+      distances[i] = EARTH_MEAN_RADIUS_KM * atan2(sqrt(y * y + x * x), z);
+    }
+  }
+}
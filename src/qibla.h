@@ -0,0 +1,48 @@
+#ifndef ADHAN_QIBLA_H
+#define ADHAN_QIBLA_H
+
+#include "coordinates.h"
+#include <stddef.h>
+
+/** Latitude of the Kaaba in degrees */
+#define KAABA_LATITUDE 21.4225241
+/** Longitude of the Kaaba in degrees */
+#define KAABA_LONGITUDE 39.8261818
+
+/** Mean radius of the Earth in kilometers (IUGG) */
+#define EARTH_MEAN_RADIUS_KM 6371.0088
+
+/**
+ * @brief Qibla direction
+ * @param[in] coordinates Observer's coordinates
+ * @return Initial great circle bearing to the Kaaba in degrees clockwise from
+ * true north, in [0, 360)
+ */
+double qibla(const coordinates_t *coordinates);
+
+/**
+ * @brief Great circle distance to the Kaaba
+ * @param[in] coordinates Observer's coordinates
+ * @return Distance in kilometers on a sphere of EARTH_MEAN_RADIUS_KM
+ */
+double qibla_distance(const coordinates_t *coordinates);
+
+/**
+ * @brief Qibla direction and distance for arrays of coordinates
+ *
+ * Structure of arrays variant of qibla() and qibla_distance() for bulk
+ * precomputation. Each combination of outputs has its own loop, without
+ * calls besides libm and with the sign of the bearing as a select, so it
+ * vectorizes when the toolchain provides vector math (e.g. glibc libmvec
+ * with -O3 -ffast-math).
+ *
+ * @param[in] latitudes Latitudes in degrees
+ * @param[in] longitudes Longitudes in degrees
+ * @param[in] count Number of coordinates
+ * @param[out] bearings Bearings in degrees, may be NULL
+ * @param[out] distances Distances in kilometers, may be NULL
+ */
+void qibla_batch(const double *latitudes, const double *longitudes,
+                 size_t count, double *bearings, double *distances);
+
+#endif /* ADHAN_QIBLA_H */
@@ -0,0 +1,395 @@
+#include "registry_loader.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define COLUMNS 12
+#define MAX_ADJUSTMENT 1440
+#define COORDINATE_UNITS 1e7
+
+/* Binary layout, fixed width fields without padding */
+static const char MAGIC[8] = {'A', 'D', 'H', 'A', 'N', 'R', 'E', 'G'};
+#define VERSION 1
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t rows;
+} registry_header_t;
+
+typedef struct {
+  int32_t latitude;  /* 1e-7 degrees */
+  int32_t longitude; /* 1e-7 degrees */
+  int16_t adjustments[7];
+  uint8_t method;
+  uint8_t madhab;
+  uint8_t highLatitudeRule;
+  uint8_t reserved[3];
+} registry_record_t;
+
+/* Exact powers of ten, for decimals whose digits fit in a double */
+static const double POWERS_OF_TEN[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+bool registry_file_open(const char *path, registry_file_t *file) {
+  return file_mapping_open(path, true, file);
+}
+
+void registry_file_close(registry_file_t *file) { file_mapping_close(file); }
+
+static bool binary_header(const char *data, size_t size,
+                          registry_header_t *header) {
+  if (size < sizeof(*header) || memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+    return false;
+  }
+  memcpy(header, data, sizeof(*header));
+  return true;
+}
+
+size_t registry_rows(const char *data, size_t size) {
+  registry_header_t header;
+  if (!data) {
+    return 0;
+  }
+  if (binary_header(data, size, &header)) {
+    return header.rows;
+  }
+  size_t rows = size > 0 && data[size - 1] != '\n';
+  for (const char *line = data, *end = data + size;
+       (line = memchr(line, '\n', (size_t)(end - line))) != NULL; line++) {
+    rows++;
+  }
+  return rows;
+}
+
+static bool is_digit(char c) { return (unsigned)(c - '0') < 10; }
+
+static bool is_number_char(char c) {
+  return is_digit(c) || c == '.' || c == '-' || c == '+' || c == 'e' ||
+         c == 'E';
+}
+
+/* Decimal number at `p`, NULL when there is none. Decimals of up to 15
+ * digits are divided by an exact power of ten, which rounds them like
+ * strtod(); the rest go through strtod() */
+static const char *parse_double(const char *p, const char *end,
+                                double *value) {
+  const char *start = p;
+  const bool negative = p < end && *p == '-';
+  p += p < end && (*p == '-' || *p == '+');
+
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int fraction = 0;
+  while (p < end && is_digit(*p)) {
+    mantissa = mantissa * 10 + (uint64_t)(*p++ - '0');
+    digits++;
+  }
+  if (p < end && *p == '.') {
+    p++;
+    while (p < end && is_digit(*p)) {
+      mantissa = mantissa * 10 + (uint64_t)(*p++ - '0');
+      digits++;
+      fraction++;
+    }
+  }
+  if (digits == 0) {
+    return NULL;
+  }
+  if (digits <= 15 && !(p < end && (*p == 'e' || *p == 'E'))) {
+    const double magnitude = (double)mantissa / POWERS_OF_TEN[fraction];
+    *value = negative ? -magnitude : magnitude;
+    return p;
+  }
+
+  char buffer[64];
+  const char *token = start;
+  while (token < end && is_number_char(*token)) {
+    token++;
+  }
+  const size_t length = (size_t)(token - start);
+  if (length >= sizeof(buffer)) {
+    return NULL;
+  }
+  memcpy(buffer, start, length);
+  buffer[length] = '\0';
+  char *parsed;
+  *value = strtod(buffer, &parsed);
+  return parsed == buffer + length ? token : NULL;
+}
+
+/* Integer of up to 9 digits at `p`, NULL when there is none */
+static const char *parse_integer(const char *p, const char *end,
+                                 long *value) {
+  const bool negative = p < end && *p == '-';
+  p += p < end && (*p == '-' || *p == '+');
+  long magnitude = 0;
+  int digits = 0;
+  while (p < end && is_digit(*p) && digits < 10) {
+    magnitude = magnitude * 10 + (*p++ - '0');
+    digits++;
+  }
+  if (digits == 0 || digits > 9) {
+    return NULL;
+  }
+  *value = negative ? -magnitude : magnitude;
+  return p;
+}
+
+static const char *skip_spaces(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t')) {
+    p++;
+  }
+  return p;
+}
+
+/* Validates the fields of a row and fills its coordinates and parameters */
+static registry_status_t
+make_location(double latitude, double longitude, const long *fields,
+              bool add_adjustments, unsigned *column,
+              coordinates_t *coordinates,
+              calculation_parameters_t *parameters) {
+  *column = 1;
+  if (!(latitude >= -90 && latitude <= 90)) {
+    return REGISTRY_BAD_COORDINATES;
+  }
+  *column = 2;
+  if (!init_coordinates(coordinates, latitude, longitude)) {
+    return REGISTRY_BAD_COORDINATES;
+  }
+  *column = 3;
+  if (fields[0] < 0 || fields[0] > OTHER) {
+    return REGISTRY_BAD_METHOD;
+  }
+  *column = 4;
+  if (fields[1] < 0 || fields[1] > HANAFI) {
+    return REGISTRY_BAD_MADHAB;
+  }
+  *column = 5;
+  if (fields[2] < 0 || fields[2] > NEAREST_LATITUDE) {
+    return REGISTRY_BAD_RULE;
+  }
+  for (int i = 3; i < COLUMNS - 2; i++) {
+    *column = (unsigned)i + 3;
+    if (fields[i] < -MAX_ADJUSTMENT || fields[i] > MAX_ADJUSTMENT) {
+      return REGISTRY_BAD_ADJUSTMENT;
+    }
+  }
+
+  *parameters = getParameters((calculation_method)fields[0]);
+  parameters->madhab = (madhab_t)fields[1];
+  parameters->highLatitudeRule = (high_latitude_rule_t)fields[2];
+  prayer_adjustments_t *adjustments = &parameters->adjustments;
+  if (!add_adjustments) {
+    *adjustments = INIT_PRAYER_ADJUSTMENTS();
+  }
+  adjustments->fajr += (int)fields[3];
+  adjustments->sunrise += (int)fields[4];
+  adjustments->dhuhr += (int)fields[5];
+  adjustments->asr += (int)fields[6];
+  adjustments->maghrib += (int)fields[7];
+  adjustments->isha += (int)fields[8];
+  adjustments->midnight += (int)fields[9];
+  *column = 0;
+  return REGISTRY_OK;
+}
+
+static registry_status_t parse_row(const char *p, const char *end,
+                                   unsigned *column,
+                                   coordinates_t *coordinates,
+                                   calculation_parameters_t *parameters) {
+  double latitude = 0;
+  double longitude = 0;
+  long fields[COLUMNS - 2];
+
+  for (int i = 0; i < COLUMNS; i++) {
+    *column = (unsigned)i + 1;
+    p = skip_spaces(p, end);
+    if (p == end) {
+      return REGISTRY_BAD_COLUMNS;
+    }
+    p = i == 0   ? parse_double(p, end, &latitude)
+        : i == 1 ? parse_double(p, end, &longitude)
+                 : parse_integer(p, end, &fields[i - 2]);
+    if (!p) {
+      return REGISTRY_BAD_NUMBER;
+    }
+    p = skip_spaces(p, end);
+    if (i + 1 < COLUMNS) {
+      if (p == end) {
+        *column = (unsigned)i + 2;
+        return REGISTRY_BAD_COLUMNS;
+      }
+      if (*p++ != ',') {
+        return REGISTRY_BAD_NUMBER;
+      }
+    } else if (p != end) {
+      return *p == ',' ? REGISTRY_BAD_COLUMNS : REGISTRY_BAD_NUMBER;
+    }
+  }
+  return make_location(latitude, longitude, fields, true, column,
+                       coordinates, parameters);
+}
+
+static void report(registry_error_t *errors, size_t error_capacity,
+                   size_t *rejected, size_t line, unsigned column,
+                   registry_status_t status) {
+  if (errors && *rejected < error_capacity) {
+    errors[*rejected] = (registry_error_t){line, column, status};
+  }
+  (*rejected)++;
+}
+
+static size_t parse_binary(const char *data, size_t size,
+                           const registry_header_t *header,
+                           coordinates_t *coordinates,
+                           calculation_parameters_t *parameters,
+                           size_t capacity, registry_error_t *errors,
+                           size_t error_capacity, size_t *rejected) {
+  const size_t rows = header->rows;
+  if (header->version != VERSION ||
+      (size - sizeof(*header)) / sizeof(registry_record_t) != rows ||
+      (size - sizeof(*header)) % sizeof(registry_record_t) != 0) {
+    report(errors, error_capacity, rejected, 0, 0, REGISTRY_BAD_HEADER);
+    return 0;
+  }
+
+  size_t count = 0;
+  const char *record = data + sizeof(*header);
+  for (size_t row = 0; row < rows && count < capacity;
+       row++, record += sizeof(registry_record_t)) {
+    registry_record_t fields;
+    memcpy(&fields, record, sizeof(fields));
+    const long values[COLUMNS - 2] = {
+        fields.method,         fields.madhab,         fields.highLatitudeRule,
+        fields.adjustments[0], fields.adjustments[1], fields.adjustments[2],
+        fields.adjustments[3], fields.adjustments[4], fields.adjustments[5],
+        fields.adjustments[6]};
+    unsigned column;
+    const registry_status_t status = make_location(
+        fields.latitude / COORDINATE_UNITS, fields.longitude / COORDINATE_UNITS,
+        values, false, &column, &coordinates[count], &parameters[count]);
+    if (status == REGISTRY_OK) {
+      count++;
+    } else {
+      report(errors, error_capacity, rejected, row + 1, column, status);
+    }
+  }
+  return count;
+}
+
+static size_t parse_csv(const char *data, size_t size,
+                        coordinates_t *coordinates,
+                        calculation_parameters_t *parameters,
+                        size_t capacity, registry_error_t *errors,
+                        size_t error_capacity, size_t *rejected) {
+  const char *end = data + size;
+  size_t count = 0;
+  size_t line = 0;
+  bool content = false;
+
+  for (const char *p = data; count < capacity && p < end;) {
+    const char *newline = memchr(p, '\n', (size_t)(end - p));
+    const char *next = newline ? newline + 1 : end;
+    const char *stop = newline ? newline : end;
+    stop -= stop > p && stop[-1] == '\r';
+    const char *first = skip_spaces(p, stop);
+    line++;
+    p = next;
+
+    /* Blank lines, comments and the column names */
+    const bool letter = first < stop && ((*first | 0x20) >= 'a' &&
+                                         (*first | 0x20) <= 'z');
+    if (first == stop || *first == '#' || (letter && !content)) {
+      content = content || letter;
+      continue;
+    }
+    content = true;
+
+    unsigned column;
+    const registry_status_t status = parse_row(
+        first, stop, &column, &coordinates[count], &parameters[count]);
+    if (status == REGISTRY_OK) {
+      count++;
+    } else {
+      report(errors, error_capacity, rejected, line, column, status);
+    }
+  }
+  return count;
+}
+
+size_t registry_parse(const char *data, size_t size,
+                      coordinates_t *coordinates,
+                      calculation_parameters_t *parameters, size_t capacity,
+                      registry_error_t *errors, size_t error_capacity,
+                      size_t *error_count) {
+  size_t rejected = 0;
+  size_t count = 0;
+  registry_header_t header;
+
+  if (data && coordinates && parameters) {
+    count = binary_header(data, size, &header)
+                ? parse_binary(data, size, &header, coordinates, parameters,
+                               capacity, errors, error_capacity, &rejected)
+                : parse_csv(data, size, coordinates, parameters, capacity,
+                            errors, error_capacity, &rejected);
+  }
+  if (error_count) {
+    *error_count = rejected;
+  }
+  return count;
+}
+
+bool registry_write_binary(const char *path, const coordinates_t *coordinates,
+                           const calculation_parameters_t *parameters,
+                           size_t count) {
+  if (!path || !coordinates || !parameters || count > UINT32_MAX) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    coordinates_t valid;
+    const calculation_parameters_t *p = &parameters[i];
+    const int adjustments[7] = {
+        p->adjustments.fajr,    p->adjustments.sunrise, p->adjustments.dhuhr,
+        p->adjustments.asr,     p->adjustments.maghrib, p->adjustments.isha,
+        p->adjustments.midnight};
+    bool ok = init_coordinates(&valid, coordinates[i].latitude,
+                               coordinates[i].longitude) &&
+              (unsigned)p->method <= OTHER && (unsigned)p->madhab <= HANAFI &&
+              (unsigned)p->highLatitudeRule <= NEAREST_LATITUDE;
+    for (int j = 0; ok && j < 7; j++) {
+      ok = adjustments[j] >= -MAX_ADJUSTMENT &&
+           adjustments[j] <= MAX_ADJUSTMENT;
+    }
+    if (!ok) {
+      return false;
+    }
+  }
+
+  FILE *file = fopen(path, "wb");
+  registry_header_t header = {{0}, VERSION, (uint32_t)count};
+  memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  bool written = file && fwrite(&header, sizeof(header), 1, file) == 1;
+  for (size_t i = 0; written && i < count; i++) {
+    const calculation_parameters_t *p = &parameters[i];
+    const registry_record_t record = {
+        (int32_t)lround(coordinates[i].latitude * COORDINATE_UNITS),
+        (int32_t)lround(coordinates[i].longitude * COORDINATE_UNITS),
+        {(int16_t)p->adjustments.fajr, (int16_t)p->adjustments.sunrise,
+         (int16_t)p->adjustments.dhuhr, (int16_t)p->adjustments.asr,
+         (int16_t)p->adjustments.maghrib, (int16_t)p->adjustments.isha,
+         (int16_t)p->adjustments.midnight},
+        (uint8_t)p->method,
+        (uint8_t)p->madhab,
+        (uint8_t)p->highLatitudeRule,
+        {0, 0, 0}};
+    written = fwrite(&record, sizeof(record), 1, file) == 1;
+  }
+  if (file && fclose(file) != 0) {
+    written = false;
+  }
+  return written;
+}
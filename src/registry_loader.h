@@ -0,0 +1,101 @@
+#ifndef ADHAN_REGISTRY_LOADER_H
+#define ADHAN_REGISTRY_LOADER_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include "file_mapping.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Why a row of a registry was rejected
+ */
+typedef enum {
+  REGISTRY_OK,
+  REGISTRY_BAD_HEADER,      /**< Binary header or size does not match */
+  REGISTRY_BAD_COLUMNS,     /**< Missing or extra fields */
+  REGISTRY_BAD_NUMBER,      /**< A field is not a number */
+  REGISTRY_BAD_COORDINATES, /**< Not valid for init_coordinates() */
+  REGISTRY_BAD_METHOD,      /**< Not a calculation_method */
+  REGISTRY_BAD_MADHAB,      /**< Not a madhab_t */
+  REGISTRY_BAD_RULE,        /**< Not a high_latitude_rule_t */
+  REGISTRY_BAD_ADJUSTMENT   /**< More than a day of adjustment */
+} registry_status_t;
+
+/**
+ * @brief Rejected row of a registry
+ */
+typedef struct {
+  size_t line;     /**< 1 based line of a CSV or record of a binary */
+  unsigned column; /**< 1 based field, 0 for the whole row */
+  registry_status_t status;
+} registry_error_t;
+
+/**
+ * @brief Registry file mapped into memory, or read on systems without mmap
+ */
+typedef file_mapping_t registry_file_t;
+
+/**
+ * @brief Map a registry file for registry_parse(), for a sequential read
+ * @return false when the file cannot be read
+ */
+bool registry_file_open(const char *path, registry_file_t *file);
+
+void registry_file_close(registry_file_t *file);
+
+/**
+ * @brief Upper bound of the rows of a registry, to size the arrays of
+ * registry_parse()
+ */
+size_t registry_rows(const char *data, size_t size);
+
+/**
+ * @brief Parse a CSV or binary registry into coordinates and parameters
+ *
+ * A CSV registry has one location per line:
+ *
+ *     latitude,longitude,method,madhab,rule,fajr,sunrise,dhuhr,asr,
+ *     maghrib,isha,midnight
+ *
+ * with the calculation_method, madhab_t and high_latitude_rule_t as
+ * numbers, and seven adjustments in minutes that are added to those of
+ * getParameters(). Blank lines, lines that start with `#` and a first line
+ * that starts with a letter, the column names, are skipped; lines may end
+ * with CRLF.
+ *
+ * A binary registry, written by registry_write_binary(), starts with
+ * `ADHANREG` and holds the same fields, with the final adjustments, in
+ * fixed width records of the byte order of the machine that wrote it.
+ *
+ * Rows are scanned in place without allocating, and the row boundaries
+ * are found with memchr(), which C libraries vectorize. Rejected rows are
+ * left out of the arrays, which hold the valid rows in order.
+ *
+ * @param[out] coordinates At least `capacity` entries
+ * @param[out] parameters At least `capacity` entries
+ * @param[out] errors The first `error_capacity` rejected rows, may be NULL;
+ * a binary registry whose header does not match is rejected as line 0
+ * @param[out] error_count Number of rejected rows, may be NULL
+ * @return Number of valid rows written, at most `capacity`
+ */
+size_t registry_parse(const char *data, size_t size,
+                      coordinates_t *coordinates,
+                      calculation_parameters_t *parameters, size_t capacity,
+                      registry_error_t *errors, size_t error_capacity,
+                      size_t *error_count);
+
+/**
+ * @brief Write locations as a binary registry
+ *
+ * Stores the method, madhab, high latitude rule and adjustments of each
+ * location, so parsing it back gives getParameters() of the method with
+ * those fields. Coordinates are stored in units of 1e-7 degrees.
+ *
+ * @return false when a location is invalid or the file cannot be written
+ */
+bool registry_write_binary(const char *path, const coordinates_t *coordinates,
+                           const calculation_parameters_t *parameters,
+                           size_t count);
+
+#endif /* ADHAN_REGISTRY_LOADER_H */
@@ -0,0 +1,308 @@
+#ifdef ADHAN_THREADS
+/* sched_yield() and pthreads with the C17 standard library */
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "snapshot_registry.h"
+#include "calendrical_helper.h"
+#include "timetable.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#ifdef ADHAN_THREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#define CACHE_LINE 64
+
+/* Counter of a reader, odd while it holds a snapshot, alone on its cache
+ * line so that readers do not slow each other down */
+typedef struct {
+  _Alignas(CACHE_LINE) atomic_ulong count;
+} reader_slot_t;
+
+_Static_assert(sizeof(reader_slot_t) == CACHE_LINE,
+               "aligned_alloc() needs a multiple of the alignment");
+
+struct snapshot_registry {
+  registry_location_t *locations;
+  size_t count;
+  calculation_parameters_t *parameters;
+  daily_snapshot_t snapshots[2];
+  prayer_times_t *buffers[2];
+  _Atomic(daily_snapshot_t *) current;
+  bool prewarmed; /* The other snapshot is ready to be published */
+  unsigned readers;
+  reader_slot_t *slots;
+#ifdef ADHAN_THREADS
+  pthread_mutex_t mutex;
+  pthread_cond_t wake;
+  pthread_t thread;
+  bool running;
+  bool stopping;
+  unsigned lead;
+#endif
+};
+
+static time_t start_of_day(time_t date) {
+  return (time_t)floor_div((int64_t)date, SECONDS_PER_DAY) * SECONDS_PER_DAY;
+}
+
+const prayer_times_t *daily_snapshot_times(const daily_snapshot_t *snapshot,
+                                           size_t location, time_t date) {
+  if (!snapshot || location >= snapshot->locations) {
+    return NULL;
+  }
+  const long day = floor_div((int64_t)(date - snapshot->day), SECONDS_PER_DAY);
+  if (day < 0 || day >= SNAPSHOT_DAYS) {
+    return NULL;
+  }
+  return &snapshot->times[location * SNAPSHOT_DAYS + (size_t)day];
+}
+
+snapshot_registry_t *
+snapshot_registry_new(const registry_location_t *locations, size_t count,
+                      const calculation_parameters_t *parameters,
+                      size_t parameter_sets, unsigned readers, time_t now) {
+  if (!locations || count == 0 || !parameters || parameter_sets == 0 ||
+      readers == 0) {
+    return NULL;
+  }
+  for (size_t i = 0; i < count; i++) {
+    const coordinates_t *coordinates = &locations[i].coordinates;
+    if (coordinates->latitude < -90 || coordinates->latitude > 90 ||
+        coordinates->longitude < -180 || coordinates->longitude > 180 ||
+        locations[i].parameters >= parameter_sets) {
+      return NULL;
+    }
+  }
+
+  snapshot_registry_t *registry = calloc(1, sizeof(*registry));
+  if (!registry) {
+    return NULL;
+  }
+  registry->count = count;
+  registry->readers = readers;
+  registry->locations = malloc(count * sizeof(*locations));
+  registry->parameters = malloc(parameter_sets * sizeof(*parameters));
+  /* calloc() only aligns to max_align_t, not to a cache line */
+  registry->slots = aligned_alloc(CACHE_LINE, readers * sizeof(reader_slot_t));
+  for (int i = 0; i < 2; i++) {
+    registry->buffers[i] =
+        calloc(count * SNAPSHOT_DAYS, sizeof(*registry->buffers[i]));
+    registry->snapshots[i] =
+        (daily_snapshot_t){0, count, registry->buffers[i]};
+  }
+  bool ok = registry->locations && registry->parameters && registry->slots &&
+            registry->buffers[0] && registry->buffers[1];
+#ifdef ADHAN_THREADS
+  ok = ok && pthread_mutex_init(&registry->mutex, NULL) == 0;
+  if (ok && pthread_cond_init(&registry->wake, NULL) != 0) {
+    pthread_mutex_destroy(&registry->mutex);
+    ok = false;
+  }
+#endif
+  if (!ok) {
+    free(registry->buffers[1]);
+    free(registry->buffers[0]);
+    free(registry->slots);
+    free(registry->parameters);
+    free(registry->locations);
+    free(registry);
+    return NULL;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    registry->locations[i] = locations[i];
+  }
+  for (size_t i = 0; i < parameter_sets; i++) {
+    registry->parameters[i] = parameters[i];
+  }
+  for (unsigned i = 0; i < readers; i++) {
+    atomic_init(&registry->slots[i].count, 0);
+  }
+  /* The first snapshot is computed in the second buffer and published
+   * before any reader can see the registry */
+  registry->snapshots[0].day = start_of_day(now);
+  atomic_init(&registry->current, &registry->snapshots[0]);
+  snapshot_registry_prewarm(registry, now);
+  atomic_store(&registry->current, &registry->snapshots[1]);
+  registry->prewarmed = false;
+  return registry;
+}
+
+void snapshot_registry_free(snapshot_registry_t *registry) {
+  if (!registry) {
+    return;
+  }
+  snapshot_registry_stop(registry);
+#ifdef ADHAN_THREADS
+  pthread_cond_destroy(&registry->wake);
+  pthread_mutex_destroy(&registry->mutex);
+#endif
+  free(registry->buffers[1]);
+  free(registry->buffers[0]);
+  free(registry->slots);
+  free(registry->parameters);
+  free(registry->locations);
+  free(registry);
+}
+
+const daily_snapshot_t *snapshot_registry_acquire(
+    snapshot_registry_t *registry, unsigned reader) {
+  if (!registry || reader >= registry->readers) {
+    return NULL;
+  }
+  /* Both sequentially consistent: a publisher that misses this increment
+   * swapped the pointer before it, so the load below sees the new one */
+  atomic_fetch_add(&registry->slots[reader].count, 1);
+  return atomic_load(&registry->current);
+}
+
+void snapshot_registry_release(snapshot_registry_t *registry,
+                               unsigned reader) {
+  if (registry && reader < registry->readers) {
+    atomic_fetch_add_explicit(&registry->slots[reader].count, 1,
+                              memory_order_release);
+  }
+}
+
+void snapshot_registry_prewarm(snapshot_registry_t *registry, time_t date) {
+  if (!registry) {
+    return;
+  }
+  const daily_snapshot_t *current =
+      atomic_load_explicit(&registry->current, memory_order_relaxed);
+  const int index = current == &registry->snapshots[0] ? 1 : 0;
+  daily_snapshot_t *next = &registry->snapshots[index];
+  prayer_times_t *times = registry->buffers[index];
+  const time_t day = start_of_day(date);
+  /* Tomorrow of the published snapshot is today of the next one */
+  const bool shift = day == current->day + SECONDS_PER_DAY;
+
+  for (size_t i = 0; i < registry->count; i++) {
+    registry_location_t *location = &registry->locations[i];
+    prayer_times_t *row = &times[i * SNAPSHOT_DAYS];
+    if (shift) {
+      row[0] = current->times[i * SNAPSHOT_DAYS + 1];
+      new_prayer_times_range(&location->coordinates, day + SECONDS_PER_DAY,
+                             SNAPSHOT_DAYS - 1,
+                             &registry->parameters[location->parameters],
+                             NULL, row + 1);
+    } else {
+      new_prayer_times_range(&location->coordinates, day, SNAPSHOT_DAYS,
+                             &registry->parameters[location->parameters],
+                             NULL, row);
+    }
+  }
+  next->day = day;
+  registry->prewarmed = true;
+}
+
+/* Wait until no reader holds a snapshot acquired before the last swap */
+static void synchronize(snapshot_registry_t *registry) {
+  for (unsigned i = 0; i < registry->readers; i++) {
+    atomic_ulong *count = &registry->slots[i].count;
+    const unsigned long held = atomic_load(count);
+    while ((held & 1) && atomic_load(count) == held) {
+#ifdef ADHAN_THREADS
+      sched_yield();
+#endif
+    }
+  }
+}
+
+bool snapshot_registry_publish(snapshot_registry_t *registry) {
+  if (!registry || !registry->prewarmed) {
+    return false;
+  }
+  const daily_snapshot_t *current =
+      atomic_load_explicit(&registry->current, memory_order_relaxed);
+  daily_snapshot_t *next = current == &registry->snapshots[0]
+                               ? &registry->snapshots[1]
+                               : &registry->snapshots[0];
+  atomic_store(&registry->current, next);
+  registry->prewarmed = false;
+  synchronize(registry);
+  return true;
+}
+
+#ifdef ADHAN_THREADS
+static void wait_until(snapshot_registry_t *registry, time_t deadline) {
+  const struct timespec until = {deadline, 0};
+  pthread_cond_timedwait(&registry->wake, &registry->mutex, &until);
+}
+
+static void *prewarmer(void *argument) {
+  snapshot_registry_t *registry = argument;
+  pthread_mutex_lock(&registry->mutex);
+  while (!registry->stopping) {
+    const daily_snapshot_t *current =
+        atomic_load_explicit(&registry->current, memory_order_relaxed);
+    const time_t now = time(NULL);
+    time_t next = current->day + SECONDS_PER_DAY;
+    if (next < start_of_day(now)) {
+      next = start_of_day(now);
+    }
+    if (now < next - (time_t)registry->lead) {
+      wait_until(registry, next - (time_t)registry->lead);
+      continue;
+    }
+
+    pthread_mutex_unlock(&registry->mutex);
+    snapshot_registry_prewarm(registry, next);
+    pthread_mutex_lock(&registry->mutex);
+    while (!registry->stopping && time(NULL) < next) {
+      wait_until(registry, next);
+    }
+    if (!registry->stopping) {
+      pthread_mutex_unlock(&registry->mutex);
+      snapshot_registry_publish(registry);
+      pthread_mutex_lock(&registry->mutex);
+    }
+  }
+  pthread_mutex_unlock(&registry->mutex);
+  return NULL;
+}
+#endif
+
+bool snapshot_registry_start(snapshot_registry_t *registry, unsigned lead) {
+#ifdef ADHAN_THREADS
+  if (!registry) {
+    return false;
+  }
+  pthread_mutex_lock(&registry->mutex);
+  bool ok = !registry->running;
+  if (ok) {
+    registry->lead = lead;
+    registry->stopping = false;
+    ok = pthread_create(&registry->thread, NULL, prewarmer, registry) == 0;
+    registry->running = ok;
+  }
+  pthread_mutex_unlock(&registry->mutex);
+  return ok;
+#else
+  (void)registry;
+  (void)lead;
+  return false;
+#endif
+}
+
+void snapshot_registry_stop(snapshot_registry_t *registry) {
+#ifdef ADHAN_THREADS
+  if (!registry) {
+    return;
+  }
+  pthread_mutex_lock(&registry->mutex);
+  const bool running = registry->running;
+  registry->stopping = true;
+  pthread_cond_signal(&registry->wake);
+  pthread_mutex_unlock(&registry->mutex);
+  if (running) {
+    pthread_join(registry->thread, NULL);
+    registry->running = false;
+  }
+#else
+  (void)registry;
+#endif
+}
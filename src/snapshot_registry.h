@@ -0,0 +1,134 @@
+#ifndef ADHAN_SNAPSHOT_REGISTRY_H
+#define ADHAN_SNAPSHOT_REGISTRY_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include "prayer_times.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/** Days of each location in a snapshot: today and tomorrow */
+#define SNAPSHOT_DAYS 2
+
+/**
+ * @brief Location of a registry and the index of its calculation parameters
+ */
+typedef struct {
+  coordinates_t coordinates;
+  uint32_t parameters; /**< Index in the parameters of the registry */
+} registry_location_t;
+
+/**
+ * @brief Prayer times of every location of a registry for two UTC days
+ *
+ * The times of location `i` on the day `d` after `day` are
+ * `times[i * SNAPSHOT_DAYS + d]`.
+ */
+typedef struct {
+  time_t day;                  /**< 0h UTC of the first day */
+  size_t locations;            /**< Locations of the registry */
+  const prayer_times_t *times; /**< SNAPSHOT_DAYS entries per location */
+} daily_snapshot_t;
+
+/**
+ * @brief Times of a location on the UTC day of `date`
+ * @return NULL when the location or the day is not in the snapshot
+ */
+const prayer_times_t *daily_snapshot_times(const daily_snapshot_t *snapshot,
+                                           size_t location, time_t date);
+
+/**
+ * @brief Fixed set of locations whose snapshot is read by many threads
+ *
+ * Readers get the published snapshot without locks or waiting: each reader
+ * has its own counter, which snapshot_registry_acquire() and
+ * snapshot_registry_release() increment. A new snapshot is computed in a
+ * second buffer and published by swapping one atomic pointer; the publisher
+ * then waits until every reader that may hold the previous snapshot has
+ * released it, and reuses its buffer for the next one.
+ */
+typedef struct snapshot_registry snapshot_registry_t;
+
+/**
+ * @brief Create a registry and compute the snapshot of the UTC day of `now`
+ *
+ * `locations` and `parameters` are copied.
+ *
+ * @param readers Number of threads that read the registry at the same time
+ * @return NULL when a location is invalid or refers to missing parameters,
+ * `readers` is 0 or memory runs out
+ */
+snapshot_registry_t *
+snapshot_registry_new(const registry_location_t *locations, size_t count,
+                      const calculation_parameters_t *parameters,
+                      size_t parameter_sets, unsigned readers, time_t now);
+
+/**
+ * @brief Stop the pre-warmer and release the registry
+ *
+ * No reader may hold a snapshot.
+ */
+void snapshot_registry_free(snapshot_registry_t *registry);
+
+/**
+ * @brief Published snapshot, valid until snapshot_registry_release()
+ *
+ * Wait free. Each reader index is used by one thread at a time, and a
+ * reader releases its snapshot before acquiring another one.
+ *
+ * @param reader Index of the reader, below the `readers` of the registry
+ * @return NULL when `reader` is out of range
+ */
+const daily_snapshot_t *snapshot_registry_acquire(
+    snapshot_registry_t *registry, unsigned reader);
+
+/**
+ * @brief Release the snapshot acquired by `reader`
+ */
+void snapshot_registry_release(snapshot_registry_t *registry,
+                               unsigned reader);
+
+/**
+ * @brief Compute the snapshot that starts at the UTC day of `date`, without
+ * publishing it
+ *
+ * When it starts the day after the published one, the times of that day
+ * are copied from it and only the next day is computed.
+ *
+ * Writer call: snapshot_registry_prewarm() and snapshot_registry_publish()
+ * must not run at the same time as each other or the pre-warmer.
+ */
+void snapshot_registry_prewarm(snapshot_registry_t *registry, time_t date);
+
+/**
+ * @brief Publish the snapshot of snapshot_registry_prewarm()
+ *
+ * Returns once no reader holds the previous snapshot, so it must not be
+ * called by a thread that holds one.
+ *
+ * @return false when no snapshot was computed since the last publication
+ */
+bool snapshot_registry_publish(snapshot_registry_t *registry);
+
+/**
+ * @brief Start a thread that keeps the snapshot on the current UTC day
+ *
+ * The thread computes the next day's snapshot `lead` seconds before each
+ * UTC midnight and publishes it at midnight. A snapshot also holds the day
+ * after its own, so readers that look up times by date find them while
+ * the next one is published. Snapshots that are already out of date are
+ * replaced right away.
+ *
+ * @return false when the library is built without ADHAN_THREADS, the
+ * thread is already running or cannot be started
+ */
+bool snapshot_registry_start(snapshot_registry_t *registry, unsigned lead);
+
+/**
+ * @brief Stop the thread of snapshot_registry_start(), if running
+ */
+void snapshot_registry_stop(snapshot_registry_t *registry);
+
+#endif /* ADHAN_SNAPSHOT_REGISTRY_H */
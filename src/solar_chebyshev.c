@@ -0,0 +1,59 @@
+#include "solar_chebyshev.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+
+/* Defined in the generated solar_chebyshev_table.c */
+extern const double solar_chebyshev_first_julian_day;
+extern const int solar_chebyshev_segments;
+extern const float
+    solar_chebyshev_coefficients[][SOLAR_CHEBYSHEV_COEFFICIENTS];
+
+/* Clenshaw's recurrence for the sum of c[j] * T_j(x) */
+static double chebyshev_sum(const float *c, int order, double x) {
+  double b1 = 0;
+  double b2 = 0;
+  for (int j = order - 1; j >= 1; j--) {
+    const double b0 = 2 * x * b1 - b2 + c[j];
+    b2 = b1;
+    b1 = b0;
+  }
+  return x * b1 - b2 + c[0];
+}
+
+bool chebyshev_solar_coordinates(double julian_day,
+                                 solar_coordinates_t *coordinates) {
+  const double segment = (julian_day - solar_chebyshev_first_julian_day) /
+                         SOLAR_CHEBYSHEV_SEGMENT_DAYS;
+  /* Also rejects NaN */
+  if (!(segment >= 0 && segment <= solar_chebyshev_segments)) {
+    return false;
+  }
+  int index = (int)segment;
+  if (index == solar_chebyshev_segments) {
+    index--;
+  }
+  const double x = 2 * (segment - index) - 1;
+
+  const float *c = solar_chebyshev_coefficients[index];
+  const double declination =
+      chebyshev_sum(c, SOLAR_CHEBYSHEV_DECLINATION_ORDER, x);
+  c += SOLAR_CHEBYSHEV_DECLINATION_ORDER;
+  const double rightAscension =
+      chebyshev_sum(c, SOLAR_CHEBYSHEV_RIGHT_ASCENSION_ORDER, x);
+  c += SOLAR_CHEBYSHEV_RIGHT_ASCENSION_ORDER;
+  const double equinoxes = chebyshev_sum(c, SOLAR_CHEBYSHEV_EQUINOXES_ORDER, x);
+
+  coordinates->declination = declination;
+  coordinates->rightAscension = unwind_angle(rightAscension);
+  coordinates->apparentSiderealTime =
+      mean_sidereal_time(julian_century(julian_day)) + equinoxes;
+  return true;
+}
+
+void chebyshev_solar_range(double *first_julian_day, double *last_julian_day) {
+  *first_julian_day = solar_chebyshev_first_julian_day;
+  *last_julian_day = solar_chebyshev_first_julian_day +
+                     (double)solar_chebyshev_segments *
+                         SOLAR_CHEBYSHEV_SEGMENT_DAYS;
+}
@@ -0,0 +1,46 @@
+#ifndef ADHAN_SOLAR_CHEBYSHEV_H
+#define ADHAN_SOLAR_CHEBYSHEV_H
+
+#include "solar_coordinates.h"
+#include <stdbool.h>
+
+/** Days covered by each segment of the Chebyshev table */
+#define SOLAR_CHEBYSHEV_SEGMENT_DAYS 128
+
+/** Coefficients of the declination in each segment */
+#define SOLAR_CHEBYSHEV_DECLINATION_ORDER 12
+
+/** Coefficients of the unwrapped right ascension in each segment */
+#define SOLAR_CHEBYSHEV_RIGHT_ASCENSION_ORDER 12
+
+/** Coefficients of the equation of the equinoxes in each segment */
+#define SOLAR_CHEBYSHEV_EQUINOXES_ORDER 6
+
+/** Coefficients of one segment, declination first */
+#define SOLAR_CHEBYSHEV_COEFFICIENTS                                          \
+  (SOLAR_CHEBYSHEV_DECLINATION_ORDER +                                        \
+   SOLAR_CHEBYSHEV_RIGHT_ASCENSION_ORDER + SOLAR_CHEBYSHEV_EQUINOXES_ORDER)
+
+/**
+ * @brief Solar coordinates at a Julian day from piecewise Chebyshev series
+ *
+ * The declination, the right ascension, unwrapped within each segment, and
+ * the equation of the equinoxes are fitted per SOLAR_CHEBYSHEV_SEGMENT_DAYS
+ * by tools/solar_chebyshev_gen.c, and the mean sidereal time is computed
+ * exactly. Any instant in the table range costs the same few multiply-adds,
+ * so fractional days are as cheap as whole ones. The series stay within
+ * 3e-5 degrees of the exact coordinates, except for the 13.7 day lunar term
+ * of the nutation, up to 6.4e-5 degrees of sidereal time, that is left out
+ * of the fit.
+ *
+ * @return false, leaving `coordinates` unchanged, outside the table range
+ */
+bool chebyshev_solar_coordinates(double julian_day,
+                                 solar_coordinates_t *coordinates);
+
+/**
+ * @brief First and last Julian day covered by the Chebyshev table
+ */
+void chebyshev_solar_range(double *first_julian_day, double *last_julian_day);
+
+#endif /* ADHAN_SOLAR_CHEBYSHEV_H */
@@ -0,0 +1,5725 @@
+/*
+ * Generated by tools/solar_chebyshev_gen.c, do not edit.
+ *
+ * Chebyshev coefficients of the declination, the unwrapped right
+ * ascension and the equation of the equinoxes, in degrees, for
+ * 571 segments of 128 days from Julian day 2433282.5.
+ */
+#include "solar_chebyshev.h"
+
+const double solar_chebyshev_first_julian_day = 2433282.5;
+const int solar_chebyshev_segments = 571;
+
+const float
+    solar_chebyshev_coefficients[][SOLAR_CHEBYSHEV_COEFFICIENTS] = {
+        /* 2433282.5 */ {
+            -4.48548985, 21.253624, 1.5073545, -1.15373933,
+            0.0199325252, 0.00765731372, -0.00417384552, 0.000960097648,
+            5.32674603e-05, -3.85711719e-05, 1.0138483e-05, -1.08411757e-06,
+            -15.5142393, 61.6153374, -1.47119462, 0.655359983,
+            0.097546123, -0.0438442975, 0.0024099052, 0.000316570513,
+            -0.000454840483, 0.000102716556, 4.31521994e-06, -5.2191881e-06,
+            -0.000627881614, -6.09928065e-05, -0.000146987673, 9.10404415e-05,
+            1.78290175e-05, -6.14839428e-06,
+        },
+        /* 2433410.5 */ {
+            16.1063423, -7.13384199, -5.82445526, 0.440943211,
+            0.155447617, -0.0202552322, -0.00308029074, 0.00142943929,
+            7.98217879e-05, -9.25728527e-05, 3.03566594e-06, 5.98077668e-06,
+            109.347687, 63.487709, -1.13999474, -0.508801758,
+            0.160648987, 0.0380326137, -0.01203728, -0.00113802124,
+            0.000894863158, -1.06672896e-05, -6.38786805e-05, 7.64544166e-06,
+            -0.000122137746, 0.000544659968, -0.000166050202, -8.54999671e-05,
+            2.00840732e-05, 5.76981938e-06,
+        },
+        /* 2433538.5 */ {
+            -13.4330311, -12.9178858, 5.24602747, 0.925195932,
+            -0.120674327, -0.0415648855, -0.00251185568, 0.00202910299,
+            0.000469161459, -5.49918077e-05, -4.04562925e-05, -3.97859321e-06,
+            -125.712067, 65.2338409, 2.29505825, -0.28755784,
+            -0.280174971, -0.00265528332, 0.0171757806, 0.00310936198,
+            -0.000655680604, -0.000367901346, -1.25011993e-05, 2.81112189e-05,
+            0.000325625588, 0.000385843014, 0.000248119963, -3.92128131e-05,
+            -3.00244446e-05, 2.64493269e-06,
+        },
+        /* 2433666.5 */ {
+            0.910144925, 21.9138412, -0.465487719, -1.09657001,
+            0.0316742659, -8.73832832e-05, -0.000214858403, 0.000933209492,
+            -5.03943447e-05, -6.29666556e-06, 3.93991968e-07, -1.58796729e-06,
+            2.95573711, 60.6449013, -0.314207196, 0.748622715,
+            -0.0211048871, -0.0367281288, 0.00151971052, -0.000605909794,
+            5.58055544e-05, 8.35663886e-05, -6.51318987e-06, 7.05596449e-07,
+            0.000858215964, -0.000125184364, 1.46329357e-05, 0.000109221932,
+            -1.85282181e-06, -7.37583923e-06,
+        },
+        /* 2433794.5 */ {
+            13.6048527, -13.1392956, -4.83386326, 0.733461857,
+            0.0944443867, -0.0220415518, 0.00205676188, 0.000987435225,
+            -0.000239740402, -2.06646509e-05, 1.62331744e-05, -1.8677232e-06,
+            -232.462112, 62.2219925, -1.63008308, -0.0879107341,
+            0.214434385, -0.00183930027, -0.0103941988, 0.00180170778,
+            0.00028341022, -0.000180514617, 8.86730595e-06, 1.06994848e-05,
+            0.00138518144, 0.00033364931, -0.000258817599, -2.71947447e-05,
+            3.11494769e-05, 1.83365921e-06,
+        },
+        /* 2433922.5 */ {
+            -15.6954603, -6.40390491, 6.44204092, 0.519954503,
+            -0.227819294, -0.0329443142, 0.00739081344, 0.00260215066,
+            -0.000281549757, -0.000204064228, 3.14157387e-06, 1.68339375e-05,
+            -106.776237, 66.9386749, 1.38300991, -0.813455641,
+            -0.194588378, 0.0603768118, 0.0182497539, -0.0027886678,
+            -0.00167123834, 7.00390519e-05, 0.000147082261, 9.40779319e-06,
+            0.00180177798, 0.000547410862, 0.000139673793, -9.27949295e-05,
+            -1.70612402e-05, 6.26255314e-06,
+        },
+        /* 2434050.5 */ {
+            6.23164129, 20.3523655, -2.3158505, -1.0115062,
+            0.0389327332, 0.0046991678, 0.00288203452, 0.000553711667,
+            -0.000117485411, -2.18202858e-05, -4.28812518e-06, 2.8883855e-07,
+            21.2772865, 60.78339, 0.788408101, 0.581057966,
+            -0.1227661, -0.0324039236, 0.00103076873, 0.000455955364,
+            0.000371139788, 3.11958538e-05, -1.41009268e-05, -3.39518397e-06,
+            0.0022454795, -6.8075693e-05, 0.00017014789, 8.34582461e-05,
+            -2.07895937e-05, -5.63647791e-06,
+        },
+        /* 2434178.5 */ {
+            9.72907162, -17.8441849, -3.42753315, 0.902976692,
+            0.0456765704, -0.011379567, 0.00391246844, -7.82328934e-05,
+            -0.000191979329, 2.9917861e-05, 5.50775837e-07, -2.24438827e-06,
+            -214.329956, 60.8100662, -1.42028224, 0.359112233,
+            0.175445005, -0.0258167777, -0.00318961754, 0.0015348536,
+            -0.00034341967, -4.5361201e-05, 2.71530116e-05, -3.83216593e-06,
+            0.00272142352, 5.71084202e-05, -0.000247819524, 4.20394026e-05,
+            2.96849539e-05, -2.83990357e-06,
+        },
+        /* 2434306.5 */ {
+            -16.3195324, 0.894372344, 6.82557011, -0.0485059693,
+            -0.271452874, 0.00234855199, 0.0124854641, -0.000247721124,
+            -0.000840274035, 2.45736519e-05, 6.18598206e-05, -2.65448193e-06,
+            -87.7600861, 67.547081, -0.0647781864, -1.0032208,
+            0.0201432575, 0.0891777948, -0.00202910602, -0.00664082216,
+            0.000213576364, 0.00054941501, -2.28338467e-05, -5.2551597e-05,
+            0.00307350163, 0.000554224942, -2.54216866e-05, -0.00010905962,
+            2.76527749e-06, 7.36089578e-06,
+        },
+        /* 2434434.5 */ {
+            10.8974657, 16.7808323, -3.95832443, -0.878939748,
+            0.0695187896, 0.0160347316, 0.00346570765, -0.000299691601,
+            -0.000243931427, -1.94896475e-05, 6.95916242e-06, 3.0644444e-06,
+            39.5449524, 61.7721481, 1.43012559, 0.208213955,
+            -0.198883444, -0.0201265067, 0.00603481755, 0.00191976433,
+            0.000191947314, -0.000107768748, -3.05407957e-05, -7.30766061e-08,
+            0.0033766469, 7.7694116e-05, 0.000256644707, 2.41138569e-05,
+            -3.13640558e-05, -1.62978677e-06,
+        },
+        /* 2434562.5 */ {
+            4.84536982, -20.8169098, -1.76953363, 0.994625211,
+            0.0281617492, -0.000340089726, 0.00228394871, -0.00068318093,
+            -7.26495564e-05, 1.21184803e-05, -4.65404401e-06, 5.09677534e-07,
+            -196.233948, 59.9026718, -0.570822597, 0.670939803,
+            0.0917407051, -0.0315541551, -0.00020292656, -7.87331446e-05,
+            -0.000300365908, 5.00314236e-05, 6.59537227e-06, -1.6335191e-06,
+            0.00372772524, -0.000186163365, -0.000137815223, 9.43551277e-05,
+            1.62798315e-05, -6.3710354e-06,
+        },
+        /* 2434690.5 */ {
+            -15.2554255, 8.11078835, 6.28735447, -0.606387258,
+            -0.21778436, 0.0352807939, 0.00606506271, -0.00271767355,
+            -0.000139626587, 0.00020129983, -9.97078314e-06, -1.48780082e-05,
+            -68.7265167, 66.8811188, -1.45792127, -0.740013123,
+            0.221033707, 0.0504765473, -0.0197528265, -0.00163234689,
+            0.00168645394, -5.50751138e-05, -0.000135597627, 2.21092869e-05,
+            0.00398040051, 0.000388519111, -0.000181066818, -8.14617451e-05,
+            2.14796164e-05, 5.49810102e-06,
+        },
+        /* 2434818.5 */ {
+            14.4337988, 11.5658083, -5.26200056, -0.647116482,
+            0.125309959, 0.0224063024, 8.7049084e-05, -0.00131514785,
+            -0.00015631938, 5.76733146e-05, 1.63528839e-05, -1.05537958e-06,
+            57.8115768, 63.0281868, 1.38020587, -0.254654139,
+            -0.208353043, 0.0125752306, 0.0124161672, 0.000984556391,
+            -0.00060900487, -0.000165718258, 2.07718986e-05, 1.52643352e-05,
+            0.00411542645, 0.000236103951, 0.000239049739, -4.49376967e-05,
+            -2.93223711e-05, 3.03269348e-06,
+        },
+        /* 2434946.5 */ {
+            -0.541561425, -21.7712517, 0.0430454053, 1.06366813,
+            0.0298430286, 0.00183431047, -0.00108243886, -0.000944188156,
+            -4.17999145e-05, 3.92590982e-06, 2.74558442e-06, 1.69233044e-06,
+            -178.086823, 60.0203781, 0.631421924, 0.769165397,
+            -0.00687392522, -0.0353479125, -0.00200712541, -0.000696305826,
+            5.35279614e-05, 8.36907566e-05, 6.67604036e-06, 1.00806642e-06,
+            0.00428111851, -0.000317798345, 2.67010419e-05, 0.000108711589,
+            -3.6737631e-06, -7.33951492e-06,
+        },
+        /* 2435074.5 */ {
+            -12.5890532, 14.3853779, 4.96007538, -0.988464475,
+            -0.109385543, 0.0399732143, -0.00338251353, -0.00171566138,
+            0.000497257162, 2.39867404e-05, -3.65934902e-05, 6.07105358e-06,
+            -49.740593, 65.1935806, -2.23304415, -0.183577225,
+            0.279152542, -0.01196252, -0.0153425708, 0.00349457306,
+            0.000366682303, -0.00034973846, 3.66323402e-05, 2.05550787e-05,
+            0.00439866632, 9.56422082e-05, -0.00026486101, -2.1099313e-05,
+            3.15537254e-05, 1.42362398e-06,
+        },
+        /* 2435202.5 */ {
+            16.5168896, 5.22359371, -6.05562353, -0.296693802,
+            0.176905125, 0.0135359624, -0.005089988, -0.00110323424,
+            0.000254984538, 8.23594892e-05, -1.14132827e-05, -6.52437802e-06,
+            76.0806808, 63.9263191, 0.677457809, -0.615411937,
+            -0.115318559, 0.0511077233, 0.00926225632, -0.00254286453,
+            -0.000773443317, 0.000126907733, 6.46381231e-05, -5.54541157e-06,
+            0.00436148606, 0.00032062325, 0.000124271886, -9.59168465e-05,
+            -1.54854242e-05, 6.47542902e-06,
+        },
+        /* 2435330.5 */ {
+            -5.84211302, -20.5530052, 1.95427275, 1.11619937,
+            0.0189560093, -0.00881402008, -0.00494124414, -0.000895676087,
+            8.14778323e-05, 4.74674453e-05, 1.10709525e-05, 4.58955981e-07,
+            -159.764099, 61.3009109, 1.77103591, 0.613316238,
+            -0.122372545, -0.0431571603, -0.0022714322, 0.000701061683,
+            0.000541067799, 9.0288413e-05, -1.03601142e-05, -7.27212091e-06,
+            0.00430901395, -0.000308828923, 0.000179427472, 7.93373038e-05,
+            -2.21497903e-05, -5.35579693e-06,
+        },
+        /* 2435458.5 */ {
+            -8.55552673, 19.0087776, 3.14458823, -1.14619374,
+            -0.0178133231, 0.0226984639, -0.00627043191, 0.000273929356,
+            0.000305921363, -7.45145444e-05, 2.33537344e-06, 4.22480525e-06,
+            -30.8878574, 63.1008415, -2.12908792, 0.366200924,
+            0.200840116, -0.0433158912, -0.00241141068, 0.00251574372,
+            -0.000653914991, -2.57138272e-05, 5.10764039e-05, -1.17339132e-05,
+            0.00426123152, -0.000231408994, -0.000243178976, 4.77504836e-05,
+            2.89353902e-05, -3.22342953e-06,
+        },
+        /* 2435586.5 */ {
+            16.9746494, -1.6131922, -6.20423746, 0.119634181,
+            0.186473817, -0.00680335844, -0.00636044517, 0.000514517946,
+            0.000384593703, -4.00066019e-05, -2.36587966e-05, 3.48020581e-06,
+            94.336586, 64.0451202, -0.361648023, -0.692573607,
+            0.0454453006, 0.060508728, -0.00396656943, -0.003628843,
+            0.000357737095, 0.000247576361, -3.22732994e-05, -1.92006682e-05,
+            0.00406689197, 0.000271966215, -4.15571994e-05, -0.000108312932,
+            4.58098793e-06, 7.31338878e-06,
+        },
+        /* 2435714.5 */ {
+            -10.4708471, -17.1679134, 3.85377622, 1.08553791,
+            -0.037004333, -0.0290348139, -0.0064131408, 0.000265760114,
+            0.000419585442, 6.85820196e-05, -8.97708651e-06, -6.95241761e-06,
+            -141.189362, 63.3934898, 2.39924097, 0.19199343,
+            -0.23795779, -0.0365869738, 0.00617274689, 0.00336689129,
+            0.000492037449, -0.000140212898, -6.68212888e-05, -7.00317605e-06,
+            0.00380050531, -0.000188266597, 0.000258937216, 1.80511652e-05,
+            -3.1716394e-05, -1.21766516e-06,
+        },
+        /* 2435842.5 */ {
+            -3.55503607, 21.5318108, 1.15459573, -1.14696574,
+            0.0238926597, 0.00533561176, -0.00349434162, 0.000998764532,
+            2.08582424e-05, -2.91647175e-05, 8.96320671e-06, -1.52428106e-06,
+            -12.2428579, 61.3714371, -1.28332865, 0.6918962,
+            0.0753969178, -0.0426077843, 0.00260021235, -1.67121761e-05,
+            -0.000362347375, 0.00010603694, -9.15232476e-07, -3.23880613e-06,
+            0.00357308495, -0.000486245175, -0.000124689817, 9.73965361e-05,
+            1.46780203e-05, -6.57383362e-06,
+        },
+        /* 2435970.5 */ {
+            15.7727928, -8.26268864, -5.68642044, 0.501704276,
+            0.145428702, -0.0218278561, -0.00210196781, 0.00146697566,
+            9.61975502e-07, -8.73131721e-05, 8.57890791e-06, 4.81788447e-06,
+            112.562256, 63.2993736, -1.27150404, -0.445307374,
+            0.177866608, 0.0309914388, -0.0126378378, -0.000461974676,
+            0.000865460199, -6.87155043e-05, -5.50584846e-05, 1.19760161e-05,
+            0.00325006759, 8.51232107e-05, -0.000191638333, -7.71356499e-05,
+            2.28049157e-05, 5.20940557e-06,
+        },
+        /* 2436098.5 */ {
+            -13.9413519, -11.8586836, 5.50238562, 0.870108128,
+            -0.140749529, -0.0423132107, -0.000998554402, 0.00234758924,
+            0.000398119068, -9.43228224e-05, -4.15471804e-05, -5.36011555e-07,
+            -122.384911, 65.589119, 2.19246793, -0.391928583,
+            -0.2769835, 0.00786462612, 0.0188704059, 0.00244514551,
+            -0.000963130442, -0.000359791185, 1.92684311e-05, 3.43667052e-05,
+            0.00281179044, -2.82640976e-05, 0.000233382685, -5.04916497e-05,
+            -2.85251772e-05, 3.41048008e-06,
+        },
+        /* 2436226.5 */ {
+            1.87013316, 21.7917366, -0.802559376, -1.08336353,
+            0.0322720669, -4.12523659e-05, 0.000435668713, 0.000887853035,
+            -5.785135e-05, -6.58206909e-06, -1.23023847e-06, -1.3786688e-06,
+            6.1923008, 60.5947571, -0.102901511, 0.736392379,
+            -0.0401632227, -0.0358272456, 0.00117911608, -0.000533670594,
+            0.000130374319, 7.67025704e-05, -6.34395383e-06, 4.00252929e-07,
+            0.00241658138, -0.000588770607, 4.31198168e-05, 0.000107872052,
+            -5.4834295e-06, -7.28007717e-06,
+        },
+        /* 2436354.5 */ {
+            13.0099697, -14.0738792, -4.60930347, 0.771446943,
+            0.0839319006, -0.0207438879, 0.00268915738, 0.000796534703,
+            -0.000253700709, -5.60498302e-06, 1.41964883e-05, -2.65033532e-06,
+            -229.260559, 61.9633217, -1.64581001, -0.00515139475,
+            0.21304138, -0.00773432152, -0.00916260015, 0.00198254338,
+            0.00012984121, -0.000168425075, 1.884827e-05, 7.45629086e-06,
+            0.0020018185, -0.000185615936, -0.000265389943, -1.49231228e-05,
+            3.18555321e-05, 1.00992077e-06,
+        },
+        /* 2436482.5 */ {
+            -15.9240484, -5.1511364, 6.57256126, 0.427717477,
+            -0.241847783, -0.0281464625, 0.00899274182, 0.00230999384,
+            -0.000449129759, -0.000191949235, 1.95549583e-05, 1.73350836e-05,
+            -103.433144, 67.1324158, 1.15273535, -0.877409399,
+            -0.163225278, 0.069732137, 0.0159165766, -0.00397789199,
+            -0.00154064235, 0.000208472848, 0.000145699785, -6.70101417e-06,
+            0.00146288099, 8.77750863e-05, 0.000113286689, -9.87171152e-05,
+            -1.3859446e-05, 6.66692813e-06,
+        },
+        /* 2436610.5 */ {
+            7.11422205, 19.856987, -2.62278414, -0.992983878,
+            0.0421991162, 0.00649747066, 0.0032193556, 0.00044394398,
+            -0.000138853022, -2.54045062e-05, -3.56341093e-06, 8.1716513e-07,
+            24.4960575, 60.9137039, 0.943516612, 0.527714372,
+            -0.138746172, -0.0313291773, 0.00149015838, 0.000754315348,
+            0.00038834865, 1.41644323e-05, -1.79330709e-05, -4.03274134e-06,
+            0.000943191233, -0.000514710729, 0.000193022905, 7.49654791e-05,
+            -2.34393701e-05, -5.05815296e-06,
+        },
+        /* 2436738.5 */ {
+            8.92743301, -18.4985657, -3.14894986, 0.922643423,
+            0.0402544476, -0.00911877491, 0.00382508337, -0.000226342614,
+            -0.000166072918, 2.97647366e-05, -1.64645326e-06, -1.69123723e-06,
+            -211.141556, 60.5931892, -1.3111937, 0.426937461,
+            0.1624742, -0.027739061, -0.00220886292, 0.00125989504,
+            -0.000376916083, -1.98737707e-05, 2.33725041e-05, -4.41221982e-06,
+            0.000478861824, -0.000446015998, -0.000232845196, 5.33014827e-05,
+            2.80922686e-05, -3.59564547e-06,
+        },
+        /* 2436866.5 */ {
+            -16.2508507, 2.19415617, 6.79531193, -0.152693346,
+            -0.268682092, 0.00932717323, 0.0121167926, -0.000866366201,
+            -0.000795386673, 8.10374186e-05, 5.66652852e-05, -8.44454462e-06,
+            -84.4130173, 67.5183105, -0.330588937, -0.988144636,
+            0.0612509958, 0.0868636817, -0.00626484025, -0.0063164481,
+            0.000657378871, 0.000505785632, -6.92187314e-05, -4.63006363e-05,
+            -7.58821698e-05, 0.000100993791, -5.27209049e-05, -0.000107224419,
+            6.38160191e-06, 7.24157462e-06,
+        },
+        /* 2436994.5 */ {
+            11.6102858, 15.9667206, -4.21654081, -0.84656167,
+            0.0780385286, 0.0178957209, 0.00316259312, -0.000497742672,
+            -0.00025495101, -1.06866801e-05, 1.00665302e-05, 3.10714722e-06,
+            42.7594147, 61.9955101, 1.47307694, 0.128414378,
+            -0.206830353, -0.015882263, 0.00734893372, 0.00200435403,
+            8.0449332e-05, -0.00013573152, -2.81394823e-05, 2.66490292e-06,
+            -0.000648401096, -0.000303388806, 0.000265060196, 1.19143024e-05,
+            -3.19672945e-05, -8.01686895e-07,
+        },
+        /* 2437122.5 */ {
+            3.9172039, -21.1323395, -1.45966482, 1.00698292,
+            0.0277705379, 0.000861736073, 0.00177793333, -0.000742461416,
+            -6.26439578e-05, 7.93701383e-06, -3.98224847e-06, 8.05401271e-07,
+            -193.048111, 59.836525, -0.374382287, 0.704841912,
+            0.075242117, -0.0319027565, -0.000293016288, -0.0003000703,
+            -0.000251831574, 5.6796358e-05, 5.1369525e-06, -7.04384206e-07,
+            -0.00111648848, -0.00059809559, -0.000106742438, 0.0001000958,
+            1.30291319e-05, -6.75468391e-06,
+        },
+        /* 2437250.5 */ {
+            -14.8957396, 9.30270672, 6.10323572, -0.689113736,
+            -0.200591102, 0.0383736603, 0.00424772687, -0.00277526304,
+            2.71828649e-05, 0.000186451609, -2.32359689e-05, -1.14543045e-05,
+            -65.3851547, 66.6444473, -1.64972293, -0.655316651,
+            0.243175402, 0.0392285213, -0.0205468722, -0.000393061375,
+            0.00160141045, -0.000174048764, -0.000112107511, 3.18492857e-05,
+            -0.00160650664, 2.16588433e-06, -0.000197502814, -7.25906357e-05,
+            2.40557783e-05, 4.90313505e-06,
+        },
+        /* 2437378.5 */ {
+            14.909687, 10.5139036, -5.44291878, -0.593414247,
+            0.135911718, 0.0220727883, -0.000842998561, -0.00140590267,
+            -9.78307435e-05, 7.21442411e-05, 1.41325354e-05, -2.64521304e-06,
+            61.0255394, 63.2294617, 1.29696059, -0.331646323,
+            -0.199516341, 0.0198814347, 0.0128110657, 0.000455099595,
+            -0.000735360489, -0.000136780916, 3.56591045e-05, 1.52497114e-05,
+            -0.00214386685, -4.081101e-05, 0.000230619378, -5.59194887e-05,
+            -2.76367718e-05, 3.77736524e-06,
+        },
+        /* 2437506.5 */ {
+            -1.49686396, -21.7128849, 0.373566687, 1.07471311,
+            0.0298692081, 0.000932282826, -0.00176516664, -0.000971487549,
+            -3.46207089e-05, 7.76448815e-06, 4.63264041e-06, 1.77589936e-06,
+            -174.881805, 60.1619911, 0.848860443, 0.761025071,
+            -0.025785828, -0.0366094708, -0.00240047043, -0.000612496107,
+            0.000134259782, 9.00695595e-05, 6.92495632e-06, 4.5379025e-07,
+            -0.00256747752, -0.000578764419, 6.25579851e-05, 0.000106636893,
+            -7.27463976e-06, -7.19663285e-06,
+        },
+        /* 2437634.5 */ {
+            -11.9688187, 15.3317862, 4.66682005, -1.03138995,
+            -0.0904733911, 0.037909355, -0.00446181791, -0.00133253005,
+            0.000509572448, -8.96287929e-06, -3.0482699e-05, 7.55549399e-06,
+            -46.4175758, 64.8350754, -2.27808714, -0.0784706771,
+            0.272990823, -0.0204777326, -0.013020806, 0.00371336099,
+            7.91843995e-05, -0.000308960385, 5.52138335e-05, 1.18599719e-05,
+            -0.002931542, -0.000164144905, -0.000262461952, -8.74793022e-06,
+            3.20534091e-05, 5.92301376e-07,
+        },
+        /* 2437762.5 */ {
+            16.7160149, 4.03795719, -6.1305232, -0.225550443,
+            0.182445943, 0.0103869569, -0.00574471848, -0.000878873805,
+            0.000319336104, 6.8179208e-05, -1.73325134e-05, -5.69859458e-06,
+            79.292572, 64.0117569, 0.505742729, -0.653061569,
+            -0.0895760581, 0.055736877, 0.00736120157, -0.00307097682,
+            -0.000637021381, 0.000184168603, 5.55637962e-05, -1.18330154e-05,
+            -0.00334743573, 0.000175044654, 0.00010390285, -0.000101250916,
+            -1.21894909e-05, 6.83713461e-06,
+        },
+        /* 2437890.5 */ {
+            -6.71942806, -20.1096287, 2.29329467, 1.11941195,
+            0.0130774649, -0.0119343298, -0.00550347427, -0.000798806141,
+            0.000129746462, 5.77669525e-05, 1.06605003e-05, -4.53757764e-07,
+            -156.519669, 61.6234245, 1.9301939, 0.557748735,
+            -0.144004539, -0.0438743271, -0.00153792033, 0.00115747983,
+            0.000608070637, 7.3282863e-05, -1.95361408e-05, -9.36560537e-06,
+            -0.00367819238, -0.000385420892, 0.000207289573, 7.02924881e-05,
+            -2.46520576e-05, -4.74386934e-06,
+        },
+        /* 2438018.5 */ {
+            -7.73287582, 19.6115112, 2.80053306, -1.15481317,
+            -0.00691191899, 0.0191235561, -0.00604914362, 0.000501855568,
+            0.000242276583, -7.11998873e-05, 6.41569432e-06, 2.72634725e-06,
+            -27.5975304, 62.7523918, -2.02418685, 0.442888826,
+            0.179764256, -0.0447791144, -0.000797147572, 0.00201583304,
+            -0.000666600245, 2.03616419e-05, 3.97283256e-05, -1.17613745e-05,
+            -0.0038823681, -0.00031806156, -0.000221153488, 5.86209826e-05,
+            2.71574609e-05, -3.95675261e-06,
+        },
+        /* 2438146.5 */ {
+            16.8819084, -2.81500983, -6.15983772, 0.192358837,
+            0.182473496, -0.0103470599, -0.0059285746, 0.00079496851,
+            0.000341588893, -6.09794624e-05, -1.95134235e-05, 5.16519731e-06,
+            97.5442429, 63.973793, -0.545440555, -0.670799077,
+            0.0736854672, 0.0576652661, -0.00627880543, -0.00328854355,
+            0.000554322731, 0.000209051504, -4.8919439e-05, -1.46622187e-05,
+            -0.0041109384, 0.000272762089, -6.38253696e-05, -0.000105847401,
+            8.16097327e-06, 7.14672115e-06,
+        },
+        /* 2438274.5 */ {
+            -11.1762419, -16.3628693, 4.16975975, 1.06354129,
+            -0.0524318665, -0.0325277969, -0.00604755525, 0.000618022343,
+            0.000469517254, 5.48924072e-05, -1.65946039e-05, -7.87195313e-06,
+            -137.901184, 63.7914658, 2.42877746, 0.0957985222,
+            -0.253185093, -0.0317776203, 0.00853786711, 0.00364311319,
+            0.000330249692, -0.000205022923, -6.86894855e-05, -1.67505573e-06,
+            -0.00430473732, -7.8194782e-05, 0.000269499491, 5.67964662e-06,
+            -3.2113323e-05, -3.83006494e-07,
+        },
+        /* 2438402.5 */ {
+            -2.61572719, 21.743084, 0.804882646, -1.1386373,
+            0.0267926473, 0.00341958622, -0.0027931009, 0.001013375,
+            -3.78396157e-06, -2.10580311e-05, 7.34996138e-06, -1.76356536e-06,
+            -8.99089432, 61.1584854, -1.08631968, 0.719745398,
+            0.0538208298, -0.04126909, 0.00258223969, -0.000276774139,
+            -0.000267808762, 0.000104819657, -4.24565496e-06, -1.60768229e-06,
+            -0.00434209267, -0.00037802849, -8.99598163e-05, 0.000102414291,
+            1.13375154e-05, -6.91411969e-06,
+        },
+        /* 2438530.5 */ {
+            15.395648, -9.36285973, -5.53299236, 0.558653533,
+            0.134848192, -0.0228565019, -0.0011171787, 0.00144775014,
+            -7.16429859e-05, -7.73622305e-05, 1.29114042e-05, 3.3433812e-06,
+            115.763466, 63.09412, -1.38583302, -0.376209497,
+            0.191853091, 0.0237267651, -0.0128155304, 0.00017732702,
+            0.000791216502, -0.000116914169, -4.27026207e-05, 1.46115726e-05,
+            -0.00435177935, 0.000234417312, -0.000204896482, -6.78629513e-05,
+            2.52285099e-05, 4.58149998e-06,
+        },
+        /* 2438658.5 */ {
+            -14.4054232, -10.7629585, 5.7414937, 0.808254063,
+            -0.160780907, -0.042172838, 0.000679682184, 0.00259681884,
+            0.000295660109, -0.000132358648, -3.89349698e-05, 3.59855608e-06,
+            -119.063942, 65.9242935, 2.06461287, -0.493140638,
+            -0.268937826, 0.0190195031, 0.0200468171, 0.00157470722,
+            -0.00124520552, -0.000320750551, 5.41225127e-05, 3.74115734e-05,
+            -0.00437535904, 0.000242168593, 0.000224327028, -6.12145377e-05,
+            -2.66572115e-05, 4.13191401e-06,
+        },
+        /* 2438786.5 */ {
+            2.82239151, 21.6084995, -1.13465214, -1.06984842,
+            0.0329537876, 0.000376719836, 0.00104955316, 0.000835515733,
+            -6.60271689e-05, -8.3342602e-06, -2.58965474e-06, -1.125528e-06,
+            9.4162569, 60.5787849, 0.103574045, 0.716805279,
+            -0.0587037951, -0.0350773446, 0.000904881279, -0.000404736551,
+            0.000198108421, 6.9640264e-05, -6.58614545e-06, -1.8783102e-07,
+            -0.00425921381, -0.000295942213, 7.84695367e-05, 0.000105013089,
+            -9.04276658e-06, -7.09027427e-06,
+        },
+        /* 2438914.5 */ {
+            12.3793592, -14.9675188, -4.37511683, 0.805792391,
+            0.0740902722, -0.0191224962, 0.00319473841, 0.000598320796,
+            -0.000255647203, 7.26125654e-06, 1.14780942e-05, -3.07245068e-06,
+            -226.068054, 61.7049141, -1.63998365, 0.0769113079,
+            0.209049806, -0.012946968, -0.0078396285, 0.00205242424,
+            -1.11527579e-05, -0.000148090723, 2.57551801e-05, 4.15824525e-06,
+            -0.00405768398, 0.000100236299, -0.000262483605, -2.58061027e-06,
+            3.21475818e-05, 1.73366658e-07,
+        },
+        /* 2439042.5 */ {
+            -16.1059589, -3.88260221, 6.67871094, 0.331394106,
+            -0.253550559, -0.0225802474, 0.0103657637, 0.00190495397,
+            -0.000599506428, -0.000165142497, 3.52484676e-05, 1.58944167e-05,
+            -100.093567, 67.2919998, 0.909333467, -0.929717958,
+            -0.128319353, 0.0776223615, 0.0129081048, -0.00502632745,
+            -0.0013030516, 0.000337971345, 0.000129774155, -2.32042075e-05,
+            -0.0038961363, 0.000472083222, 8.99811203e-05, -0.000103485661,
+            -1.04783321e-05, 6.98482381e-06,
+        },
+        /* 2439170.5 */ {
+            7.97486353, 19.3084793, -2.92346621, -0.973159313,
+            0.0463280343, 0.00845725834, 0.00347311143, 0.000317303173,
+            -0.000162584984, -2.79597989e-05, -2.26454085e-06, 1.38567623e-06,
+            27.710371, 61.0676346, 1.08294284, 0.468741447,
+            -0.153972521, -0.0299323685, 0.00214543915, 0.00105639105,
+            0.000388393091, -6.55332133e-06, -2.20665006e-05, -4.30837144e-06,
+            -0.00365083292, -7.94161242e-05, 0.00021637771, 6.53686002e-05,
+            -2.5785519e-05, -4.41444581e-06,
+        },
+        /* 2439298.5 */ {
+            8.1003828, -19.1035023, -2.86482954, 0.940576077,
+            0.0358680636, -0.00692761689, 0.00364201772, -0.000355492288,
+            -0.000140827702, 2.77154304e-05, -3.29217346e-06, -1.12942496e-06,
+            -207.95575, 60.3957138, -1.18419886, 0.489996076,
+            0.148587495, -0.0291583892, -0.0014121799, 0.000964137667,
+            -0.000389558118, 1.96312953e-06, 1.91012732e-05, -4.41648535e-06,
+            -0.00328009506, -5.06295582e-05, -0.000213473948, 6.3735868e-05,
+            2.61350888e-05, -4.30441196e-06,
+        },
+        /* 2439426.5 */ {
+            -16.135479, 3.48737526, 6.73901176, -0.255509079,
+            -0.262939841, 0.0160195082, 0.0113752177, -0.00143811922,
+            -0.000707265164, 0.000130603366, 4.66806232e-05, -1.31584229e-05,
+            -81.0654373, 67.4527893, -0.591368079, -0.959374726,
+            0.100962572, 0.082407847, -0.0102164689, -0.00569372997,
+            0.00105140172, 0.000423236022, -0.00010795649, -3.472342e-05,
+            -0.00294317398, 0.000543657283, -7.95927481e-05, -0.000104133804,
+            9.9154322e-06, 7.02808802e-06,
+        },
+        /* 2439554.5 */ {
+            12.2901945, 15.1091032, -4.46528435, -0.811083436,
+            0.0873434916, 0.0195418373, 0.00272865593, -0.000699115102,
+            -0.000257034379, 9.21580863e-07, 1.29718992e-05, 2.84619568e-06,
+            45.9764099, 62.2243881, 1.49480414, 0.0465257913,
+            -0.212574244, -0.0109330686, 0.00867579784, 0.00199543498,
+            -5.21085167e-05, -0.000159657022, -2.27984856e-05, 5.84898726e-06,
+            -0.00259672897, 0.000208104189, 0.000268152537, -5.75689796e-07,
+            -3.2156102e-05, 3.70066928e-08,
+        },
+        /* 2439682.5 */ {
+            2.9766345, -21.3917618, -1.14555538, 1.01930642,
+            0.0278651994, 0.00175625784, 0.00123035605, -0.000794777356,
+            -5.58335669e-05, 4.55852114e-06, -2.98901523e-06, 1.05391177e-06,
+            -189.856171, 59.8037643, -0.169116169, 0.732348442,
+            0.0584372021, -0.0323264077, -0.00051927584, -0.000481116906,
+            -0.000197000438, 6.2496787e-05, 4.55504005e-06, 1.08270875e-07,
+            -0.00212079403, -0.000135120892, -7.77627502e-05, 0.000104407314,
+            9.60974739e-06, -7.05061711e-06,
+        },
+        /* 2439810.5 */ {
+            -14.4912624, 10.4663248, 5.89770889, -0.766009092,
+            -0.182132915, 0.040496178, 0.00241514086, -0.00271583069,
+            0.00017885644, 0.000160587035, -3.32156633e-05, -7.25908467e-06,
+            -62.0395393, 66.3801041, -1.82068479, -0.563095212,
+            0.260447681, 0.0276466273, -0.0205895789, 0.000765647914,
+            0.00142670656, -0.000268859847, -8.08745317e-05, 3.68809378e-05,
+            -0.00164562324, 0.000448869308, -0.000216403452, -6.29014612e-05,
+            2.6320633e-05, 4.24422842e-06,
+        },
+        /* 2439938.5 */ {
+            15.3446274, 9.43071747, -5.60938072, -0.536023915,
+            0.146255314, 0.0212174058, -0.00181381695, -0.0014486172,
+            -2.86313752e-05, 8.37611733e-05, 1.04266574e-05, -4.20097558e-06,
+            64.2473984, 63.4182739, 1.19467044, -0.404739708,
+            -0.187392086, 0.0272743814, 0.01283924, -0.000153734203,
+            -0.000831080717, -9.45680367e-05, 4.93722509e-05, 1.35268028e-05,
+            -0.00122707861, 0.000469823106, 0.000212711049, -6.62967068e-05,
+            -2.55919713e-05, 4.4735375e-06,
+        },
+        /* 2440066.5 */ {
+            -2.44922876, -21.5927601, 0.708022416, 1.08554435,
+            0.0293268412, -0.000379379344, -0.00246285996, -0.000990101253,
+            -2.30640071e-05, 1.34671873e-05, 6.53373445e-06, 1.78595121e-06,
+            -171.661591, 60.339283, 1.06286037, 0.745230079,
+            -0.0453641899, -0.0380394831, -0.00270796777, -0.000461668125,
+            0.000220154005, 9.59847603e-05, 6.28326052e-06, -5.1367158e-07,
+            -0.000716713897, -0.000102579004, 8.97704158e-05, 0.000103071223,
+            -1.07810429e-05, -6.96062307e-06,
+        },
+        /* 2440194.5 */ {
+            -11.3087759, 16.2310123, 4.36061573, -1.06783628,
+            -0.0724672228, 0.0352737382, -0.00529712019, -0.000943586463,
+            0.000495899934, -3.59237347e-05, -2.3062772e-05, 8.03742842e-06,
+            -43.0880737, 64.4680252, -2.29604983, 0.0249461606,
+            0.263014227, -0.0277768523, -0.0105786063, 0.00372935622,
+            -0.000172375177, -0.000253232633, 6.59168363e-05, 3.70230987e-06,
+            -0.000165094389, 0.000240084584, -0.000265737413, 3.62335368e-06,
+            3.21382067e-05, -2.46968426e-07,
+        },
+        /* 2440322.5 */ {
+            16.8684788, 2.83663464, -6.18656874, -0.152457982,
+            0.186533675, 0.00691308081, -0.00624275627, -0.000611503376,
+            0.000369806599, 4.89147715e-05, -2.21551127e-05, -4.24594327e-06,
+            82.5164185, 64.0728226, 0.3251203, -0.681375623,
+            -0.0619548559, 0.05926672, 0.00515771797, -0.00348429149,
+            -0.000457512477, 0.000230545353, 4.11301517e-05, -1.71843785e-05,
+            0.000293351797, 0.00061205338, 7.20117969e-05, -0.000105360006,
+            -8.73349109e-06, 7.11059965e-06,
+        },
+        /* 2440450.5 */ {
+            -7.57751989, -19.6014099, 2.63323689, 1.11981225,
+            0.00560094696, -0.0153460065, -0.00597827882, -0.000660128135,
+            0.000186175166, 6.69241344e-05, 9.08954007e-06, -1.63539698e-06,
+            -153.253998, 61.9694405, 2.072263, 0.493845493,
+            -0.165681526, -0.0440222062, -0.000481696741, 0.00165327231,
+            0.000653950905, 4.64524492e-05, -3.03619599e-05, -1.10712663e-05,
+            0.0007739024, 4.26734441e-05, 0.000221373557, 6.02637228e-05,
+            -2.68350959e-05, -4.07065954e-06,
+        },
+        /* 2440578.5 */ {
+            -6.88032389, 20.1532917, 2.45155811, -1.15943849,
+            0.00239608181, 0.0156725403, -0.0056788642, 0.000683510734,
+            0.000181765616, -6.43942039e-05, 9.0602025e-06, 1.36316953e-06,
+            -24.2993469, 62.4187737, -1.89758122, 0.512116671,
+            0.157789513, -0.0453757495, 0.000499725284, 0.00150926539,
+            -0.000641943072, 5.60280278e-05, 2.8278464e-05, -1.06503021e-05,
+            0.00132401031, 7.10061977e-06, -0.000208125799, 6.86800486e-05,
+            2.50280482e-05, -4.63890592e-06,
+        },
+        /* 2440706.5 */ {
+            16.7391796, -4.0137167, -6.09524298, 0.263866007,
+            0.176887929, -0.013631532, -0.0053214822, 0.00103947695,
+            0.000282285968, -7.75247681e-05, -1.39658114e-05, 6.28614089e-06,
+            100.766327, 63.8757133, -0.723662853, -0.63891381,
+            0.100577444, 0.0535938293, -0.00834820885, -0.00281273038,
+            0.00071464153, 0.000156648734, -6.08786613e-05, -8.73513272e-06,
+            0.00178270286, 0.000580355467, -9.77326708e-05, -0.000102052712,
+            1.16380552e-05, 6.88746513e-06,
+        },
+        /* 2440834.5 */ {
+            -11.8473454, -15.4969816, 4.47844744, 1.03514671,
+            -0.0694117993, -0.0357116796, -0.00543256942, 0.000999620301,
+            0.000503338582, 3.37382371e-05, -2.45282899e-05, -8.12474536e-06,
+            -134.590576, 64.1901627, 2.43124795, -0.00521395635,
+            -0.265601158, -0.0256014764, 0.0110099455, 0.00376842218,
+            0.000114784736, -0.000267505908, -6.39588689e-05, 5.47712534e-06,
+            0.00218365225, 0.000241898029, 0.000263723021, -6.79590994e-06,
+            -3.20946056e-05, 4.56775126e-07,
+        },
+        /* 2440962.5 */ {
+            -1.66194963, 21.8857422, 0.455131471, -1.12893009,
+            0.0288486369, 0.00191440829, -0.00207833271, 0.00100902014,
+            -2.20287056e-05, -1.45638514e-05, 5.4785869e-06, -1.84762314e-06,
+            -5.7288928, 60.9777946, -0.880501628, 0.738980889,
+            0.0326573327, -0.0399188288, 0.0024028162, -0.000463229168,
+            -0.000173848632, 0.000100654674, -6.03666376e-06, -3.93000846e-07,
+            0.00265119364, -0.000159753312, -6.71254165e-05, 0.000106100095,
+            7.85022075e-06, -7.16491468e-06,
+        },
+        /* 2441090.5 */ {
+            14.9687386, -10.4392958, -5.36188078, 0.61202991,
+            0.123777881, -0.0233367905, -0.000149880419, 0.00137530873,
+            -0.000135094844, -6.37240155e-05, 1.58092371e-05, 1.73017349e-06,
+            118.979485, 62.8707733, -1.48197079, -0.301630229,
+            0.202531055, 0.0163676739, -0.0125879906, 0.000755331363,
+            0.000679078221, -0.000152827619, -2.81671255e-05, 1.54669142e-05,
+            0.00306056556, 0.000381063117, -0.00022861574, -5.77040882e-05,
+            2.73282385e-05, 3.89391562e-06,
+        },
+        /* 2441218.5 */ {
+            -14.8232346, -9.62082767, 5.96166182, 0.7387802,
+            -0.180458769, -0.0410370491, 0.00248555932, 0.00275457534,
+            0.000163304561, -0.000165661288, -3.220703e-05, 8.03018611e-06,
+            -115.722794, 66.23629, 1.91055167, -0.590050459,
+            -0.25558567, 0.0305843577, 0.020578213, 0.000517596549,
+            -0.00147712964, -0.000248947152, 8.86844355e-05, 3.612207e-05,
+            0.00334837078, 0.000405609724, 0.00019942467, -7.11314642e-05,
+            -2.44437761e-05, 4.80047356e-06,
+        },
+        /* 2441346.5 */ {
+            3.76987624, 21.3548164, -1.46401453, -1.05550706,
+            0.0339273997, 0.00116157136, 0.00162332971, 0.000773960724,
+            -7.61825941e-05, -1.12908119e-05, -3.624496e-06, -8.19786408e-07,
+            12.6529417, 60.5979767, 0.304120839, 0.689278483,
+            -0.0768796727, -0.0344067365, 0.000736461603, -0.000222269417,
+            0.000258583168, 6.17250334e-05, -7.5155217e-06, -9.91908792e-07,
+            0.00366400275, -0.000205496035, 0.000100208352, 0.000100833007,
+            -1.24855651e-05, -6.80887206e-06,
+        },
+        /* 2441474.5 */ {
+            11.7046518, -15.8174715, -4.12811708, 0.836530924,
+            0.0649632439, -0.0172122177, 0.00356731121, 0.000398878095,
+            -0.000247017568, 1.74423913e-05, 8.36629988e-06, -3.15723037e-06,
+            -222.862183, 61.4466362, -1.61082196, 0.15795818,
+            0.20248282, -0.0174469426, -0.00647574244, 0.00201728591,
+            -0.000134079339, -0.000121863792, 2.95274003e-05, 1.13602516e-06,
+            0.00396742392, 7.95960877e-05, -0.000268302276, 9.84901635e-06,
+            3.20257459e-05, -6.65901553e-07,
+        },
+        /* 2441602.5 */ {
+            -16.2337933, -2.59212542, 6.75635529, 0.230917037,
+            -0.262481093, -0.0163181983, 0.0114381574, 0.00139735837,
+            -0.000721130345, -0.000124509024, 4.85389428e-05, 1.24996959e-05,
+            -96.7376709, 67.4126205, 0.653554499, -0.96866864,
+            -0.0901740193, 0.0836702287, 0.009290291, -0.00586022623,
+            -0.000966486114, 0.000445671642, 9.97147581e-05, -3.78288642e-05,
+            0.00412215106, 0.000450822175, 5.4058426e-05, -0.000106861065,
+            -6.96007874e-06, 7.21310607e-06,
+        },
+        /* 2441730.5 */ {
+            8.81100845, 18.6939392, -3.21766973, -0.950989366,
+            0.0514535494, 0.0105342492, 0.0036249836, 0.00017096191,
+            -0.000187446334, -2.88438187e-05, -3.59390413e-07, 1.96124438e-06,
+            30.9380703, 61.2440453, 1.20398164, 0.403610677,
+            -0.168178976, -0.0280515552, 0.00300178025, 0.00134697091,
+            0.000367004861, -3.11493495e-05, -2.59990975e-05, -4.05374249e-06,
+            0.00424120855, -0.000130993372, 0.000226315984, 5.50000113e-05,
+            -2.7799284e-05, -3.71390752e-06,
+        },
+        /* 2441858.5 */ {
+            7.24174595, -19.6481514, -2.57247615, 0.956587136,
+            0.0324867778, -0.00484980457, 0.00336613809, -0.000465991616,
+            -0.000117449526, 2.42028618e-05, -4.36040818e-06, -5.9638802e-07,
+            -204.758377, 60.2199478, -1.03799593, 0.547571599,
+            0.133749574, -0.0301373079, -0.000813622901, 0.000659959565,
+            -0.000383189326, 1.98418838e-05, 1.48289291e-05, -3.95867619e-06,
+            0.00438425224, -0.000223897805, -0.000201040195, 7.34367131e-05,
+            2.3841043e-05, -4.95787117e-06,
+        },
+        /* 2441986.5 */ {
+            -15.963171, 4.77190018, 6.65195274, -0.356067508,
+            -0.254079551, 0.0222269595, 0.0102734733, -0.00193211518,
+            -0.000580755936, 0.000169062987, 3.28717579e-05, -1.62056367e-05,
+            -77.7066803, 67.345932, -0.84378618, -0.916077375,
+            0.138351783, 0.0758286044, -0.0137005532, -0.00480016926,
+            0.00136538793, 0.000308802875, -0.00013475286, -1.94000622e-05,
+            0.00439569121, 0.000336690253, -0.000114074937, -9.96086965e-05,
+            1.33235753e-05, 6.72417355e-06,
+        },
+        /* 2442114.5 */ {
+            12.9288425, 14.197546, -4.70127487, -0.771430552,
+            0.0973245576, 0.0208689738, 0.0021553759, -0.000895215198,
+            -0.000247245393, 1.50475826e-05, 1.53121709e-05, 2.21996174e-06,
+            49.2038651, 62.4540977, 1.49227464, -0.0367889181,
+            -0.215491474, -0.00524536753, 0.00993888732, 0.00187313976,
+            -0.000201331466, -0.000176229398, -1.42106428e-05, 9.16809404e-06,
+            0.00430601928, 9.91738216e-06, 0.000260339992, -1.29594064e-05,
+            -3.19308529e-05, 8.75102103e-07,
+        },
+        /* 2442242.5 */ {
+            2.02334833, -21.5794106, -0.826167166, 1.03109801,
+            0.0282990318, 0.00229717442, 0.000641738414, -0.000840783818,
+            -5.13674131e-05, 2.32128559e-06, -1.7063719e-06, 1.26428506e-06,
+            -186.653641, 59.8076782, 0.0441370532, 0.752290249,
+            0.0411965623, -0.0328633673, -0.000856357394, -0.00061381649,
+            -0.000135982016, 6.77479256e-05, 4.70811847e-06, 7.30486818e-07,
+            0.00425012689, -0.000432074885, -5.39715184e-05, 0.000107484608,
+            6.06631602e-06, -7.25562677e-06,
+        },
+        /* 2442370.5 */ {
+            -14.0330601, 11.5904312, 5.66775894, -0.835878134,
+            -0.162684843, 0.0415762588, 0.000639241713, -0.00254557631,
+            0.000306319125, 0.000126509505, -3.91808317e-05, -2.86818113e-06,
+            -58.6897659, 66.0868683, -1.96634555, -0.464298397,
+            0.272268385, 0.0160906333, -0.019893283, 0.00177874661,
+            0.00117932225, -0.000332671189, -4.58006834e-05, 3.70282978e-05,
+            0.0041156793, 8.38703781e-05, -0.000237385641, -5.22877017e-05,
+            2.82479778e-05, 3.53042537e-06,
+        },
+        /* 2442498.5 */ {
+            15.726881, 8.31355095, -5.7560792, -0.474599838,
+            0.15595147, 0.0197835267, -0.0027879267, -0.00143265631,
+            4.83542935e-05, 9.0917958e-05, 5.3513595e-06, -5.51273206e-06,
+            67.4741516, 63.5874062, 1.07253575, -0.471983224,
+            -0.171687678, 0.0344937257, 0.0124296406, -0.000815240317,
+            -0.000883361034, -4.06531653e-05, 6.01084794e-05, 9.97863117e-06,
+            0.00383838499, 0.000135145281, 0.000188595834, -7.57049202e-05,
+            -2.32180919e-05, 5.11219241e-06,
+        },
+        /* 2442626.5 */ {
+            -3.39203715, -21.3958664, 1.04487097, 1.0951997,
+            0.0279704109, -0.00212319545, -0.00316189276, -0.00099398091,
+            -5.37541291e-06, 2.09715163e-05, 8.30667977e-06, 1.67685857e-06,
+            -168.432175, 60.5529022, 1.26976073, 0.720567346,
+            -0.0655585453, -0.0395279676, -0.00287299929, -0.000238280249,
+            0.000309316965, 0.000100060919, 4.27576197e-06, -1.90999003e-06,
+            0.00357436226, -0.000486406439, 0.00011379271, 9.83003774e-05,
+            -1.41487753e-05, -6.6348739e-06,
+        },
+        /* 2442754.5 */ {
+            -10.6054106, 17.0664234, 4.0413065, -1.09708357,
+            -0.055696521, 0.0321671776, -0.00586913433, -0.000567861251,
+            0.000460241194, -5.56221494e-05, -1.5228442e-05, 7.64471042e-06,
+            -39.762886, 64.0960236, -2.2844007, 0.124709733,
+            0.24941501, -0.0337016694, -0.00813894626, 0.00356025365,
+            -0.000374574098, -0.00018927468, 6.89299195e-05, -3.03452134e-06,
+            0.00330020022, -0.000230605889, -0.000266181509, 1.60706932e-05,
+            3.18098355e-05, -1.08339543e-06,
+        },
+        /* 2442882.5 */ {
+            16.9631748, 1.6266526, -6.21877241, -0.0781878978,
+            0.188817456, 0.00321118929, -0.00654431107, -0.000312649267,
+            0.000401415222, 2.5792524e-05, -2.52704376e-05, -2.29610328e-06,
+            85.7386475, 64.1030655, 0.138354957, -0.698579311,
+            -0.0330103263, 0.0614341497, 0.00273308554, -0.00374464341,
+            -0.00024540149, 0.000260608125, 2.24942578e-05, -2.07767916e-05,
+            0.0028833854, 0.000170539322, 4.00730532e-05, -0.000107993452,
+            -5.16561249e-06, 7.29288104e-06,
+        },
+        /* 2443010.5 */ {
+            -8.40503979, -19.0202789, 2.96964502, 1.11614442,
+            -0.00359472167, -0.0189616457, -0.00632355129, -0.000473855122,
+            0.000248488272, 7.3493371e-05, 6.11926089e-06, -3.03657043e-06,
+            -149.983383, 62.3345032, 2.19238186, 0.421535194,
+            -0.186772749, -0.0433600321, 0.000912313932, 0.00216191541,
+            0.000668000721, 8.7473536e-06, -4.19487442e-05, -1.1934023e-05,
+            0.00243937923, -0.000387604639, 0.000234940162, 4.95810091e-05,
+            -2.86728118e-05, -3.34517722e-06,
+        },
+        /* 2443138.5 */ {
+            -6.00184822, 20.6183472, 2.09993315, -1.15991604,
+            0.0100514358, 0.0124524655, -0.00518387789, 0.000818397559,
+            0.000127444931, -5.53517493e-05, 1.03353514e-05, 2.32881874e-07,
+            -21.0129776, 62.1058769, -1.75055444, 0.572332799,
+            0.13532865, -0.0452158973, 0.0014588323, 0.00102574017,
+            -0.000587314484, 8.09087433e-05, 1.78662449e-05, -8.81628148e-06,
+            0.00204422115, -0.000501296192, -0.000188671518, 7.79724505e-05,
+            2.25764943e-05, -5.26146141e-06,
+        },
+        /* 2443266.5 */ {
+            16.5400295, -5.19484997, -6.00813103, 0.332772195,
+            0.169755802, -0.016514685, -0.00456223357, 0.00123293197,
+            0.000210771628, -8.82144013e-05, -7.59649674e-06, 6.71346424e-06,
+            103.980446, 63.7487907, -0.891474426, -0.596926212,
+            0.125241026, 0.048405759, -0.010062865, -0.00223020813,
+            0.000825776311, 9.53174967e-05, -6.68791399e-05, -2.23215375e-06,
+            0.00155176641, 8.26006726e-05, -0.000125244769, -9.68339809e-05,
+            1.4964824e-05, 6.53995403e-06,
+        },
+        /* 2443394.5 */ {
+            -12.4724712, -14.5730219, 4.77364683, 0.999672115,
+            -0.087602213, -0.0383939035, -0.00455590943, 0.00139114994,
+            0.000514030573, 5.45393868e-06, -3.18532402e-05, -7.46185651e-06,
+            -131.282181, 64.5816422, 2.40419292, -0.109029561,
+            -0.274298698, -0.0180793479, 0.0134446807, 0.0037012347,
+            -0.00014657795, -0.000319874409, -5.13826599e-05, 1.38415589e-05,
+            0.00099182385, -0.000192623891, 0.000261009875, -1.90742358e-05,
+            -3.16633268e-05, 1.29028126e-06,
+        },
+        /* 2443522.5 */ {
+            -0.703908384, 21.9507294, 0.108982883, -1.11781275,
+            0.0302180722, 0.000849687145, -0.00136914023, 0.000989248161,
+            -3.50822011e-05, -9.96312701e-06, 3.52483835e-06, -1.81343864e-06,
+            -2.48261499, 60.8326187, -0.670102775, 0.749027312,
+            0.0121315373, -0.0386302173, 0.00211121771, -0.000573206984,
+            -8.37374319e-05, 9.47790613e-05, -6.67941958e-06, 3.6337147e-07,
+            0.000510886894, -0.00063425285, -3.57363388e-05, 0.00010851986,
+            4.26195038e-06, -7.32330318e-06,
+        },
+        /* 2443650.5 */ {
+            14.4928284, -11.4757242, -5.17428827, 0.660819292,
+            0.112557821, -0.0232567284, 0.000754932349, 0.0012565701,
+            -0.000185748067, -4.78857146e-05, 1.71237589e-05, 1.8298492e-07,
+            -237.817978, 62.6328583, -1.55636549, -0.223308772,
+            0.209617168, 0.00920424052, -0.0119905891, 0.00123847718,
+            0.000540263136, -0.00017435303, -1.3208838e-05, 1.46521061e-05,
+            9.67453525e-06, -0.00010576639, -0.000240539041, -4.67137324e-05,
+            2.90755834e-05, 3.15639954e-06,
+        },
+        /* 2443778.5 */ {
+            -15.1872168, -8.44518757, 6.15781689, 0.66252172,
+            -0.199101537, -0.0388639346, 0.00433387328, 0.00279949629,
+            8.34284492e-06, -0.000190072795, -2.15674008e-05, 1.21410112e-05,
+            -112.391045, 66.5183563, 1.73266554, -0.679750085,
+            -0.236948118, 0.0420538485, 0.0203581695, -0.000666621781,
+            -0.00163069321, -0.000147740982, 0.000118289572, 2.99243129e-05,
+            -0.000577843166, 1.02672684e-05, 0.000181852331, -8.00474809e-05,
+            -2.19171288e-05, 5.40681503e-06,
+        },
+        /* 2443906.5 */ {
+            4.70036077, 21.0315514, -1.78651917, -1.04019499,
+            0.0353392176, 0.00227410439, 0.00214212714, 0.000701998419,
+            -8.90380543e-05, -1.50370061e-05, -4.25505368e-06, -4.57150009e-07,
+            15.8732595, 60.6500626, 0.494169861, 0.654224813,
+            -0.0944590569, -0.0337439738, 0.000709738932, 4.48875744e-06,
+            0.000309725612, 5.23104864e-05, -9.28264126e-06, -1.90917513e-06,
+            -0.00109176699, -0.000583074056, 0.000131457404, 9.54261923e-05,
+            -1.57671238e-05, -6.43957583e-06,
+        },
+        /* 2444034.5 */ {
+            10.9936943, -16.6121159, -3.87200642, 0.863517463,
+            0.0568043478, -0.015108685, 0.00380162522, 0.000208164493,
+            -0.000230260892, 2.4535133e-05, 5.21877473e-06, -2.96287567e-06,
+            -219.673248, 61.1952896, -1.55852973, 0.236087725,
+            0.193722337, -0.0211611371, -0.00515399035, 0.00189162733,
+            -0.000233039609, -9.29394664e-05, 3.04020068e-05, -1.30844592e-06,
+            -0.00154265226, -0.000323024287, -0.000259072316, 2.22068375e-05,
+            3.14907156e-05, -1.49660457e-06,
+        },
+        /* 2444162.5 */ {
+            -16.3068142, -1.29744446, 6.80441999, 0.128378153,
+            -0.268336326, -0.00960769691, 0.0121476045, 0.000818183122,
+            -0.000803198898, -7.35945068e-05, 5.77656792e-05, 7.55000383e-06,
+            -93.3960648, 67.4927368, 0.39118135, -0.993180156,
+            -0.0500695072, 0.0875690281, 0.0052606035, -0.00641244696,
+            -0.000558209256, 0.000519125082, 5.87892391e-05, -4.82175601e-05,
+            -0.00206385832, 0.000138125746, 2.96728776e-05, -0.000108811735,
+            -3.35459026e-06, 7.34836203e-06,
+        },
+        /* 2444290.5 */ {
+            9.6135273, 18.023838, -3.50178552, -0.92649287,
+            0.0575137921, 0.0126383631, 0.00366375153, 7.29796693e-06,
+            -0.000211408653, -2.75323364e-05, 2.0714881e-06, 2.48400261e-06,
+            34.1496887, 61.4368553, 1.30452049, 0.333769828,
+            -0.180991933, -0.0256211292, 0.00402870914, 0.00160517718,
+            0.000322121603, -5.86711285e-05, -2.9070261e-05, -3.15219336e-06,
+            -0.00254444918, -0.0003667571, 0.00024602082, 4.39578034e-05,
+            -2.94542933e-05, -2.96558801e-06,
+        },
+        /* 2444418.5 */ {
+            6.36349154, -20.1299648, -2.276196, 0.971091568,
+            0.0300923344, -0.00296168705, 0.00301499036, -0.000558511761,
+            -9.73728384e-05, 1.98514081e-05, -4.87160423e-06, -1.25641009e-07,
+            -201.577652, 60.0712624, -0.876162291, 0.598839223,
+            0.118380666, -0.0307910647, -0.000421533128, 0.000365487969,
+            -0.000361579179, 3.37275706e-05, 1.1059039e-05, -3.19959327e-06,
+            -0.00290008564, -0.000477293564, -0.000173029985, 8.22039729e-05,
+            2.12390205e-05, -5.54742155e-06,
+        },
+        /* 2444546.5 */ {
+            -15.7401886, 6.03257322, 6.53781366, -0.452545941,
+            -0.242556259, 0.0277334768, 0.0088870544, -0.00232176087,
+            -0.000427957624, 0.000193497035, 1.70231251e-05, -1.7289125e-05,
+            -74.3647079, 67.2022247, -1.08290935, -0.860118389,
+            0.172322288, 0.0675303414, -0.0165502056, -0.00371404854,
+            0.00157716288, 0.000176186193, -0.000147141531, -2.8226259e-06,
+            -0.00327594182, 0.000146850114, -0.000133964393, -9.37973746e-05,
+            1.65572455e-05, 6.33384798e-06,
+        },
+        /* 2444674.5 */ {
+            13.5238438, 13.2482405, -4.92286205, -0.728233576,
+            0.10770309, 0.0218137, 0.00146312767, -0.00107522425,
+            -0.000224544012, 3.07500086e-05, 1.67423368e-05, 1.23805125e-06,
+            52.4155731, 62.6795006, 1.46728253, -0.119596608,
+            -0.215467468, 0.00102912867, 0.0110575845, 0.00163551595,
+            -0.000357597775, -0.000182758537, -2.77695676e-06, 1.21730554e-05,
+            -0.00365286996, -6.22382431e-05, 0.000262207031, -2.51839119e-05,
+            -3.129381e-05, 1.7014471e-06,
+        },
+        /* 2444802.5 */ {
+            1.06866336, -21.7025166, -0.504962981, 1.04278457,
+            0.0288981423, 0.00246922113, 2.42085243e-05, -0.000882233784,
+            -4.81734205e-05, 1.49422056e-06, -2.01251453e-07, 1.44559112e-06,
+            -183.463394, 59.8486595, 0.260901123, 0.76491791,
+            0.023679778, -0.0335811675, -0.00126357074, -0.000693635491,
+            -7.00223391e-05, 7.3168696e-05, 5.35023855e-06, 1.10009501e-06,
+            -0.0038838631, -0.000493825355, -1.67049729e-05, 0.000109142573,
+            2.44433977e-06, -7.36681432e-06,
+        },
+        /* 2444930.5 */ {
+            -13.5320921, 12.6686869, 5.41982412, -0.898454189,
+            -0.142930031, 0.0416986085, -0.00100315665, -0.00228907098,
+            0.000403801241, 8.84709079e-05, -4.11294823e-05, 1.13368344e-06,
+            -55.3577805, 65.7726746, -2.08609343, -0.361881673,
+            0.278915823, 0.00502626738, -0.0185934417, 0.00259781932,
+            0.000889204093, -0.000363987172, -1.14359136e-05, 3.31181946e-05,
+            -0.00406593643, 4.80790368e-05, -0.000242941518, -4.10462599e-05,
+            2.98086015e-05, 2.77147956e-06,
+        },
+        /* 2445058.5 */ {
+            16.0615215, 7.1781044, -5.88449335, -0.410341978,
+            0.164789364, 0.0178368334, -0.00372179621, -0.00135816808,
+            0.000128135958, 9.27450819e-05, -6.54933217e-07, -6.3942407e-06,
+            70.6865005, 63.7364807, 0.935030401, -0.532372534,
+            -0.152960509, 0.0412869118, 0.0115954932, -0.00148879166,
+            -0.000886667811, 2.06090172e-05, 6.64712788e-05, 4.91917262e-06,
+            -0.00427799718, 0.000225393596, 0.000173773762, -8.41891815e-05,
+            -2.05454508e-05, 5.68422001e-06,
+        },
+        /* 2445186.5 */ {
+            -4.31913757, -21.1364002, 1.38215017, 1.10391486,
+            0.0256614909, -0.00426283665, -0.00384815084, -0.000979593024,
+            1.95196717e-05, 2.99641306e-05, 9.79296055e-06, 1.40967859e-06,
+            -165.208954, 60.7986908, 1.46670985, 0.687943876,
+            -0.0862471461, -0.0410027355, -0.00285464898, 5.37120395e-05,
+            0.00039895167, 0.00010098546, 5.72165277e-07, -3.68356609e-06,
+            -0.0043682307, -0.000346539338, 0.000147259052, 9.21843166e-05,
+            -1.73334138e-05, -6.22308289e-06,
+        },
+        /* 2445314.5 */ {
+            -9.87037754, 17.8427925, 3.71477842, -1.12025595,
+            -0.0404098071, 0.028781265, -0.00619968632, -0.00022218228,
+            0.000409873581, -6.80761659e-05, -7.83560245e-06, 6.64420531e-06,
+            -36.4550514, 63.7260628, -2.246732, 0.219382361,
+            0.233176157, -0.0383060612, -0.00583171425, 0.00325232372,
+            -0.000522816321, -0.000124495433, 6.57947749e-05, -7.88787838e-06,
+            -0.00434537744, -9.72554553e-05, -0.00025321875, 2.82191104e-05,
+            3.10692012e-05, -1.90559751e-06,
+        },
+        /* 2445442.5 */ {
+            17.0104485, 0.417272627, -6.23148346, -0.00377375283,
+            0.189442873, -0.000581152795, -0.00664922921, 4.19528277e-07,
+            0.000412909634, 8.03779869e-07, -2.64222272e-05, -9.16239244e-08,
+            88.949585, 64.1071548, -0.0505516529, -0.705509722,
+            -0.00354653434, 0.0622686222, 0.000208294005, -0.00384402997,
+            -1.73791832e-05, 0.00027222815, 1.70962198e-06, -2.21802238e-05,
+            -0.00435376354, 0.0004031274, 1.64607318e-05, -0.000109326131,
+            -1.53267217e-06, 7.38048948e-06,
+        },
+        /* 2445570.5 */ {
+            -9.20314789, -18.3822803, 3.30240107, 1.10866046,
+            -0.0144614559, -0.0226906799, -0.00651957886, -0.000240327019,
+            0.000313706143, 7.63004209e-05, 1.70333112e-06, -4.55615009e-06,
+            -146.714157, 62.7137604, 2.29071665, 0.342189997,
+            -0.207005426, -0.0417934842, 0.00262090121, 0.0026562463,
+            0.000643605774, -3.92840557e-05, -5.31384831e-05, -1.15617177e-05,
+            -0.00429714937, -7.08118969e-05, 0.000253035629, 3.81472491e-05,
+            -3.01389573e-05, -2.5762215e-06,
+        },
+        /* 2445698.5 */ {
+            -5.10552502, 21.0199432, 1.74860585, -1.15764749,
+            0.0162340384, 0.00952973031, -0.00460460875, 0.000913575583,
+            8.0998434e-05, -4.5447061e-05, 1.05082454e-05, -6.32671799e-07,
+            -17.7406654, 61.8163948, -1.58764076, 0.624142826,
+            0.112898283, -0.0445498414, 0.00210912689, 0.000587541203,
+            -0.000513280567, 9.64819919e-05, 9.20145339e-06, -6.6956809e-06,
+            -0.00409202604, -0.000205965975, -0.000160576397, 8.61331791e-05,
+            1.98322832e-05, -5.81600125e-06,
+        },
+        /* 2445826.5 */ {
+            16.2961063, -6.35859346, -5.90382385, 0.398959786,
+            0.161468491, -0.0189591311, -0.00369626982, 0.0013716832,
+            0.000132710324, -9.28933514e-05, -1.07215612e-06, 6.47674733e-06,
+            107.187775, 63.5998993, -1.04779804, -0.546739399,
+            0.14746125, 0.0423963815, -0.0113931578, -0.00158425176,
+            0.000885390211, 3.10270188e-05, -6.69739675e-05, 4.00806039e-06,
+            -0.00388985197, 0.00042471409, -0.000146409817, -9.04870103e-05,
+            1.80963998e-05, 6.10781672e-06,
+        },
+        /* 2445954.5 */ {
+            -13.0588846, -13.6031151, 5.05728149, 0.957654297,
+            -0.106757618, -0.0404926538, -0.00343461614, 0.00177530525,
+            0.000497925445, -2.86696941e-05, -3.77084289e-05, -5.77396713e-06,
+            -127.971954, 64.9642105, 2.35041571, -0.214271992,
+            -0.279170126, -0.00934794731, 0.0157319661, 0.0034272531,
+            -0.000440608797, -0.000355815166, -3.09578754e-05, 2.25046806e-05,
+            -0.00368868117, 0.000247855787, 0.000258075161, -3.12361772e-05,
+            -3.08212802e-05, 2.10700159e-06,
+        },
+        /* 2446082.5 */ {
+            0.256610185, 21.9537315, -0.23390092, -1.10619092,
+            0.031150626, 0.000195713874, -0.000675397867, 0.000959337747,
+            -4.47918101e-05, -7.24452275e-06, 1.61940966e-06, -1.70100316e-06,
+            0.756616294, 60.7215919, -0.457556069, 0.751182795,
+            -0.00782284327, -0.0374912731, 0.00176337198, -0.000613533193,
+            1.21634844e-06, 8.83217945e-05, -6.67302493e-06, 6.92146557e-07,
+            -0.00334659335, -0.000209103091, -2.32626621e-06, 0.000109396722,
+            6.18065371e-07, -7.38692961e-06,
+        },
+        /* 2446210.5 */ {
+            13.9767389, -12.4805708, -4.97410297, 0.705836296,
+            0.101458289, -0.0227002241, 0.0015767226, 0.00110381388,
+            -0.000223053954, -3.13479104e-05, 1.70204767e-05, -1.15476098e-06,
+            -234.617081, 62.3860092, -1.61076176, -0.142583176,
+            0.21357663, 0.00239464268, -0.0111094927, 0.00161692663,
+            0.000387448847, -0.000182370248, 7.50858248e-07, 1.25773713e-05,
+            -0.00296173897, 0.000306145696, -0.000249413773, -3.52538627e-05,
+            3.04457371e-05, 2.37823383e-06,
+        },
+        /* 2446338.5 */ {
+            -15.5069408, -7.24016762, 6.33337593, 0.580163002,
+            -0.21650742, -0.0357100293, 0.00616179872, 0.00272582565,
+            -0.000160695461, -0.000202993426, -7.76420529e-06, 1.53767251e-05,
+            -109.054359, 66.7725372, 1.53431344, -0.761727035,
+            -0.21348168, 0.0531252623, 0.0193775371, -0.00191744312,
+            -0.00169084372, -2.41006619e-05, 0.000139288619, 1.9129975e-05,
+            -0.0026279639, 0.000505055476, 0.00016021679, -8.80601292e-05,
+            -1.91056588e-05, 5.94280891e-06,
+        },
+        /* 2446466.5 */ {
+            5.61809254, 20.6504364, -2.10470748, -1.02423394,
+            0.0373383239, 0.00367301702, 0.00260543916, 0.000618325546,
+            -0.000105190644, -1.91640756e-05, -4.44021725e-06, -3.1352851e-08,
+            19.0953255, 60.7326164, 0.673789978, 0.612500846,
+            -0.111615978, -0.0330321155, 0.000846851442, 0.000266859046,
+            0.000350854913, 4.06938998e-05, -1.19361439e-05, -2.8377749e-06,
+            -0.00220296602, -8.28712436e-05, 0.000157699411, 8.86489725e-05,
+            -1.88446884e-05, -5.98662291e-06,
+        },
+        /* 2446594.5 */ {
+            10.2497978, -17.3633728, -3.60775924, 0.887863636,
+            0.0496054515, -0.0128912702, 0.00391334668, 3.02762473e-05,
+            -0.000208270503, 2.87407747e-05, 2.27835949e-06, -2.57486772e-06,
+            -216.480194, 60.9535103, -1.48557115, 0.31126228,
+            0.183254853, -0.0241867248, -0.0039230953, 0.00169677055,
+            -0.00030785639, -6.37966878e-05, 2.90308308e-05, -3.07332448e-06,
+            -0.00169326155, 0.000116081828, -0.000251333957, 3.41521336e-05,
+            3.05479152e-05, -2.30784008e-06,
+        },
+        /* 2446722.5 */ {
+            -16.3324947, 0.00552852033, 6.82624245, 0.02413477,
+            -0.271203786, -0.00261048228, 0.0124802608, 0.000195158616,
+            -0.00084121176, -1.64057183e-05, 6.20530336e-05, 1.63645996e-06,
+            -90.0459137, 67.535675, 0.124212377, -1.00384939,
+            -0.00870593172, 0.0892922357, 0.000981090358, -0.00665868819,
+            -0.000106903535, 0.000552168465, 1.12706748e-05, -5.29751305e-05,
+            -0.00125208998, 0.000616417616, -1.42848262e-06, -0.00010946986,
+            2.95468681e-07, 7.38809149e-06,
+        },
+        /* 2446850.5 */ {
+            10.3895903, 17.3020267, -3.77902484, -0.899551749,
+            0.0645588934, 0.0147271007, 0.00358497631, -0.000173119988,
+            -0.000232830382, -2.36460601e-05, 4.9328828e-06, 2.89641025e-06,
+            37.3704681, 61.6450005, 1.3856318, 0.259518445,
+            -0.192406774, -0.0225682054, 0.00520538026, 0.00181690801,
+            0.000252451631, -8.81855885e-05, -3.06852744e-05, -1.53756946e-06,
+            -0.000795539061, 0.000138883493, 0.000254844228, 3.22330488e-05,
+            -3.07273403e-05, -2.17831507e-06,
+        },
+        /* 2446978.5 */ {
+            5.46329594, -20.5582638, -1.97414875, 0.984866142,
+            0.0285230596, -0.00128569675, 0.00259998604, -0.000637100777,
+            -8.09727935e-05, 1.51728927e-05, -4.8982115e-06, 2.78364837e-07,
+            -198.385971, 59.9499817, -0.70000118, 0.64437151,
+            0.102531694, -0.0312609375, -0.000219425798, 8.94929181e-05,
+            -0.000328172784, 4.43873905e-05, 8.04191313e-06, -2.27952614e-06,
+            -0.000237558343, -5.45021576e-05, -0.000151713713, 8.98100261e-05,
+            1.83621578e-05, -6.06536787e-06,
+        },
+        /* 2447106.5 */ {
+            -15.4688721, 7.27785873, 6.39817476, -0.545143485,
+            -0.228665829, 0.0324674286, 0.0072761653, -0.00259683398,
+            -0.00025943981, 0.000203133983, 7.27867473e-07, -1.6450078e-05,
+            -71.0112991, 67.02388, -1.30817163, -0.792521358,
+            0.20259583, 0.0578149483, -0.0187033657, -0.00250242697,
+            0.00167980918, 3.75426425e-05, -0.000144974503, 1.28502215e-05,
+            0.000269040727, 0.000549042947, -0.000162178912, -8.68548887e-05,
+            1.95778575e-05, 5.86130773e-06,
+        },
+        /* 2447234.5 */ {
+            14.0809469, 12.2569914, -5.13237333, -0.681075573,
+            0.118432947, 0.0223340988, 0.00066004676, -0.00123179774,
+            -0.000188058664, 4.71918793e-05, 1.69887426e-05, -6.65509532e-08,
+            55.6410217, 62.9006348, 1.42044508, -0.20172444,
+            -0.212371543, 0.00785089098, 0.0119753396, 0.00128080242,
+            -0.000513176259, -0.000177176, 1.09722096e-05, 1.44400965e-05,
+            0.000714099675, 0.000376052107, 0.000249671546, -3.71594979e-05,
+            -3.02501085e-05, 2.50627727e-06,
+        },
+        /* 2447362.5 */ {
+            0.107156157, -21.7631264, -0.178652942, 1.05451512,
+            0.0294580311, 0.00226091431, -0.000624306675, -0.00091997924,
+            -4.4828168e-05, 2.2707502e-06, 1.4982578e-06, 1.60176478e-06,
+            -180.254807, 59.9264412, 0.480921119, 0.770317495,
+            0.00562832551, -0.0345156938, -0.00170454313, -0.00071730389,
+            1.63083109e-06, 7.9123849e-05, 6.1740725e-06, 1.16957722e-06,
+            0.00123961875, -0.000130837638, 9.00031864e-06, 0.000109330678,
+            -1.20959885e-06, -7.38300514e-06,
+        },
+        /* 2447490.5 */ {
+            -12.9851284, 13.7080851, 5.15314245, -0.954258323,
+            -0.123092487, 0.0409364328, -0.00247617275, -0.00196546689,
+            0.000469744147, 4.96449538e-05, -3.94659946e-05, 4.38640154e-06,
+            -52.0136871, 65.4384766, -2.1796875, -0.256584376,
+            0.280640572, -0.00534972269, -0.0167980641, 0.00320433173,
+            0.000579171814, -0.000364748383, 1.91178278e-05, 2.62734829e-05,
+            0.00175263349, 0.000333149888, -0.00025775563, -2.93125868e-05,
+            3.09848947e-05, 1.97660256e-06,
+        },
+        /* 2447618.5 */ {
+            16.3494301, 6.01562452, -5.99485159, -0.342761457,
+            0.172638535, 0.0153791206, -0.00458811549, -0.00122353912,
+            0.000206914498, 8.8582201e-05, -7.17588864e-06, -6.7001115e-06,
+            73.9146423, 63.8647156, 0.782163024, -0.585470498,
+            -0.131207839, 0.0474994108, 0.0103283459, -0.00214472134,
+            -0.000836687512, 8.5345062e-05, 6.74123439e-05, -1.24043947e-06,
+            0.00215093442, 0.000533270009, 0.000143875644, -9.16156641e-05,
+            -1.76046979e-05, 6.18288914e-06,
+        },
+        /* 2447746.5 */ {
+            -5.235044, -20.8080425, 1.72261238, 1.11109626,
+            0.0221588761, -0.00680492818, -0.00451077195, -0.000940094993,
+            5.29713034e-05, 4.01000652e-05, 1.07925252e-05, 9.31515103e-07,
+            -161.962265, 61.0762138, 1.65284812, 0.646692872,
+            -0.107548542, -0.0423367918, -0.00260349968, 0.000415241026,
+            0.000485759374, 9.68723834e-05, -5.16036062e-06, -5.75598324e-06,
+            0.00257330108, -8.52632147e-05, 0.000165777747, 8.48625568e-05,
+            -2.02946921e-05, -5.73087755e-06,
+        },
+        /* 2447874.5 */ {
+            -9.09720135, 18.5607967, 3.37864137, -1.13778389,
+            -0.0266171433, 0.0252073165, -0.00630481495, 8.61372682e-05,
+            0.000349883398, -7.383107e-05, -1.38235055e-06, 5.26680242e-06,
+            -33.1366806, 63.3593826, -2.18256402, 0.30860576,
+            0.214594454, -0.0416709073, -0.00372153847, 0.00283873128,
+            -0.000617556332, -6.34588359e-05, 5.80807973e-05, -1.07853984e-05,
+            0.00302200625, 4.95009954e-05, -0.000250087382, 4.00113968e-05,
+            2.9928e-05, -2.7032595e-06,
+        },
+        /* 2448002.5 */ {
+            17.0052738, -0.799182177, -6.22255564, 0.0710234419,
+            0.18828544, -0.00439995108, -0.00654580723, 0.000316155667,
+            0.000402931997, -2.44386447e-05, -2.54469069e-05, 2.14153533e-06,
+            92.1762543, 64.0824127, -0.241073713, -0.701531053,
+            0.0261589661, 0.0616871603, -0.00234153285, -0.00377158308,
+            0.000213538311, 0.000263905007, -1.9393492e-05, -2.11631213e-05,
+            0.00334197585, 0.000538272026, -2.03478176e-05, -0.000109228749,
+            2.12253008e-06, 7.3725505e-06,
+        },
+        /* 2448130.5 */ {
+            -9.97195053, -17.6758194, 3.63177466, 1.09611142,
+            -0.0271446407, -0.0264520887, -0.00652903458, 4.319664e-05,
+            0.000378015422, 7.38684394e-05, -4.1801386e-06, -6.04568049e-06,
+            -143.421326, 63.1052933, 2.36491132, 0.255375922,
+            -0.22591795, -0.0390998647, 0.00463431282, 0.00310374028,
+            0.000571448938, -9.6731972e-05, -6.24025415e-05, -9.51462334e-06,
+            0.00361111993, 5.20574067e-05, 0.000255213847, 2.62496305e-05,
+            -3.12162847e-05, -1.7735681e-06,
+        },
+        /* 2448258.5 */ {
+            -4.18569088, 21.350771, 1.39497352, -1.15266526,
+            0.0210823659, 0.00694315555, -0.00395688415, 0.000973840069,
+            4.27468694e-05, -3.55493394e-05, 9.79936794e-06, -1.24037365e-06,
+            -14.4596748, 61.5528183, -1.40874255, 0.667130589,
+            0.0904951468, -0.043501202, 0.00247671851, 0.000206786819,
+            -0.000425921695, 0.000104259881, 2.53270332e-06, -4.57335682e-06,
+            0.0039243442, -0.000202267955, -0.000142574369, 9.32335679e-05,
+            1.68324332e-05, -6.29569695e-06,
+        },
+        /* 2448386.5 */ {
+            15.9982624, -7.50634003, -5.77877235, 0.462253779,
+            0.152021721, -0.0209017955, -0.00274596526, 0.00145018357,
+            5.21798065e-05, -9.14122429e-05, 5.06595279e-06, 5.6319027e-06,
+            110.408592, 63.4258461, -1.19058478, -0.488068759,
+            0.166855916, 0.0356669016, -0.0122939972, -0.000904562185,
+            0.000890680763, -3.14317549e-05, -6.13712764e-05, 9.30858005e-06,
+            0.00413455442, 0.000372168142, -0.000177226801, -8.29108103e-05,
+            2.09963218e-05, 5.59658974e-06,
+        },
+        /* 2448514.5 */ {
+            -13.6009474, -12.5763006, 5.32619667, 0.907835007,
+            -0.126639038, -0.0418405011, -0.00206825184, 0.0021299182,
+            0.000449942425, -6.6917848e-05, -4.10659595e-05, -3.0004137e-06,
+            -124.642624, 65.3332291, 2.26745701, -0.319873661,
+            -0.279412419, 0.00054085959, 0.0177236944, 0.00292149326,
+            -0.000751112937, -0.000367740082, -3.12744123e-06, 3.02443223e-05,
+            0.00422609365, 0.00020684622, 0.000241078684, -4.29284592e-05,
+            -2.9581126e-05, 2.89718241e-06,
+        },
+        /* 2448642.5 */ {
+            1.2206105, 21.8815823, -0.57480377, -1.09357154,
+            0.0318429321, -3.57218014e-05, -2.30458272e-06, 0.000919719925,
+            -5.27379234e-05, -6.36906407e-06, -1.52178856e-07, -1.52598216e-06,
+            4.0037899, 60.6470909, -0.244333893, 0.744646549,
+            -0.0273210257, -0.0364917517, 0.00140445365, -0.00058493379,
+            8.056144e-05, 8.15543681e-05, -6.44268903e-06, 6.23870221e-07,
+            0.00434716605, -0.000341806386, 2.13200947e-05, 0.000108948421,
+            -3.03402976e-06, -7.35566937e-06,
+        },
+        /* 2448770.5 */ {
+            13.4110899, -13.4466343, -4.75799417, 0.746661127,
+            0.0905862153, -0.0216700584, 0.00229257927, 0.000923721411,
+            -0.000246125652, -1.52559569e-05, 1.5642916e-05, -2.18001242e-06,
+            -231.40683, 62.1292877, -1.64216352, -0.0599472746,
+            0.214226469, -0.00392800244, -0.00998630654, 0.00187777064,
+            0.000230078178, -0.000177504204, 1.26217665e-05, 9.62356353e-06,
+            0.00441688113, 7.92713108e-05, -0.000263833412, -2.32445182e-05,
+            3.14245372e-05, 1.56932447e-06,
+        },
+        /* 2448898.5 */ {
+            -15.7723656, -6.00144053, 6.48268652, 0.49144119,
+            -0.232084066, -0.0315431617, 0.00788720883, 0.00252132188,
+            -0.000333441654, -0.000201496558, 8.14736995e-06, 1.71411539e-05,
+            -105.705109, 66.9921188, 1.31548417, -0.833630025,
+            -0.185070559, 0.0633392558, 0.0175770838, -0.0031621845,
+            -0.00163939991, 0.000112861184, 0.000147827304, 4.57599572e-06,
+            0.00433158875, 0.000293088902, 0.000128922053, -9.48413217e-05,
+            -1.60467443e-05, 6.40261987e-06,
+        },
+        /* 2449026.5 */ {
+            6.51767159, 20.197525, -2.41735506, -1.00666535,
+            0.0400958322, 0.00533280242, 0.00299726566, 0.000518998597,
+            -0.000124696628, -2.31483391e-05, -4.09089216e-06, 4.61649961e-07,
+            22.3242893, 60.8451729, 0.839540541, 0.563418806,
+            -0.128162369, -0.0321258828, 0.00117621897, 0.000555986073,
+            0.000378557685, 2.59149601e-05, -1.53887395e-05, -3.64118523e-06,
+            0.00423268741, -0.000337641424, 0.000175578331, 8.08381301e-05,
+            -2.16801764e-05, -5.45686498e-06,
+        },
+        /* 2449154.5 */ {
+            9.46773815, -18.0570526, -3.33353806, 0.90916115,
+            0.0434465334, -0.0106125008, 0.00390013517, -0.000130785513,
+            -0.000182974793, 3.01670043e-05, -2.64861171e-07, -2.05994979e-06,
+            -213.28244, 60.7240372, -1.38994896, 0.382382363,
+            0.171105415, -0.0265187714, -0.00282690045, 0.00144592335,
+            -0.000357245648, -3.62692845e-05, 2.5946425e-05, -4.1072376e-06,
+            0.00413777772, -0.000247813965, -0.000245376577, 4.57731257e-05,
+            2.92122932e-05, -3.08924291e-06,
+        },
+        /* 2449282.5 */ {
+            -16.2998295, 1.31121647, 6.81624746, -0.0806891918,
+            -0.270689249, 0.00446371641, 0.0123934681, -0.000438434741,
+            -0.000829641998, 4.2222604e-05, 6.06651556e-05, -4.49176241e-06,
+            -86.6902466, 67.5354996, -0.143764392, -0.998985529,
+            0.032935489, 0.0885886326, -0.00335137034, -0.00656263949,
+            0.000353196199, 0.000539211673, -3.75863419e-05, -5.11189428e-05,
+            0.00389689696, 0.000250683486, -3.61441271e-05, -0.000108602973,
+            3.94280596e-06, 7.33264778e-06,
+        },
+        /* 2449410.5 */ {
+            11.1286097, 16.5197678, -4.0454073, -0.869146466,
+            0.0725526959, 0.0167026948, 0.00336973509, -0.000366582215,
+            -0.000248720287, -1.67680537e-05, 8.0337677e-06, 3.1092045e-06,
+            40.5946617, 61.8636475, 1.44352138, 0.181356505,
+            -0.201809585, -0.018782841, 0.00648567732, 0.00195732829,
+            0.000156516879, -0.000117612428, -3.00413794e-05, 8.01490671e-07,
+            0.00358798495, -0.000216699496, 0.000258191663, 2.02133615e-05,
+            -3.16057012e-05, -1.3630729e-06,
+        },
+        /* 2449538.5 */ {
+            4.54296923, -20.9165554, -1.66652882, 0.997509778,
+            0.0277175233, 0.000120174867, 0.00212546275, -0.000702794117,
+            -6.84707702e-05, 1.06258485e-05, -4.47774028e-06, 6.13668931e-07,
+            -195.192719, 59.8605766, -0.510234356, 0.682881653,
+            0.0862239897, -0.0316103883, -0.000201610455, -0.000156677561,
+            -0.000284706388, 5.2362444e-05, 5.94525227e-06, -1.31526701e-06,
+            0.00332051073, -0.000502260693, -0.000129194683, 9.63832645e-05,
+            1.52494249e-05, -6.50514494e-06,
+        },
+        /* 2449666.5 */ {
+            -15.1414642, 8.49345303, 6.23026133, -0.632142723,
+            -0.212615803, 0.0362457521, 0.00551180029, -0.002741965,
+            -8.7647044e-05, 0.000197594039, -1.42691579e-05, -1.39050017e-05,
+            -67.6599426, 66.8091583, -1.51421833, -0.713910043,
+            0.228142485, 0.0470158048, -0.0200483967, -0.00124518247,
+            0.00166722492, -9.35042917e-05, -0.000129089269, 2.54947481e-05,
+            0.00295919925, 7.27921579e-05, -0.000187595302, -7.86739547e-05,
+            2.23467068e-05, 5.31309297e-06,
+        },
+        /* 2449794.5 */ {
+            14.5879698, 11.2244349, -5.32432747, -0.629626632,
+            0.129159078, 0.0223358124, -0.000231533864, -0.00135109143,
+            -0.000137555573, 6.29075657e-05, 1.57588547e-05, -1.59495346e-06,
+            58.8641396, 63.1099052, 1.35047054, -0.281194299,
+            -0.205730945, 0.0150396591, 0.0125922952, 0.000813236285,
+            -0.000654888456, -0.000157391987, 2.58968503e-05, 1.5439975e-05,
+            0.002488069, -5.03490191e-05, 0.000236094478, -4.85367236e-05,
+            -2.88180163e-05, 3.27903922e-06,
+        },
+        /* 2449922.5 */ {
+            -0.852510452, -21.7483311, 0.150397196, 1.06567204,
+            0.0297780409, 0.00163649372, -0.00129534095, -0.000951715803,
+            -3.97715739e-05, 4.85171586e-06, 3.33152434e-06, 1.71953945e-06,
+            -177.046143, 60.0429726, 0.700508475, 0.767392933,
+            -0.0129183475, -0.0356425717, -0.00213307166, -0.000677273434,
+            7.87083482e-05, 8.54126265e-05, 6.79670529e-06, 8.79035667e-07,
+            0.00206551282, -0.000602956745, 3.81820537e-05, 0.000108230844,
+            -4.84751854e-06, -7.30431384e-06,
+        },
+        /* 2450050.5 */ {
+            -12.3909903, 14.6909542, 4.86879063, -1.0022074,
+            -0.103665419, 0.0393483303, -0.00372220995, -0.00159781554,
+            0.000502739626, 1.34436395e-05, -3.48252688e-05, 6.61046124e-06,
+            -48.679882, 65.0880966, -2.24376965, -0.150748238,
+            0.277421176, -0.0146798603, -0.014634205, 0.00357626216,
+            0.000275164901, -0.000338443206, 4.30215878e-05, 1.78510818e-05,
+            0.00162662682, -0.000188505641, -0.000264272792, -1.70902276e-05,
+            3.17618942e-05, 1.15627688e-06,
+        },
+        /* 2450178.5 */ {
+            16.5811844, 4.83634806, -6.08263826, -0.272689253,
+            0.17908664, 0.0124656837, -0.00533473864, -0.00103112834,
+            0.000278470223, 7.81226408e-05, -1.35382998e-05, -6.31671764e-06,
+            77.1342926, 63.9657059, 0.616608739, -0.629215837,
+            -0.106816903, 0.0527966283, 0.00865190383, -0.0027344164,
+            -0.000732121989, 0.000147368861, 6.21882064e-05, -7.74868204e-06,
+            0.00106936693, 7.7041339e-05, 0.000118442185, -9.77550881e-05,
+            -1.44383439e-05, 6.60222531e-06,
+        },
+        /* 2450306.5 */ {
+            -6.12761402, -20.4065514, 2.06186819, 1.11587763,
+            0.0172909386, -0.0097071249, -0.00511940056, -0.00086822774,
+            9.52523551e-05, 5.06047327e-05, 1.10319233e-05, 2.02828005e-07,
+            -158.717682, 61.3820229, 1.82325697, 0.596638322,
+            -0.129063547, -0.0433444269, -0.00207438855, 0.000836984604,
+            0.00056271255, 8.565592e-05, -1.29820737e-05, -7.92317041e-06,
+            0.000538912776, -0.000524599978, 0.000189721279, 7.65520599e-05,
+            -2.29945854e-05, -5.16529326e-06,
+        },
+        /* 2450434.5 */ {
+            -8.29217243, 19.2064705, 3.03669834, -1.14961457,
+            -0.0145507576, 0.0215953663, -0.00620293664, 0.000347117049,
+            0.000286063878, -7.371838e-05, 3.70377984e-06, 3.75127911e-06,
+            -29.8359241, 63.0027847, -2.09295869, 0.390387893,
+            0.194288701, -0.0438373648, -0.00189480255, 0.0023603891,
+            -0.000660711434, -1.05771105e-05, 4.76019086e-05, -1.18471971e-05,
+            6.85356717e-05, -0.00044085845, -0.000235015614, 5.13779923e-05,
+            2.84010421e-05, -3.46574893e-06,
+        },
+        /* 2450562.5 */ {
+            16.9444065, -2.00683546, -6.19070911, 0.144677103,
+            0.185306698, -0.00808199868, -0.00623448938, 0.000614801887,
+            0.000371908594, -4.76348105e-05, -2.24264659e-05, 4.11294741e-06,
+            95.389328, 64.0273132, -0.428186655, -0.686368048,
+            0.0551345572, 0.0596791245, -0.00477693928, -0.00352932303,
+            0.000428171828, 0.000236229243, -3.83885927e-05, -1.78489081e-05,
+            -0.000487029989, 0.000104088322, -4.71043531e-05, -0.000107642169,
+            5.7491493e-06, 7.26974758e-06,
+        },
+        /* 2450690.5 */ {
+            -10.70084, -16.9075279, 3.95243406, 1.0779587,
+            -0.0414733775, -0.0300863665, -0.00632092077, 0.0003696942,
+            0.000435457128, 6.50050933e-05, -1.12277194e-05, -7.27293536e-06,
+            -140.134949, 63.5017586, 2.41218257, 0.16268234,
+            -0.24271749, -0.0351685062, 0.00687773991, 0.00346030411,
+            0.000446571386, -0.000159889722, -6.78227298e-05, -5.53917198e-06,
+            -0.00105234387, -0.000306104659, 0.000264816306, 1.40904767e-05,
+            -3.18921411e-05, -9.48526463e-07,
+        },
+        /* 2450818.5 */ {
+            -3.2537446, 21.6059475, 1.04357922, -1.1453855,
+            0.0247056019, 0.00475652004, -0.00327063701, 0.00100449286,
+            1.29113232e-05, -2.65461567e-05, 8.46962757e-06, -1.61284163e-06,
+            -11.1999598, 61.3196945, -1.21828496, 0.700758517,
+            0.0685456246, -0.0422278978, 0.00259735971, -0.000102704573,
+            -0.000332522439, 0.000106006446, -2.06611367e-06, -2.6980349e-06,
+            -0.00150742137, -0.000587313552, -0.000111232846, 9.91900743e-05,
+            1.36159724e-05, -6.69379369e-06,
+        },
+        /* 2450946.5 */ {
+            15.6506596, -8.62303162, -5.6354804, 0.52152127,
+            0.141779825, -0.022280965, -0.00176283787, 0.00146742328,
+            -2.48156721e-05, -8.44107053e-05, 1.02182448e-05, 4.34175445e-06,
+            113.612297, 63.2308807, -1.31604862, -0.422664434,
+            0.182929084, 0.0285379291, -0.0127448412, -0.000238759225,
+            0.00084505172, -8.63560781e-05, -5.11877261e-05, 1.30724557e-05,
+            -0.00198036805, 1.82542171e-05, -0.000193589731, -7.42206103e-05,
+            2.36240103e-05, 5.01312206e-06,
+        },
+        /* 2451074.5 */ {
+            -14.0937977, -11.5077906, 5.57650375, 0.850869179,
+            -0.14667882, -0.0423249342, -0.000505079399, 0.00242825598,
+            0.000369405258, -0.000106036379, -4.10681132e-05, 6.73926877e-07,
+            -121.324608, 65.6824036, 2.1571846, -0.423113883,
+            -0.274742156, 0.0112484517, 0.0192644242, 0.00219385815,
+            -0.00105201558, -0.000350360351, 2.97746283e-05, 3.56063792e-05,
+            -0.00249387836, -3.40989754e-05, 0.000233624742, -5.40289875e-05,
+            -2.79611231e-05, 3.64974653e-06,
+        },
+        /* 2451202.5 */ {
+            2.17638779, 21.7399635, -0.909844816, -1.08028972,
+            0.032482516, 0.000130872621, 0.000635756121, 0.000872258446,
+            -6.04016168e-05, -7.14846101e-06, -1.69367229e-06, -1.30266983e-06,
+            7.23064995, 60.6081161, -0.0350865163, 0.73005563,
+            -0.0461958461, -0.0356439613, 0.00108454609, -0.000494034612,
+            0.000152955632, 7.46588048e-05, -6.39256086e-06, 2.21613462e-07,
+            -0.00288759032, -0.000564794696, 5.76444982e-05, 0.000107113112,
+            -6.64616618e-06, -7.22935147e-06,
+        },
+        /* 2451330.5 */ {
+            12.8060017, -14.3657818, -4.53076124, 0.783221066,
+            0.080299966, -0.0202546045, 0.00288116536, 0.000729732681,
+            -0.000255733932, -8.96940378e-07, 1.33388385e-05, -2.8365464e-06,
+            -228.215073, 61.8701477, -1.65064144, 0.0224694014,
+            0.211929858, -0.0095819952, -0.0087180594, 0.00201974972,
+            8.03347357e-05, -0.000162329059, 2.15571199e-05, 6.32307001e-06,
+            -0.00321904034, -0.000138920223, -0.000261738867, -1.09352404e-05,
+            3.19961109e-05, 7.4010751e-07,
+        },
+        /* 2451458.5 */ {
+            -15.9860353, -4.74658728, 6.60571671, 0.398203701,
+            -0.245419919, -0.0265204497, 0.00942199305, 0.00219501019,
+            -0.000496362802, -0.000184921068, 2.44454313e-05, 1.70615622e-05,
+            -102.369896, 67.1760254, 1.08159184, -0.893985212,
+            -0.152667373, 0.0722535029, 0.015038141, -0.00431173341,
+            -0.00147596037, 0.000249332545, 0.000142025485, -1.1807695e-05,
+            -0.00359812216, 0.000191777377, 0.000109031127, -0.000100406542,
+            -1.27828098e-05, 6.77981325e-06,
+        },
+        /* 2451586.5 */ {
+            7.39204502, 19.6866951, -2.72203302, -0.987764418,
+            0.0436520837, 0.0071819257, 0.00330796558, 0.000403833721,
+            -0.000146942693, -2.64306491e-05, -3.17906711e-06, 1.00595594e-06,
+            25.5364056, 60.982666, 0.98930198, 0.508349657,
+            -0.143908843, -0.0309536364, 0.00169991655, 0.000856407918,
+            0.000390439673, 7.67122856e-06, -1.93575379e-05, -4.17252886e-06,
+            -0.00388688943, -0.000369951973, 0.000204005832, 7.1958355e-05,
+            -2.42350543e-05, -4.85690543e-06,
+        },
+        /* 2451714.5 */ {
+            8.65985966, -18.695015, -3.05406332, 0.928122282,
+            0.0383883752, -0.00837051217, 0.00378011935, -0.00027201834,
+            -0.00015713858, 2.93158973e-05, -2.27604983e-06, -1.49969856e-06,
+            -210.101242, 60.5129662, -1.27516246, 0.448543042,
+            0.157858059, -0.0282543544, -0.00190745981, 0.00116301631,
+            -0.000383388862, -1.20221084e-05, 2.19403792e-05, -4.47933326e-06,
+            -0.00404757354, -0.000289330346, -0.000223841285, 5.6755438e-05,
+            2.74979338e-05, -3.83051292e-06,
+        },
+        /* 2451842.5 */ {
+            -16.2175446, 2.60690284, 6.77870464, -0.184316635,
+            -0.267068028, 0.0113557158, 0.0119137689, -0.00104405661,
+            -0.000771548657, 9.68456879e-05, 5.39714238e-05, -1.00002917e-05,
+            -83.3485336, 67.4968567, -0.407762319, -0.979869843,
+            0.0736048743, 0.0856321007, -0.0075066206, -0.00614681561,
+            0.000783544558, 0.00048337871, -8.19496199e-05, -4.31501248e-05,
+            -0.00423161127, 0.000297827588, -5.85752205e-05, -0.000106389169,
+            7.53717995e-06, 7.18259889e-06,
+        },
+        /* 2451970.5 */ {
+            11.8309278, 15.6939859, -4.30068398, -0.835822403,
+            0.0813368782, 0.0184952244, 0.00302426168, -0.00056635472,
+            -0.000256998261, -7.01130512e-06, 1.11036225e-05, 3.0569056e-06,
+            43.8057861, 62.0882759, 1.47966599, 0.100929171,
+            -0.209083989, -0.0143096121, 0.0078090718, 0.00201260834,
+            3.77565411e-05, -0.000144520731, -2.66978132e-05, 3.71217902e-06,
+            -0.0043776664, -6.19453422e-05, 0.00026921925, 7.86401779e-06,
+            -3.20755389e-05, -5.30694024e-07,
+        },
+        /* 2452098.5 */ {
+            3.61242223, -21.2155342, -1.35626245, 1.00983441,
+            0.0275200736, 0.00122753088, 0.00160742097, -0.000759286573,
+            -5.96542304e-05, 6.6679163e-06, -3.69900908e-06, 8.90674698e-07,
+            -192.010056, 59.8045158, -0.31110549, 0.714773297,
+            0.0696989, -0.0319714174, -0.000339130173, -0.000365163083,
+            -0.000234269493, 5.86341739e-05, 4.79034861e-06, -4.18165968e-07,
+            -0.00436674571, -0.000351457769, -9.49336973e-05, 0.000101620215,
+            1.1938957e-05, -6.86032081e-06,
+        },
+        /* 2452226.5 */ {
+            -14.7695179, 9.67638779, 6.04055548, -0.713153303,
+            -0.195084706, 0.0390533321, 0.00368884043, -0.00276429369,
+            7.50394829e-05, 0.000179270501, -2.65932104e-05, -1.02077001e-05,
+            -64.3208084, 66.5656738, -1.6998347, -0.627064407,
+            0.248841032, 0.0356631055, -0.0206157044, -2.72565012e-05,
+            0.00155408739, -0.000205613178, -0.000102986065, 3.38310601e-05,
+            -0.00432999665, 0.00026393024, -0.000201603078, -6.95737981e-05,
+            2.48250035e-05, 4.69616771e-06,
+        },
+        /* 2452354.5 */ {
+            15.0520945, 10.1643629, -5.5010848, -0.574761629,
+            0.139697537, 0.0218324568, -0.00117759791, -0.00142684754,
+            -7.52691922e-05, 7.65770674e-05, 1.30375429e-05, -3.1929676e-06,
+            62.0781326, 63.307003, 1.26122034, -0.357016236,
+            -0.195860311, 0.022394063, 0.0128725553, 0.000255538063,
+            -0.000772293133, -0.000123958045, 4.05642968e-05, 1.48776371e-05,
+            -0.00430665584, 0.000259082764, 0.000227185403, -5.93913173e-05,
+            -2.70136552e-05, 4.00903446e-06,
+        },
+        /* 2452482.5 */ {
+            -1.80642271, -21.6731853, 0.481528282, 1.0767684,
+            0.0296792109, 0.000612471427, -0.00198211218, -0.00097692979,
+            -3.1519623e-05, 9.26025496e-06, 5.2286855e-06, 1.78435641e-06,
+            -173.839554, 60.1954613, 0.917083502, 0.757044554,
+            -0.0319786333, -0.0369665958, -0.00250595366, -0.000573423924,
+            0.000160838114, 9.17551079e-05, 6.82641257e-06, 2.01235281e-07,
+            -0.00414388487, -0.000275664555, 7.3221534e-05, 0.000105609019,
+            -8.42234022e-06, -7.13064901e-06,
+        },
+        /* 2452610.5 */ {
+            -11.7598972, 15.624527, 4.57224989, -1.04336262,
+            -0.0850376487, 0.0371174701, -0.00472907769, -0.00121228409,
+            0.000507038028, -1.77708444e-05, -2.82596448e-05, 7.78304275e-06,
+            -45.3559265, 64.7282333, -2.28100801, -0.0461344756,
+            0.270138055, -0.022835061, -0.0122719491, 0.00373278349,
+            -2.26275756e-06, -0.000292683631, 5.92093711e-05, 9.24639517e-06,
+            -0.00389953004, 0.000128924366, -0.000262471876, -4.77341518e-06,
+            3.21266962e-05, 3.20788644e-07,
+        },
+        /* 2452738.5 */ {
+            16.7675323, 3.64619565, -6.15216208, -0.20086281,
+            0.184174091, 0.00920062978, -0.00594113208, -0.000791514234,
+            0.000338721176, 6.21457148e-05, -1.91577237e-05, -5.27213024e-06,
+            80.3495636, 64.0434113, 0.441904455, -0.664010465,
+            -0.0804309472, 0.0570913702, 0.0066447705, -0.0032284495,
+            -0.000580591965, 0.000201598043, 5.12471415e-05, -1.3814566e-05,
+            -0.00369759905, 0.000489408849, 9.48162997e-05, -0.000102757775,
+            -1.10855462e-05, 6.93605853e-06,
+        },
+        /* 2452866.5 */ {
+            -6.99974537, -19.9456768, 2.40117002, 1.1184659,
+            0.010969528, -0.0129206395, -0.00565893576, -0.000759808463,
+            0.000146066392, 6.06837966e-05, 1.02992062e-05, -7.91097307e-07,
+            -155.467407, 61.7122459, 1.97775757, 0.538670301,
+            -0.150734231, -0.0439189486, -0.00124677457, 0.00130689889,
+            0.000624205451, 6.58740901e-05, -2.27055261e-05, -9.93578669e-06,
+            -0.00341310538, -6.71784655e-05, 0.000212943109, 6.71137095e-05,
+            -2.53958151e-05, -4.53269422e-06,
+        },
+        /* 2452994.5 */ {
+            -7.46075583, 19.7932301, 2.6911869, -1.15723705,
+            -0.00411948515, 0.0180585068, -0.00593650294, 0.00056118553,
+            0.000223242925, -6.92720714e-05, 7.34357263e-06, 2.28619683e-06,
+            -26.5416241, 62.6594849, -1.98171234, 0.464957923,
+            0.172940314, -0.0450419188, -0.000376317184, 0.00185681391,
+            -0.000661598286, 3.23777604e-05, 3.61369457e-05, -1.14950517e-05,
+            -0.00300778449, -2.81296816e-05, -0.000216783126, 6.19422572e-05,
+            2.65053859e-05, -4.18354966e-06,
+        },
+        /* 2453122.5 */ {
+            16.8377819, -3.20879626, -6.14036655, 0.217133433,
+            0.18077679, -0.0115551269, -0.00574242137, 0.000884999696,
+            0.000323106244, -6.73074028e-05, -1.77571219e-05, 5.62805235e-06,
+            98.6033173, 63.9472504, -0.61065042, -0.661373913,
+            0.0830188617, 0.056427177, -0.00702109607, -0.00314178993,
+            0.000614260847, 0.000192646607, -5.3644635e-05, -1.2769241e-05,
+            -0.00264122174, 0.000560279412, -7.47715458e-05, -0.000104794752,
+            9.30151509e-06, 7.07293566e-06,
+        },
+        /* 2453250.5 */ {
+            -11.3972349, -16.0851021, 4.26681852, 1.0542587,
+            -0.057379812, -0.0335076526, -0.0058837831, 0.00073201675,
+            0.000481270486, 4.91102255e-05, -1.9011326e-05, -8.01796341e-06,
+            -136.838074, 63.9012642, 2.4340663, 0.0649362803,
+            -0.257193506, -0.0299589876, 0.00928655174, 0.00369536201,
+            0.000268383534, -0.000224623756, -6.78575088e-05, 3.70024679e-07,
+            -0.00226747501, 0.000212827275, 0.0002678569, 1.6154587e-06,
+            -3.2153861e-05, -1.11358084e-07,
+        },
+        /* 2453378.5 */ {
+            -2.30912757, 21.7985725, 0.693263412, -1.13679981,
+            0.0273662526, 0.00296572689, -0.002564169, 0.00101343123,
+            -9.72704311e-06, -1.89248876e-05, 6.76339778e-06, -1.80225766e-06,
+            -7.94094992, 61.1169777, -1.01844072, 0.726107478,
+            0.0470584445, -0.0408918932, 0.00252752635, -0.000340411701,
+            -0.000237837274, 0.000103826962, -4.89800686e-06, -1.1913055e-06,
+            -0.00176869426, -0.000122899553, -8.312711e-05, 0.000103733895,
+            1.02223776e-05, -7.00510691e-06,
+        },
+        /* 2453506.5 */ {
+            15.2587986, -9.71789551, -5.47651339, 0.577418327,
+            0.130992264, -0.0231310036, -0.000778337941, 0.00142992695,
+            -9.48450761e-05, -7.3072275e-05, 1.409979e-05, 2.79686355e-06,
+            116.821907, 63.0189552, -1.42501605, -0.351637483,
+            0.195880681, 0.0212123469, -0.0127865421, 0.000384390325,
+            0.000757170899, -0.000130796252, -3.79150188e-05, 1.51173781e-05,
+            -0.00127717841, 0.000462501921, -0.000213610037, -6.46861008e-05,
+            2.59466578e-05, 4.36472146e-06,
+        },
+        /* 2453634.5 */ {
+            -14.5451727, -10.3972111, 5.81075478, 0.786771834,
+            -0.166679859, -0.0419000275, 0.00121805898, 0.00265258807,
+            0.000257559645, -0.000143047684, -3.72337709e-05, 4.94866936e-06,
+            -117.993401, 66.0121918, 2.02146029, -0.52332896,
+            -0.265131503, 0.0225695856, 0.020259954, 0.00126296154,
+            -0.00132173416, -0.000301369204, 6.49484573e-05, 3.74311458e-05,
+            -0.000846021227, 0.000468907005, 0.000215591368, -6.45417167e-05,
+            -2.59777935e-05, 4.35487391e-06,
+        },
+        /* 2453762.5 */ {
+            3.12895942, 21.5358944, -1.24211478, -1.06659532,
+            0.0332802236, 0.000667205197, 0.00123930129, 0.000817126303,
+            -6.92581307e-05, -9.31923387e-06, -2.95939549e-06, -1.03237028e-06,
+            10.4644117, 60.6035538, 0.169918418, 0.707987964,
+            -0.0646966249, -0.0349277295, 0.000842522597, -0.000347220368,
+            0.000218803718, 6.73618633e-05, -6.85115401e-06, -4.45029286e-07,
+            -0.00032686445, -0.000102459664, 8.44204333e-05, 0.000103788771,
+            -1.01726228e-05, -7.0090091e-06,
+        },
+        /* 2453890.5 */ {
+            12.1610832, -15.2478256, -4.29218245, 0.81639874,
+            0.0706510097, -0.0185248945, 0.00334423129, 0.0005298467,
+            -0.000253888458, 1.11473819e-05, 1.04446253e-05, -3.14118529e-06,
+            -225.013214, 61.6102486, -1.63738215, 0.104445644,
+            0.207067102, -0.0145708174, -0.00737121282, 0.00205371669,
+            -5.55107545e-05, -0.000139669995, 2.74153535e-05, 3.07442724e-06,
+            0.000226690245, 0.000247608667, -0.000266189047, 1.43218051e-06,
+            3.21544721e-05, -9.90350628e-08,
+        },
+        /* 2454018.5 */ {
+            -16.1519699, -3.46898365, 6.70379877, 0.30044058,
+            -0.256355762, -0.0207271054, 0.0107127298, 0.00175687997,
+            -0.000639280828, -0.00015371271, 3.95884963e-05, 1.50105961e-05,
+            -99.0196075, 67.325058, 0.833925784, -0.942448974,
+            -0.116667055, 0.079627201, 0.0118294694, -0.0053029065,
+            -0.00120640662, 0.000373558374, 0.000121613877, -2.79835003e-05,
+            0.00068195496, 0.000607467198, 7.68121972e-05, -0.00010474724,
+            -9.35176649e-06, 7.06928267e-06,
+        },
+        /* 2454146.5 */ {
+            8.24695873, 19.116457, -3.02178645, -0.967147827,
+            0.0481419303, 0.00918871537, 0.0035302972, 0.000270133984,
+            -0.000171316322, -2.84862945e-05, -1.67120288e-06, 1.58424552e-06,
+            28.7619858, 61.1443787, 1.12310338, 0.447196096,
+            -0.158894464, -0.0294000097, 0.00242559239, 0.00115733175,
+            0.000383739214, -1.44748728e-05, -2.34985655e-05, -4.28709654e-06,
+            0.00115612184, 3.14552308e-05, 0.000218090427, 6.2083629e-05,
+            -2.64759492e-05, -4.19360231e-06,
+        },
+        /* 2454274.5 */ {
+            7.82119894, -19.2820377, -2.76680779, 0.945344925,
+            0.0343296677, -0.00620223489, 0.00356466696, -0.000394907838,
+            -0.000132274246, 2.6700629e-05, -3.73131752e-06, -9.42345935e-07,
+            -206.906006, 60.3209343, -1.14149296, 0.509982705,
+            0.143616259, -0.0295126513, -0.00117334141, 0.000862129789,
+            -0.000389330002, 8.52871563e-06, 1.75951409e-05, -4.31188619e-06,
+            0.00169380219, 5.50187497e-06, -0.000211741062, 6.69633664e-05,
+            2.54281731e-05, -4.5227639e-06,
+        },
+        /* 2454402.5 */ {
+            -16.0839291, 3.90040898, 6.71289778, -0.286732107,
+            -0.260370404, 0.0179272406, 0.0110581489, -0.00159541634,
+            -0.00067083945, 0.000143416532, 4.26764382e-05, -1.42536455e-05,
+            -79.9908981, 67.4192047, -0.66662097, -0.946528494,
+            0.112750396, 0.0804977268, -0.0113362437, -0.00543513522,
+            0.00115598377, 0.00038993085, -0.000117399206, -3.02070875e-05,
+            0.00213402207, 0.000573155237, -9.3042865e-05, -0.000102828111,
+            1.10362471e-05, 6.93982929e-06,
+        },
+        /* 2454530.5 */ {
+            12.4989977, 14.8164377, -4.54611588, -0.798784018,
+            0.0909218118, 0.0200417619, 0.00254099467, -0.000767624762,
+            -0.000255234365, 5.5610858e-06, 1.38644991e-05, 2.67368341e-06,
+            47.0335426, 62.3178596, 1.49323261, 0.0182270184,
+            -0.213931814, -0.00908680819, 0.00912599172, 0.00196639425,
+            -0.00010162461, -0.000166365207, -2.02315914e-05, 6.99486782e-06,
+            0.00251361215, 0.000222278031, 0.000263730006, -4.60567298e-06,
+            -3.21295593e-05, 3.08819324e-07,
+        },
+        /* 2454658.5 */ {
+            2.66567707, -21.4516983, -1.03998649, 1.021891,
+            0.0277607758, 0.00201405166, 0.00104524277, -0.000809112098,
+            -5.37587002e-05, 3.61218872e-06, -2.60428669e-06, 1.12430837e-06,
+            -188.809067, 59.782814, -0.102450103, 0.739853263,
+            0.0527427904, -0.0324169435, -0.000606630638, -0.000531221624,
+            -0.000177321097, 6.40574726e-05, 4.47375351e-06, 3.40870571e-07,
+            0.00295544043, -0.000172173779, -7.25434875e-05, 0.000105548657,
+            8.47359388e-06, -7.12718202e-06,
+        },
+        /* 2454786.5 */ {
+            -14.3464403, 10.8299484, 5.82669258, -0.788080752,
+            -0.17626211, 0.0408571437, 0.00186523283, -0.00266914908,
+            0.000220103524, 0.000150504842, -3.53790201e-05, -5.89028605e-06,
+            -60.9671822, 66.2922974, -1.86319017, -0.532455623,
+            0.264441639, 0.0240327902, -0.0204213765, 0.00109306246,
+            0.00135426747, -0.000291323697, -7.01011159e-05, 3.73208131e-05,
+            0.00333306147, 0.000371073285, -0.000226011747, -5.95548336e-05,
+            2.69848533e-05, 4.01862053e-06,
+        },
+        /* 2454914.5 */ {
+            15.4701128, 9.06669807, -5.66118765, -0.515708745,
+            0.149861917, 0.0207695588, -0.00215639966, -0.00144987053,
+            -2.72186298e-06, 8.6823391e-05, 8.81591677e-06, -4.69218094e-06,
+            65.3084869, 63.489006, 1.15158582, -0.428409606,
+            -0.182454392, 0.0297740325, 0.0127524463, -0.000376775628,
+            -0.000854366692, -7.72663916e-05, 5.34789542e-05, 1.25125352e-05,
+            0.00358629203, 0.000381725724, 0.000202636802, -6.94517803e-05,
+            -2.48589331e-05, 4.68725784e-06,
+        },
+        /* 2455042.5 */ {
+            -2.75743055, -21.5265408, 0.817050397, 1.08717191,
+            0.0289183315, -0.000839239161, -0.00268157246, -0.000991270179,
+            -1.82408094e-05, 1.55550679e-05, 7.10297263e-06, 1.76104925e-06,
+            -170.611389, 60.3847885, 1.12952614, 0.738302708,
+            -0.0517523922, -0.0384212025, -0.0027743571, -0.000399285171,
+            0.00024787322, 9.72117923e-05, 5.80325741e-06, -9.03327759e-07,
+            0.00386512512, -0.000228124642, 9.50925969e-05, 0.000101669481,
+            -1.18894395e-05, -6.86482554e-06,
+        },
+        /* 2455170.5 */ {
+            -11.0837412, 16.5041523, 4.26081181, -1.07759404,
+            -0.0673724934, 0.0343206972, -0.0054822769, -0.000825391966,
+            0.000485952361, -4.25472281e-05, -2.06181376e-05, 7.97262328e-06,
+            -42.0217438, 64.3594894, -2.28932905, 0.0563980788,
+            0.258925736, -0.0297163688, -0.00981548522, 0.0036872963,
+            -0.000239488552, -0.000233593746, 6.74272887e-05, 1.45656531e-06,
+            0.00412695436, 6.58903518e-05, -0.000268897653, 7.66832545e-06,
+            3.20786203e-05, -5.19093533e-07,
+        },
+        /* 2455298.5 */ {
+            16.8999405, 2.43913579, -6.19963026, -0.127068236,
+            0.187619269, 0.00562306028, -0.00637290534, -0.000510741549,
+            0.000383057923, 4.12929257e-05, -2.34477338e-05, -3.62041533e-06,
+            83.578476, 64.0928421, 0.258366883, -0.688511848,
+            -0.0522133224, 0.0601626225, 0.00434732856, -0.00359191699,
+            -0.000387735345, 0.000242860246, 3.5131503e-05, -1.8644665e-05,
+            0.00423741341, 0.000426848215, 5.91273711e-05, -0.000106367093,
+            -7.58833585e-06, 7.18036745e-06,
+        },
+        /* 2455426.5 */ {
+            -7.84850407, -19.4111595, 2.73999047, 1.11753833,
+            0.00296380091, -0.0164073277, -0.00609528553, -0.000606475747,
+            0.000204555865, 6.91566529e-05, 8.30434237e-06, -2.04738217e-06,
+            -152.19635, 62.0653496, 2.1130569, 0.471896321,
+            -0.172239378, -0.0438230745, -8.32614242e-05, 0.00180919596,
+            0.00066074694, 3.56715973e-05, -3.38603022e-05, -1.14171826e-05,
+            0.00431210268, -0.000160571435, 0.000223514522, 5.68890937e-05,
+            -2.74701652e-05, -3.84119858e-06,
+        },
+        /* 2455554.5 */ {
+            -6.59774923, 20.3090305, 2.34031796, -1.16047442,
+            0.0046771965, 0.0146741811, -0.00552290725, 0.000727917592,
+            0.000164418991, -6.16339239e-05, 9.5401092e-06, 9.88841407e-07,
+            -23.2425156, 62.3327713, -1.84802794, 0.531314671,
+            0.150713444, -0.045381844, 0.000813658815, 0.00135457749,
+            -0.000626431953, 6.46222179e-05, 2.49122422e-05, -1.01113819e-05,
+            0.00440842379, -0.00024197415, -0.000204630705, 7.18041047e-05,
+            2.42687638e-05, -4.84790689e-06,
+        },
+        /* 2455682.5 */ {
+            16.6744308, -4.40288019, -6.06706715, 0.287870258,
+            0.174573094, -0.0147125758, -0.00507546682, 0.00111295236,
+            0.000258769753, -8.1915452e-05, -1.18328844e-05, 6.51416622e-06,
+            101.826393, 63.8373756, -0.785754383, -0.625727832,
+            0.109216005, 0.0519274436, -0.00897687674, -0.0026231946,
+            0.000758512819, 0.000136365183, -6.3616746e-05, -6.52970539e-06,
+            0.00437112665, 0.000315866579, -0.000109211898, -0.000100498262,
+            1.27351313e-05, 6.78509741e-06,
+        },
+        /* 2455810.5 */ {
+            -12.0525417, -15.1977663, 4.57080412, 1.0235548,
+            -0.0747557431, -0.0365442634, -0.00518582575, 0.00111813541,
+            0.000508288387, 2.56588701e-05, -2.68330259e-05, -8.0015916e-06,
+            -133.526077, 64.2984238, 2.42684293, -0.0371417105,
+            -0.268423766, -0.0233482774, 0.0117565272, 0.00376187474,
+            3.75481286e-05, -0.000284516864, -6.07221045e-05, 7.9689089e-06,
+            0.00423440384, -2.12600626e-05, 0.000260967558, -1.07765336e-05,
+            -3.20012441e-05, 7.27627537e-07,
+        },
+        /* 2455938.5 */ {
+            -1.35286844, 21.9132004, 0.343988121, -1.12651956,
+            0.0292105153, 0.00160644669, -0.00184918754, 0.00100365432,
+            -2.62374469e-05, -1.30341405e-05, 4.84869042e-06, -1.84477233e-06,
+            -4.68116283, 60.9484634, -0.810854912, 0.742174447,
+            0.0260514095, -0.0395516604, 0.00230802572, -0.000501702947,
+            -0.000144688122, 9.89950931e-05, -6.28674434e-06, -1.23532473e-07,
+            0.00413229596, -0.000453849585, -5.91135649e-05, 0.000107057684,
+            6.69694464e-06, -7.22665118e-06,
+        },
+        /* 2456066.5 */ {
+            14.8135462, -10.7800646, -5.29873323, 0.629089475,
+            0.119791716, -0.0234042443, 0.000172122222, 0.00133963022,
+            -0.000154088513, -5.84451882e-05, 1.64418125e-05, 1.18282435e-06,
+            -239.965347, 62.788517, -1.51353049, -0.275488317,
+            0.205259398, 0.0138876261, -0.0124192955, 0.000932259776,
+            0.000634036551, -0.000161762655, -2.30177302e-05, 1.53566816e-05,
+            0.00395108247, 6.80154408e-05, -0.000234673862, -5.42019225e-05,
+            2.7936072e-05, 3.66039694e-06,
+        },
+        /* 2456194.5 */ {
+            -14.943532, -9.24275208, 6.02248621, 0.715082049,
+            -0.186041087, -0.0404356197, 0.00304222503, 0.00277571846,
+            0.000117507298, -0.000173831344, -2.92414952e-05, 9.33058527e-06,
+            -114.655251, 66.3147888, 1.85938728, -0.617948949,
+            -0.250042468, 0.034126021, 0.0205553249, 0.000160949727,
+            -0.00153052958, -0.000219858775, 9.83020145e-05, 3.46129527e-05,
+            0.00362998736, 0.000108484019, 0.000192422216, -7.41055555e-05,
+            -2.36597407e-05, 5.00395299e-06,
+        },
+        /* 2456322.5 */ {
+            4.07056904, 21.2562046, -1.5694195, -1.05177832,
+            0.034420345, 0.00156502833, 0.00179516315, 0.000751856365,
+            -8.03332732e-05, -1.257031e-05, -3.86390593e-06, -7.06634637e-07,
+            13.6964979, 60.6340179, 0.366776735, 0.677750289,
+            -0.0826913118, -0.0342553183, 0.000720857584, -0.00014887951,
+            0.000276341452, 5.89468873e-05, -8.05954551e-06, -1.29669581e-06,
+            0.0033262067, -0.000509326113, 0.000109200417, 9.92519199e-05,
+            -1.35687342e-05, -6.69863766e-06,
+        },
+        /* 2456450.5 */ {
+            11.4729719, -16.0766983, -4.04154491, 0.845562518,
+            0.0618354231, -0.0165302586, 0.00366700161, 0.000332540541,
+            -0.000241985792, 2.02595547e-05, 7.27985071e-06, -3.1186396e-06,
+            -221.814392, 61.3527031, -1.59979105, 0.184532225,
+            0.199649841, -0.0187872741, -0.00601212261, 0.00198446587,
+            -0.00017039146, -0.000112125686, 3.01150412e-05, 2.27535736e-07,
+            0.00301394612, -0.00024101467, -0.000266668765, 1.39025888e-05,
+            3.18997227e-05, -9.36682568e-07,
+        },
+        /* 2456578.5 */ {
+            -16.2597485, -2.17745781, 6.77113628, 0.199328572,
+            -0.264300853, -0.0143151451, 0.0116721326, 0.00122487871,
+            -0.000748948893, -0.000109565568, 5.17012049e-05, 1.10873907e-05,
+            -95.6704254, 67.4326172, 0.57594955, -0.976643801,
+            -0.0778479874, 0.0849885941, 0.0080690356, -0.00605011079,
+            -0.000845010276, 0.000471137348, 8.78146384e-05, -4.14337592e-05,
+            0.00256277574, 0.000153602843, 4.56120833e-05, -0.00010762037,
+            -5.80072265e-06, 7.26753296e-06,
+        },
+        /* 2456706.5 */ {
+            9.07055283, 18.4811916, -3.31232548, -0.944019556,
+            0.0536012948, 0.0112749813, 0.00364311016, 0.000117502539,
+            -0.000196001056, -2.8642482e-05, 4.24090302e-07, 2.14753049e-06,
+            31.9829025, 61.3259315, 1.2367239, 0.380348682,
+            -0.172620222, -0.0273266137, 0.00334245176, 0.00143811957,
+            0.000354365009, -4.01883226e-05, -2.71900317e-05, -3.81864356e-06,
+            0.00209087995, -0.000407508487, 0.000232806386, 5.15293614e-05,
+            -2.83767258e-05, -3.47625996e-06,
+        },
+        /* 2456834.5 */ {
+            6.95595598, -19.802639, -2.47334671, 0.960549831,
+            0.0313098766, -0.00418189028, 0.00326089235, -0.00049843156,
+            -0.000109896195, 2.281874e-05, -4.59935518e-06, -4.29366281e-07,
+            -203.718048, 60.1534157, -0.989591062, 0.565255404,
+            0.128577664, -0.0303499941, -0.000646447064, 0.000559950946,
+            -0.000377176824, 2.49315035e-05, 1.34449419e-05, -3.73163107e-06,
+            0.00167201809, -0.000506604731, -0.00019209247, 7.64228462e-05,
+            2.30317964e-05, -5.15683178e-06,
+        },
+        /* 2456962.5 */ {
+            -15.8935375, 5.1753459, 6.61664248, -0.385879964,
+            -0.250656635, 0.0239136256, 0.00986353401, -0.00205723173,
+            -0.000535337778, 0.000177570109, 2.81026205e-05, -1.66925638e-05,
+            -76.6415405, 67.3007889, -0.914509594, -0.899075627,
+            0.14903453, 0.0733491406, -0.014622516, -0.00447573699,
+            0.00143841188, 0.000268786011, -0.0001397327, -1.42975623e-05,
+            0.00115998404, 7.82526549e-05, -0.000120144432, -9.78366661e-05,
+            1.43920051e-05, 6.60765545e-06,
+        },
+        /* 2457090.5 */ {
+            13.1213293, 13.8916531, -4.77661943, -0.757791817,
+            0.101036809, 0.0212333426, 0.00192526681, -0.000958775228,
+            -0.000241010406, 2.03130039e-05, 1.59174524e-05, 1.92225457e-06,
+            50.2521935, 62.5450134, 1.48261487, -0.0649087131,
+            -0.215819865, -0.00318892137, 0.0103430152, 0.0018043234,
+            -0.000254028564, -0.000179685914, -1.06164698e-05, 1.02485101e-05,
+            0.000587971474, -0.0002048194, 0.000262275134, -1.69120358e-05,
+            -3.1770629e-05, 1.14445982e-06,
+        },
+        /* 2457218.5 */ {
+            1.71306908, -21.6157589, -0.720873237, 1.03345883,
+            0.0282950383, 0.00243484206, 0.000448305509, -0.000852967089,
+            -4.99308917e-05, 1.81028906e-06, -1.24768587e-06, 1.32203343e-06,
+            -185.61647, 59.7986946, 0.112029567, 0.757219374,
+            0.0354782753, -0.0329961367, -0.000971665839, -0.000646347413,
+            -0.0001149077, 6.92257745e-05, 4.82412088e-06, 8.83879466e-07,
+            0.000101308346, -0.000634960015, -4.06278959e-05, 0.000108211949,
+            4.89960621e-06, -7.30253942e-06,
+        },
+        /* 2457346.5 */ {
+            -13.8739786, 11.9367895, 5.59099483, -0.855518699,
+            -0.15673171, 0.0416310951, 0.000130966044, -0.00247061555,
+            0.000338223384, 0.000114954877, -4.00598183e-05, -1.58860485e-06,
+            -57.6284714, 65.9932404, -2.00028443, -0.432555228,
+            0.274571627, 0.0126273371, -0.0195263438, 0.00204579625,
+            0.00109168387, -0.000344780914, -3.49791881e-05, 3.61068924e-05,
+            -0.000401391211, -9.76994779e-05, -0.000237837972, -4.86882418e-05,
+            2.87956591e-05, 3.28967894e-06,
+        },
+        /* 2457474.5 */ {
+            15.8352261, 7.94456816, -5.80106258, -0.453290313,
+            0.159241021, 0.0191527288, -0.00311825261, -0.00141359249,
+            7.55897927e-05, 9.21993924e-05, 3.37923575e-06, -5.87140448e-06,
+            68.5251999, 63.6500053, 1.02408695, -0.493228972,
+            -0.165697202, 0.0368543528, 0.0121958265, -0.00104499958,
+            -0.000890187628, -2.04591433e-05, 6.28257476e-05, 8.41029942e-06,
+            -0.000983414124, 9.50041613e-06, 0.000186100864, -7.85410593e-05,
+            -2.23850457e-05, 5.30499756e-06,
+        },
+        /* 2457602.5 */ {
+            -3.69330931, -21.3088074, 1.1528511, 1.09649503,
+            0.027309306, -0.00270555308, -0.00337517564, -0.000989960507,
+            1.45650256e-06, 2.35351581e-05, 8.79552226e-06, 1.60790523e-06,
+            -167.391098, 60.6087456, 1.33307469, 0.711101174,
+            -0.0720164254, -0.0399107188, -0.00288648298, -0.000154736539,
+            0.000337012636, 0.0001004472, 3.3126114e-06, -2.41806356e-06,
+            -0.00148440222, -0.000579328102, 0.000127157386, 9.64836217e-05,
+            -1.5203208e-05, -6.51086202e-06,
+        },
+        /* 2457730.5 */ {
+            -10.3710423, 17.3187237, 3.93963575, -1.10488927,
+            -0.0510930717, 0.0311290678, -0.00597666204, -0.000459055096,
+            0.000445368729, -5.99224222e-05, -1.2886373e-05, 7.37080063e-06,
+            -38.7081032, 63.9893799, -2.26944947, 0.154401585,
+            0.244479746, -0.0352127068, -0.00741581107, 0.00347208884,
+            -0.000424534781, -0.000169025807, 6.83829203e-05, -4.69919496e-06,
+            -0.00191819284, -0.000305462774, -0.000259762281, 2.00551149e-05,
+            3.16161859e-05, -1.35165294e-06,
+        },
+        /* 2457858.5 */ {
+            16.9787617, 1.23161483, -6.22496223, -0.0528334342,
+            0.189307779, 0.00188552123, -0.0066063907, -0.00020598156,
+            0.000407825399, 1.73721292e-05, -2.59059034e-05, -1.56054136e-06,
+            86.7907562, 64.1132431, 0.0710182413, -0.702177227,
+            -0.02309357, 0.0618728809, 0.00188265438, -0.0037977132,
+            -0.000168987055, 0.000266765564, 1.55834896e-05, -2.15199943e-05,
+            -0.00241714553, 0.000150174616, 3.52892821e-05, -0.000108567547,
+            -3.99508326e-06, 7.33176785e-06,
+        },
+        /* 2457986.5 */ {
+            -8.66493893, -18.8133354, 3.07420754, 1.1128118,
+            -0.00670009293, -0.0200579148, -0.00639667036, -0.00040660883,
+            0.000267877418, 7.46864025e-05, 4.90663979e-06, -3.49094398e-06,
+            -148.933624, 62.4349327, 2.2263124, 0.397552013,
+            -0.193026662, -0.0429031923, 0.00140482665, 0.00231458154,
+            0.000663657323, -5.11843973e-06, -4.54097753e-05, -1.19379074e-05,
+            -0.00286844303, -0.000358246703, 0.000244133174, 4.59551302e-05,
+            -2.91905362e-05, -3.10035193e-06,
+        },
+        /* 2458114.5 */ {
+            -5.71520615, 20.7534046, 1.98935509, -1.16014862,
+            0.0118643297, 0.0115540531, -0.00500167022, 0.000849955482,
+            0.000112625887, -5.22766932e-05, 1.04511209e-05, -5.73602037e-08,
+            -19.9664631, 62.0283127, -1.69637597, 0.588792086,
+            0.128288999, -0.0450591706, 0.00167256419, 0.000885155634,
+            -0.000565269671, 8.64527756e-05, 1.50340647e-05, -8.16394731e-06,
+            -0.00319092372, -0.000454766647, -0.000176745772, 8.07403485e-05,
+            2.17190718e-05, -5.44924251e-06,
+        },
+        /* 2458242.5 */ {
+            16.4616814, -5.57602692, -5.97441673, 0.355723679,
+            0.167029768, -0.017446246, -0.00427751709, 0.00128793216,
+            0.000184632983, -9.05563211e-05, -5.35570553e-06, 6.71005228e-06,
+            105.03196, 63.7025757, -0.94958508, -0.581026614,
+            0.133041024, 0.0464538224, -0.0105624134, -0.00201651105,
+            0.000852302823, 7.3573683e-05, -6.75932388e-05, -4.48244002e-08,
+            -0.00353096146, 0.000170087063, -0.000129156018, -9.4914416e-05,
+            1.60019172e-05, 6.40938833e-06,
+        },
+        /* 2458370.5 */ {
+            -12.6646824, -14.2621269, 4.86194515, 0.986330986,
+            -0.0932136327, -0.0390600935, -0.00423766579, 0.00150820019,
+            0.000511330029, -4.43763474e-06, -3.37817874e-05, -7.04015065e-06,
+            -130.223938, 64.6875, 2.39184594, -0.141246065,
+            -0.275988877, -0.0154743353, 0.0141524719, 0.00363410125,
+            -0.000234289764, -0.000332395197, -4.57898786e-05, 1.64969242e-05,
+            -0.00386693701, -4.85260098e-05, 0.000263568334, -2.30502446e-05,
+            -3.1436175e-05, 1.55716157e-06,
+        },
+        /* 2458498.5 */ {
+            -0.395602345, 21.9597092, -0.000735162408, -1.11534774,
+            0.0304560512, 0.000673135335, -0.00114571757, 0.00098085613,
+            -3.81700775e-05, -9.04456647e-06, 2.90601611e-06, -1.78476535e-06,
+            -1.44207799, 60.814476, -0.600242972, 0.749783218,
+            0.00572504383, -0.0383175053, 0.00199737586, -0.000589350821,
+            -5.62016503e-05, 9.29321977e-05, -6.69793235e-06, 4.93825723e-07,
+            -0.00405373005, -0.00047094078, -2.18814785e-05, 0.000108954962,
+            3.08556105e-06, -7.35480944e-06,
+        },
+        /* 2458626.5 */ {
+            14.3265514, -11.8050432, -5.10761499, 0.676500618,
+            0.108604737, -0.0231596492, 0.00105007412, 0.00120869849,
+            -0.000200233015, -4.22537814e-05, 1.72595355e-05, -3.04609983e-07,
+            -236.768936, 62.5473137, -1.58141303, -0.196454689,
+            0.211295381, 0.00684222765, -0.0117219854, 0.00138083484,
+            0.000489656639, -0.00017864343, -8.28788325e-06, 1.40770826e-05,
+            -0.00419138139, 7.81441486e-05, -0.000240812311, -4.30759683e-05,
+            2.95620302e-05, 2.90882758e-06,
+        },
+        /* 2458754.5 */ {
+            -15.2941484, -8.0607605, 6.21262598, 0.637239218,
+            -0.20433493, -0.0379809514, 0.00488706306, 0.00278631551,
+            -4.21152254e-05, -0.000195016386, -1.76020549e-05, 1.32227588e-05,
+            -111.327347, 66.5892944, 1.67571247, -0.705327988,
+            -0.230003044, 0.0454872623, 0.020112494, -0.00104651076,
+            -0.00165725558, -0.000111435525, 0.000125594612, 2.6996413e-05,
+            -0.00435685413, 0.000244246563, 0.00017789031, -8.27779004e-05,
+            -2.10368271e-05, 5.58829106e-06,
+        },
+        /* 2458882.5 */ {
+            4.99635029, 20.9169006, -1.89054763, -1.03636575,
+            0.0360345691, 0.00276789675, 0.00229702122, 0.000676429714,
+            -9.43086052e-05, -1.64715839e-05, -4.3568848e-06, -3.23472648e-07,
+            16.9138889, 60.6956215, 0.553335249, 0.640700221,
+            -0.100157149, -0.0335874595, 0.000746232283, 8.98277867e-05,
+            0.000324564899, 4.88791447e-05, -1.01245951e-05, -2.22789413e-06,
+            -0.00439830916, -0.000326651701, 0.000142748613, 9.33470365e-05,
+            -1.67890048e-05, -6.30190198e-06,
+        },
+        /* 2459010.5 */ {
+            10.7534571, -16.8578854, -3.78359103, 0.87160641,
+            0.0539981984, -0.0143834613, 0.00386025175, 0.000146039994,
+            -0.000223241135, 2.63630609e-05, 4.18263926e-06, -2.85159354e-06,
+            -218.628326, 61.1038933, -1.54103065, 0.26165989,
+            0.190343365, -0.0222629607, -0.00471742451, 0.0018345454,
+            -0.000261265755, -8.29600831e-05, 3.01759646e-05, -1.99458418e-06,
+            -0.00432827277, -6.62892198e-05, -0.000254590501, 2.60924735e-05,
+            3.12306656e-05, -1.76177628e-06,
+        },
+        /* 2459138.5 */ {
+            -16.3195095, -0.881680012, 6.81210709, 0.0963923186,
+            -0.269321591, -0.0075178952, 0.0122731859, 0.000631268776,
+            -0.000818319619, -5.64985603e-05, 5.95162783e-05, 5.79917878e-06,
+            -92.3294449, 67.5029907, 0.31238234, -0.99715513,
+            -0.0373637825, 0.0882552341, 0.00395671977, -0.00651332363,
+            -0.000421858364, 0.000532927341, 4.45608457e-05, -5.02264775e-05,
+            -0.00429060031, 0.000425936829, 2.17002053e-05, -0.000109205808,
+            -2.17555294e-06, 7.37154096e-06,
+        },
+        /* 2459266.5 */ {
+            9.86533356, 17.7970257, -3.59469628, -0.918825567,
+            0.0599959791, 0.0133777196, 0.00364535046, -5.20121685e-05,
+            -0.000219392736, -2.65179297e-05, 3.01224873e-06, 2.64224923e-06,
+            35.1958504, 61.5234604, 1.33121705, 0.309131056,
+            -0.185048223, -0.0247016046, 0.00442202529, 0.00168324809,
+            0.000301561173, -6.85566192e-05, -2.98567211e-05, -2.68605936e-06,
+            -0.00418729754, -5.53762293e-05, 0.000251018035, 4.01915458e-05,
+            -2.99101866e-05, -2.71410363e-06,
+        },
+        /* 2459394.5 */ {
+            6.07193661, -20.2694263, -2.1759181, 0.974804461,
+            0.0292048343, -0.0023562361, 0.00288938358, -0.000585876231,
+            -9.10246672e-05, 1.83060074e-05, -4.94577625e-06, 1.83235933e-08,
+            -200.536148, 60.0126572, -0.823288143, 0.61475414,
+            0.113097668, -0.0309304837, -0.00031749648, 0.000270836608,
+            -0.000351547846, 3.76395583e-05, 9.90305944e-06, -2.90710432e-06,
+            -0.00393805699, -0.0001799561, -0.000164896177, 8.47641932e-05,
+            2.03367417e-05, -5.7236266e-06,
+        },
+        /* 2459522.5 */ {
+            -15.6572981, 6.43187094, 6.49574471, -0.481291771,
+            -0.238469854, 0.0292018894, 0.00840857159, -0.00241391594,
+            -0.000377143733, 0.000197646121, 1.19962224e-05, -1.71903412e-05,
+            -73.2967911, 67.1482086, -1.1497066, -0.839734674,
+            0.181958541, 0.064619489, -0.0172715317, -0.0033474979,
+            0.00161807507, 0.000133390437, -0.000147726489, 2.18440323e-06,
+            -0.00369571196, 0.000448865467, -0.00014216562, -9.17071156e-05,
+            1.75606892e-05, 6.18955892e-06,
+        },
+        /* 2459650.5 */ {
+            13.7060528, 12.930295, -4.99513197, -0.713332474,
+            0.111565255, 0.0220453478, 0.00119485462, -0.00113246951,
+            -0.000213797321, 3.64021253e-05, 1.69882678e-05, 8.25229847e-07,
+            53.4688301, 62.7692032, 1.45078051, -0.147652164,
+            -0.214862451, 0.00328246481, 0.011405725, 0.00152814807,
+            -0.000411355868, -0.000182476637, 1.68410202e-06, 1.30657527e-05,
+            -0.0034557227, 0.000259060122, 0.000259339751, -2.91334563e-05,
+            -3.1000076e-05, 1.96539736e-06,
+        },
+        /* 2459778.5 */ {
+            0.756113112, -21.7218304, -0.398411065, 1.04523575,
+            0.028926108, 0.00249366858, -0.000178293267, -0.000893340388,
+            -4.69386359e-05, 1.4605755e-06, 3.19659222e-07, 1.49518769e-06,
+            -182.420593, 59.850666, 0.330120116, 0.767739356,
+            0.0178414993, -0.0337822922, -0.00139495055, -0.000709163432,
+            -4.74034423e-05, 7.47843078e-05, 5.56906616e-06, 1.16441379e-06,
+            -0.00307768374, -0.00019230484, -7.88986199e-06, 0.000109334971,
+            1.26245391e-06, -7.38307881e-06,
+        },
+        /* 2459906.5 */ {
+            -13.359889, 13.0054636, 5.33788776, -0.916283965,
+            -0.136952236, 0.0414946601, -0.00146427099, -0.00219294429,
+            0.000426440994, 7.64389188e-05, -4.08856868e-05, 2.21414484e-06,
+            -54.2908707, 65.6740952, -2.11258459, -0.32918483,
+            0.279781163, 0.00174693565, -0.0180719458, 0.00280292565,
+            0.000793707615, -0.000366705004, -1.51333882e-06, 3.12045704e-05,
+            -0.0026625935, 0.000327818736, -0.000247916469, -3.73244184e-05,
+            3.02329317e-05, 2.51777033e-06,
+        },
+        /* 2460034.5 */ {
+            16.1571522, 6.80008078, -5.9244976, -0.387839139,
+            0.167797551, 0.017030891, -0.00403540302, -0.00131911493,
+            0.000155724672, 9.20959428e-05, -2.86862837e-06, -6.5775348e-06,
+            71.7452774, 63.7926598, 0.881420434, -0.551505923,
+            -0.145958379, 0.0434968695, 0.011218084, -0.00171800994,
+            -0.00087628176, 4.25996986e-05, 6.75072733e-05, 2.91340575e-06,
+            -0.00230208435, 0.000513018516, 0.000164199781, -8.67454874e-05,
+            -1.96202691e-05, 5.85429962e-06,
+        },
+        /* 2460162.5 */ {
+            -4.61824179, -21.0299149, 1.49127734, 1.10490954,
+            0.0246797316, -0.0049699205, -0.00405670051, -0.000968946551,
+            2.88221981e-05, 3.29390423e-05, 1.01582518e-05, 1.28229101e-06,
+            -164.158447, 60.8646736, 1.52736163, 0.67594111,
+            -0.0929021314, -0.0413658097, -0.00280292612, 0.000158893148,
+            0.000426253333, 0.000100069534, -9.82828624e-07, -4.29609918e-06,
+            -0.00185323867, -7.70223778e-05, 0.000153065528, 8.99181541e-05,
+            -1.83195643e-05, -6.07264474e-06,
+        },
+        /* 2460290.5 */ {
+            -9.62407589, 18.0801048, 3.60998273, -1.12656939,
+            -0.0362354368, 0.027683042, -0.00623935787, -0.00012380752,
+            0.000391744106, -7.03105179e-05, -5.73920897e-06, 6.23651295e-06,
+            -35.3927155, 63.6208916, -2.22391701, 0.247632742,
+            0.227511659, -0.0394505858, -0.00516217109, 0.00312942499,
+            -0.000556609419, -0.000104982326, 6.37189587e-05, -8.95751782e-06,
+            -0.00132590276, 0.000131024601, -0.000253259088, 3.20636791e-05,
+            3.07437695e-05, -2.16684407e-06,
+        },
+        /* 2460418.5 */ {
+            17.010973, 0.0179734286, -6.23115158, 0.0219253115,
+            0.189347833, -0.00193666003, -0.0066427011, 0.000110363384,
+            0.000412232417, -7.97623397e-06, -2.6353202e-05, 6.88009493e-07,
+            90.0112686, 64.1078644, -0.119039997, -0.705653548,
+            0.00656517595, 0.0622503534, -0.000666975975, -0.00384090398,
+            6.22383814e-05, 0.000271834491, -5.59023556e-06, -2.21260379e-05,
+            -0.000872514327, 0.000621784246, 3.58934244e-06, -0.000109472814,
+            -3.48288097e-07, 7.38832205e-06,
+        },
+        /* 2460546.5 */ {
+            -9.45574379, -18.154562, 3.40654516, 1.10396194,
+            -0.0181154795, -0.0238144826, -0.00654061325, -0.000157775736,
+            0.000333373522, 7.6056378e-05, 3.24698703e-08, -5.0208464e-06,
+            -145.652893, 62.8192177, 2.31787157, 0.315829068,
+            -0.212941006, -0.0410150215, 0.00321156066, 0.0027989056,
+            0.000625490968, -5.62417408e-05, -5.61937704e-05, -1.10934034e-05,
+            -0.000406786305, 0.00013460264, 0.000252916536, 3.43218708e-05,
+            -3.05324538e-05, -2.31945046e-06,
+        },
+        /* 2460674.5 */ {
+            -4.81017303, 21.1352577, 1.63650727, -1.15718579,
+            0.0176586136, 0.00873078126, -0.00439955387, 0.00093448296,
+            6.86302228e-05, -4.23096972e-05, 1.03341627e-05, -8.4376228e-07,
+            -16.6853065, 61.7470551, -1.52828562, 0.638048053,
+            0.105810478, -0.0442751683, 0.00223473832, 0.000463162607,
+            -0.000486509933, 9.95484661e-05, 6.96244479e-06, -6.01851752e-06,
+            0.000154753405, -4.98526897e-05, -0.0001563798, 8.85438567e-05,
+            1.88877893e-05, -5.97989902e-06,
+        },
+        /* 2460802.5 */ {
+            16.2009888, -6.73733425, -5.86325264, 0.421150893,
+            0.158301681, -0.0197351743, -0.00337662827, 0.00140708929,
+            0.000104963779, -9.31383402e-05, 1.12185728e-06, 6.25448229e-06,
+            108.249451, 63.5444794, -1.10215187, -0.527877748,
+            0.154417381, 0.0401688442, -0.0117557785, -0.00135336956,
+            0.000893815886, 9.14499378e-06, -6.56978009e-05, 5.9689728e-06,
+            0.000658277189, 0.000551342499, -0.000158241819, -8.81749002e-05,
+            1.90637074e-05, 5.95044685e-06,
+        },
+        /* 2460930.5 */ {
+            -13.2386608, -13.2731314, 5.14180088, 0.941970885,
+            -0.112650946, -0.0409505367, -0.00303893443, 0.00188619434,
+            0.000485860655, -4.00838253e-05, -3.89784364e-05, -5.01613977e-06,
+            -126.902122, 65.0674973, 2.32921004, -0.246909261,
+            -0.279504389, -0.00636249036, 0.0163670313, 0.00328985951,
+            -0.000535672298, -0.000361676794, -2.2957478e-05, 2.50178709e-05,
+            0.00109674316, 0.000364265579, 0.000251126301, -3.50913651e-05,
+            -3.04634668e-05, 2.36675601e-06,
+        },
+        /* 2461058.5 */ {
+            0.56809932, 21.9395294, -0.344134897, -1.10345721,
+            0.0313342772, 0.00015375526, -0.000456052978, 0.000947891269,
+            -4.73115542e-05, -6.92277899e-06, 1.0303595e-06, -1.651292e-06,
+            1.80689454, 60.7153625, -0.387008071, 0.749198735,
+            -0.0141605176, -0.0372255482, 0.00164330937, -0.000607458467,
+            2.73855912e-05, 8.63622918e-05, -6.59681427e-06, 6.92368758e-07,
+            0.0016113217, -0.000138249772, 3.36991093e-06, 0.00010939638,
+            -5.65958715e-07, -7.38759127e-06,
+        },
+        /* 2461186.5 */ {
+            13.7936296, -12.7995644, -4.90161705, 0.720165491,
+            0.0975119099, -0.0224337243, 0.00184074778, 0.00104500481,
+            -0.00023277523, -2.56724379e-05, 1.66917871e-05, -1.54927966e-06,
+            -233.558685, 62.295433, -1.62845457, -0.114780307,
+            0.214133516, 0.000164467667, -0.0107481098, 0.00172127737,
+            0.000333650038, -0.000182117568, 5.11439976e-06, 1.16436122e-05,
+            0.00210660929, 0.000330758863, -0.000256582833, -3.14189929e-05,
+            3.08072995e-05, 2.11909696e-06,
+        },
+        /* 2461314.5 */ {
+            -15.5971203, -6.84249592, 6.38046503, 0.552757621,
+            -0.221254021, -0.0345096402, 0.00669379951, 0.00267274911,
+            -0.000213604071, -0.000203716103, -3.00509419e-06, 1.60597483e-05,
+            -107.980408, 66.8339615, 1.47053766, -0.784455419,
+            -0.204932719, 0.0563487336, 0.0188765656, -0.00230465899,
+            -0.00168397988, 1.75544646e-05, 0.000143065103, 1.48992312e-05,
+            0.00248300936, 0.000517229433, 0.000148029983, -9.03995533e-05,
+            -1.8140232e-05, 6.10086272e-06,
+        },
+        /* 2461442.5 */ {
+            5.91019392, 20.5112514, -2.20806646, -1.01981878,
+            0.0383122787, 0.00425910344, 0.00273907604, 0.000587313552,
+            -0.000111713569, -2.06054992e-05, -4.36995879e-06, 1.27712056e-07,
+            20.145668, 60.7884636, 0.728776455, 0.596396863,
+            -0.117195636, -0.0328138471, 0.000947589229, 0.000362977618,
+            0.000361702085, 3.61934399e-05, -1.30758945e-05, -3.13150076e-06,
+            0.00288058678, -0.00010401279, 0.000161353702, 8.62339657e-05,
+            -1.97922873e-05, -5.82361236e-06,
+        },
+        /* 2461570.5 */ {
+            9.99530983, -17.5911636, -3.51531458, 0.894813657,
+            0.0471198522, -0.0121271256, 0.00392843131, -2.68453641e-05,
+            -0.00019971421, 2.9587145e-05, 1.34977859e-06, -2.40957934e-06,
+            -215.427795, 60.864254, -1.46015942, 0.335698754,
+            0.179238036, -0.0250471998, -0.00352324545, 0.00161786389,
+            -0.000327476999, -5.40836445e-05, 2.81292323e-05, -3.51340464e-06,
+            0.00329879089, 4.03897029e-05, -0.000252239755, 3.7966176e-05,
+            3.01587497e-05, -2.56459566e-06,
+        },
+        /* 2461698.5 */ {
+            -16.3256874, 0.42499429, 6.82374525, -0.00829668436,
+            -0.271152347, -0.000468847866, 0.0124772014, 1.01214277e-06,
+            -0.00084114488, 1.68517181e-06, 6.20714854e-05, -2.64593439e-07,
+            -88.9713898, 67.5328903, 0.0444417521, -1.00292838,
+            0.00424221531, 0.0892213807, -0.000364536478, -0.00665363437,
+            3.6208763e-05, 0.000551809731, -3.97244276e-06, -5.29608114e-05,
+            0.00358368387, 0.000520748959, -1.52479879e-05, -0.000109352914,
+            1.4801916e-06, 7.38074914e-06,
+        },
+        /* 2461826.5 */ {
+            10.6303396, 17.0524788, -3.86908412, -0.890542209,
+            0.0674044117, 0.0154361576, 0.00351981469, -0.00023805628,
+            -0.000239207802, -2.16012777e-05, 5.98864699e-06, 2.99583417e-06,
+            38.4246483, 61.7354622, 1.40445805, 0.233259663,
+            -0.19583717, -0.0213871859, 0.00564215751, 0.00187302462,
+            0.00022258544, -9.83784412e-05, -3.0766776e-05, -8.1129906e-07,
+            0.00381616014, 2.51980455e-05, 0.000253700389, 2.83754434e-05,
+            -3.10573741e-05, -1.91695631e-06,
+        },
+        /* 2461954.5 */ {
+            5.16308117, -20.6738033, -1.87149644, 0.988016784,
+            0.0279125702, -0.000759954099, 0.00245231506, -0.000659512822,
+            -7.58965325e-05, 1.35936425e-05, -4.81229927e-06, 3.98116299e-07,
+            -197.339157, 59.9006767, -0.641847908, 0.657963812,
+            0.0970586911, -0.0313354991, -0.000179261537, 3.36733683e-06,
+            -0.000314340868, 4.72571337e-05, 7.17415833e-06, -1.95599728e-06,
+            0.004089172, -0.000219319511, -0.000147252955, 9.20731036e-05,
+            1.73789776e-05, -6.2167228e-06,
+        },
+        /* 2462082.5 */ {
+            -15.3660154, 7.66946793, 6.34635353, -0.572313011,
+            -0.223850757, 0.0336485505, 0.00674095144, -0.00264885928,
+            -0.000206295284, 0.000202449693, -4.0579107e-06, -1.57801496e-05,
+            -69.9387589, 66.9582596, -1.36919212, -0.768355191,
+            0.210802913, 0.0545070507, -0.0191748533, -0.00211237441,
+            0.00168409408, -4.22601397e-06, -0.000141035605, 1.70943895e-05,
+            0.00425496418, 0.00035482875, -0.000173290508, -8.4324347e-05,
+            2.05053166e-05, 5.69161784e-06,
+        },
+        /* 2462210.5 */ {
+            14.2463427, 11.9219732, -5.19880962, -0.664429784,
+            0.122331701, 0.0223835912, 0.000356049946, -0.00127734093,
+            -0.000172191052, 5.27799275e-05, 1.67373346e-05, -5.74658998e-07,
+            56.6990051, 62.9860039, 1.39547515, -0.229139,
+            -0.210518107, 0.0102673573, 0.0122265983, 0.00113192468,
+            -0.000563749752, -0.000172034939, 1.60179879e-05, 1.49465122e-05,
+            0.00430151448, 0.000176880319, 0.000243037561, -4.09027416e-05,
+            -2.98295763e-05, 2.76097558e-06,
+        },
+        /* 2462338.5 */ {
+            -0.206199959, -21.7553139, -0.0710693374, 1.05662942,
+            0.0294519067, 0.00215060357, -0.00083464256, -0.000928933441,
+            -4.32867346e-05, 2.80526388e-06, 2.06736695e-06, 1.63899369e-06,
+            -179.208847, 59.94104, 0.550678015, 0.77028048,
+            -0.000355930708, -0.0347706564, -0.00183823355, -0.000712159555,
+            2.59030112e-05, 8.08137265e-05, 6.37876246e-06, 1.12158784e-06,
+            0.00437689293, -0.000366075197, 1.59609717e-05, 0.000109140674,
+            -2.39151427e-06, -7.3682977e-06,
+        },
+        /* 2462466.5 */ {
+            -12.7953806, 14.0266447, 5.0645299, -0.969611406,
+            -0.117195353, 0.0404603481, -0.00286882068, -0.00185295474,
+            0.000481876079, 3.81482751e-05, -3.82015533e-05, 5.15935926e-06,
+            -50.9462814, 65.33461, -2.19651341, -0.223448575,
+            0.279856771, -0.00832661893, -0.0161433183, 0.00333521911,
+            0.000483097159, -0.000358333928, 2.71518948e-05, 2.3718274e-05,
+            0.00439818949, 6.27092959e-05, -0.000262669229, -2.53780017e-05,
+            3.12822231e-05, 1.71304407e-06,
+        },
+        /* 2462594.5 */ {
+            16.4249325, 5.62950182, -6.02654076, -0.319124877,
+            0.175151065, 0.0143951606, -0.00486403657, -0.00116299,
+            0.00023266011, 8.56762199e-05, -9.41772487e-06, -6.64731351e-06,
+            74.9740295, 63.9103432, 0.723452568, -0.601405263,
+            -0.123180166, 0.0494146645, 0.00979844853, -0.00235588336,
+            -0.000806703814, 0.000107135595, 6.63129176e-05, -3.46800834e-06,
+            0.00426475657, 0.000265534589, 0.000133551919, -9.37296063e-05,
+            -1.6602502e-05, 6.3283901e-06,
+        },
+        /* 2462722.5 */ {
+            -5.52660275, -20.674736, 1.83103597, 1.11123037,
+            0.0207726136, -0.00763172144, -0.00470298156, -0.000919707469,
+            6.49812937e-05, 4.32575143e-05, 1.09380517e-05, 7.29053397e-07,
+            -160.911255, 61.1519928, 1.70863008, 0.631685555,
+            -0.11424619, -0.0426038243, -0.00246666092, 0.000540414941,
+            0.000510251848, 9.38809753e-05, -7.36756056e-06, -6.41625866e-06,
+            0.00411991728, -0.000365963206, 0.000171692431, 8.23068331e-05,
+            -2.12002706e-05, -5.55603947e-06,
+        },
+        /* 2462850.5 */ {
+            -8.83877563, 18.7728577, 3.27113223, -1.14218199,
+            -0.0229815543, 0.0240881294, -0.00627520727, 0.000169908948,
+            0.00033004579, -7.40919568e-05, 3.0384345e-07, 4.7943945e-06,
+            -32.0781326, 63.2577858, -2.15108442, 0.334481627,
+            0.208278731, -0.0424185544, -0.00313715823, 0.00269106077,
+            -0.000634307566, -4.62128628e-05, 5.49464967e-05, -1.12452062e-05,
+            0.00397889083, -0.000263503112, -0.000247443269, 4.37787385e-05,
+            2.9476023e-05, -2.95454947e-06,
+        },
+        /* 2462978.5 */ {
+            16.985199, -1.19613779, -6.21332932, 0.0964428782,
+            0.187489003, -0.00572357373, -0.00646263734, 0.000422107638,
+            0.000394538976, -3.27428243e-05, -2.46259533e-05, 2.86044383e-06,
+            93.2343674, 64.0708237, -0.308793962, -0.697584391,
+            0.0360990763, 0.061147742, -0.00319048879, -0.00370670506,
+            0.000289440155, 0.000256462983, -2.62122139e-05, -2.02651863e-05,
+            0.00369306258, 0.000230179707, -3.06846996e-05, -0.000108851389,
+            3.30327885e-06, 7.35015647e-06,
+        },
+        /* 2463106.5 */ {
+            -10.2102346, -17.4257126, 3.73240376, 1.08958077,
+            -0.0313058197, -0.0275424551, -0.00648249313, 0.000139432916,
+            0.000395885028, 7.16918294e-05, -6.23920914e-06, -6.44622423e-06,
+            -142.363083, 63.212883, 2.38320732, 0.227038369,
+            -0.231157124, -0.0379347354, 0.00530113373, 0.00321995071,
+            0.000536948384, -0.000115728166, -6.43888852e-05, -8.45737213e-06,
+            0.00334375864, -0.000243915812, 0.000257373817, 2.23684547e-05,
+            -3.14814861e-05, -1.50877156e-06,
+        },
+        /* 2463234.5 */ {
+            -3.88581252, 21.4386139, 1.28318536, -1.15134966,
+            0.0221137386, 0.0062757032, -0.00373726594, 0.000984660699,
+            3.31065021e-05, -3.26496374e-05, 9.40249811e-06, -1.37290726e-06,
+            -13.4113922, 61.4940872, -1.34542835, 0.677827895,
+            0.0835117027, -0.0431396067, 0.0025188562, 0.000105001971,
+            -0.000396551739, 0.000105221385, 9.65575509e-07, -3.95852749e-06,
+            0.0030388392, -0.000516704575, -0.000133618931, 9.53311901e-05,
+            1.58133298e-05, -6.43374369e-06,
+        },
+        /* 2463362.5 */ {
+            15.8847971, -7.87320518, -5.73100328, 0.482938409,
+            0.14850314, -0.0214759819, -0.00240907003, 0.00146338297,
+            2.50964804e-05, -8.95889825e-05, 6.96773623e-06, 5.23111248e-06,
+            111.462944, 63.3613434, -1.23885453, -0.466641545,
+            0.172629923, 0.0332649089, -0.0124953296, -0.000673918345,
+            0.000880442793, -5.11858452e-05, -5.83307592e-05, 1.07791884e-05,
+            0.00264234305, 6.20238498e-05, -0.000183450669, -8.01818242e-05,
+            2.18804416e-05, 5.41526879e-06,
+        },
+        /* 2463490.5 */ {
+            -13.7626209, -12.2321482, 5.40383434, 0.889900863,
+            -0.132571787, -0.0420305058, -0.00160932937, 0.00222429167,
+            0.000427742518, -7.88045872e-05, -4.13415364e-05, -1.94536915e-06,
+            -123.579475, 65.4302597, 2.23725653, -0.351713955,
+            -0.27815786, 0.00379044213, 0.0182218291, 0.00271344371,
+            -0.0008446211, -0.000364683947, 6.64166646e-06, 3.21177467e-05,
+            0.00214193179, -7.06249848e-05, 0.000238734443, -4.65616104e-05,
+            -2.90992757e-05, 3.14556132e-06,
+        },
+        /* 2463618.5 */ {
+            1.52862394, 21.8419857, -0.683080614, -1.09051025,
+            0.0320240147, 5.68755859e-05, 0.000205591015, 0.000905491004,
+            -5.51222874e-05, -6.61102786e-06, -6.71182136e-07, -1.45924287e-06,
+            5.04526997, 60.6530266, -0.175364584, 0.739839256,
+            -0.0334567875, -0.0362718515, 0.00129560812, -0.000557586609,
+            0.00010455164, 7.95332817e-05, -6.40454118e-06, 5.08370647e-07,
+            0.00169594923, -0.000614940946, 3.32484124e-05, 0.000108545275,
+            -4.21024833e-06, -7.32517356e-06,
+        },
+        /* 2463746.5 */ {
+            13.2141123, -13.7471237, -4.68133068, 0.759254217,
+            0.0868114233, -0.0212544929, 0.00251231994, 0.00085874513,
+            -0.000250885438, -1.00792549e-05, 1.49473444e-05, -2.44718285e-06,
+            -230.358612, 62.0364571, -1.65161252, -0.0321823768,
+            0.213683173, -0.00592634501, -0.00956378132, 0.00193969358,
+            0.000177968192, -0.000173317283, 1.60106665e-05, 8.51442928e-06,
+            0.00123717624, -0.00018922372, -0.000263034482, -1.92508069e-05,
+            3.16562e-05, 1.30218791e-06,
+        },
+        /* 2463874.5 */ {
+            -15.8437767, -5.59977341, 6.52061653, 0.462725878,
+            -0.236114353, -0.0300749727, 0.00836164877, 0.00242986809,
+            -0.000383905979, -0.000197536225, 1.31357274e-05, 1.72700675e-05,
+            -104.640518, 67.04216, 1.2469734, -0.852560461,
+            -0.175246119, 0.0661540627, 0.0168402605, -0.00352319679,
+            -0.00159720692, 0.000155192451, 0.000147193874, -3.75626371e-07,
+            0.000666115666, 6.8474561e-05, 0.000123560036, -9.67539236e-05,
+            -1.50116293e-05, 6.53463121e-06,
+        },
+        /* 2464002.5 */ {
+            6.79982948, 20.0378704, -2.51769471, -1.00169933,
+            0.0413509272, 0.00598163623, 0.00310341152, 0.000482597301,
+            -0.000132201007, -2.43837821e-05, -3.83243605e-06, 6.40038422e-07,
+            23.3651867, 60.9090462, 0.888698578, 0.545255184,
+            -0.133463502, -0.0318174548, 0.00134254782, 0.000656702556,
+            0.000384253945, 2.02474184e-05, -1.67284488e-05, -3.85523708e-06,
+            0.000129573309, -0.000532017031, 0.000186349207, 7.8107194e-05,
+            -2.25405929e-05, -5.27021848e-06,
+        },
+        /* 2464130.5 */ {
+            9.20526314, -18.2634659, -3.23968601, 0.915035546,
+            0.0413521007, -0.00985245313, 0.00387624302, -0.000180704694,
+            -0.000173953304, 3.01562486e-05, -1.01520084e-06, -1.87177307e-06,
+            -212.24147, 60.6401367, -1.35779476, 0.404986084,
+            0.166684374, -0.0271487422, -0.00248577562, 0.00135409541,
+            -0.000368391484, -2.76179599e-05, 2.46433337e-05, -4.305944e-06,
+            -0.000342113141, -0.000433240464, -0.000237091255, 4.94335363e-05,
+            2.86984268e-05, -3.33449407e-06,
+        },
+        /* 2464258.5 */ {
+            -16.275938, 1.72502661, 6.80473852, -0.11256133,
+            -0.269670844, 0.00654606801, 0.0122675383, -0.000624937064,
+            -0.000814916508, 5.93304576e-05, 5.89987321e-05, -6.25138046e-06,
+            -85.6262741, 67.5209656, -0.221910343, -0.993507981,
+            0.0455511324, 0.0878016502, -0.00464665098, -0.00645600026,
+            0.000488772173, 0.000525158481, -5.17683038e-05, -4.91343089e-05,
+            -0.000893722812, 0.000109407323, -4.14739443e-05, -0.000108017113,
+            5.11464032e-06, 7.29499698e-06,
+        },
+        /* 2464386.5 */ {
+            11.3556242, 16.2561703, -4.13124895, -0.859092712,
+            0.0756640509, 0.0173471626, 0.00326027698, -0.000434018264,
+            -0.000252653525, -1.37333627e-05, 9.10163908e-06, 3.12430961e-06,
+            41.6392975, 61.9551811, 1.4547019, 0.154384956,
+            -0.204517379, -0.0173690021, 0.00693966169, 0.00198558415,
+            0.000118711592, -0.00012716146, -2.92433524e-05, 1.73742933e-06,
+            -0.00144712615, -0.000306489062, 0.000264456437, 1.62608449e-05,
+            -3.18044586e-05, -1.09526491e-06,
+        },
+        /* 2464514.5 */ {
+            4.240973, -21.0109978, -1.56396997, 1.00037134,
+            0.027348455, 0.000549106684, 0.00196390017, -0.000721248449,
+            -6.47356283e-05, 9.19962622e-06, -4.26568067e-06, 7.10099869e-07,
+            -194.156555, 59.8218155, -0.449023187, 0.694138765,
+            0.0807363465, -0.0316667221, -0.000216798639, -0.000230216028,
+            -0.00026849733, 5.44764007e-05, 5.40152041e-06, -1.00654506e-06,
+            -0.00188468676, -0.000574183592, -0.000115692739, 9.82435013e-05,
+            1.41971341e-05, -6.62978164e-06,
+        },
+        /* 2464642.5 */ {
+            -15.0245581, 8.87218285, 6.17190886, -0.657305956,
+            -0.207371742, 0.037123099, 0.00495810574, -0.00275551062,
+            -3.69346162e-05, 0.000192804539, -1.82866261e-05, -1.28401543e-05,
+            -66.5978317, 66.7356033, -1.56851864, -0.687260211,
+            0.234800041, 0.0435325876, -0.0202743895, -0.000864749425,
+            0.00163926138, -0.000129880747, -0.000121730242, 2.84547968e-05,
+            -0.00233627763, 3.63132094e-05, -0.000189617698, -7.58205206e-05,
+            2.31834329e-05, 5.12077122e-06,
+        },
+        /* 2464770.5 */ {
+            14.7384691, 10.882103, -5.38533306, -0.611847281,
+            0.132983625, 0.0222120825, -0.000555118953, -0.00138235302,
+            -0.000117541793, 6.79110526e-05, 1.50017122e-05, -2.14158831e-06,
+            59.9131889, 63.1901665, 1.31901872, -0.307315618,
+            -0.202800319, 0.0175179243, 0.0127328895, 0.000632691605,
+            -0.00069809769, -0.000147604223, 3.09871903e-05, 1.54437294e-05,
+            -0.00282193744, -2.55599098e-05, 0.000236513239, -5.21169568e-05,
+            -2.82752299e-05, 3.52047232e-06,
+        },
+        /* 2464898.5 */ {
+            -1.16217923, -21.7213745, 0.257465482, 1.06774354,
+            0.0296889618, 0.00140293688, -0.0015086066, -0.000958762248,
+            -3.75035343e-05, 5.94817402e-06, 3.92002403e-06, 1.74196771e-06,
+            -176.008331, 60.0688744, 0.76915288, 0.765009344,
+            -0.0189725533, -0.0359595716, -0.00225413847, -0.000652339659,
+            0.000104171238, 8.71489829e-05, 6.86643762e-06, 7.13622001e-07,
+            -0.00318215787, -0.000548978511, 5.26825243e-05, 0.000107544882,
+            -6.01458441e-06, -7.25837162e-06,
+        },
+        /* 2465026.5 */ {
+            -12.1908188, 14.9926271, 4.77707291, -1.01545119,
+            -0.0980511904, 0.0386774167, -0.00403984822, -0.00147943059,
+            0.00050577923, 3.42563544e-06, -3.2909531e-05, 7.05303682e-06,
+            -47.6217117, 64.9827194, -2.25230336, -0.118145213,
+            0.275377631, -0.0172845442, -0.0139149642, 0.00363896065,
+            0.000186680583, -0.000325566914, 4.86778881e-05, 1.51597142e-05,
+            -0.00347783929, -0.000112241847, -0.00026093924, -1.31167508e-05,
+            3.19263927e-05, 8.86702651e-07,
+        },
+        /* 2465154.5 */ {
+            16.6423397, 4.44894981, -6.1082902, -0.248538136,
+            0.181132987, 0.0113596655, -0.00556468824, -0.000954077521,
+            0.00030074353, 7.3290139e-05, -1.55820089e-05, -6.03637272e-06,
+            78.1864395, 64.0029526, 0.555017829, -0.642172396,
+            -0.0981319547, 0.0543849356, 0.00800789893, -0.00291583571,
+            -0.000685847015, 0.000166986269, 5.91211938e-05, -9.90319404e-06,
+            -0.00381739391, 0.000209596372, 0.00011408412, -9.95227892e-05,
+            -1.33722579e-05, 6.72024453e-06,
+        },
+        /* 2465282.5 */ {
+            -6.41143417, -20.2565689, 2.16938519, 1.11547959,
+            0.0155100562, -0.0106273005, -0.00529166032, -0.000837799103,
+            0.000109770532, 5.37066044e-05, 1.09064149e-05, -7.64421912e-08,
+            -157.671646, 61.4654427, 1.87414992, 0.579357028,
+            -0.135763049, -0.0435001254, -0.00185109652, 0.000977047021,
+            0.000582955545, 8.0278216e-05, -1.57730792e-05, -8.55921189e-06,
+            -0.00406198017, -0.000353422365, 0.000200608963, 7.35944632e-05,
+            -2.38069133e-05, -4.96750499e-06,
+        },
+        /* 2465410.5 */ {
+            -8.0271492, 19.4005108, 2.92875266, -1.15283334,
+            -0.0114316223, 0.0205062926, -0.00612262683, 0.000416124996,
+            0.000266476127, -7.25715727e-05, 4.937413e-06, 3.28664032e-06,
+            -28.7842808, 62.9065094, -2.05517387, 0.413975507,
+            0.187682807, -0.0442848653, -0.00140763144, 0.00220395159,
+            -0.000663911633, 3.61022012e-06, 4.40780859e-05, -1.18380831e-05,
+            -0.00417754566, -0.000259833643, -0.000226471995, 5.48690114e-05,
+            2.7826829e-05, -3.70388648e-06,
+        },
+        /* 2465538.5 */ {
+            16.91115, -2.40024805, -6.17583084, 0.169629812,
+            0.183985755, -0.00934060756, -0.0060895849, 0.0007121737,
+            0.00035731445, -5.48900498e-05, -2.1013142e-05, 4.69624183e-06,
+            96.4428787, 64.0072861, -0.494330376, -0.679252505,
+            0.0647215173, 0.0587257445, -0.00556807639, -0.00341456756,
+            0.000495624612, 0.000223172436, -4.41038974e-05, -1.63034965e-05,
+            -0.00431593601, 0.000323164422, -5.33350467e-05, -0.000106890002,
+            6.90971592e-06, 7.21675406e-06,
+        },
+        /* 2465666.5 */ {
+            -10.9288321, -16.6434975, 4.05086327, 1.07001126,
+            -0.0460811816, -0.0311230831, -0.0062094396, 0.000476769317,
+            0.000450347143, 6.08089431e-05, -1.35440014e-05, -7.55021119e-06,
+            -139.078598, 63.6107788, 2.42311573, 0.132949367,
+            -0.24729614, -0.0336415917, 0.00759827299, 0.00354310125,
+            0.000396374264, -0.000179706563, -6.83396938e-05, -3.90032983e-06,
+            -0.00441366993, -4.55420668e-05, 0.000268799398, 1.0045771e-05,
+            -3.20231629e-05, -6.7855035e-07,
+        },
+        /* 2465794.5 */ {
+            -2.95112848, 21.6762524, 0.932422459, -1.14383388,
+            0.0254511759, 0.004214291, -0.00304555264, 0.00100868568,
+            5.58633246e-06, -2.40744648e-05, 7.9458614e-06, -1.68596557e-06,
+            -10.1549091, 61.2709808, -1.15245342, 0.708979189,
+            0.0617237687, -0.0418545194, 0.00257857563, -0.000182089047,
+            -0.000302639703, 0.000105685511, -3.05858885e-06, -2.19424533e-06,
+            -0.00435447693, -0.000324872322, -9.99008262e-05, 0.000100786536,
+            1.25340866e-05, -6.80445555e-06,
+        },
+        /* 2465922.5 */ {
+            15.5251474, -8.98259449, -5.58325148, 0.54106456,
+            0.138067737, -0.0226804148, -0.00142272853, 0.00146205339,
+            -4.98947156e-05, -8.10290876e-05, 1.17219652e-05, 3.83638007e-06,
+            114.665321, 63.160656, -1.3591671, -0.399453461,
+            0.187695116, 0.0260617528, -0.0128095327, -1.96550882e-05,
+            0.00082010153, -0.000102894577, -4.69741608e-05, 1.39819831e-05,
+            -0.0042717997, 0.000292970275, -0.000198258538, -7.12584733e-05,
+            2.44119965e-05, 4.81021516e-06,
+        },
+        /* 2466050.5 */ {
+            -14.2436333, -11.153059, 5.64974785, 0.831046879,
+            -0.1526279, -0.0422611982, 3.04493824e-06, 0.00250263559,
+            0.000337901409, -0.000117574367, -4.02442129e-05, 1.93859819e-06,
+            -120.2603, 65.7747192, 2.1197474, -0.454112619,
+            -0.272079796, 0.0146928029, 0.0196115095, 0.00192410324,
+            -0.00113819295, -0.000338062702, 4.04914463e-05, 3.65216329e-05,
+            -0.00420251535, 0.000275293976, 0.00022992499, -5.75424965e-05,
+            -2.73582718e-05, 3.88342823e-06,
+        },
+        /* 2466178.5 */ {
+            2.48330784, 21.6834736, -1.01749384, -1.07724953,
+            0.0327322632, 0.000338988059, 0.000833623053, 0.000855976134,
+            -6.31780276e-05, -7.85487373e-06, -2.1318574e-06, -1.2216185e-06,
+            8.27349377, 60.6249161, 0.0324899331, 0.723048449,
+            -0.0522424094, -0.0354773067, 0.000999207725, -0.000448788312,
+            0.000175112262, 7.25707068e-05, -6.50690936e-06, 1.59200724e-08,
+            -0.00399459666, -0.000256087107, 6.79184523e-05, 0.000106162355,
+            -7.80025857e-06, -7.16797194e-06,
+        },
+        /* 2466306.5 */ {
+            12.598134, -14.655714, -4.45102835, 0.794698715,
+            0.0767202377, -0.0197297391, 0.00306053343, 0.00066209439,
+            -0.000256508531, 3.57243903e-06, 1.24124226e-05, -2.9840312e-06,
+            -227.164841, 61.7764282, -1.65339649, 0.050129842,
+            0.210559338, -0.0113641433, -0.00826379936, 0.00204548915,
+            3.22037449e-05, -0.000155397327, 2.39333822e-05, 5.19237119e-06,
+            -0.00370933278, 0.000156555267, -0.000262377493, -6.96508459e-06,
+            3.20941508e-05, 4.68790148e-07,
+        },
+        /* 2466434.5 */ {
+            -16.0443592, -4.33863974, 6.63706636, 0.36821264,
+            -0.248806313, -0.0248235706, 0.00983082037, 0.00206984603,
+            -0.000541870832, -0.000176556874, 2.92345503e-05, 1.66064929e-05,
+            -101.301033, 67.2171631, 1.00904191, -0.909572184,
+            -0.141760096, 0.0746446699, 0.0140972659, -0.00463184528,
+            -0.00140145782, 0.0002891123, 0.000136995877, -1.6897151e-05,
+            -0.00346928881, 0.000505355943, 9.95923547e-05, -0.000101986683,
+            -1.16884594e-05, 6.88336377e-06,
+        },
+        /* 2466562.5 */ {
+            7.66926765, 19.5104313, -2.82155108, -0.982350469,
+            0.0452279001, 0.00788528472, 0.00338795595, 0.000361342158,
+            -0.000155347807, -2.73216629e-05, -2.72628176e-06, 1.20053755e-06,
+            26.5830383, 61.0543098, 1.03366315, 0.4882797,
+            -0.14904356, -0.0305330548, 0.00193331705, 0.000959185767,
+            0.000390574598, 6.77951903e-07, -2.08126476e-05, -4.26691668e-06,
+            -0.00314823771, -5.62477144e-05, 0.000209405043, 6.88306827e-05,
+            -2.49969307e-05, -4.64831146e-06,
+        },
+        /* 2466690.5 */ {
+            8.38830948, -18.887558, -2.95807672, 0.933425009,
+            0.0366214924, -0.00762531115, 0.00372471754, -0.000315769867,
+            -0.000148257575, 2.86645445e-05, -2.84619568e-06, -1.30779608e-06,
+            -209.054962, 60.4340668, -1.2370429, 0.469748884,
+            0.153125495, -0.0287178457, -0.00162476592, 0.00106380763,
+            -0.000387652719, -4.56215912e-06, 2.04618918e-05, -4.48613991e-06,
+            -0.00271130237, -7.08835614e-06, -0.00022002004, 6.01241809e-05,
+            2.6866217e-05, -4.06102754e-06,
+        },
+        /* 2466818.5 */ {
+            -16.179285, 3.02139544, 6.75953245, -0.215974346,
+            -0.265179515, 0.0133612491, 0.0116760815, -0.00121714245,
+            -0.000743737153, 0.000111928093, 5.08464946e-05, -1.1439196e-05,
+            -82.2774658, 67.4720535, -0.484733284, -0.970242977,
+            0.0858626813, 0.0841947123, -0.00872155372, -0.00594916102,
+            0.000904517539, 0.000457399234, -9.38539379e-05, -3.95270508e-05,
+            -0.00231829984, 0.00057509332, -6.99340089e-05, -0.000105412379,
+            8.68313418e-06, 7.11436633e-06,
+        },
+        /* 2466946.5 */ {
+            12.0491009, 15.4145088, -4.38438511, -0.824567854,
+            0.0847507417, 0.0190684218, 0.00286935014, -0.000635674398,
+            -0.000257890322, -2.98138821e-06, 1.21126332e-05, 2.96789881e-06,
+            44.8593178, 62.1817894, 1.48381364, 0.0730315149,
+            -0.211088538, -0.0126397396, 0.00827131048, 0.00200938154,
+            -7.60032663e-06, -0.00015280256, -2.48844499e-05, 4.81087272e-06,
+            -0.00192066189, 0.000215790686, 0.000267443393, 3.80479128e-06,
+            -3.21387779e-05, -2.589247e-07,
+        },
+        /* 2467074.5 */ {
+            3.30459356, -21.2924347, -1.25183833, 1.01262903,
+            0.0273228958, 0.00156212726, 0.00143168727, -0.000775285938,
+            -5.69934418e-05, 5.4844113e-06, -3.3807753e-06, 9.70701876e-07,
+            -190.965347, 59.7757225, -0.246483505, 0.724012792,
+            0.064096503, -0.032045126, -0.000399807206, -0.000425908336,
+            -0.000215978551, 6.03532644e-05, 4.53527809e-06, -1.45775445e-07,
+            -0.0014026626, -0.000112379479, -8.84655383e-05, 0.00010301968,
+            1.08314471e-05, -6.95712515e-06,
+        },
+        /* 2467202.5 */ {
+            -14.6373281, 10.0488634, 5.97516394, -0.73674345,
+            -0.189441159, 0.0396409743, 0.00312857865, -0.00274218735,
+            0.0001213133, 0.000171090549, -2.96169819e-05, -8.9017276e-06,
+            -63.2497368, 66.4839478, -1.74791229, -0.597929716,
+            0.254033446, 0.0320578888, -0.0206116345, 0.000330052455,
+            0.00149832678, -0.000234692721, -9.32013063e-05, 3.53479845e-05,
+            -0.000898556027, 0.000474143628, -0.000210737257, -6.64442559e-05,
+            2.55618161e-05, 4.48340415e-06,
+        },
+        /* 2467330.5 */ {
+            15.1898794, 9.80867481, -5.5576005, -0.555456102,
+            0.143454924, 0.0215218589, -0.00151807501, -0.00144160481,
+            -5.132347e-05, 8.06291064e-05, 1.17553218e-05, -3.73292346e-06,
+            63.1377563, 63.3827744, 1.22290623, -0.38201043,
+            -0.191766709, 0.0249252208, 0.0128867459, 4.59404218e-05,
+            -0.000805290649, -0.000109479559, 4.52965251e-05, 1.42891249e-05,
+            -0.000458607858, 0.000465961581, 0.000218381538, -6.27612972e-05,
+            -2.63529328e-05, 4.23471738e-06,
+        },
+        /* 2467458.5 */ {
+            -2.11691713, -21.6249771, 0.590268016, 1.07870603,
+            0.0294295587, 0.00024715616, -0.00220066728, -0.000981193967,
+            -2.79368469e-05, 1.09520779e-05, 5.82223674e-06, 1.78370658e-06,
+            -172.790588, 60.2329216, 0.98518765, 0.752118886,
+            -0.0382525288, -0.0373355523, -0.00260136812, -0.00052687811,
+            0.000187888567, 9.33421106e-05, 6.62422281e-06, -9.53250137e-08,
+            6.5427339e-05, -0.00010416071, 7.9035708e-05, 0.00010446502,
+            -9.56006534e-06, -7.05469074e-06,
+        },
+        /* 2467586.5 */ {
+            -11.5449371, 15.9123983, 4.47552156, -1.05470967,
+            -0.0796772465, 0.0362689719, -0.00497203553, -0.00109161809,
+            0.000502044568, -2.59646386e-05, -2.59311728e-05, 7.91556522e-06,
+            -44.2883492, 64.6203995, -2.28086925, -0.0138840182,
+            0.266868711, -0.0250751674, -0.0115116965, 0.00373225543,
+            -7.9929705e-05, -0.000275068043, 6.24307431e-05, 6.71113003e-06,
+            0.000616968551, 0.000253169361, -0.000266533199, -7.59016132e-07,
+            3.21579319e-05, 4.88489889e-08,
+        },
+        /* 2467714.5 */ {
+            16.8125153, 3.25064445, -6.17098236, -0.175778121,
+            0.185692355, 0.00796804298, -0.00611673063, -0.000698562362,
+            0.000356254488, 5.54759936e-05, -2.08309466e-05, -4.76860941e-06,
+            81.4125519, 64.0712204, 0.376686215, -0.673742115,
+            -0.0710153729, 0.0583017208, 0.00588894542, -0.00337080075,
+            -0.000518823043, 0.000217552762, 4.62770404e-05, -1.5658401e-05,
+            0.00106515561, 0.000600789266, 8.15843014e-05, -0.000104092491,
+            -9.96649578e-06, 7.02510306e-06,
+        },
+        /* 2467842.5 */ {
+            -7.27808714, -19.7720852, 2.50907326, 1.1170857,
+            0.00868880376, -0.0139369508, -0.00580344303, -0.000716167269,
+            0.000163148128, 6.34339958e-05, 9.8088085e-06, -1.15442572e-06,
+            -154.409317, 61.8038521, 2.02334952, 0.518563628,
+            -0.157437116, -0.0438905731, -0.00092060212, 0.00145960844,
+            0.000637669, 5.74006262e-05, -2.60146899e-05, -1.04498731e-05,
+            0.00152908324, 1.84098553e-05, 0.000214725456, 6.38783022e-05,
+            -2.61059467e-05, -4.31458693e-06,
+        },
+        /* 2467970.5 */ {
+            -7.18395805, 19.9667454, 2.58059287, -1.15919864,
+            -0.00147820776, 0.0170083232, -0.00580839254, 0.000615958415,
+            0.000204578158, -6.70307418e-05, 8.12882172e-06, 1.86230727e-06,
+            -25.4812717, 62.5684586, -1.9366293, 0.486189008,
+            0.165982172, -0.0452181846, 1.21637977e-05, 0.00169757882,
+            -0.000652915973, 4.33561945e-05, 3.25669935e-05, -1.11267673e-05,
+            0.00205053855, 2.13515227e-06, -0.000215263703, 6.52210219e-05,
+            2.58182245e-05, -4.40535587e-06,
+        },
+        /* 2468098.5 */ {
+            16.7860184, -3.60257745, -6.11757994, 0.241768658,
+            0.178839535, -0.0127280168, -0.00553290593, 0.00097009039,
+            0.000302571338, -7.30314205e-05, -1.58346993e-05, 6.01501051e-06,
+            99.6665955, 63.9162254, -0.675137281, -0.650554359,
+            0.0921700671, 0.0550251156, -0.00773026422, -0.00297798798,
+            0.000669270055, 0.000174593646, -5.77390092e-05, -1.07239639e-05,
+            0.0024686472, 0.000564030197, -8.83065222e-05, -0.000103562692,
+            1.0429254e-05, 6.98971598e-06,
+        },
+        /* 2468226.5 */ {
+            -11.6133366, -15.7985249, 4.36250687, 1.04416108,
+            -0.0624762587, -0.034445893, -0.00569259748, 0.000848227006,
+            0.000491030165, 4.25636208e-05, -2.14238389e-05, -8.08501136e-06,
+            -135.77095, 64.010994, 2.4360733, 0.0335775577,
+            -0.260826558, -0.0279915631, 0.0100398641, 0.00372955878,
+            0.000201146453, -0.000243644434, -6.62816819e-05, 2.58181217e-06,
+            0.00282342266, 0.000200963186, 0.000263643975, -2.41384146e-06,
+            -3.21507032e-05, 1.60993295e-07,
+        },
+        /* 2468354.5 */ {
+            -2.00060129, 21.8438129, 0.581270933, -1.13471222,
+            0.0278712567, 0.00255928142, -0.00233358168, 0.00101151585,
+            -1.50993637e-05, -1.69758259e-05, 6.15436466e-06, -1.82627991e-06,
+            -6.88833475, 61.0794868, -0.949620724, 0.731373608,
+            0.0403097942, -0.0405120105, 0.00245796144, -0.000395908806,
+            -0.000207871839, 0.000102567043, -5.41022064e-06, -8.20436014e-07,
+            0.00323625305, -0.000186024699, -7.7917517e-05, 0.000104956511,
+            9.0929916e-06, -7.08744028e-06,
+        },
+        /* 2468482.5 */ {
+            15.1144781, -10.0686445, -5.41716194, 0.595608234,
+            0.127053037, -0.0233301651, -0.000442601158, 0.00140521047,
+            -0.000116754454, -6.83446415e-05, 1.50985097e-05, 2.23937582e-06,
+            117.88221, 62.9405937, -1.46160007, -0.326352715,
+            0.199446946, 0.0186898876, -0.0127048902, 0.000582662818,
+            0.000718576601, -0.00014303338, -3.29075556e-05, 1.53999135e-05,
+            0.00357910246, 0.0003595663, -0.000223300129, -6.13829689e-05,
+            2.66300849e-05, 4.14268152e-06,
+        },
+        /* 2468610.5 */ {
+            -14.6779118, -10.0256882, 5.87704563, 0.764451385,
+            -0.172491148, -0.0415171161, 0.00176547968, 0.00269750343,
+            0.000216676883, -0.00015304111, -3.51115013e-05, 6.30247268e-06,
+            -116.921272, 66.0970001, 1.97532439, -0.552833557,
+            -0.260716885, 0.0261336174, 0.0203969069, 0.000934223004,
+            -0.00139150035, -0.000278669788, 7.55286892e-05, 3.69686168e-05,
+            0.00379506592, 0.000356468838, 0.000205788034, -6.77434655e-05,
+            -2.52627342e-05, 4.57181432e-06,
+        },
+        /* 2468738.5 */ {
+            3.43400097, 21.4527836, -1.34915507, -1.06309736,
+            0.0336665288, 0.000998768024, 0.00142359314, 0.000797298737,
+            -7.28025334e-05, -1.04174505e-05, -3.28767874e-06, -9.31826662e-07,
+            11.513339, 60.6323318, 0.235147938, 0.698128462,
+            -0.0706449598, -0.0347743891, 0.000795394648, -0.000283753034,
+            0.00023860221, 6.49058711e-05, -7.20879416e-06, -7.22345646e-07,
+            0.0040347157, -0.000251712016, 8.99609877e-05, 0.000102466249,
+            -1.12899916e-05, -6.91856212e-06,
+        },
+        /* 2468866.5 */ {
+            11.9369478, -15.5202751, -4.2074728, 0.826372206,
+            0.0673031285, -0.01788982, 0.00347578619, 0.000461561751,
+            -0.000250806101, 1.46732664e-05, 9.37388904e-06, -3.16875821e-06,
+            -223.959091, 61.5152016, -1.63160038, 0.13172105,
+            0.204739064, -0.0160954557, -0.00689943973, 0.00204197643,
+            -9.72839771e-05, -0.000130613858, 2.86816339e-05, 2.03827335e-06,
+            0.00425293809, 5.12998558e-05, -0.000269360084, 5.48287062e-06,
+            3.21190855e-05, -3.70818498e-07,
+        },
+        /* 2468994.5 */ {
+            -16.1901321, -3.05414009, 6.72496891, 0.269194454,
+            -0.258824885, -0.0188160148, 0.0110233435, 0.00159976375,
+            -0.000675390242, -0.000141018667, 4.35896545e-05, 1.39415561e-05,
+            -97.9466019, 67.353363, 0.757526815, -0.953524768,
+            -0.104740337, 0.081404604, 0.0106967287, -0.00555233285,
+            -0.00110067194, 0.00040615903, 0.000112119502, -3.24482389e-05,
+            0.00431757141, 0.00040205085, 6.41998704e-05, -0.000105828505,
+            -8.21256253e-06, 7.14364569e-06,
+        },
+        /* 2469122.5 */ {
+            8.5143919, 18.9155483, -3.11879182, -0.960706234,
+            0.0500782728, 0.00992523041, 0.00357355876, 0.000220544272,
+            -0.000180033516, -2.87681578e-05, -1.00728732e-06, 1.78068217e-06,
+            29.8122807, 61.22295, 1.16056228, 0.424944192,
+            -0.163645446, -0.0287965257, 0.0027279749, 0.00125543121,
+            0.000376284297, -2.28333865e-05, -2.48657216e-05, -4.19424669e-06,
+            0.0043467842, -0.000190509279, 0.000220652073, 5.87550167e-05,
+            -2.71317276e-05, -3.96667519e-06,
+        },
+        /* 2469250.5 */ {
+            7.53896046, -19.4507847, -2.66817188, 0.949712336,
+            0.0329220779, -0.00549353659, 0.00347621413, -0.000431665365,
+            -0.000123988764, 2.55234045e-05, -4.09774111e-06, -7.60987461e-07,
+            -205.859253, 60.2487564, -1.0965277, 0.529109895,
+            0.138546467, -0.0298060384, -0.000959448284, 0.000760059804,
+            -0.000386823522, 1.45611939e-05, 1.61072767e-05, -4.15677459e-06,
+            0.00439573452, -0.000260137429, -0.00020810758, 7.01415775e-05,
+            2.46882173e-05, -4.73520367e-06,
+        },
+        /* 2469378.5 */ {
+            -16.025074, 4.30992842, 6.68315458, -0.317475498,
+            -0.257492393, 0.0197637677, 0.0107079977, -0.00174253457,
+            -0.00063111668, 0.00015487615, 3.83726547e-05, -1.51567128e-05,
+            -78.9196701, 67.3812485, -0.740335882, -0.932163775,
+            0.124174871, 0.0783815533, -0.0123928431, -0.0051523908,
+            0.00125058962, 0.000354026299, -0.000125430568, -2.54274219e-05,
+            0.00430959696, 0.000294980942, -0.000104273407, -0.000101345227,
+            1.21414378e-05, 6.84194083e-06,
+        },
+        /* 2469506.5 */ {
+            12.7011671, 14.5180683, -4.62468433, -0.785928011,
+            0.0945468768, 0.0204922501, 0.002337388, -0.000834599021,
+            -0.00025185931, 1.04514947e-05, 1.4665191e-05, 2.45628189e-06,
+            48.0871811, 62.4101334, 1.48858202, -0.0100383544,
+            -0.214904845, -0.00716127502, 0.00956099201, 0.00192314817,
+            -0.000152550143, -0.000171994689, -1.72867112e-05, 8.13233237e-06,
+            0.00412626937, -5.21010115e-05, 0.000261522626, -8.59098509e-06,
+            -3.20598665e-05, 5.80851975e-07,
+        },
+        /* 2469634.5 */ {
+            2.35496068, -21.5018234, -0.934644639, 1.02429354,
+            0.027702665, 0.00223008497, 0.00085729931, -0.000822392642,
+            -5.19572604e-05, 2.80403606e-06, -2.19287085e-06, 1.1891251e-06,
+            -187.766586, 59.7660255, -0.0352941118, 0.746362209,
+            0.0470507182, -0.0325134732, -0.000705124869, -0.000575193902,
+            -0.000157177099, 6.55319818e-05, 4.46969125e-06, 5.47938555e-07,
+            0.00397890294, -0.000474854198, -6.41981533e-05, 0.000106587831,
+            7.32650642e-06, -7.19487161e-06,
+        },
+        /* 2469762.5 */ {
+            -14.1960344, 11.1864939, 5.75340939, -0.809257269,
+            -0.170353144, 0.0411119312, 0.00132830313, -0.00261249184,
+            0.000258341548, 0.000139840675, -3.71168753e-05, -4.53693247e-06,
+            -59.9001007, 66.2023087, -1.90260684, -0.501401603,
+            0.267836154, 0.020462513, -0.0201828778, 0.00140112848,
+            0.00127607631, -0.000310370495, -5.9201906e-05, 3.72893956e-05,
+            0.00375243253, 5.2980442e-05, -0.000231836224, -5.60929802e-05,
+            2.76118171e-05, 3.78803179e-06,
+        },
+        /* 2469890.5 */ {
+            15.5884924, 8.70092678, -5.71011686, -0.495013922,
+            0.153342277, 0.0202536006, -0.00249510631, -0.00144378643,
+            2.37762888e-05, 8.92722674e-05, 7.0643523e-06, -5.14202566e-06,
+            66.3642273, 63.5563316, 1.10649586, -0.451165169,
+            -0.177124918, 0.0322246067, 0.0126124471, -0.000603020249,
+            -0.000871929165, -5.88238581e-05, 5.7134017e-05, 1.1293163e-05,
+            0.00338961836, 8.28836928e-05, 0.000196202178, -7.24784113e-05,
+            -2.40919162e-05, 4.89480317e-06,
+        },
+        /* 2470018.5 */ {
+            -3.06252789, -21.4520798, 0.925286055, 1.08862233,
+            0.0284372382, -0.00133942848, -0.00289759203, -0.000990757602,
+            -1.28424508e-05, 1.77963902e-05, 7.64684864e-06, 1.72313673e-06,
+            -169.566818, 60.4338379, 1.19489026, 0.730465233,
+            -0.0581290759, -0.0388009734, -0.00282448693, -0.000330044772,
+            0.000275461964, 9.81907069e-05, 5.18170191e-06, -1.33069511e-06,
+            0.00304864999, -0.000530698453, 0.00010459419, 0.000100164376,
+            -1.29823666e-05, -6.76040145e-06,
+        },
+        /* 2470146.5 */ {
+            -10.8555698, 16.7686939, 4.16039133, -1.08661532,
+            -0.0624482557, 0.0333377346, -0.00564072141, -0.000710184628,
+            0.000474240165, -4.83946278e-05, -1.8191753e-05, 7.83306587e-06,
+            -40.9620323, 64.251709, -2.27971125, 0.0871972814,
+            0.254532903, -0.0315068774, -0.00906413049, 0.0036289657,
+            -0.000300919259, -0.000213609921, 6.82216778e-05, -6.06367848e-07,
+            0.00270132883, -0.000249759789, -0.000267022668, 1.17290056e-05,
+            3.19755563e-05, -7.89671333e-07,
+        },
+        /* 2470274.5 */ {
+            16.9251137, 2.04351711, -6.20991373, -0.101743802,
+            0.188477024, 0.00432008831, -0.00647839811, -0.000407624611,
+            0.000393894617, 3.33432981e-05, -2.45143383e-05, -2.94936171e-06,
+            84.6340408, 64.108963, 0.191520631, -0.694338322,
+            -0.0424173847, 0.0608922541, 0.00352150924, -0.00368026667,
+            -0.000315282698, 0.000253054022, 2.87598468e-05, -1.98651451e-05,
+            0.00221932307, 0.000138374031, 5.11561411e-05, -0.000107205371,
+            -6.43286694e-06, 7.23988478e-06,
+        },
+        /* 2470402.5 */ {
+            -8.11468506, -19.2152634, 2.84543777, 1.11491024,
+            0.000191633895, -0.0174772516, -0.00619800109, -0.000548815355,
+            0.000223227064, 7.10814638e-05, 7.39005645e-06, -2.47299022e-06,
+            -151.144867, 62.1625862, 2.15137362, 0.449332118,
+            -0.178663239, -0.043544624, 0.000343701045, 0.00196394115,
+            0.000664118445, 2.39650344e-05, -3.73585499e-05, -1.16641668e-05,
+            0.0017234399, -0.000425307866, 0.000230599122, 5.34574974e-05,
+            -2.80691984e-05, -3.60654076e-06,
+        },
+        /* 2470530.5 */ {
+            -6.31459284, 20.4567165, 2.229599, -1.16120243,
+            0.00679556932, 0.0137109365, -0.00535813905, 0.000767876219,
+            0.000147912535, -5.87523755e-05, 9.89482578e-06, 6.42135831e-07,
+            -22.1926994, 62.2498131, -1.79703355, 0.54952234,
+            0.143659219, -0.0453293398, 0.00109337037, 0.0012044817,
+            -0.000608608476, 7.21698743e-05, 2.17129709e-05, -9.52714618e-06,
+            0.00128506939, -0.00050962728, -0.000195420711, 7.48419479e-05,
+            2.34772833e-05, -5.04982836e-06,
+        },
+        /* 2470658.5 */ {
+            16.6049595, -4.78774118, -6.03691578, 0.311406136,
+            0.172109321, -0.0157386437, -0.00481550628, 0.00117987685,
+            0.00023424426, -8.55867329e-05, -9.64729588e-06, 6.66029018e-06,
+            102.8797, 63.7962151, -0.846258819, -0.611616313,
+            0.117537253, 0.0501603559, -0.00955959875, -0.00242466619,
+            0.000796331733, 0.000115455055, -6.56461198e-05, -4.30952878e-06,
+            0.000757936912, 7.60614203e-05, -0.000114985232, -9.88005559e-05,
+            1.38139094e-05, 6.67279301e-06,
+        },
+        /* 2470786.5 */ {
+            -12.2525997, -14.8958178, 4.66136694, 1.01147735,
+            -0.0801613405, -0.0373239033, -0.00491786795, 0.00123601034,
+            0.000510957092, 1.70302428e-05, -2.90328899e-05, -7.79012316e-06,
+            -132.467728, 64.405632, 2.41986394, -0.0690377131,
+            -0.270879269, -0.0209944509, 0.0124901487, 0.00373693346,
+            -4.28756648e-05, -0.000300214946, -5.67737043e-05, 1.05232448e-05,
+            0.000178531831, -0.000214676606, 0.000263440976, -1.47433975e-05,
+            -3.18652637e-05, 9.98061182e-07,
+        },
+        /* 2470914.5 */ {
+            -1.04522264, 21.934412, 0.233737975, -1.12409472,
+            0.0295300893, 0.00134232896, -0.00162257161, 0.000997298746,
+            -3.0045454e-05, -1.17079708e-05, 4.22195399e-06, -1.83303825e-06,
+            -3.63975692, 60.9228477, -0.741388977, 0.744560122,
+            0.0195334945, -0.0392028578, 0.00220653531, -0.000532754639,
+            -0.00011611401, 9.72666385e-05, -6.4518099e-06, 9.96148941e-08,
+            -0.000309119205, -0.000633129152, -4.55018162e-05, 0.000107860214,
+            5.53528889e-06, -7.27881434e-06,
+        },
+        /* 2471042.5 */ {
+            14.6553516, -11.1156435, -5.23468447, 0.64558959,
+            0.11582543, -0.0234136842, 0.000484406628, 0.00129961898,
+            -0.000171496475, -5.30188772e-05, 1.68979859e-05, 6.5314714e-07,
+            -238.916351, 62.7053833, -1.54280603, -0.24920164,
+            0.207617536, 0.0114536854, -0.0122153368, 0.00109716947,
+            0.000586920651, -0.000169066378, -1.79205508e-05, 1.50757951e-05,
+            -0.00080854632, -8.73236204e-05, -0.00023504594, -5.06436045e-05,
+            2.8504106e-05, 3.42168937e-06,
+        },
+        /* 2471170.5 */ {
+            -15.0593309, -8.86441231, 6.08127308, 0.69103086,
+            -0.191503704, -0.0397527777, 0.00359681691, 0.00278665987,
+            7.03152546e-05, -0.000181059804, -2.59689677e-05, 1.05734662e-05,
+            -113.593071, 66.3908386, 1.80663037, -0.645041466,
+            -0.244096428, 0.0376264974, 0.0204659831, -0.000202586132,
+            -0.00157595635, -0.000188539983, 0.000107269079, 3.26710942e-05,
+            -0.00138034974, 1.09469784e-05, 0.00019026536, -7.70037732e-05,
+            -2.28435292e-05, 5.20114008e-06,
+        },
+        /* 2471298.5 */ {
+            4.36872435, 21.1533337, -1.67402399, -1.04805756,
+            0.0349764042, 0.0019961535, 0.0019613225, 0.000728795538,
+            -8.48414056e-05, -1.39063404e-05, -4.06026038e-06, -5.87263685e-07,
+            14.7352695, 60.6729088, 0.428133637, 0.665652871,
+            -0.0884528607, -0.0341060124, 0.000721636054, -7.17103321e-05,
+            0.000293191697, 5.59872278e-05, -8.70015447e-06, -1.60818615e-06,
+            -0.00186385645, -0.000573225727, 0.000122792771, 9.75024814e-05,
+            -1.46334551e-05, -6.57995679e-06,
+        },
+        /* 2471426.5 */ {
+            11.2397003, -16.3310661, -3.95488429, 0.854243279,
+            0.0588264279, -0.0158348028, 0.00375260599, 0.000267782103,
+            -0.000236231048, 2.27313649e-05, 6.20700257e-06, -3.05328581e-06,
+            -220.771378, 61.2598915, -1.58678317, 0.210680857,
+            0.196651682, -0.0200416073, -0.00555799576, 0.00194329605,
+            -0.000203894539, -0.000102279075, 3.04097775e-05, -6.06268429e-07,
+            -0.00227625482, -0.000285783142, -0.00026036636, 1.78943264e-05,
+            3.17286904e-05, -1.20565221e-06,
+        },
+        /* 2471554.5 */ {
+            -16.2821369, -1.76405656, 6.78402758, 0.167750955,
+            -0.265883565, -0.0122919139, 0.011874306, 0.00104824814,
+            -0.000773045234, -9.39496167e-05, 5.44545546e-05, 9.56475287e-06,
+            -94.6069565, 67.4499588, 0.498235762, -0.983443499,
+            -0.0654449835, 0.0861204937, 0.0068246834, -0.00621370599,
+            -0.000718910829, 0.000493192754, 7.51579792e-05, -4.45827682e-05,
+            -0.00274892175, 0.000163995952, 4.08692067e-05, -0.000108279681,
+            -4.63304013e-06, 7.31193722e-06,
+        },
+        /* 2471682.5 */ {
+            9.32728481, 18.2656002, -3.4063096, -0.936901808,
+            0.0558510907, 0.0120149637, 0.00365022337, 6.22265798e-05,
+            -0.000204434255, -2.81924022e-05, 1.26047769e-06, 2.32683396e-06,
+            33.0249519, 61.4090691, 1.26761234, 0.356741488,
+            -0.17695038, -0.0265455842, 0.00370010245, 0.00152551383,
+            0.000339301652, -4.95294698e-05, -2.82713736e-05, -3.51147628e-06,
+            -0.00316726835, -0.000347951049, 0.000242121867, 4.79341106e-05,
+            -2.89161471e-05, -3.23424388e-06,
+        },
+        /* 2471810.5 */ {
+            6.66948557, -19.9530506, -2.37438345, 0.964448869,
+            0.0302355438, -0.00353462412, 0.00314965448, -0.000528996112,
+            -0.000102758604, 2.13711537e-05, -4.78229322e-06, -2.7063524e-07,
+            -202.680359, 60.0894814, -0.940020382, 0.582362413,
+            0.123403624, -0.0305359736, -0.000500472263, 0.000461802585,
+            -0.000369843125, 2.95893824e-05, 1.2133306e-05, -3.480038e-06,
+            -0.0034533937, -0.000430630957, -0.000180418545, 7.92428618e-05,
+            2.21907248e-05, -5.34797755e-06,
+        },
+        /* 2471938.5 */ {
+            -15.8209848, 5.57685328, 6.5798707, -0.415335804,
+            -0.247066453, 0.0255360603, 0.00943438802, -0.00217278162,
+            -0.000488273596, 0.000184802353, 2.32352286e-05, -1.70043459e-05,
+            -75.5780716, 67.2535858, -0.984019101, -0.881176889,
+            0.159405112, 0.0707502365, -0.0154858865, -0.00413865596,
+            0.00150203449, 0.000227785291, -0.000143406505, -9.1845759e-06,
+            -0.00375485979, 0.000194443754, -0.000124326456, -9.59919707e-05,
+            1.54408408e-05, 6.48140849e-06,
+        },
+        /* 2472066.5 */ {
+            13.3110981, 13.5835905, -4.85120964, -0.743839741,
+            0.10480009, 0.0215586051, 0.00168326357, -0.00102067005,
+            -0.000233384591, 2.57336869e-05, 1.64178091e-05, 1.58620651e-06,
+            51.2999458, 62.6356049, 1.47104728, -0.0929931104,
+            -0.215887308, -0.00107074459, 0.0107320948, 0.00172357308,
+            -0.000307339942, -0.000182036732, -6.72505439e-06, 1.12845055e-05,
+            -0.00404761871, -3.38535283e-05, 0.000264791393, -2.09081227e-05,
+            -3.15674515e-05, 1.41257669e-06,
+        },
+        /* 2472194.5 */ {
+            1.40264404, -21.6484299, -0.61553055, 1.03591275,
+            0.0283129551, 0.00253937719, 0.000252838887, -0.000864868925,
+            -4.86356112e-05, 1.4404435e-06, -7.70790564e-07, 1.37704365e-06,
+            -184.579346, 59.7929916, 0.180207327, 0.761582136,
+            0.0297531765, -0.0331519954, -0.00109322101, -0.000673797738,
+            -9.34943528e-05, 7.07377694e-05, 4.9855289e-06, 1.01083333e-06,
+            -0.00418851385, -0.000447185332, -2.70809342e-05, 0.000108722677,
+            3.72683508e-06, -7.33918432e-06,
+        },
+        /* 2472322.5 */ {
+            -13.7121344, 12.280859, 5.51324034, -0.874692559,
+            -0.15078859, 0.0416142531, -0.000363747647, -0.00238947803,
+            0.000367445551, 0.000103220067, -4.06010549e-05, -3.61831837e-07,
+            -56.5665855, 65.8986588, -2.03222752, -0.400580615,
+            0.276481152, 0.00921851676, -0.0191146675, 0.00229496066,
+            0.00100144988, -0.000354089978, -2.43698487e-05, 3.48674221e-05,
+            -0.00428058812, 0.000108594228, -0.000238619657, -4.50862681e-05,
+            2.93032899e-05, 3.04376431e-06,
+        },
+        /* 2472450.5 */ {
+            15.9407797, 7.57363176, -5.84497118, -0.431647956,
+            0.162460312, 0.0184680242, -0.00344475056, -0.0013883569,
+            0.000103111008, 9.28935115e-05, 1.31198567e-06, -6.17946034e-06,
+            69.5779495, 63.7110329, 0.974195421, -0.513907731,
+            -0.159409016, 0.0391788036, 0.0119180689, -0.00127590459,
+            -0.000891774602, 4.67771088e-07, 6.50484872e-05, 6.68426901e-06,
+            -0.0043988307, 0.000263161433, 0.00018190252, -8.1335209e-05,
+            -2.15207292e-05, 5.49123888e-06,
+        },
+        /* 2472578.5 */ {
+            -3.99422407, -21.2176552, 1.26117611, 1.097808,
+            0.026566986, -0.00332434243, -0.00358769903, -0.000984378043,
+            8.96927031e-06, 2.62368485e-05, 9.25490076e-06, 1.52365146e-06,
+            -166.347458, 60.6676521, 1.39573371, 0.700982869,
+            -0.0785324648, -0.0402973667, -0.00288259564, -6.48216374e-05,
+            0.000364719745, 0.000100527657, 2.18402306e-06, -2.96031044e-06,
+            -0.00439142995, -0.00030672978, 0.00013815063, 9.44726926e-05,
+            -1.62361212e-05, -6.37834773e-06,
+        },
+        /* 2472706.5 */ {
+            -10.1337996, 17.5681171, 3.83729267, -1.11236966,
+            -0.0466140322, 0.0300747789, -0.00606494118, -0.000353164156,
+            0.000429496256, -6.36083059e-05, -1.06079369e-05, 7.05273396e-06,
+            -37.6505699, 63.8833313, -2.25239944, 0.183735892,
+            0.23935011, -0.036620874, -0.00670780288, 0.00337336399,
+            -0.000469776103, -0.000148910738, 6.73530158e-05, -6.18780587e-06,
+            -0.00427467935, -3.56399069e-05, -0.000255890453, 2.39569927e-05,
+            3.13782875e-05, -1.61809578e-06,
+        },
+        /* 2472834.5 */ {
+            16.9910088, 0.834959805, -6.22964907, -0.0273295324,
+            0.189631507, 0.000545395073, -0.00664771115, -9.76353549e-05,
+            0.00041205273, 8.7583503e-06, -2.63220663e-05, -8.00566397e-07,
+            87.8466721, 64.1210175, 0.00322088646, -0.704810202,
+            -0.0130906468, 0.0621773675, 0.00102013035, -0.00383367506,
+            -9.09309892e-05, 0.000270901539, 8.46591684e-06, -2.20156653e-05,
+            -0.00419187918, 0.000448004517, 2.69026623e-05, -0.000109043656,
+            -2.81734401e-06, 7.36096308e-06,
+        },
+        /* 2472962.5 */ {
+            -8.92364979, -18.601347, 3.17901158, 1.10919118,
+            -0.00996598788, -0.0211682692, -0.0064563849, -0.000334896904,
+            0.000287531788, 7.55101428e-05, 3.55704856e-06, -3.95413554e-06,
+            -147.879089, 62.5372429, 2.2585237, 0.372880459,
+            -0.199227422, -0.0423621573, 0.00192779081, 0.0024657601,
+            0.000655571173, -1.99549359e-05, -4.88087317e-05, -1.18155767e-05,
+            -0.00404329132, -4.07071275e-05, 0.000248874567, 4.22212906e-05,
+            -2.96682356e-05, -2.85184387e-06,
+        },
+        /* 2473090.5 */ {
+            -5.42582226, 20.8843536, 1.87819123, -1.16027665,
+            0.0135690644, 0.0106834704, -0.00481254887, 0.000878491323,
+            9.85227089e-05, -4.91680621e-05, 1.04764331e-05, -3.24175573e-07,
+            -18.915308, 61.9531021, -1.64064586, 0.604610503,
+            0.121227771, -0.0448713265, 0.00186006294, 0.000748955063,
+            -0.000541703135, 9.12479227e-05, 1.23735408e-05, -7.49752735e-06,
+            -0.00375180971, -0.000154859445, -0.000169173582, 8.33615341e-05,
+            2.08314323e-05, -5.62898822e-06,
+        },
+        /* 2473218.5 */ {
+            16.3790531, -5.95776892, -5.93888283, 0.378534615,
+            0.164161101, -0.0183344521, -0.0039800168, 0.00133704662,
+            0.000157744711, -9.22310355e-05, -3.10264522e-06, 6.63277888e-06,
+            106.088898, 63.6537399, -1.00683188, -0.564209342,
+            0.140619814, 0.0444076397, -0.0110218534, -0.00179563579,
+            0.000873197219, 5.15441934e-05, -6.76548007e-05, 2.10042731e-06,
+            -0.00347153889, 0.000471675536, -0.000137885247, -9.28915397e-05,
+            1.70190178e-05, 6.26963993e-06,
+        },
+        /* 2473346.5 */ {
+            -12.8543921, -13.9455156, 4.94970131, 0.972345412,
+            -0.0989373773, -0.0396739878, -0.00389581337, 0.00162452064,
+            0.00050601922, -1.48660811e-05, -3.55522643e-05, -6.51858045e-06,
+            -129.159485, 64.7932663, 2.37700748, -0.173717126,
+            -0.277320057, -0.0127475392, 0.0148460604, 0.00354668475,
+            -0.000324973022, -0.000343203428, -3.94447925e-05, 1.91561212e-05,
+            -0.00319531118, 0.000268840638, 0.00026048196, -2.70172422e-05,
+            -3.11663316e-05, 1.82191241e-06,
+        },
+        /* 2473474.5 */ {
+            -0.0854329914, 21.9628906, -0.111058027, -1.11286843,
+            0.0306823291, 0.000536905427, -0.000922472856, 0.000971642556,
+            -4.10845169e-05, -8.31189664e-06, 2.29177158e-06, -1.74954687e-06,
+            -0.39536792, 60.7999229, -0.529900968, 0.749777198,
+            -0.000690918532, -0.0380229652, 0.00188062817, -0.000598730519,
+            -2.89296659e-05, 9.10587914e-05, -6.67984295e-06, 5.83284589e-07,
+            -0.00278424961, -0.00017688387, -1.34659977e-05, 0.000109228647,
+            1.90526691e-06, -7.37568735e-06,
+        },
+        /* 2473602.5 */ {
+            14.155138, -12.132885, -5.03909397, 0.691839159,
+            0.10463389, -0.0230073947, 0.00133715104, 0.00115681323,
+            -0.000213238425, -3.65408196e-05, 1.72362761e-05, -7.6714673e-07,
+            -235.713577, 62.4599533, -1.60439122, -0.169192329,
+            0.212632209, 0.00450958451, -0.0114207994, 0.00151181745,
+            0.000437464507, -0.000181429597, -3.49141305e-06, 1.33662343e-05,
+            -0.00234211655, 0.000347789144, -0.000246332638, -3.93799382e-05,
+            3.00090614e-05, 2.6564071e-06,
+        },
+        /* 2473730.5 */ {
+            -15.3969088, -7.6711297, 6.26561308, 0.611243725,
+            -0.209465399, -0.0370011479, 0.00543845538, 0.00276146294,
+            -9.38103622e-05, -0.000198790061, -1.33493513e-05, 1.42055014e-05,
+            -110.25676, 66.6579742, 1.61651015, -0.730217636,
+            -0.22255367, 0.0488846414, 0.0197905377, -0.00143226888,
+            -0.00167431077, -7.30878382e-05, 0.000131968583, 2.36335272e-05,
+            -0.00195825775, 0.000519109133, 0.000168105704, -8.53949095e-05,
+            -2.01275525e-05, 5.76284219e-06,
+        },
+        /* 2473858.5 */ {
+            5.29239178, 20.7947788, -1.99497235, -1.03237629,
+            0.0368261598, 0.00329433242, 0.0024465546, 0.000649061752,
+            -0.00010004358, -1.79319522e-05, -4.40633312e-06, -1.80493103e-07,
+            17.9615822, 60.7446671, 0.61153394, 0.626324356,
+            -0.105862528, -0.0334149078, 0.000803339819, 0.000179414506,
+            0.000338349433, 4.51017295e-05, -1.10753217e-05, -2.54504266e-06,
+            -0.00148915488, -7.28838568e-05, 0.000148362247, 9.11504612e-05,
+            -1.77873644e-05, -6.15564522e-06,
+        },
+        /* 2473986.5 */ {
+            10.5079718, -17.0993843, -3.69358373, 0.879360259,
+            0.0512809567, -0.0136396624, 0.00390469562, 8.51811783e-05,
+            -0.000215586813, 2.7864151e-05, 3.17044874e-06, -2.71885278e-06,
+            -217.576981, 61.0126495, -1.52096987, 0.286999762,
+            0.186739519, -0.0232887082, -0.0042893705, 0.00176943175,
+            -0.000286770985, -7.29560779e-05, 2.96995713e-05, -2.60275328e-06,
+            -0.000947942492, 0.000144114398, -0.000255088322, 2.99629501e-05,
+            3.0927742e-05, -2.02516662e-06,
+        },
+        /* 2474114.5 */ {
+            -16.3263817, -0.462900609, 6.81681252, 0.0641010478,
+            -0.270004362, -0.00539775053, 0.0123608224, 0.00044040443,
+            -0.000828966207, -3.88823937e-05, 6.07591974e-05, 3.97196891e-06,
+            -91.2560577, 67.5094147, 0.232867017, -0.999659598,
+            -0.0245013535, 0.0887157843, 0.00262866262, -0.00658273138,
+            -0.000281817076, 0.000542545109, 2.97980005e-05, -5.16430846e-05,
+            -0.000486159319, 0.000625062967, 8.60141336e-06, -0.000109431385,
+            -9.92210744e-07, 7.38550716e-06,
+        },
+        /* 2474242.5 */ {
+            10.1146965, 17.5619392, -3.68724632, -0.910683215,
+            0.0626177937, 0.0141130881, 0.0036116594, -0.000113738912,
+            -0.000226980133, -2.51600504e-05, 4.00490126e-06, 2.78486323e-06,
+            36.2489891, 61.6117821, 1.35551608, 0.283811867,
+            -0.188937783, -0.023691332, 0.00483369408, 0.00175519648,
+            0.000277783402, -7.8687015e-05, -3.04374225e-05, -2.12896407e-06,
+            -1.5141236e-05, 0.00012840853, 0.000250885991, 3.63966647e-05,
+            -3.03252873e-05, -2.45948922e-06,
+        },
+        /* 2474370.5 */ {
+            5.77629662, -20.4017048, -2.07443309, 0.978320181,
+            0.0284093954, -0.00177230977, 0.00275557954, -0.000611532421,
+            -8.50623765e-05, 1.67209346e-05, -4.96415942e-06, 1.5450884e-07,
+            -199.488739, 59.9566498, -0.768395543, 0.62997824,
+            0.107728027, -0.0310431346, -0.000234689476, 0.000178248854,
+            -0.000340102531, 4.11798428e-05, 8.83133816e-06, -2.59805915e-06,
+            0.000546006486, -4.70475024e-05, -0.000160982236, 8.72423334e-05,
+            1.94058539e-05, -5.89196316e-06,
+        },
+        /* 2474498.5 */ {
+            -15.5675039, 6.83049774, 6.45031071, -0.50969708,
+            -0.234127656, 0.0305897854, 0.00790809281, -0.00249413447,
+            -0.000325016881, 0.000200291004, 6.97290989e-06, -1.69036211e-05,
+            -72.2230377, 67.0902481, -1.21500814, -0.818010569,
+            0.191201225, 0.0615583509, -0.0179191157, -0.00296951039,
+            0.00164765515, 9.03278706e-05, -0.000146848353, 7.03535807e-06,
+            0.00104253681, 0.000551570032, -0.000154238805, -8.94589539e-05,
+            1.85422305e-05, 6.03708713e-06,
+        },
+        /* 2474626.5 */ {
+            13.8832188, 12.6049557, -5.06576586, -0.697732866,
+            0.115467004, 0.0222163536, 0.000911952346, -0.00118639169,
+            -0.000201204573, 4.21156437e-05, 1.70726817e-05, 3.73049687e-07,
+            54.527935, 62.8578072, 1.43127894, -0.175672084,
+            -0.213831499, 0.00560982013, 0.0117249833, 0.00140563771,
+            -0.000464764278, -0.000180579707, 6.41605766e-06, 1.38493533e-05,
+            0.00147056137, 0.000350513496, 0.000252484984, -3.30090916e-05,
+            -3.06649818e-05, 2.22619656e-06,
+        },
+        /* 2474754.5 */ {
+            0.441972643, -21.7316761, -0.291112691, 1.04754543,
+            0.0289529767, 0.00247422257, -0.000384169107, -0.000903698325,
+            -4.56718408e-05, 1.60599222e-06, 8.59550084e-07, 1.54078145e-06,
+            -181.372879, 59.8568153, 0.399887651, 0.769594371,
+            0.0119398516, -0.0339988917, -0.00152937009, -0.00071800896,
+            -2.41972321e-05, 7.6414457e-05, 5.79957623e-06, 1.19375341e-06,
+            0.00197040057, -0.000147376923, -2.25408917e-06, 0.000109417677,
+            7.8170558e-08, -7.3887586e-06,
+        },
+        /* 2474882.5 */ {
+            -13.1808472, 13.3372679, 5.25320435, -0.933372378,
+            -0.130962312, 0.041198805, -0.00190634537, -0.0020904073,
+            0.000445797225, 6.44310712e-05, -4.02916703e-05, 3.2080095e-06,
+            -53.2198563, 65.5732727, -2.13594747, -0.296145141,
+            0.280094087, -0.00145687093, -0.0175005533, 0.00298521947,
+            0.000696837786, -0.000366354623, 7.92447736e-06, 2.90332209e-05,
+            0.00244428567, 0.000326530106, -0.000255297578, -3.35113982e-05,
+            3.06177681e-05, 2.2601057e-06,
+        },
+        /* 2475010.5 */ {
+            16.2457008, 6.41746092, -5.96158123, -0.364793032,
+            0.170643851, 0.0161547679, -0.00433849031, -0.00127207569,
+            0.000183003678, 9.06488931e-05, -5.12819634e-06, -6.68217172e-06,
+            72.8079681, 63.8451614, 0.825684249, -0.569613516,
+            -0.138544872, 0.0456202403, 0.0107835783, -0.0019434758,
+            -0.000858926564, 6.48493151e-05, 6.78194119e-05, 7.90761078e-07,
+            0.00279531023, 0.000499364629, 0.000152136286, -8.91476011e-05,
+            -1.86694106e-05, 6.01662214e-06,
+        },
+        /* 2475138.5 */ {
+            -4.91565323, -20.9130554, 1.6004169, 1.10557783,
+            0.0235690624, -0.00571966637, -0.00426065363, -0.000955227879,
+            3.89935922e-05, 3.59994629e-05, 1.04597366e-05, 1.13171166e-06,
+            -163.104584, 60.9342537, 1.58658969, 0.662846565,
+            -0.099582091, -0.0416998863, -0.00272439444, 0.000271124387,
+            0.000452806213, 9.85325314e-05, -2.74763352e-06, -4.93067682e-06,
+            0.00316480896, -0.000124230981, 0.000156880269, 8.75702535e-05,
+            -1.92809584e-05, -5.91359094e-06,
+        },
+        /* 2475266.5 */ {
+            -9.37248898, 18.3088036, 3.50366712, -1.13221228,
+            -0.0322202183, 0.0265699849, -0.00625523599, -2.96452854e-05,
+            0.000372806186, -7.18767915e-05, -3.75758577e-06, 5.79882635e-06,
+            -34.3285408, 63.5164948, -2.19794679, 0.275193483,
+            0.221575797, -0.0404632129, -0.00451592775, 0.00299651967,
+            -0.000584793102, -8.60063737e-05, 6.12299555e-05, -9.82681468e-06,
+            0.00354944589, 2.98756495e-05, -0.000254273909, 3.59077349e-05,
+            3.03770503e-05, -2.42594069e-06,
+        },
+        /* 2475394.5 */ {
+            17.0034676, -0.381751388, -6.22729111, 0.0476384945,
+            0.18898347, -0.0032904523, -0.00660786591, 0.000219941969,
+            0.000408725871, -1.67026828e-05, -2.60089964e-05, 1.46002776e-06,
+            91.07444, 64.1037674, -0.187568858, -0.70428288,
+            0.0166738369, 0.0620399527, -0.00154038437, -0.00381525536,
+            0.000141495242, 0.00026887827, -1.2835937e-05, -2.17643919e-05,
+            0.00379652367, 0.000501780887, -1.01230507e-05, -0.000109434579,
+            8.36448805e-07, 7.38691324e-06,
+        },
+        /* 2475522.5 */ {
+            -9.70352364, -17.9175606, 3.50949168, 1.09858966,
+            -0.0219433326, -0.0249312464, -0.00653957343, -7.05202619e-05,
+            0.000352595962, 7.52120322e-05, -1.77353093e-06, -5.4711204e-06,
+            -144.590469, 62.9256935, 2.34196424, 0.288698792,
+            -0.218645707, -0.0401075706, 0.00382947479, 0.00293389335,
+            0.000602068962, -7.3964984e-05, -5.89525407e-05, -1.04405181e-05,
+            0.00398993026, -2.74091349e-06, 0.000252108206, 3.04902696e-05,
+            -3.08845301e-05, -2.05976357e-06,
+        },
+        /* 2475650.5 */ {
+            -4.51242447, 21.2400284, 1.52408516, -1.15635478,
+            0.0189520232, 0.0079736989, -0.00418795878, 0.00095183088,
+            5.7125133e-05, -3.92174516e-05, 1.00770967e-05, -1.02868569e-06,
+            -15.6304188, 61.6812172, -1.46728814, 0.650827527,
+            0.0987195447, -0.0439625867, 0.00233146129, 0.000345694716,
+            -0.00045852724, 0.000101862985, 4.93730431e-06, -5.35245726e-06,
+            0.0042206659, -0.000237166329, -0.000151847998, 9.08772781e-05,
+            1.79171529e-05, -6.13603333e-06,
+        },
+        /* 2475778.5 */ {
+            16.0982628, -7.11207867, -5.81957436, 0.442814738,
+            0.154973894, -0.0204391871, -0.00304792821, 0.00143439334,
+            7.71647756e-05, -9.26022258e-05, 3.23840027e-06, 5.96046539e-06,
+            109.30999, 63.4851456, -1.15439057, -0.507964194,
+            0.16095534, 0.0378597379, -0.0120602651, -0.00112027151,
+            0.000895326375, -1.22310967e-05, -6.37364574e-05, 7.7807681e-06,
+            0.00434041535, 0.000336673576, -0.000169258012, -8.57059276e-05,
+            2.00062459e-05, 5.78569143e-06,
+        },
+        /* 2475906.5 */ {
+            -13.4115381, -12.9370251, 5.22368288, 0.925462782,
+            -0.118561424, -0.0413196087, -0.00262106839, 0.00199211994,
+            0.000470470666, -5.17291082e-05, -3.99449927e-05, -4.15687418e-06,
+            -125.833687, 65.1686249, 2.30471325, -0.279317588,
+            -0.279285073, -0.00328195048, 0.0169590302, 0.00312867784,
+            -0.000630825059, -0.000364729174, -1.43178067e-05, 2.73608748e-05,
+            0.00434083026, 0.000146391409, 0.00024492832, -3.88590342e-05,
+            -3.00649117e-05, 2.62269873e-06,
+        },
+        /* 2476034.5 */ {
+            0.878517568, 21.9149094, -0.453821391, -1.1005224,
+            0.0315165408, 0.00015938314, -0.000240092617, 0.000935299904,
+            -4.9760296e-05, -6.79641516e-06, 4.61480198e-07, -1.59505248e-06,
+            2.85472393, 60.7134094, -0.316914588, 0.746140003,
+            -0.0204384103, -0.0369705409, 0.00152584666, -0.00059382047,
+            5.28956261e-05, 8.43582093e-05, -6.52340441e-06, 6.51612368e-07,
+            0.00436981861, -0.000390409405, 1.06257712e-05, 0.0001092893,
+            -1.74984473e-06, -7.37791561e-06,
+        },
+        /* 2476162.5 */ {
+            13.6046629, -13.111124, -4.82722044, 0.733787179,
+            0.0936069041, -0.0221073721, 0.00208930345, 0.000983329373,
+            -0.000240644833, -2.01209641e-05, 1.62154556e-05, -1.90022092e-06,
+            -232.503922, 62.2035065, -1.6430254, -0.0869280398,
+            0.214257866, -0.00198759139, -0.0103598488, 0.0018102444,
+            0.000279961852, -0.00018033263, 9.16157933e-06, 1.06247535e-05,
+            0.00434251409, 4.61612108e-05, -0.000261367473, -2.75026541e-05,
+            3.11286385e-05, 1.85705483e-06,
+        },
+        /* 2476290.5 */ {
+            -15.6797771, -6.44314194, 6.42396021, 0.524887025,
+            -0.225751221, -0.0332169756, 0.00720767863, 0.00260676956,
+            -0.000265954062, -0.000202915791, 1.86702368e-06, 1.65711881e-05,
+            -106.91021, 66.8911743, 1.40500188, -0.805841029,
+            -0.195930138, 0.0594369434, 0.0182949193, -0.00268473453,
+            -0.00166541629, 5.97332e-05, 0.000145437589, 1.03855009e-05,
+            0.00416132808, 0.000238168795, 0.000138160642, -9.25782806e-05,
+            -1.71514548e-05, 6.25033317e-06,
+        },
+        /* 2476418.5 */ {
+            6.19821119, 20.3635502, -2.31019425, -1.01513052,
+            0.0393848494, 0.00486775069, 0.00286292308, 0.00055434095,
+            -0.000118581745, -2.19861176e-05, -4.23482652e-06, 2.94079371e-07,
+            21.191906, 60.8470535, 0.781592071, 0.579501629,
+            -0.122667909, -0.0325616971, 0.00107099896, 0.000461015443,
+            0.000370787544, 3.1287469e-05, -1.42910867e-05, -3.40171437e-06,
+            0.00397146307, -0.000393577851, 0.000167770224, 8.37412008e-05,
+            -2.07130961e-05, -5.65215532e-06,
+        },
+        /* 2476546.5 */ {
+            9.7376585, -17.8099098, -3.4222753, 0.901259065,
+            0.0447750948, -0.0113607012, 0.0039284667, -8.13606894e-05,
+            -0.000190864623, 3.01038053e-05, 4.8070433e-07, -2.23293773e-06,
+            -214.380905, 60.7766647, -1.4321754, 0.359427541,
+            0.175050125, -0.0258162897, -0.00314291054, 0.00153347303,
+            -0.00034391848, -4.46971935e-05, 2.70516484e-05, -3.86419788e-06,
+            0.00378575735, -0.000278267136, -0.000249377714, 4.1766576e-05,
+            2.97295355e-05, -2.8185566e-06,
+        },
+        /* 2476674.5 */ {
+            -16.3120937, 0.841749787, 6.81778002, -0.0404861122,
+            -0.27076447, 0.00165307638, 0.0124327876, -0.00019103341,
+            -0.000836197694, 1.95469565e-05, 6.15321187e-05, -2.13723547e-06,
+            -87.9023972, 67.5257797, -0.0346974321, -1.00039411,
+            0.0170737561, 0.0889044926, -0.00169558288, -0.00661440846,
+            0.000177471273, 0.000546883093, -1.89869443e-05, -5.22913178e-05,
+            0.00345698977, 0.00021065661, -2.51823876e-05, -0.000109054832,
+            2.66161214e-06, 7.36380252e-06,
+        },
+        /* 2476802.5 */ {
+            10.8652458, 16.7975044, -3.95727515, -0.881115556,
+            0.0703375489, 0.0161211509, 0.0034388341, -0.000303921552,
+            -0.000244757102, -1.92095449e-05, 7.05476259e-06, 3.06767492e-06,
+            39.4733505, 61.8259468, 1.42042112, 0.206760168,
+            -0.198996708, -0.0201242883, 0.00608512899, 0.00191960309,
+            0.000189896469, -0.000108398519, -3.05540088e-05, -8.52504556e-09,
+            0.00306982757, -0.000269714976, 0.000256482133, 2.45127321e-05,
+            -3.13448581e-05, -1.65287804e-06,
+        },
+        /* 2476930.5 */ {
+            4.86265516, -20.7806015, -1.76914787, 0.990965426,
+            0.0273972563, -0.000268024509, 0.00229973393, -0.000680178695,
+            -7.13054324e-05, 1.20517834e-05, -4.67955488e-06, 5.08530491e-07,
+            -196.298828, 59.8550339, -0.58264792, 0.670642495,
+            0.0915924609, -0.0313940197, -0.000159423827, -7.83459764e-05,
+            -0.000299611536, 4.97975452e-05, 6.41895713e-06, -1.6345416e-06,
+            0.0027304485, -0.000529398967, -0.000137961979, 9.42414263e-05,
+            1.63718487e-05, -6.36029745e-06,
+        },
+        /* 2477058.5 */ {
+            -15.2580519, 8.05524349, 6.29221773, -0.598716378,
+            -0.218895406, 0.0347264111, 0.00619950006, -0.00268806703,
+            -0.000153824847, 0.000200386537, -8.61451736e-06, -1.49713896e-05,
+            -68.8728104, 66.8899384, -1.42776, -0.743366897,
+            0.218468383, 0.0511396043, -0.0195636842, -0.00172469416,
+            0.0016775392, -4.43990684e-05, -0.000135915223, 2.09442896e-05,
+            0.00230221846, 5.29769059e-05, -0.000179209164, -8.16573884e-05,
+            2.1404383e-05, 5.51505991e-06,
+        },
+        /* 2477186.5 */ {
+            14.4056034, 11.5849895, -5.26293659, -0.647399008,
+            0.126190409, 0.02237124, 4.5268378e-05, -0.00131793553,
+            -0.000154856622, 5.81894237e-05, 1.6311511e-05, -1.09989708e-06,
+            57.7506447, 63.0690994, 1.36822283, -0.256030858,
+            -0.208283707, 0.012702506, 0.0124394288, 0.000971887435,
+            -0.000611944124, -0.000165284611, 2.11117913e-05, 1.52878329e-05,
+            0.00177640107, -8.89479998e-05, 0.000241298854, -4.45691512e-05,
+            -2.9368457e-05, 3.01137788e-06,
+        },
+        /* 2477314.5 */ {
+            -0.517334282, -21.7403889, 0.0358086526, 1.05867934,
+            0.0294312853, 0.00199991371, -0.00104483473, -0.000937170058,
+            -4.1592717e-05, 3.51717176e-06, 2.64088544e-06, 1.67145629e-06,
+            -178.169403, 59.9594383, 0.619851947, 0.769417524,
+            -0.00632376829, -0.0350427069, -0.00196891115, -0.000700543518,
+            5.03836272e-05, 8.25080133e-05, 6.55445047e-06, 1.03673199e-06,
+            0.00131116621, -0.00062461081, 2.83178397e-05, 0.000108816494,
+            -3.57119734e-06, -7.34358719e-06,
+        },
+        /* 2477442.5 */ {
+            -12.6025982, 14.3381405, 4.97511911, -0.984200954,
+            -0.111406468, 0.0399209373, -0.00323621975, -0.0017384981,
+            0.000490984472, 2.71148183e-05, -3.67114772e-05, 5.82487792e-06,
+            -49.8857574, 65.230545, -2.2105279, -0.190578833,
+            0.278651595, -0.0111753605, -0.0154669117, 0.00344340526,
+            0.000389347319, -0.000349708542, 3.44235814e-05, 2.10953986e-05,
+            0.000836940017, -0.000187688056, -0.000261679379, -2.14041283e-05,
+            3.15373254e-05, 1.44773924e-06,
+        },
+        /* 2477570.5 */ {
+            16.495121, 5.24434662, -6.05593681, -0.295388252,
+            0.177490562, 0.0133703128, -0.00512382388, -0.00109670742,
+            0.000257260457, 8.20968125e-05, -1.16037736e-05, -6.51592791e-06,
+            76.0270157, 63.9527893, 0.66393739, -0.616266191,
+            -0.114945196, 0.051214423, 0.00922953431, -0.00255708606,
+            -0.000771058141, 0.000128277854, 6.45331384e-05, -5.69020403e-06,
+            0.000256740372, 6.21306463e-05, 0.000128634609, -9.5714553e-05,
+            -1.55786383e-05, 6.4645069e-06,
+        },
+        /* 2477698.5 */ {
+            -5.81455564, -20.536478, 1.93858206, 1.11121166,
+            0.0192783587, -0.00848513842, -0.00488837436, -0.00089650997,
+            7.76993547e-05, 4.64055811e-05, 1.10052915e-05, 5.04733521e-07,
+            -159.866089, 61.2300911, 1.76262951, 0.616017699,
+            -0.120906547, -0.0428395942, -0.00230442127, 0.00066988758,
+            0.000533434853, 9.02191314e-05, -9.74767227e-06, -7.07257641e-06,
+            -0.000281138928, -0.000536938198, 0.000182904056, 7.96305394e-05,
+            -2.20776346e-05, -5.37303731e-06,
+        },
+        /* 2477826.5 */ {
+            -8.57925892, 18.9783573, 3.16393065, -1.14619362,
+            -0.0195242614, 0.0229821224, -0.00622936478, 0.000248723605,
+            0.00031029465, -7.3883275e-05, 1.84257226e-06, 4.32257139e-06,
+            -31.0258598, 63.1582756, -2.11772752, 0.359541029,
+            0.201890171, -0.0430662669, -0.002585368, 0.00254053343,
+            -0.000646567787, -2.99613093e-05, 5.16661348e-05, -1.1546329e-05,
+            -0.000749385916, -0.000423175836, -0.000239075132, 4.7469126e-05,
+            2.89843356e-05, -3.20198023e-06,
+        },
+        /* 2477954.5 */ {
+            16.9610977, -1.59032714, -6.20232105, 0.121604405,
+            0.186516345, -0.00702264067, -0.00635854015, 0.000525164651,
+            0.000384006824, -4.07145853e-05, -2.35961234e-05, 3.53785049e-06,
+            94.2868805, 64.0564957, -0.375757873, -0.692611396,
+            0.0458938181, 0.0604704544, -0.00401940057, -0.00362483598,
+            0.000362642546, 0.00024706783, -3.26915142e-05, -1.91355703e-05,
+            -0.00129231613, 0.000116907009, -3.58360339e-05, -0.000108349268,
+            4.47782213e-06, 7.31743057e-06,
+        },
+        /* 2478082.5 */ {
+            -10.4446249, -17.1726913, 3.83196068, 1.08270586,
+            -0.0355830602, -0.0286156796, -0.00641735317, 0.000238637222,
+            0.000412931317, 6.89394146e-05, -8.37816515e-06, -6.81419078e-06,
+            -141.309509, 63.3207397, 2.39922071, 0.198396161,
+            -0.236187086, -0.0366697721, 0.00598317804, 0.00332651357,
+            0.000497914793, -0.000135000068, -6.59681173e-05, -7.22958839e-06,
+            -0.00182922173, -0.000304613204, 0.000263977272, 1.84238852e-05,
+            -3.17034755e-05, -1.2413434e-06,
+        },
+        /* 2478210.5 */ {
+            -3.58626962, 21.5213013, 1.17204773, -1.15000594,
+            0.023052793, 0.00564957317, -0.00351674552, 0.000993396738,
+            2.42431233e-05, -2.98895975e-05, 8.96391157e-06, -1.4857028e-06,
+            -12.3678341, 61.4386711, -1.2815882, 0.687753856,
+            0.0766059682, -0.0427769683, 0.00254115951, 1.05058343e-05,
+            -0.000367070461, 0.000105756968, -4.09855005e-07, -3.37862934e-06,
+            -0.0022449391, -0.000558812986, -0.000120123703, 9.72580383e-05,
+            1.47723995e-05, -6.56365364e-06,
+        },
+        /* 2478338.5 */ {
+            15.7684689, -8.23668766, -5.6821909, 0.503182411,
+            0.144932285, -0.0219915248, -0.00207142322, 0.00147034007,
+            -1.34355093e-06, -8.72236196e-05, 8.74137004e-06, 4.79076698e-06,
+            112.513245, 63.2953606, -1.28538787, -0.444732845,
+            0.178065494, 0.0308439471, -0.0126510793, -0.000446980586,
+            0.00086520263, -6.99120137e-05, -5.48681091e-05, 1.20655468e-05,
+            -0.00267112511, 5.62108035e-05, -0.000185591867, -7.73911306e-05,
+            2.27331711e-05, 5.22695927e-06,
+        },
+        /* 2478466.5 */ {
+            -13.920784, -11.8865604, 5.48014736, 0.871541083,
+            -0.138502106, -0.0421501771, -0.00113683497, 0.00231308397,
+            0.00040288319, -9.06317218e-05, -4.13062698e-05, -8.23635901e-07,
+            -122.519333, 65.5259399, 2.20509195, -0.383232921,
+            -0.276514083, 0.00709133968, 0.0186775308, 0.00248756004,
+            -0.000936259108, -0.000358978723, 1.67355938e-05, 3.37326019e-05,
+            -0.00312521937, -1.53460733e-05, 0.000239281726, -5.01840877e-05,
+            -2.85768383e-05, 3.38958921e-06,
+        },
+        /* 2478594.5 */ {
+            1.8355099, 21.7985039, -0.790907383, -1.08753109,
+            0.0322271958, 0.000184521705, 0.000410133158, 0.000890819938,
+            -5.76216989e-05, -7.00470309e-06, -1.16562558e-06, -1.38854818e-06,
+            6.08431387, 60.6622276, -0.10696844, 0.734438419,
+            -0.0395555831, -0.0360740237, 0.00119382795, -0.00052472495,
+            0.000127974112, 7.75218796e-05, -6.41056522e-06, 3.63149553e-07,
+            -0.00344868726, -0.000531492231, 4.76714085e-05, 0.000107934007,
+            -5.38166478e-06, -7.28503619e-06,
+        },
+        /* 2478722.5 */ {
+            13.0149822, -14.0443325, -4.60421705, 0.771484077,
+            0.0831099451, -0.020804489, 0.00271880161, 0.000792923791,
+            -0.000254295213, -5.12815586e-06, 1.41684141e-05, -2.6740056e-06,
+            -229.312408, 61.9436951, -1.65910459, -0.00452785008,
+            0.212891281, -0.00785057433, -0.00913102459, 0.00198969129,
+            0.000127111634, -0.000168177765, 1.90654482e-05, 7.38907192e-06,
+            -0.00370581192, -8.43006856e-05, -0.000260065164, -1.52945668e-05,
+            3.1844098e-05, 1.03394916e-06,
+        },
+        /* 2478850.5 */ {
+            -15.9121008, -5.19750452, 6.55700541, 0.433743507,
+            -0.239975542, -0.0285449289, 0.00881815795, 0.00232881075,
+            -0.000433107693, -0.000192302134, 1.80960906e-05, 1.7231243e-05,
+            -103.576813, 67.0900192, 1.1774745, -0.870561659,
+            -0.1651344, 0.0688520819, 0.0160453878, -0.00387341296,
+            -0.00154560735, 0.000197003174, 0.000145282058, -5.41286727e-06,
+            -0.0040035164, 0.000228298493, 0.000119059478, -9.85978259e-05,
+            -1.39553813e-05, 6.65703965e-06,
+        },
+        /* 2478978.5 */ {
+            7.08048248, 19.8748455, -2.61784077, -0.996684015,
+            0.0427057296, 0.00664767902, 0.00320223928, 0.000444398058,
+            -0.000140045944, -2.55282666e-05, -3.51396511e-06, 8.24702738e-07,
+            24.4062099, 60.9752045, 0.936494112, 0.526589513,
+            -0.138732821, -0.0314809382, 0.0015298872, 0.000758476905,
+            0.000388380431, 1.41644268e-05, -1.81213672e-05, -4.03661306e-06,
+            -0.00420214562, -0.000336040161, 0.000197098765, 7.52005944e-05,
+            -2.33709143e-05, -5.07599361e-06,
+        },
+        /* 2479106.5 */ {
+            8.94094181, -18.4667168, -3.14559364, 0.920770228,
+            0.0393667147, -0.00909710303, 0.00384265441, -0.000228522578,
+            -0.000164958226, 2.99253188e-05, -1.70713849e-06, -1.68143799e-06,
+            -211.20018, 60.5578499, -1.32401884, 0.427163333,
+            0.162191153, -0.0277241003, -0.00216347375, 0.00125980773,
+            -0.000377275253, -1.93604246e-05, 2.32693365e-05, -4.4385738e-06,
+            -0.00427138666, -0.000229783851, -0.000229043944, 5.29594909e-05,
+            2.81457524e-05, -3.57494605e-06,
+        },
+        /* 2479234.5 */ {
+            -16.2489643, 2.13890457, 6.79157782, -0.14437066,
+            -0.268429399, 0.00860893354, 0.012110346, -0.000808120938,
+            -0.000796383363, 7.59408576e-05, 5.68934847e-05, -7.93220715e-06,
+            -84.5608597, 67.5040512, -0.299749166, -0.986924946,
+            0.0580760166, 0.0868342221, -0.00592192542, -0.00632294361,
+            0.000620740058, 0.00050752284, -6.53884199e-05, -4.66395322e-05,
+            -0.00436343905, 0.000348556583, -4.81063871e-05, -0.000107345768,
+            6.27943427e-06, 7.24668962e-06,
+        },
+        /* 2479362.5 */ {
+            11.5807505, 15.9890318, -4.21681213, -0.848742247,
+            0.0788792148, 0.0179734342, 0.00313707814, -0.000502437004,
+            -0.000255739054, -1.03706971e-05, 1.01641335e-05, 3.10864061e-06,
+            42.6864738, 62.0475273, 1.46397161, 0.12711522,
+            -0.207048088, -0.0158761032, 0.00739944912, 0.00200474542,
+            7.83674841e-05, -0.000136439063, -2.81353787e-05, 2.73588853e-06,
+            -0.00441269577, -2.91872257e-05, 0.000268239935, 1.22218316e-05,
+            -3.19592509e-05, -8.2514282e-07,
+        },
+        /* 2479490.5 */ {
+            3.93738627, -21.1018085, -1.46100855, 1.00327861,
+            0.0270404872, 0.000950902875, 0.00179838168, -0.000738901901,
+            -6.13839075e-05, 7.83833639e-06, -4.01975058e-06, 8.00599139e-07,
+            -193.117584, 59.7859497, -0.38682884, 0.704863727,
+            0.0752332285, -0.0317288041, -0.000247059274, -0.000299958483,
+            -0.000251693709, 5.64349466e-05, 4.95492259e-06, -7.07277934e-07,
+            -0.00430563698, -0.000298471423, -0.000104856779, 9.99126423e-05,
+            1.3125883e-05, -6.74579906e-06,
+        },
+        /* 2479618.5 */ {
+            -14.9041023, 9.25014687, 6.11194611, -0.68211174,
+            -0.202022046, 0.0379221626, 0.00440118043, -0.00275884778,
+            1.27180247e-05, 0.000186977719, -2.20369238e-05, -1.16907468e-05,
+            -65.5321426, 66.6600876, -1.62125635, -0.659900665,
+            0.241070047, 0.040008083, -0.0204351228, -0.000489440048,
+            0.00160290301, -0.000164330238, -0.000113568887, 3.1003492e-05,
+            -0.00417793076, 0.000321343308, -0.00019486346, -7.29126696e-05,
+            2.3988101e-05, 4.92134586e-06,
+        },
+        /* 2479746.5 */ {
+            14.8863268, 10.5359774, -5.44551229, -0.593603015,
+            0.136812493, 0.022032043, -0.000885860412, -0.00140889199,
+            -9.61424084e-05, 7.26807048e-05, 1.40725933e-05, -2.69461816e-06,
+            60.9668045, 63.2695503, 1.28556716, -0.333213598,
+            -0.19952859, 0.0200272463, 0.0128370561, 0.000441791461,
+            -0.000738636474, -0.000136267612, 3.60382546e-05, 1.52649936e-05,
+            -0.00406404445, 0.000290632539, 0.000232546081, -5.56726882e-05,
+            -2.76920491e-05, 3.75760101e-06,
+        },
+        /* 2479874.5 */ {
+            -1.47277212, -21.6895332, 0.3651914, 1.06986225,
+            0.0295640528, 0.00113071874, -0.00172394083, -0.000965244777,
+            -3.49150578e-05, 7.22710229e-06, 4.5138504e-06, 1.75886635e-06,
+            -174.965485, 60.098259, 0.83784461, 0.761949778,
+            -0.0250945296, -0.0362988859, -0.00236965204, -0.000621070154,
+            0.000130140252, 8.88883369e-05, 6.87138572e-06, 5.091199e-07,
+            -0.00381279015, -0.00023737154, 6.25653993e-05, 0.000106674524,
+            -7.17375906e-06, -7.20315256e-06,
+        },
+        /* 2480002.5 */ {
+            -11.9865484, 15.2919779, 4.68395376, -1.02826166,
+            -0.0925003737, 0.0379546359, -0.00433697877, -0.00135985774,
+            0.000506417826, -6.10418238e-06, -3.08485978e-05, 7.40233145e-06,
+            -46.5583458, 64.8766479, -2.25849032, -0.0855366737,
+            0.272987872, -0.0197924897, -0.0131807653, 0.00368299102,
+            0.000100899968, -0.000311119307, 5.36261614e-05, 1.24853259e-05,
+            -0.0034888417, 0.000182979362, -0.000262199785, -9.15319924e-06,
+            3.20472936e-05, 6.16389912e-07,
+        },
+        /* 2480130.5 */ {
+            16.6996479, 4.05816317, -6.13230133, -0.224009991,
+            0.183035061, 0.0102071883, -0.00577948941, -0.000871345925,
+            0.00032175245, 6.78118377e-05, -1.75358837e-05, -5.67913685e-06,
+            79.2446136, 64.0377579, 0.492116749, -0.654249907,
+            -0.0891823396, 0.0558696091, 0.00732410932, -0.0030867653,
+            -0.000634154363, 0.000185692887, 5.53983155e-05, -1.19957085e-05,
+            -0.00321322773, 0.000519799651, 0.00010430978, -0.000101176105,
+            -1.22858219e-05, 6.82882819e-06,
+        },
+        /* 2480258.5 */ {
+            -6.69480801, -20.1000977, 2.27745342, 1.11487305,
+            0.0135826515, -0.0115810735, -0.00545743015, -0.0008036457,
+            0.000125140868, 5.6754041e-05, 1.06798861e-05, -3.82020829e-07,
+            -156.618973, 61.5517273, 1.9237721, 0.561225593,
+            -0.142499223, -0.043611303, -0.00159715151, 0.00112193322,
+            0.000601530948, 7.40129835e-05, -1.87465375e-05, -9.17270245e-06,
+            -0.00285849324, -4.67360587e-05, 0.000205767443, 7.05217099e-05,
+            -2.45877e-05, -4.76302921e-06,
+        },
+        /* 2480386.5 */ {
+            -7.75803995, 19.5900135, 2.81970191, -1.15576077,
+            -0.00844253786, 0.0194249116, -0.00602764729, 0.000481159717,
+            0.000247057178, -7.10675595e-05, 6.03877879e-06, 2.83020404e-06,
+            -27.7264633, 62.8115883, -2.01512885, 0.436994642,
+            0.180950105, -0.0446540602, -0.000948342378, 0.00204559625,
+            -0.000663402723, 1.68924871e-05, 4.05009814e-05, -1.17097779e-05,
+            -0.00239312113, 1.23972122e-05, -0.000223182462, 5.82817775e-05,
+            2.72152938e-05, -3.93650862e-06,
+        },
+        /* 2480514.5 */ {
+            16.8726521, -2.7954402, -6.15863323, 0.194616631,
+            0.182462156, -0.0105812605, -0.00592244836, 0.000806474709,
+            0.000340587838, -6.17300684e-05, -1.94070253e-05, 5.22337814e-06,
+            97.5031662, 63.9839134, -0.560321629, -0.670961857,
+            0.0742314383, 0.0576225333, -0.00633962033, -0.00328257098,
+            0.000559783308, 0.000208270532, -4.93662701e-05, -1.45597951e-05,
+            -0.00197705207, 0.000588020368, -6.50794609e-05, -0.000105988031,
+            8.06222397e-06, 7.1531631e-06,
+        },
+        /* 2480642.5 */ {
+            -11.1543789, -16.3720207, 4.14900541, 1.06143916,
+            -0.0508599989, -0.032139685, -0.00607428234, 0.000587401621,
+            0.000463957316, 5.58953725e-05, -1.59204519e-05, -7.77295008e-06,
+            -138.015015, 63.7206917, 2.43148088, 0.102586091,
+            -0.251632452, -0.0319781639, 0.00833505113, 0.00361275952,
+            0.000340733619, -0.000199553993, -6.82718164e-05, -2.07129369e-06,
+            -0.00155907578, 0.000216932851, 0.000266914081, 5.99359601e-06,
+            -3.21111511e-05, -4.0695582e-07,
+        },
+        /* 2480770.5 */ {
+            -2.64554358, 21.739624, 0.820454121, -1.14215195,
+            0.0261281468, 0.00371182943, -0.00281743077, 0.00101101981,
+            -1.14641136e-06, -2.17504967e-05, 7.38880954e-06, -1.74342188e-06,
+            -9.10328484, 61.2256165, -1.08537185, 0.716351807,
+            0.0548874214, -0.0414789058, 0.0025430494, -0.000254461367,
+            -0.000272503996, 0.000105050785, -3.89731804e-06, -1.72829016e-06,
+            -0.00102559628, -0.000103607905, -9.37745208e-05, 0.000102263824,
+            1.14358518e-05, -6.90597608e-06,
+        },
+        /* 2480898.5 */ {
+            15.3933573, -9.34109497, -5.5285306, 0.560270667,
+            0.13425225, -0.023015745, -0.00108097412, 0.00144998438,
+            -7.41729746e-05, -7.71276173e-05, 1.30718718e-05, 3.3030235e-06,
+            115.724899, 63.087429, -1.40045416, -0.375434399,
+            0.192096129, 0.0235507227, -0.012824988, 0.000194756401,
+            0.00079012441, -0.000118171178, -4.24109021e-05, 1.46858256e-05,
+            -0.000512731262, 0.000483759708, -0.000207784105, -6.817549e-05,
+            2.51670663e-05, 4.60020374e-06,
+        },
+        /* 2481026.5 */ {
+            -14.3888035, -10.7915411, 5.7212286, 0.810371697,
+            -0.158574924, -0.0421013646, 0.00052715349, 0.00256890943,
+            0.000303259323, -0.000128799918, -3.90219939e-05, 3.25118663e-06,
+            -119.189201, 65.8652573, 2.07941365, -0.484829098,
+            -0.268867016, 0.0181992315, 0.0198984612, 0.00163378788,
+            -0.00122045469, -0.000322482811, 5.13332852e-05, 3.70432681e-05,
+            -6.78638535e-05, 0.000460971525, 0.000221082126, -6.09553936e-05,
+            -2.67176802e-05, 4.11278461e-06,
+        },
+        /* 2481154.5 */ {
+            2.79089975, 21.6181545, -1.12555468, -1.07405365,
+            0.0330311283, 0.000589017931, 0.00102852331, 0.000838486012,
+            -6.62197344e-05, -8.70275835e-06, -2.53927351e-06, -1.13378314e-06,
+            9.32272148, 60.6457367, 0.0996767282, 0.715077698,
+            -0.0582977273, -0.0353159308, 0.000925272296, -0.000397153548,
+            0.000196708512, 7.03658297e-05, -6.69824885e-06, -2.17063757e-07,
+            0.000457115355, -0.000107684122, 7.36199581e-05, 0.000105099534,
+            -8.94380719e-06, -7.09754067e-06,
+        },
+        /* 2481282.5 */ {
+            12.3839531, -14.9410667, -4.36920404, 0.805696905,
+            0.0731917545, -0.0191613641, 0.00322465831, 0.000593536068,
+            -0.00025587235, 7.76294655e-06, 1.14174773e-05, -3.08946869e-06,
+            -226.109085, 61.6816025, -1.65330958, 0.0778199956,
+            0.208844855, -0.0130688259, -0.0077982652, 0.00205816119,
+            -1.42378531e-05, -0.000147584928, 2.59392436e-05, 4.07430161e-06,
+            0.00100270309, 0.000256775384, -0.000266768038, -2.94996562e-06,
+            3.21483894e-05, 1.96916304e-07,
+        },
+        /* 2481410.5 */ {
+            -16.0961361, -3.92657876, 6.66520548, 0.33766377,
+            -0.251923025, -0.0230472647, 0.0102121001, 0.00193347933,
+            -0.000584932044, -0.00016673161, 3.38469763e-05, 1.59514893e-05,
+            -100.226585, 67.2543335, 0.934851706, -0.923787951,
+            -0.130455658, 0.0768583044, 0.0130874151, -0.0049329265,
+            -0.00131622236, 0.000327177811, 0.000130482236, -2.18843161e-05,
+            0.00143995427, 0.000592046708, 8.63282548e-05, -0.000103395556,
+            -1.05767649e-05, 6.97801806e-06,
+        },
+        /* 2481538.5 */ {
+            7.94415855, 19.3246975, -2.92070794, -0.97653687,
+            0.0469378904, 0.00860477705, 0.00345617207, 0.000316131365,
+            -0.000163958161, -2.80262848e-05, -2.19782828e-06, 1.39870394e-06,
+            27.635067, 61.1286163, 1.07588983, 0.467340648,
+            -0.154081896, -0.0300490037, 0.00219187723, 0.0010614933,
+            0.000388223707, -6.84224869e-06, -2.22656108e-05, -4.30309456e-06,
+            0.00188985316, 3.57987392e-06, 0.000211281353, 6.56477569e-05,
+            -2.57260399e-05, -4.43404861e-06,
+        },
+        /* 2481666.5 */ {
+            8.11184883, -19.0722523, -2.86070657, 0.938363194,
+            0.0349704288, -0.00688614743, 0.00365694123, -0.000357197452,
+            -0.000139459269, 2.78020543e-05, -3.3484348e-06, -1.11695965e-06,
+            -208.004761, 60.3568649, -1.19632638, 0.49032104,
+            0.148241267, -0.0291174352, -0.00136376708, 0.000962484512,
+            -0.000389433699, 2.44318471e-06, 1.8948178e-05, -4.43088175e-06,
+            0.00239138328, -2.94414644e-06, -0.000218690446, 6.34518146e-05,
+            2.61981204e-05, -4.28553949e-06,
+        },
+        /* 2481794.5 */ {
+            -16.1334629, 3.4357636, 6.73654509, -0.247477576,
+            -0.262950271, 0.0153245237, 0.0113995858, -0.00138329493,
+            -0.000711721194, 0.00012601132, 4.72894899e-05, -1.27264238e-05,
+            -81.202652, 67.442627, -0.560973763, -0.958958268,
+            0.097917065, 0.0825204924, -0.00989450421, -0.00572141353,
+            0.00101822207, 0.000427792082, -0.000104666033, -3.54540934e-05,
+            0.00278387126, 0.000553050078, -8.35231622e-05, -0.000104254395,
+            9.81875473e-06, 7.03616297e-06,
+        },
+        /* 2481922.5 */ {
+            12.2620344, 15.1267776, -4.4665122, -0.812654138,
+            0.0882570371, 0.0196016673, 0.00269616605, -0.000704798731,
+            -0.000257335807, 1.39232748e-06, 1.30660073e-05, 2.83441705e-06,
+            45.9163818, 62.2751007, 1.48480618, 0.044848375,
+            -0.212738782, -0.0108694611, 0.00872808415, 0.0019923998,
+            -5.53704194e-05, -0.000160299998, -2.26643115e-05, 5.94251196e-06,
+            0.00311053474, 0.000178044429, 0.000263465976, -2.21238849e-07,
+            -3.21600564e-05, 1.32330218e-08,
+        },
+        /* 2482050.5 */ {
+            2.99461603, -21.3593063, -1.14675355, 1.01521599,
+            0.0271817148, 0.00185807655, 0.00125094375, -0.000790139602,
+            -5.46575211e-05, 4.40981421e-06, -3.02744593e-06, 1.04469677e-06,
+            -189.918503, 59.7508469, -0.180659175, 0.732283413,
+            0.0584464036, -0.0321189612, -0.0004750347, -0.000481211959,
+            -0.000196959139, 6.19385974e-05, 4.37192784e-06, 1.07791514e-07,
+            0.00349127688, -0.000201200121, -8.3242754e-05, 0.000104321516,
+            9.70976635e-06, -7.0442311e-06,
+        },
+        /* 2482178.5 */ {
+            -14.4978485, 10.4165344, 5.90655518, -0.759577572,
+            -0.183672845, 0.0401182063, 0.0025721807, -0.00270808325,
+            0.00016531827, 0.000161960445, -3.22425221e-05, -7.55757037e-06,
+            -62.177269, 66.398941, -1.79313481, -0.567976177,
+            0.258626372, 0.0284389071, -0.0205266271, 0.000673974515,
+            0.00143422489, -0.000260707166, -8.28827106e-05, 3.63552244e-05,
+            0.00379655953, 0.000346658257, -0.000220479807, -6.31843504e-05,
+            2.62646026e-05, 4.26393581e-06,
+        },
+        /* 2482306.5 */ {
+            15.3203821, 9.44785118, -5.61127996, -0.535532475,
+            0.147122592, 0.0211338513, -0.00186033419, -0.00144900789,
+            -2.6229387e-05, 8.41640212e-05, 1.02900103e-05, -4.25040434e-06,
+            64.1984558, 63.4554291, 1.18190098, -0.40628919,
+            -0.187198266, 0.027442215, 0.0128458394, -0.000171493331,
+            -0.000833197089, -9.34247946e-05, 4.97228175e-05, 1.34711054e-05,
+            0.0039728228, 0.00032998118, 0.000208878031, -6.60092919e-05,
+            -2.56574403e-05, 4.45538035e-06,
+        },
+        /* 2482434.5 */ {
+            -2.42609978, -21.5662003, 0.698927164, 1.08040524,
+            0.0291108508, -0.00016500472, -0.00241854112, -0.000983852427,
+            -2.38186531e-05, 1.28304946e-05, 6.40258168e-06, 1.77178447e-06,
+            -171.741409, 60.2745094, 1.05251122, 0.746109605,
+            -0.0445580184, -0.0377062857, -0.0026833294, -0.000472605403,
+            0.000215117339, 9.47506123e-05, 6.29935312e-06, -4.35275211e-07,
+            0.0041711987, -0.000276102219, 8.48187192e-05, 0.000103222039,
+            -1.068444e-05, -6.96953339e-06,
+        },
+        /* 2482562.5 */ {
+            -11.3243923, 16.1917324, 4.37700462, -1.06522167,
+            -0.0744430274, 0.035368178, -0.0051867296, -0.000971924339,
+            0.000494615349, -3.34196666e-05, -2.35368734e-05, 7.95249343e-06,
+            -43.2219505, 64.512207, -2.27729869, 0.0179665107,
+            0.263171852, -0.0271684397, -0.0107481983, 0.00371120777,
+            -0.000152654495, -0.000256385276, 6.4829037e-05, 4.30266118e-06,
+            0.00434412062, 3.59877595e-05, -0.000269688171, 3.29711315e-06,
+            3.21454681e-05, -2.23390359e-07,
+        },
+        /* 2482690.5 */ {
+            16.849493, 2.85426617, -6.1863122, -0.150523856,
+            0.186957777, 0.0067024678, -0.00626731198, -0.000601139851,
+            0.000371492264, 4.82638461e-05, -2.23054194e-05, -4.19619028e-06,
+            82.4740143, 64.0943527, 0.310650468, -0.682025611,
+            -0.0614184402, 0.0593388006, 0.00510230334, -0.00349454442,
+            -0.00045254032, 0.000231606842, 4.07295156e-05, -1.73080807e-05,
+            0.00436172588, 0.000376617274, 6.92749672e-05, -0.00010524947,
+            -8.83363555e-06, 7.10538143e-06,
+        },
+        /* 2482818.5 */ {
+            -7.55196953, -19.589283, 2.61593556, 1.11521816,
+            0.00624802848, -0.0149725107, -0.0059340545, -0.000667985121,
+            0.000180771676, 6.59422585e-05, 9.18439673e-06, -1.53900407e-06,
+            -153.353104, 61.897541, 2.06636238, 0.497550637,
+            -0.164030865, -0.0437792763, -0.000561215857, 0.0016134032,
+            0.000647936948, 4.78916081e-05, -2.94045585e-05, -1.08873855e-05,
+            0.0043447325, -0.000220611371, 0.000217732391, 6.0598657e-05,
+            -2.67811247e-05, -4.09138602e-06,
+        },
+        /* 2482946.5 */ {
+            -6.90444088, 20.1299839, 2.46967459, -1.16065156,
+            0.000986345462, 0.0159846395, -0.00566641195, 0.000665663392,
+            0.000186528792, -6.45316904e-05, 8.76629929e-06, 1.46128434e-06,
+            -24.4244232, 62.480114, -1.88930011, 0.506347954,
+            0.158956274, -0.0453082249, 0.000364235631, 0.00154037052,
+            -0.000640823622, 5.3187774e-05, 2.90838743e-05, -1.06723837e-05,
+            0.00434605964, -0.00027818745, -0.000211469596, 6.84514889e-05,
+            2.50959565e-05, -4.62078697e-06,
+        },
+        /* 2483074.5 */ {
+            16.7269115, -3.99288702, -6.09165478, 0.265997678,
+            0.176684245, -0.0138495909, -0.00530311, 0.00104888272,
+            0.000280362554, -7.80425835e-05, -1.37899597e-05, 6.31737612e-06,
+            100.725967, 63.8809662, -0.738197803, -0.638451159,
+            0.101028576, 0.0534779504, -0.00839572214, -0.002799968,
+            0.000718352734, 0.00015527918, -6.11155847e-05, -8.58099429e-06,
+            0.00421139318, 0.000274245744, -9.92605128e-05, -0.000102153164,
+            1.1543877e-05, 6.89713534e-06,
+        },
+        /* 2483202.5 */ {
+            -11.8230238, -15.5058479, 4.45600891, 1.03335822,
+            -0.06766738, -0.0353311263, -0.00547599886, 0.000965072599,
+            0.000498558395, 3.53356772e-05, -2.37836775e-05, -8.06665048e-06,
+            -134.707855, 64.119751, 2.43482733, 0.00204513455,
+            -0.26404345, -0.0258965362, 0.0107873278, 0.00374464528,
+            0.000129474385, -0.000261699839, -6.39541395e-05, 4.91859601e-06,
+            0.00398233114, -8.2393155e-05, 0.000262005749, -6.40024746e-06,
+            -3.21053049e-05, 4.32645862e-07,
+        },
+        /* 2483330.5 */ {
+            -1.69262671, 21.8792267, 0.469916731, -1.13242888,
+            0.0283101164, 0.00220241863, -0.00210395572, 0.00100787741,
+            -1.99142305e-05, -1.52324192e-05, 5.53465043e-06, -1.83708562e-06,
+            -5.84085274, 61.046154, -0.880565584, 0.73556143,
+            0.0336373746, -0.0401368812, 0.0023762628, -0.000442975026,
+            -0.000178279588, 0.000101104451, -5.79491825e-06, -4.98696409e-07,
+            0.00379108381, -0.000494876935, -6.92247122e-05, 0.000106074294,
+            7.95175129e-06, -7.15955457e-06,
+        },
+        /* 2483458.5 */ {
+            14.9646149, -10.4128017, -5.3558383, 0.613099813,
+            0.123087794, -0.0234566703, -0.000114507668, 0.00137449871,
+            -0.000137088733, -6.33048767e-05, 1.59003685e-05, 1.68511019e-06,
+            118.936714, 62.8601418, -1.49540472, -0.300678045,
+            0.202550113, 0.0161935557, -0.0125759142, 0.000769499864,
+            0.000676462427, -0.000153504865, -2.78081625e-05, 1.54700465e-05,
+            0.00352128618, 3.89703746e-05, -0.000228873934, -5.79620319e-05,
+            2.72779816e-05, 3.91445656e-06,
+        },
+        /* 2483586.5 */ {
+            -14.8038111, -9.65212631, 5.94029951, 0.74157995,
+            -0.178170502, -0.0410353616, 0.00231509516, 0.00273143291,
+            0.000173692984, -0.000162189652, -3.26137379e-05, 7.63154821e-06,
+            -115.854866, 66.1785126, 1.92689514, -0.581445932,
+            -0.255784482, 0.0296723917, 0.0204595681, 0.000593693228,
+            -0.001453612, -0.000253114384, 8.56605839e-05, 3.60355807e-05,
+            0.00311923609, 5.85398484e-05, 0.00019993262, -7.08210719e-05,
+            -2.45149931e-05, 4.78279753e-06,
+        },
+        /* 2483714.5 */ {
+            3.73576808, 21.3619061, -1.45505762, -1.05946612,
+            0.0341096483, 0.00136456173, 0.00160131953, 0.000776333152,
+            -7.66555459e-05, -1.16026768e-05, -3.57197609e-06, -8.24944323e-07,
+            12.5562696, 60.664505, 0.298863083, 0.687457085,
+            -0.0765129849, -0.0346205905, 0.000764118973, -0.000215481356,
+            0.000257386389, 6.22876105e-05, -7.65911955e-06, -1.01349303e-06,
+            0.00274402811, -0.00055033766, 9.99734766e-05, 0.000101035046,
+            -1.23911714e-05, -6.81857591e-06,
+        },
+        /* 2483842.5 */ {
+            11.7097063, -15.7848635, -4.12213469, 0.835773945,
+            0.0640780032, -0.017230263, 0.00359014142, 0.000394435803,
+            -0.000246651121, 1.78198607e-05, 8.29265446e-06, -3.16029491e-06,
+            -222.911865, 61.4208641, -1.62315476, 0.158527076,
+            0.202152327, -0.0175171327, -0.00643218122, 0.00201907614,
+            -0.000136114424, -0.000121184865, 2.95820555e-05, 1.06803543e-06,
+            0.00236503268, -0.000256680651, -0.000267244934, 9.55108044e-06,
+            3.20395775e-05, -6.42705572e-07,
+        },
+        /* 2483970.5 */ {
+            -16.22229, -2.64105582, 6.74307251, 0.237941697,
+            -0.260993451, -0.0168720391, 0.0112984907, 0.00143633957,
+            -0.000707687577, -0.000127351348, 4.72098181e-05, 1.27200674e-05,
+            -96.880188, 67.3777847, 0.680859506, -0.963120401,
+            -0.0926802754, 0.0829662383, 0.00952807162, -0.00577410916,
+            -0.000988116371, 0.000435487163, 0.000101554819, -3.65268679e-05,
+            0.00185601681, 0.000124994229, 5.66996168e-05, -0.00010674732,
+            -7.06318178e-06, 7.20905837e-06,
+        },
+        /* 2484098.5 */ {
+            8.77705193, 18.7096901, -3.21434689, -0.954015613,
+            0.0521151088, 0.0106611224, 0.00360435247, 0.000169087129,
+            -0.000188667531, -2.88095016e-05, -2.83824193e-07, 1.97252575e-06,
+            30.8563061, 61.3027191, 1.19560051, 0.40227136,
+            -0.168235481, -0.0281341802, 0.00304869842, 0.00135000248,
+            0.000366293592, -3.15325924e-05, -2.61489331e-05, -4.0314967e-06,
+            0.0013403073, -0.000440881966, 0.000228316174, 5.53629106e-05,
+            -2.77501786e-05, -3.73489797e-06,
+        },
+        /* 2484226.5 */ {
+            7.25606346, -19.6121559, -2.56981969, 0.953835309,
+            0.0316404551, -0.00480649015, 0.00337967556, -0.000465940684,
+            -0.000116087089, 2.42336719e-05, -4.39723271e-06, -5.87625209e-07,
+            -204.819458, 60.1794815, -1.05007231, 0.547442973,
+            0.133454472, -0.0300534256, -0.000769805862, 0.000659301935,
+            -0.000382510421, 2.00701816e-05, 1.46700131e-05, -3.96330051e-06,
+            0.00088682893, -0.000510278973, -0.000198658323, 7.3231291e-05,
+            2.39135261e-05, -4.94118558e-06,
+        },
+        /* 2484354.5 */ {
+            -15.9617252, 4.71514225, 6.65118027, -0.347680092,
+            -0.254396588, 0.0215272401, 0.010333254, -0.00187947706,
+            -0.000589016243, 0.000165003948, 3.38708414e-05, -1.58741186e-05,
+            -77.8550034, 67.340416, -0.81244117, -0.916692078,
+            0.135226175, 0.0761137307, -0.0133860921, -0.00485208351,
+            0.00133535825, 0.000316359481, -0.000132090368, -2.05035449e-05,
+            0.000349224341, 7.60831317e-05, -0.00010977326, -9.97252573e-05,
+            1.32299874e-05, 6.73530121e-06,
+        },
+        /* 2484482.5 */ {
+            12.8983784, 14.2175245, -4.70157623, -0.772741675,
+            0.098206073, 0.0208995566, 0.00212121848, -0.000899879378,
+            -0.00024708276, 1.55316884e-05, 1.5371279e-05, 2.19879826e-06,
+            49.1348572, 62.5014038, 1.48162329, -0.0381550044,
+            -0.215573832, -0.00517560774, 0.00998071861, 0.00186751352,
+            -0.000204360476, -0.000176575748, -1.40178017e-05, 9.24610049e-06,
+            -0.000232812716, -0.000222166884, 0.000264503207, -1.2569526e-05,
+            -3.19470855e-05, 8.51297614e-07,
+        },
+        /* 2484610.5 */ {
+            2.04547358, -21.5460701, -0.829879105, 1.02668726,
+            0.027682228, 0.00240956829, 0.000667958113, -0.000835037907,
+            -5.03935298e-05, 2.13332783e-06, -1.76151946e-06, 1.24969665e-06,
+            -186.730087, 59.752903, 0.0319549777, 0.752135873,
+            0.0413879491, -0.0326257832, -0.000812202576, -0.000613640645,
+            -0.000136769304, 6.69785077e-05, 4.53093799e-06, 7.29336818e-07,
+            -0.000716695155, -0.000628768001, -5.0360155e-05, 0.00010746473,
+            6.16868101e-06, -7.25208884e-06,
+        },
+        /* 2484738.5 */ {
+            -14.0427246, 11.5377808, 5.67911053, -0.829736888,
+            -0.164458588, 0.0412819311, 0.000805817894, -0.00254821009,
+            0.000293713441, 0.000128818516, -3.84742452e-05, -3.21771358e-06,
+            -58.8387604, 66.1113129, -1.93958271, -0.470170736,
+            0.270757526, 0.0169522036, -0.0198899694, 0.00169033022,
+            0.00119395507, -0.000326321431, -4.83513541e-05, 3.6860667e-05,
+            -0.00120813737, -7.46817532e-05, -0.00023216776, -5.25786127e-05,
+            2.82012679e-05, 3.55212796e-06,
+        },
+        /* 2484866.5 */ {
+            15.702589, 8.33508301, -5.75732183, -0.474092871,
+            0.15672861, 0.0196833871, -0.0028295524, -0.00143143977,
+            5.06599972e-05, 9.11552925e-05, 5.19970081e-06, -5.54878943e-06,
+            67.4150085, 63.6214066, 1.06004024, -0.473190635,
+            -0.171502471, 0.034631215, 0.0124279037, -0.000831043464,
+            -0.000884327688, -3.94924355e-05, 6.03431508e-05, 9.89769705e-06,
+            -0.00176510832, 1.45376825e-05, 0.000194340246, -7.54362773e-05,
+            -2.32933671e-05, 5.09530537e-06,
+        },
+        /* 2484994.5 */ {
+            -3.36535168, -21.3733253, 1.03302634, 1.09007251,
+            0.0278909151, -0.00187396514, -0.00311178458, -0.000988946529,
+            -6.88224554e-06, 2.01779949e-05, 8.16704323e-06, 1.67294286e-06,
+            -168.526489, 60.4858818, 1.25922072, 0.721990943,
+            -0.0645125434, -0.039186798, -0.00285952003, -0.000254797575,
+            0.000303002016, 9.89486216e-05, 4.42057399e-06, -1.79262452e-06,
+            -0.00222676061, -0.000564865593, 0.000118362106, 9.84813887e-05,
+            -1.4057292e-05, -6.64606068e-06,
+        },
+        /* 2485122.5 */ {
+            -10.6257591, 17.0282745, 4.05991459, -1.09518409,
+            -0.0576790385, 0.0323372111, -0.00577743351, -0.000598101469,
+            0.000461236545, -5.35574327e-05, -1.5807831e-05, 7.63462867e-06,
+            -39.906559, 64.1449432, -2.26796961, 0.117464945,
+            0.249939263, -0.0331756026, -0.00832786039, 0.00355803315,
+            -0.000357231736, -0.000193554981, 6.84252809e-05, -2.49076425e-06,
+            -0.00261369953, -0.000264118513, -0.000260887318, 1.57272261e-05,
+            3.18283601e-05, -1.05983452e-06,
+        },
+        /* 2485250.5 */ {
+            16.9468689, 1.64898384, -6.21865892, -0.0764457062,
+            0.189167276, 0.00300680008, -0.00656326115, -0.000302712142,
+            0.000402603793, 2.51431284e-05, -2.53724829e-05, -2.24317296e-06,
+            85.686348, 64.1226349, 0.124583408, -0.699184239,
+            -0.0325775966, 0.0614877455, 0.00268384768, -0.00375186256,
+            -0.000240785506, 0.000261314184, 2.21009923e-05, -2.08566198e-05,
+            -0.00305632944, 0.000179439201, 4.64072109e-05, -0.000107949709,
+            -5.26974509e-06, 7.28983787e-06,
+        },
+        /* 2485378.5 */ {
+            -8.37827873, -19.0161533, 2.95045114, 1.11209178,
+            -0.00271101436, -0.0185588431, -0.00628897361, -0.000487372425,
+            0.000242230744, 7.27180013e-05, 6.35254355e-06, -2.91152583e-06,
+            -150.095566, 62.2613068, 2.18789291, 0.426251769,
+            -0.185018316, -0.0431987606, 0.000798001944, 0.00211800635,
+            0.000664358668, 1.1364793e-05, -4.08543347e-05, -1.18131629e-05,
+            -0.00343839196, -0.000336039695, 0.000239986257, 4.98936934e-05,
+            -2.86288796e-05, -3.36688504e-06,
+        },
+        /* 2485506.5 */ {
+            -6.03060818, 20.6002121, 2.11915994, -1.16182995,
+            0.00878538284, 0.0127784032, -0.00518676359, 0.000804332842,
+            0.00013218791, -5.57996245e-05, 1.01451633e-05, 3.20626981e-07,
+            -21.1449986, 62.1694298, -1.74485278, 0.567030787,
+            0.136630848, -0.0452392995, 0.00134410663, 0.00105882343,
+            -0.000589026546, 7.88445686e-05, 1.86816742e-05, -8.9133373e-06,
+            -0.00368532701, -0.00040508018, -0.000184049102, 7.77145906e-05,
+            2.2652488e-05, -5.24529469e-06,
+        },
+        /* 2485634.5 */ {
+            16.5326004, -5.17108202, -6.00554705, 0.334682196,
+            0.16952832, -0.0167213157, -0.0045435084, 0.00124118093,
+            0.000208876329, -8.86157941e-05, -7.42502834e-06, 6.73239083e-06,
+            103.931892, 63.753109, -0.905728579, -0.596744418,
+            0.125624627, 0.0483083948, -0.0101037081, -0.0022185361,
+            0.000828781223, 9.40673563e-05, -6.70354639e-05, -2.09328005e-06,
+            -0.00394585822, 0.000219720547, -0.000119479017, -9.70328474e-05,
+            1.48736635e-05, 6.55196209e-06,
+        },
+        /* 2485762.5 */ {
+            -12.4500608, -14.5911398, 4.75127316, 0.998974383,
+            -0.0856587663, -0.0380610861, -0.00462952582, 0.00135381147,
+            0.000511481659, 7.85930115e-06, -3.11313306e-05, -7.49184119e-06,
+            -131.409348, 64.5126572, 2.41079259, -0.101063207,
+            -0.273041695, -0.018537635, 0.0132153472, 0.00369474362,
+            -0.000126509709, -0.000314667501, -5.21329202e-05, 1.31329343e-05,
+            -0.00419354485, -1.84285327e-05, 0.000265876006, -1.87564365e-05,
+            -3.16848345e-05, 1.26656619e-06,
+        },
+        /* 2485890.5 */ {
+            -0.737262905, 21.9518394, 0.123581469, -1.1217525,
+            0.0298243389, 0.00111637043, -0.0013971742, 0.00099027704,
+            -3.35653203e-05, -1.05684185e-05, 3.59813089e-06, -1.81425617e-06,
+            -2.59790516, 60.9005318, -0.67174083, 0.746324301,
+            0.0130510274, -0.0388768092, 0.00210008165, -0.000557275431,
+            -8.79421787e-05, 9.55132782e-05, -6.55342001e-06, 2.80787333e-07,
+            -0.0042872699, -0.000422773213, -3.23025524e-05, 0.00010844686,
+            4.36488926e-06, -7.32072522e-06,
+        },
+        /* 2486018.5 */ {
+            14.4942942, -11.4494295, -5.16971588, 0.661756575,
+            0.111862853, -0.0233731978, 0.000789179874, 0.00125571655,
+            -0.000187516052, -4.74674489e-05, 1.71955671e-05, 1.4161175e-07,
+            -237.866196, 62.6212769, -1.57032979, -0.222655326,
+            0.209675327, 0.00905148778, -0.0119802682, 0.00125162373,
+            0.000537954911, -0.000174907516, -1.28863576e-05, 1.46444036e-05,
+            -0.00433303602, 0.00013921778, -0.000236363485, -4.70798659e-05,
+            2.90339085e-05, 3.17847207e-06,
+        },
+        /* 2486146.5 */ {
+            -15.1723394, -8.48354053, 6.13887882, 0.666493118,
+            -0.196896836, -0.0389892757, 0.00415238459, 0.00278783333,
+            2.16117387e-05, -0.000187377183, -2.2392438e-05, 1.17567488e-05,
+            -112.528633, 66.4653015, 1.75214267, -0.671581626,
+            -0.237741545, 0.0411093757, 0.0203125719, -0.000574158679,
+            -0.00161372218, -0.000154994996, 0.000115587791, 3.03024572e-05,
+            -0.00440382585, 0.000281928951, 0.000185809957, -7.9857753e-05,
+            -2.19957474e-05, 5.39062148e-06,
+        },
+        /* 2486274.5 */ {
+            4.6666379, 21.046299, -1.77880752, -1.04434752,
+            0.0356076248, 0.00245691021, 0.00212334143, 0.000704558683,
+            -8.97689097e-05, -1.52973225e-05, -4.214211e-06, -4.60369648e-07,
+            15.7770834, 60.7148666, 0.488712192, 0.652942061,
+            -0.0942231342, -0.0339566655, 0.000739492767, 9.59358204e-06,
+            0.000309277966, 5.27981174e-05, -9.44465501e-06, -1.92591756e-06,
+            -0.00434790226, -0.000286971132, 0.000133466936, 9.55591895e-05,
+            -1.56782789e-05, -6.45145155e-06,
+        },
+        /* 2486402.5 */ {
+            11.0033455, -16.582962, -3.86745501, 0.862692654,
+            0.0559071265, -0.0151229752, 0.00382557791, 0.000204163909,
+            -0.000229809943, 2.48899469e-05, 5.14664225e-06, -2.96385269e-06,
+            -219.725098, 61.1675301, -1.57181251, 0.236624032,
+            0.19348079, -0.0212250613, -0.00511098281, 0.00189423992,
+            -0.000234903127, -9.23239495e-05, 3.04396144e-05, -1.36998142e-06,
+            -0.00418529427, -5.49867445e-06, -0.000257115375, 2.18118275e-05,
+            3.15149773e-05, -1.47350465e-06,
+        },
+        /* 2486530.5 */ {
+            -16.3010807, -1.34862316, 6.79510784, 0.135923222,
+            -0.267238408, -0.0102352621, 0.0120455772, 0.000866649323,
+            -0.000793473213, -7.76287779e-05, 5.67970819e-05, 7.93408162e-06,
+            -93.5392151, 67.4647293, 0.419868737, -0.989108562,
+            -0.052879069, 0.0870714784, 0.00555068115, -0.00635147281,
+            -0.000587840972, 0.000511838123, 6.1747407e-05, -4.72633837e-05,
+            -0.00405866513, 0.000469150022, 3.20672298e-05, -0.000108835782,
+            -3.45887929e-06, 7.34632249e-06,
+        },
+        /* 2486658.5 */ {
+            9.58283806, 18.0449715, -3.50036526, -0.929527938,
+            0.0582285859, 0.0127582103, 0.00364549388, 4.61613217e-06,
+            -0.00021273733, -2.74661561e-05, 2.15508612e-06, 2.4981498e-06,
+            34.0721855, 61.494091, 1.29676032, 0.332573116,
+            -0.181190923, -0.0256954711, 0.00407741126, 0.00160916103,
+            0.000321530504, -5.92233482e-05, -2.92252371e-05, -3.12486895e-06,
+            -0.00386653771, -2.69615466e-05, 0.000246607407, 4.4232158e-05,
+            -2.94148958e-05, -2.98719374e-06,
+        },
+        /* 2486786.5 */ {
+            6.37999916, -20.0996037, -2.27462244, 0.968284607,
+            0.0292502753, -0.00290406379, 0.0030313381, -0.000557976076,
+            -9.59838362e-05, 1.98609159e-05, -4.9115024e-06, -1.19057248e-07,
+            -201.637604, 60.0277176, -0.888807297, 0.598982692,
+            0.118174031, -0.0306978822, -0.000374444935, 0.000364977925,
+            -0.000361158018, 3.38690297e-05, 1.08903287e-05, -3.2055168e-06,
+            -0.00353499898, -0.000130825705, -0.000173403721, 8.19266206e-05,
+            2.13190924e-05, -5.53260816e-06,
+        },
+        /* 2486914.5 */ {
+            -15.743989, 5.97900581, 6.54086876, -0.444619864,
+            -0.243261307, 0.0270995256, 0.00898249075, -0.00227877265,
+            -0.000439350668, 0.000190731284, 1.82670483e-05, -1.71374577e-05,
+            -74.5088043, 67.2035217, -1.0526166, -0.862146258,
+            0.169502541, 0.0680065528, -0.0162915476, -0.00378707936,
+            0.00155604945, 0.000185738958, -0.000145740691, -4.07707785e-06,
+            -0.00321932649, 0.000493010506, -0.000133569425, -9.4037714e-05,
+            1.64692483e-05, 6.34684375e-06,
+        },
+        /* 2487042.5 */ {
+            13.4982328, 13.2699232, -4.92516661, -0.729355216,
+            0.108635686, 0.0218391754, 0.00142670958, -0.00108076399,
+            -0.000224149757, 3.13208438e-05, 1.67971612e-05, 1.20826098e-06,
+            52.3542633, 62.7261162, 1.45710731, -0.121211,
+            -0.215637222, 0.00112759322, 0.0111040659, 0.00162914419,
+            -0.000361340324, -0.000183119715, -2.5109332e-06, 1.22626798e-05,
+            -0.00290968409, 0.000277089217, 0.000261503534, -2.48917167e-05,
+            -3.13195524e-05, 1.67865528e-06,
+        },
+        /* 2487170.5 */ {
+            1.09008062, -21.6752586, -0.509301782, 1.03837574,
+            0.0283439085, 0.00260742498, 5.3669959e-05, -0.000876380422,
+            -4.7419202e-05, 1.22258939e-06, -2.72090602e-07, 1.4292624e-06,
+            -183.535736, 59.7908287, 0.249144778, 0.765245795,
+            0.0239673089, -0.0333285555, -0.00122080301, -0.000695748138,
+            -7.15194692e-05, 7.22859768e-05, 5.18357683e-06, 1.10929909e-06,
+            -0.00246873917, -0.000162939468, -1.90498322e-05, 0.000109080022,
+            2.54778297e-06, -7.36612037e-06,
+        },
+        /* 2487298.5 */ {
+            -13.5450039, 12.6230965, 5.43330574, -0.893378317,
+            -0.144808963, 0.0415152498, -0.000845729199, -0.00230125594,
+            0.000393879978, 9.12804244e-05, -4.07910338e-05, 8.08003961e-07,
+            -55.4981537, 65.8020706, -2.06182981, -0.368137509,
+            0.277931631, 0.00585136516, -0.0186516438, 0.00252559455,
+            0.000908278162, -0.000360465492, -1.39929261e-05, 3.3307897e-05,
+            -0.00200293586, 0.000365973741, -0.000244661904, -4.1419542e-05,
+            2.97723236e-05, 2.7941885e-06,
+        },
+        /* 2487426.5 */ {
+            16.0418949, 7.19767523, -5.88713932, -0.40944463,
+            0.165587217, 0.0177162904, -0.00376681704, -0.00135584583,
+            0.00013089909, 9.29051457e-05, -8.51717346e-07, -6.42716896e-06,
+            70.637764, 63.7698021, 0.922221422, -0.533922315,
+            -0.152726635, 0.041460108, 0.011587753, -0.00150773977,
+            -0.000887288537, 2.21370246e-05, 6.66908672e-05, 4.79506753e-06,
+            -0.00159925525, 0.000523265859, 0.000171935331, -8.40106441e-05,
+            -2.06259938e-05, 5.66937933e-06,
+        },
+        /* 2487554.5 */ {
+            -4.29538488, -21.1186523, 1.37020707, 1.09896863,
+            0.0257177129, -0.00398652302, -0.00379899354, -0.000976549403,
+            1.72883483e-05, 2.90778462e-05, 9.6747217e-06, 1.4204337e-06,
+            -165.296646, 60.7301826, 1.45768678, 0.689930379,
+            -0.0851255804, -0.0406756774, -0.00285729649, 3.24537032e-05,
+            0.000392311224, 0.000100180303, 8.63427999e-07, -3.53720156e-06,
+            -0.00111360021, -7.0504444e-05, 0.000143593323, 9.2347087e-05,
+            -1.72481796e-05, -6.236643e-06,
+        },
+        /* 2487682.5 */ {
+            -9.89126778, 17.8125305, 3.7332654, -1.11935353,
+            -0.0422545411, 0.0289962403, -0.00613112701, -0.000250169949,
+            0.000412487891, -6.66426567e-05, -8.39831864e-06, 6.68997245e-06,
+            -36.5866203, 63.7774162, -2.23252058, 0.212692693,
+            0.233940393, -0.0379139744, -0.00601392379, 0.00326273125,
+            -0.000509946665, -0.000128930595, 6.58222052e-05, -7.49142373e-06,
+            -0.00056234916, 0.000155315181, -0.000256819621, 2.78502757e-05,
+            3.10990945e-05, -1.8824818e-06,
+        },
+        /* 2487810.5 */ {
+            16.997097, 0.435451716, -6.2316165, -0.00159804022,
+            0.189727113, -0.000811177481, -0.0066637937, 1.23465379e-05,
+            0.000413712667, -2.18451355e-08, -2.64854552e-05, -2.14642082e-08,
+            88.909256, 64.1249542, -0.0652294457, -0.706153572,
+            -0.00297959847, 0.0623134226, 0.000145199127, -0.00384934107,
+            -1.14053018e-05, 0.000272696372, 1.17920513e-06, -2.22280196e-05,
+            -9.60452599e-05, 0.000626234687, 1.36076251e-05, -0.000109346089,
+            -1.63550658e-06, 7.37971368e-06,
+        },
+        /* 2487938.5 */ {
+            -9.17999744, -18.3804569, 3.28368974, 1.10502636,
+            -0.0134203304, -0.0222887825, -0.00649831723, -0.000258037646,
+            0.000307270733, 7.58608221e-05, 2.05699257e-06, -4.42066357e-06,
+            -146.81778, 62.6414642, 2.28835011, 0.347311139,
+            -0.20531027, -0.0417091101, 0.00248381356, 0.00261357683,
+            0.000642874569, -3.5809695e-05, -5.20735957e-05, -1.15390203e-05,
+            0.000376351469, 0.000120299192, 0.000248755241, 3.8457023e-05,
+            -3.01059899e-05, -2.59857416e-06,
+        },
+        /* 2488066.5 */ {
+            -5.13250351, 21.0073624, 1.76600993, -1.16010118,
+            0.0151520483, 0.00984432083, -0.00461469265, 0.000903530628,
+            8.51606383e-05, -4.60270385e-05, 1.04056226e-05, -5.66195411e-07,
+            -17.8585377, 61.880619, -1.58289647, 0.619533539,
+            0.114110619, -0.0446400978, 0.00201883516, 0.000617669139,
+            -0.000516406144, 9.52415139e-05, 9.89543423e-06, -6.81988058e-06,
+            0.000933161355, -4.60788942e-05, -0.000165517646, 8.5906453e-05,
+            1.99159967e-05, -5.80186133e-06,
+        },
+        /* 2488194.5 */ {
+            16.2892075, -6.33883858, -5.90030909, 0.401075751,
+            0.161105275, -0.0191658009, -0.00366850314, 0.0013789885,
+            0.000130178902, -9.31394825e-05, -8.59575437e-07, 6.47560364e-06,
+            107.151276, 63.6009331, -1.06271935, -0.546219051,
+            0.147891, 0.0422513373, -0.0114314631, -0.00156776723,
+            0.00088751514, 2.94008114e-05, -6.6993256e-05, 4.17012143e-06,
+            0.00141881465, 0.00054974854, -0.000150169944, -9.07074427e-05,
+            1.80130573e-05, 6.12158419e-06,
+        },
+        /* 2488322.5 */ {
+            -13.0390816, -13.6208744, 5.03582382, 0.957479775,
+            -0.104750954, -0.0402152091, -0.0035277342, 0.00173861068,
+            0.000497577363, -2.57876254e-05, -3.71035094e-05, -5.88730109e-06,
+            -128.089645, 64.8980179, 2.35890484, -0.2063362,
+            -0.278160185, -0.00989167206, 0.0155136585, 0.00343555445,
+            -0.000418014999, -0.000351776602, -3.23103413e-05, 2.17654706e-05,
+            0.00183261349, 0.000334838143, 0.0002537494, -3.09133502e-05,
+            -3.08536255e-05, 2.08470146e-06,
+        },
+        /* 2488450.5 */ {
+            0.225995392, 21.9561882, -0.221736103, -1.11019731,
+            0.0308966488, 0.000447876315, -0.000700170232, 0.000961189682,
+            -4.38382594e-05, -7.77878813e-06, 1.68606732e-06, -1.70669955e-06,
+            0.655728996, 60.7895775, -0.45928067, 0.748716354,
+            -0.00709866453, -0.037738461, 0.00176206976, -0.000600379484,
+            -2.03123955e-06, 8.91201707e-05, -6.63365336e-06, 6.29002727e-07,
+            0.00231400691, -0.000158165858, -7.86802502e-06, 0.000109395973,
+            7.21572576e-07, -7.38735298e-06,
+        },
+        /* 2488578.5 */ {
+            13.9766493, -12.4560118, -4.96803045, 0.706602633,
+            0.100651123, -0.0227896795, 0.00161286804, 0.00110071735,
+            -0.000224488133, -3.0799074e-05, 1.70423173e-05, -1.19650781e-06,
+            -234.654755, 62.3703003, -1.62450469, -0.141559437,
+            0.213532031, 0.00222338596, -0.0110840024, 0.00162893499,
+            0.000384015962, -0.000182551172, 1.10953249e-06, 1.25237411e-05,
+            0.00276293932, 0.000320532796, -0.000253898674, -3.55913035e-05,
+            3.04159967e-05, 2.40099325e-06,
+        },
+        /* 2488706.5 */ {
+            -15.4926491, -7.27651691, 6.31538534, 0.58450526,
+            -0.214409545, -0.0359134041, 0.00598150445, 0.00272317603,
+            -0.00014621095, -0.000201152754, -8.84371184e-06, 1.50551932e-05,
+            -109.182899, 66.7229309, 1.5548619, -0.754033089,
+            -0.214544907, 0.0522008874, 0.0193816498, -0.00181966205,
+            -0.00168010138, -3.30417752e-05, 0.000137159223, 1.98488433e-05,
+            0.00308527076, 0.000479762646, 0.00015619566, -8.78587452e-05,
+            -1.91902509e-05, 5.92937931e-06,
+        },
+        /* 2488834.5 */ {
+            5.58634663, 20.6624336, -2.09896803, -1.02807462,
+            0.0377202779, 0.00385229639, 0.00258798129, 0.000619587954,
+            -0.000106203588, -1.93845153e-05, -4.39405221e-06, -2.83275128e-08,
+            19.012001, 60.797184, 0.668051302, 0.610965133,
+            -0.111510895, -0.033213228, 0.000883251952, 0.0002726659,
+            0.000350650138, 4.09245113e-05, -1.21264993e-05, -2.85203214e-06,
+            0.00342358882, -0.000145813756, 0.00015236024, 8.88716313e-05,
+            -1.87631995e-05, -6.00121166e-06,
+        },
+        /* 2488962.5 */ {
+            10.2570305, -17.3327293, -3.60202241, 0.886585832,
+            0.0486805551, -0.0128805004, 0.00393270329, 2.62191115e-05,
+            -0.000207337289, 2.90059634e-05, 2.19719345e-06, -2.56635462e-06,
+            -216.524521, 60.9220428, -1.49790299, 0.311849922,
+            0.182887048, -0.0242213197, -0.00387424184, 0.00169630465,
+            -0.000309097959, -6.30467257e-05, 2.89756226e-05, -3.1221507e-06,
+            0.00377181638, 1.80781972e-05, -0.000256186613, 3.38339014e-05,
+            3.05841459e-05, -2.28547401e-06,
+        },
+        /* 2489090.5 */ {
+            -16.3253841, -0.0436965637, 6.81752443, 0.0317369103,
+            -0.270320177, -0.0032661329, 0.0124047082, 0.000247711025,
+            -0.000834531384, -2.09944465e-05, 6.14291275e-05, 2.10158782e-06,
+            -90.1817932, 67.5109634, 0.153192922, -1.00040376,
+            -0.0115892189, 0.0889132544, 0.00129039143, -0.00661631208,
+            -0.000139959709, 0.000547441363, 1.47478568e-05, -5.23918097e-05,
+            0.00397859607, 0.000481501076, -4.97263409e-06, -0.000109470289,
+            1.92631774e-07, 7.38894869e-06,
+        },
+        /* 2489218.5 */ {
+            10.3589172, 17.3181992, -3.77831578, -0.901991129,
+            0.0653591305, 0.0148331085, 0.00356081687, -0.000177300026,
+            -0.000233922357, -2.34341969e-05, 5.03423598e-06, 2.90552384e-06,
+            37.302681, 61.7009468, 1.37678683, 0.257954895,
+            -0.192571938, -0.022586422, 0.00525870686, 0.00181885029,
+            0.000250724523, -8.88816066e-05, -3.07590853e-05, -1.48132744e-06,
+            0.00413081842, -3.16028454e-05, 0.000250438665, 3.25917863e-05,
+            -3.07005685e-05, -2.20100651e-06,
+        },
+        /* 2489346.5 */ {
+            5.4780879, -20.5238762, -1.97238207, 0.981532574,
+            0.0277178381, -0.00121781498, 0.00261414656, -0.000635169854,
+            -7.95517117e-05, 1.51232225e-05, -4.92567506e-06, 2.81385951e-07,
+            -198.442413, 59.9039917, -0.711714983, 0.644263923,
+            0.102302723, -0.0311262198, -0.000174579065, 8.89665462e-05,
+            -0.000327314163, 4.43205536e-05, 7.86079545e-06, -2.2787608e-06,
+            0.00431753555, -0.00025564112, -0.000156354829, 8.96448837e-05,
+            1.84498167e-05, -6.05267996e-06,
+        },
+        /* 2489474.5 */ {
+            -15.4703531, 7.2247715, 6.40138483, -0.537443936,
+            -0.229551092, 0.031875968, 0.00739079202, -0.00256079831,
+            -0.000272342033, 0.000201350049, 2.04958678e-06, -1.64334742e-05,
+            -71.1509018, 67.0282898, -1.27804244, -0.795044899,
+            0.199919164, 0.0583737567, -0.0184808187, -0.00258523971,
+            0.0016650724, 4.77793074e-05, -0.000144500227, 1.16181245e-05,
+            0.00438996591, 0.00031787873, -0.000165129692, -8.70511431e-05,
+            1.94982495e-05, 5.8763012e-06,
+        },
+        /* 2489602.5 */ {
+            14.0532961, 12.2742472, -5.13381433, -0.681525409,
+            0.119355991, 0.0223197639, 0.000617592363, -0.00123580673,
+            -0.000186833873, 4.77737485e-05, 1.69791056e-05, -1.10561182e-07,
+            55.5851326, 62.9442024, 1.40878081, -0.203337863,
+            -0.212347358, 0.00798428245, 0.0120074423, 0.00126896566,
+            -0.000516757078, -0.00017696312, 1.1329942e-05, 1.44916667e-05,
+            0.00434347382, 0.000115579023, 0.000246750918, -3.68017572e-05,
+            -3.02885965e-05, 2.48464539e-06,
+        },
+        /* 2489730.5 */ {
+            0.128693879, -21.7312965, -0.184022754, 1.04967046,
+            0.0289746914, 0.00240928144, -0.000591377553, -0.000913142227,
+            -4.43336285e-05, 1.93664732e-06, 1.41135126e-06, 1.58158616e-06,
+            -180.328094, 59.8672523, 0.469539553, 0.770413399,
+            0.00602662284, -0.0342283808, -0.00166418729, -0.000719813514,
+            -6.23017399e-07, 7.8039724e-05, 6.02665159e-06, 1.18588491e-06,
+            0.0043257745, -0.000414607057, 5.31887554e-06, 0.000109395172,
+            -1.10602662e-06, -7.38525068e-06,
+        },
+        /* 2489858.5 */ {
+            -12.9962425, 13.6611147, 5.1665082, -0.949548125,
+            -0.125025004, 0.0408158749, -0.00232403725, -0.00198310264,
+            0.000461687741, 5.26581571e-05, -3.93756854e-05, 4.09855375e-06,
+            -52.1528053, 65.4710693, -2.15593648, -0.263103366,
+            0.279855877, -0.00454748515, -0.0168885011, 0.00314260577,
+            0.000600267027, -0.000363074651, 1.67083836e-05, 2.6668853e-05,
+            0.00425009662, 2.98315808e-05, -0.000259929046, -2.96154521e-05,
+            3.0960884e-05, 1.99990495e-06,
+        },
+        /* 2489986.5 */ {
+            16.3266754, 6.0336628, -5.99545527, -0.34145388,
+            0.173294365, 0.0152205769, -0.00462661264, -0.00121775223,
+            0.000209482416, 8.84200126e-05, -7.38432846e-06, -6.70371855e-06,
+            73.866478, 63.8935432, 0.768453896, -0.586509705,
+            -0.130810022, 0.0476286076, 0.010298172, -0.00216135429,
+            -0.000834849314, 8.69008218e-05, 6.73869872e-05, -1.39632573e-06,
+            0.00402196916, 0.000211209088, 0.00014274675, -9.13916738e-05,
+            -1.76928206e-05, 6.170912e-06,
+        },
+        /* 2490114.5 */ {
+            -5.20921755, -20.7875614, 1.70864403, 1.10594773,
+            0.022340009, -0.00650367141, -0.00445786584, -0.000938503828,
+            4.99394082e-05, 3.90967871e-05, 1.06892185e-05, 9.58743271e-07,
+            -162.055176, 61.006794, 1.64389122, 0.648827195,
+            -0.106225923, -0.0420004465, -0.00261928141, 0.000388987653,
+            0.000478237227, 9.635061e-05, -4.70439363e-06, -5.57539533e-06,
+            0.00378841604, -0.000420274708, 0.000163813733, 8.51435761e-05,
+            -2.02171377e-05, -5.7471193e-06,
+        },
+        /* 2490242.5 */ {
+            -9.11802673, 18.5280476, 3.39695501, -1.13721728,
+            -0.0283960775, 0.0254571326, -0.00624925643, 5.94136145e-05,
+            0.000353458978, -7.28194136e-05, -1.91693357e-06, 5.34396622e-06,
+            -33.2701759, 63.4137955, -2.16931391, 0.301852435,
+            0.215460733, -0.0413456447, -0.00390028814, 0.00285660638,
+            -0.000607458409, -6.78547003e-05, 5.84268855e-05, -1.04999535e-05,
+            0.00355988345, -0.000291901582, -0.000251180929, 3.97370459e-05,
+            2.99696785e-05, -2.68098665e-06,
+        },
+        /* 2490370.5 */ {
+            16.9892387, -0.778727889, -6.22047281, 0.0731151029,
+            0.188380584, -0.0046256911, -0.00654714135, 0.00032752793,
+            0.000402611447, -2.52147165e-05, -2.5410227e-05, 2.20648371e-06,
+            92.1317139, 64.0955353, -0.255466282, -0.701556444,
+            0.0266684797, 0.061655093, -0.00239984365, -0.00376885477,
+            0.000219018009, 0.000263548864, -1.98731614e-05, -2.11179376e-05,
+            0.00319059286, 0.000192313484, -1.96399997e-05, -0.000109215376,
+            2.02015804e-06, 7.37495066e-06,
+        },
+        /* 2490498.5 */ {
+            -9.94571018, -17.6748142, 3.6107533, 1.09270215,
+            -0.0259030629, -0.0260317307, -0.0065178019, 2.03514046e-05,
+            0.000371147122, 7.37818409e-05, -3.68654355e-06, -5.89867795e-06,
+            -143.533768, 63.0324516, 2.36315441, 0.261111319,
+            -0.22409831, -0.0390871949, 0.0044671027, 0.00305984239,
+            0.000573747442, -9.21939718e-05, -6.13637822e-05, -9.61087608e-06,
+            0.00276848674, -0.000293912773, 0.000255515071, 2.66481948e-05,
+            -3.11960684e-05, -1.79717335e-06,
+        },
+        /* 2490626.5 */ {
+            -4.21468163, 21.3360004, 1.41230881, -1.15529323,
+            0.0201211609, 0.00726204179, -0.00397318881, 0.000966087915,
+            4.65228368e-05, -3.62244718e-05, 9.75397506e-06, -1.18857326e-06,
+            -14.5822515, 61.6190529, -1.40539861, 0.662563026,
+            0.0916964635, -0.0436280333, 0.00240209955, 0.000235946165,
+            -0.000429919717, 0.000103532606, 3.13207352e-06, -4.71088015e-06,
+            0.0023979831, -0.000540177221, -0.000142224904, 9.31125323e-05,
+            1.69232771e-05, -6.28354746e-06,
+        },
+        /* 2490754.5 */ {
+            15.9905424, -7.48141956, -5.77395105, 0.463877022,
+            0.151550904, -0.0210732035, -0.00271544163, 0.0014542283,
+            4.97530782e-05, -9.13831536e-05, 5.24456482e-06, 5.60879971e-06,
+            110.363708, 63.4232826, -1.20443511, -0.487351835,
+            0.167078048, 0.0355080888, -0.0123103401, -0.000888656592,
+            0.000890686817, -3.27690141e-05, -6.12032381e-05, 9.41752114e-06,
+            0.00194178382, 4.57940405e-05, -0.000174874731, -8.31001307e-05,
+            2.0920701e-05, 5.61245952e-06,
+        },
+        /* 2490882.5 */ {
+            -13.5785418, -12.5986052, 5.30323172, 0.908414662,
+            -0.124456123, -0.0416088402, -0.00218681432, 0.00209257915,
+            0.000452159438, -6.34497119e-05, -4.06088293e-05, -3.21352286e-06,
+            -124.771683, 65.2676392, 2.27768564, -0.311321139,
+            -0.278600127, -0.000139767915, 0.0175072588, 0.00294728228,
+            -0.000724969141, -0.000365087937, -5.19706055e-06, 2.9497447e-05,
+            0.00139469805, -0.000105197018, 0.000243782997, -4.25588441e-05,
+            -2.96264061e-05, 2.87571129e-06,
+        },
+        /* 2491010.5 */ {
+            1.18663752, 21.8835106, -0.562494278, -1.09755194,
+            0.0317041278, 0.000205959586, -2.84811413e-05, 0.000922016567,
+            -5.21971815e-05, -6.84687666e-06, -8.29957898e-08, -1.53400106e-06,
+            3.89595175, 60.7151527, -0.24761951, 0.742281079,
+            -0.0266360622, -0.0367341526, 0.00141312974, -0.000573710771,
+            7.76663946e-05, 8.23558512e-05, -6.46878152e-06, 5.74953219e-07,
+            0.000914595672, -0.000631873321, 2.33888368e-05, 0.000109042994,
+            -2.93060407e-06, -7.35865933e-06,
+        },
+        /* 2491138.5 */ {
+            13.4127398, -13.416338, -4.75210714, 0.746827006,
+            0.0897790492, -0.0217359383, 0.00232253666, 0.000920071441,
+            -0.000246874843, -1.47645269e-05, 1.56232127e-05, -2.20745369e-06,
+            -231.456024, 62.111412, -1.65507817, -0.0592345409,
+            0.214050248, -0.00405426789, -0.00995474029, 0.00188521377,
+            0.000227149867, -0.00017729633, 1.28671263e-05, 9.55594987e-06,
+            0.00042950394, -0.000183841155, -0.000260211702, -2.35487732e-05,
+            3.14060453e-05, 1.59246679e-06,
+        },
+        /* 2491266.5 */ {
+            -15.7573624, -6.04448128, 6.46496916, 0.496796429,
+            -0.230036274, -0.0318550393, 0.00770284934, 0.00253007771,
+            -0.000317347003, -0.00020075553, 6.78231663e-06, 1.69170471e-05,
+            -105.846268, 66.9452515, 1.33841741, -0.826072693,
+            -0.186608449, 0.0623954087, 0.0176480766, -0.00305544329,
+            -0.00163662131, 0.000101904836, 0.000146498583, 5.68071709e-06,
+            -0.000155083253, 5.80399937e-05, 0.000133659763, -9.4637282e-05,
+            -1.61394564e-05, 6.3917787e-06,
+        },
+        /* 2491394.5 */ {
+            6.4827199, 20.2114315, -2.41127801, -1.01035309,
+            0.040546, 0.00549356733, 0.00297839637, 0.0005197805,
+            -0.000125774997, -2.32973543e-05, -4.04064485e-06, 4.66638738e-07,
+            22.232439, 60.9078407, 0.832582235, 0.562088966,
+            -0.128058627, -0.0322847813, 0.00121492497, 0.000560275686,
+            0.000378303026, 2.60141442e-05, -1.55709531e-05, -3.6460699e-06,
+            -0.000689523178, -0.000539365225, 0.000179383409, 8.11213758e-05,
+            -2.16059361e-05, -5.4737543e-06,
+        },
+        /* 2491522.5 */ {
+            9.47887802, -18.02281, -3.32937384, 0.907410383,
+            0.0425631888, -0.0105988961, 0.00391681353, -0.000133339243,
+            -0.000181927709, 3.03471716e-05, -3.27049065e-07, -2.05023935e-06,
+            -213.340012, 60.6910515, -1.40239692, 0.382539868,
+            0.170775816, -0.0265124366, -0.00278290128, 0.0014455847,
+            -0.000357646262, -3.57063618e-05, 2.58544478e-05, -4.13615817e-06,
+            -0.00114962133, -0.00041070304, -0.000240970432, 4.54851361e-05,
+            2.92586046e-05, -3.06800098e-06,
+        },
+        /* 2491650.5 */ {
+            -16.2946358, 1.25592017, 6.80977917, -0.0724246949,
+            -0.270127982, 0.00375100179, 0.0123545239, -0.000380190555,
+            -0.000827112061, 3.70554117e-05, 6.05095338e-05, -3.96107589e-06,
+            -86.8385696, 67.5158768, -0.113170296, -0.996646643,
+            0.0297719799, 0.0883913711, -0.00300759636, -0.00654649781,
+            0.0003160247, 0.000538022898, -3.36331323e-05, -5.10490099e-05,
+            -0.00167925248, 0.000126518382, -3.01963883e-05, -0.000108637862,
+            3.83954648e-06, 7.33662273e-06,
+        },
+        /* 2491778.5 */ {
+            11.0964708, 16.5400677, -4.04441261, -0.871452212,
+            0.0733545721, 0.0167865995, 0.0033446718, -0.000370617723,
+            -0.000249561766, -1.65037382e-05, 8.12556664e-06, 3.11286976e-06,
+            40.5177689, 61.9167099, 1.43427193, 0.180102006,
+            -0.20196031, -0.0187920593, 0.00653388212, 0.00195767102,
+            0.000154740643, -0.000118233707, -3.00636384e-05, 8.61933813e-07,
+            -0.00219524046, -0.000300572428, 0.000263375259, 2.05788674e-05,
+            -3.1590549e-05, -1.38689063e-06,
+        },
+        /* 2491906.5 */ {
+            4.56238031, -20.8826942, -1.66716516, 0.993903279,
+            0.0269602071, 0.000194391163, 0.00214380305, -0.000699640077,
+            -6.71682283e-05, 1.05616764e-05, -4.50905873e-06, 6.11098756e-07,
+            -195.262665, 59.8125839, -0.522740841, 0.682676554,
+            0.0861517265, -0.0314504653, -0.000156773662, -0.000155991918,
+            -0.000284273876, 5.20951871e-05, 5.77033097e-06, -1.31915886e-06,
+            -0.0025850106, -0.000541326997, -0.000124526807, 9.62327031e-05,
+            1.53422789e-05, -6.49441881e-06,
+        },
+        /* 2492034.5 */ {
+            -15.1472454, 8.43770885, 6.23682785, -0.624585986,
+            -0.213850036, 0.0357203558, 0.00565459905, -0.00271652127,
+            -0.000102197861, 0.000197169124, -1.29371665e-05, -1.40517041e-05,
+            -67.8103104, 66.8199844, -1.48450053, -0.71777457,
+            0.225708023, 0.0477340333, -0.0198837649, -0.00134084979,
+            0.001661869, -8.29118289e-05, -0.000129826934, 2.44100429e-05,
+            -0.00298201898, 7.77929235e-05, -0.000181516443, -7.89296173e-05,
+            2.2273829e-05, 5.33024877e-06,
+        },
+        /* 2492162.5 */ {
+            14.5615597, 11.2467508, -5.32592106, -0.630066872,
+            0.130039543, 0.0223073717, -0.000271880534, -0.00135426491,
+            -0.000136197617, 6.34280732e-05, 1.57246177e-05, -1.63866753e-06,
+            58.7998581, 63.1509972, 1.33922827, -0.282582104,
+            -0.205746531, 0.0151611371, 0.0126194628, 0.000801844173,
+            -0.000657956814, -0.000157067334, 2.62315079e-05, 1.54699355e-05,
+            -0.00340115442, -3.62430501e-06, 0.000241926289, -4.82325377e-05,
+            -2.88679184e-05, 3.25801329e-06,
+        },
+        /* 2492290.5 */ {
+            -0.827603459, -21.7216339, 0.142539129, 1.06081283,
+            0.0293927621, 0.00181388343, -0.00125582668, -0.000945033273,
+            -3.9713057e-05, 4.39816586e-06, 3.22012829e-06, 1.70001226e-06,
+            -177.131683, 59.9811401, 0.688738644, 0.767961919,
+            -0.0123063577, -0.0353388824, -0.00209640502, -0.000683169463,
+            7.51821863e-05, 8.42394729e-05, 6.69403335e-06, 9.16751219e-07,
+            -0.00368496613, -0.000512521772, 4.26122861e-05, 0.00010827963,
+            -4.74525723e-06, -7.30865531e-06,
+        },
+        /* 2492418.5 */ {
+            -12.4075403, 14.6462774, 4.88515186, -0.998311758,
+            -0.105707027, 0.0393311791, -0.00358262449, -0.00162265124,
+            0.000497546978, 1.65243182e-05, -3.50395203e-05, 6.39404652e-06,
+            -48.8265648, 65.1263885, -2.22239351, -0.15784809,
+            0.277121156, -0.013919808, -0.0147743691, 0.00353231188,
+            0.00029790969, -0.000339261402, 4.09987479e-05, 1.84390447e-05,
+            -0.00390113471, -5.53026548e-05, -0.000259118766, -1.74648158e-05,
+            3.17481608e-05, 1.17988657e-06,
+        },
+        /* 2492546.5 */ {
+            16.5623207, 4.8584938, -6.08405209, -0.271457106,
+            0.179704964, 0.0123057235, -0.00537030725, -0.00102511444,
+            0.000280851586, 7.78951289e-05, -1.3733702e-05, -6.31082412e-06,
+            77.0797729, 63.9932175, 0.603533387, -0.630327702,
+            -0.106501885, 0.0529227555, 0.00862420723, -0.00274968729,
+            -0.000730203639, 0.000148799474, 6.21209256e-05, -7.89625574e-06,
+            -0.00415507471, 0.000247679825, 0.000123954145, -9.76354131e-05,
+            -1.45330878e-05, 6.59240595e-06,
+        },
+        /* 2492674.5 */ {
+            -6.10122824, -20.3945179, 2.04621172, 1.11113203,
+            0.0176705029, -0.00936810113, -0.00506890845, -0.000870508433,
+            9.11920361e-05, 4.95539098e-05, 1.0994785e-05, 2.5745743e-07,
+            -158.820084, 61.3106689, 1.81543648, 0.59972477,
+            -0.127591372, -0.0430495441, -0.00211668899, 0.000804102106,
+            0.000555492821, 8.58662024e-05, -1.23086447e-05, -7.72479143e-06,
+            -0.00430639042, -0.000318016595, 0.000193477536, 7.67776801e-05,
+            -2.29241105e-05, -5.18315437e-06,
+        },
+        /* 2492802.5 */ {
+            -8.31769848, 19.1804485, 3.05649447, -1.14998865,
+            -0.0162068531, 0.0218854938, -0.00616958411, 0.000323459622,
+            0.000290649652, -7.32762128e-05, 3.24982057e-06, 3.85350222e-06,
+            -29.972641, 63.0603218, -2.08260846, 0.384047061,
+            0.195423096, -0.0436352193, -0.00206150068, 0.00238757208,
+            -0.000654971111, -1.45920831e-05, 4.8278107e-05, -1.17109048e-05,
+            -0.00432852795, -0.000199397648, -0.000231557089, 5.10293721e-05,
+            2.845173e-05, -3.44489854e-06,
+        },
+        /* 2492930.5 */ {
+            16.9338684, -1.98485088, -6.18990278, 0.146728903,
+            0.185383901, -0.00830695219, -0.00623465283, 0.000625919551,
+            0.000371446804, -4.83811127e-05, -2.23695151e-05, 4.17381261e-06,
+            95.3414459, 64.0398788, -0.442492664, -0.686701238,
+            0.0556176901, 0.05966435, -0.00483344262, -0.00352687575,
+            0.000433437788, 0.000235828877, -3.88398948e-05, -1.77903094e-05,
+            -0.0043739723, 0.000373798655, -4.28902022e-05, -0.000107760279,
+            5.64759921e-06, 7.27488623e-06,
+        },
+        /* 2493058.5 */ {
+            -10.6772318, -16.9155293, 3.93142128, 1.07545781,
+            -0.0400085002, -0.0296790842, -0.00633339677, 0.000341412582,
+            0.000429203443, 6.55839467e-05, -1.06030093e-05, -7.14771613e-06,
+            -140.252792, 63.4295769, 2.41324258, 0.169262394,
+            -0.241056278, -0.035296265, 0.00668429025, 0.00342379347,
+            0.000454102963, -0.00015460336, -6.71214802e-05, -5.82340454e-06,
+            -0.00437500561, -1.308229e-05, 0.000267542811, 1.43950829e-05,
+            -3.18819657e-05, -9.72727548e-07,
+        },
+        /* 2493186.5 */ {
+            -3.28497553, 21.600008, 1.06061399, -1.14866662,
+            0.0239186492, 0.00505940523, -0.00329396897, 0.00100038026,
+            1.60325199e-05, -2.72582583e-05, 8.48685249e-06, -1.58146861e-06,
+            -11.3210211, 61.3861961, -1.21679211, 0.697029412,
+            0.069718577, -0.0424157903, 0.00254576537, -7.75403896e-05,
+            -0.000337349775, 0.000105937266, -1.61702792e-06, -2.83157669e-06,
+            -0.00422088383, -0.000272446865, -0.00010979957, 9.89979817e-05,
+            1.37107818e-05, -6.68389248e-06,
+        },
+        /* 2493314.5 */ {
+            15.6484165, -8.59974003, -5.63191795, 0.523174942,
+            0.141282573, -0.0224534962, -0.00173103425, 0.0014712608,
+            -2.72549569e-05, -8.43305679e-05, 1.03919128e-05, 4.31331728e-06,
+            113.567581, 63.2274017, -1.33056283, -0.422179312,
+            0.183209106, 0.0283886213, -0.012763408, -0.000222716684,
+            0.000845070346, -8.76689082e-05, -5.10005775e-05, 1.3171737e-05,
+            -0.00404941291, 0.000348870497, -0.000191416446, -7.45381549e-05,
+            2.35561911e-05, 5.03096089e-06,
+        },
+        /* 2493442.5 */ {
+            -14.0762825, -11.5365067, 5.55561638, 0.852556765,
+            -0.144468904, -0.0421955958, -0.000647484732, 0.00239632581,
+            0.000375119533, -0.000102411053, -4.09395579e-05, 3.66953657e-07,
+            -121.454208, 65.6207657, 2.17064643, -0.414640427,
+            -0.274444491, 0.0104661547, 0.0190900601, 0.00224198913,
+            -0.00102610991, -0.000350448769, 2.71653153e-05, 3.50646042e-05,
+            -0.00389261078, 0.000304933143, 0.000235049316, -5.377856e-05,
+            -2.80153381e-05, 3.62907531e-06,
+        },
+        /* 2493570.5 */ {
+            2.14335918, 21.7498302, -0.899190366, -1.08456695,
+            0.0324640162, 0.000349619484, 0.00061277987, 0.000875433267,
+            -6.03036024e-05, -7.54928169e-06, -1.63719642e-06, -1.31273544e-06,
+            7.1286993, 60.6749611, -0.0386913083, 0.728328049,
+            -0.0456708856, -0.0358932018, 0.00109985482, -0.000485953118,
+            0.000151000131, 7.54756911e-05, -6.47173283e-06, 1.88055395e-07,
+            -0.00360014895, -0.000219663503, 5.71656747e-05, 0.00010714239,
+            -6.54516634e-06, -7.23437779e-06,
+        },
+        /* 2493698.5 */ {
+            12.8115015, -14.3395643, -4.52571487, 0.783399582,
+            0.0794504881, -0.0203150194, 0.00291283964, 0.00072583172,
+            -0.000256364903, -3.87952298e-07, 1.33062513e-05, -2.86132604e-06,
+            -228.260712, 61.8501205, -1.66445208, 0.0232260916,
+            0.211819619, -0.00971227325, -0.00868511386, 0.00202779612,
+            7.732417e-05, -0.000162079814, 2.17935358e-05, 6.25002713e-06,
+            -0.00324001908, 0.00020806097, -0.000261935609, -1.13368305e-05,
+            3.1988915e-05, 7.63424396e-07,
+        },
+        /* 2493826.5 */ {
+            -15.97647, -4.79133129, 6.59147978, 0.404223293,
+            -0.243656263, -0.0269371215, 0.0092564309, 0.00221686135,
+            -0.000480997551, -0.000185680954, 2.30177648e-05, 1.70114181e-05,
+            -102.506844, 67.1352997, 1.10638642, -0.887585878,
+            -0.154635489, 0.0714297071, 0.0151831238, -0.00421247352,
+            -0.00148370105, 0.000238212233, 0.000141992918, -1.05172021e-05,
+            -0.00293162814, 0.000532623497, 0.000108967994, -0.000100323894,
+            -1.28793818e-05, 6.77106436e-06,
+        },
+        /* 2493954.5 */ {
+            7.36058235, 19.7052307, -2.71827006, -0.991458297,
+            0.0441830531, 0.00733500067, 0.00329266046, 0.00040380843,
+            -0.000148244551, -2.65569015e-05, -3.12688667e-06, 1.01627097e-06,
+            25.4540253, 61.0442085, 0.982877433, 0.507169008,
+            -0.143977478, -0.0311015062, 0.00174120779, 0.000861493754,
+            0.000390630652, 7.57942234e-06, -1.95608864e-05, -4.17785441e-06,
+            -0.00254629902, -3.87376276e-05, 0.000202033669, 7.21831166e-05,
+            -2.41684193e-05, -4.87493753e-06,
+        },
+        /* 2494082.5 */ {
+            8.67225266, -18.6657143, -3.05026197, 0.926290929,
+            0.0374812372, -0.00834204536, 0.00379785104, -0.000274406251,
+            -0.00015593908, 2.94688598e-05, -2.34064964e-06, -1.48865081e-06,
+            -210.152573, 60.4767303, -1.28801358, 0.448947161,
+            0.157562524, -0.0282424614, -0.00185919763, 0.00116244168,
+            -0.000383804756, -1.14714521e-05, 2.18239293e-05, -4.50554353e-06,
+            -0.00205584755, 3.02405588e-05, -0.000226266478, 5.64172769e-05,
+            2.75539896e-05, -3.81100426e-06,
+        },
+        /* 2494210.5 */ {
+            -16.2166214, 2.55472016, 6.77564526, -0.176251918,
+            -0.266898096, 0.0106556481, 0.011916603, -0.000987773063,
+            -0.00077359844, 9.19773229e-05, 5.43162314e-05, -9.5187379e-06,
+            -83.4886169, 67.4835587, -0.377500534, -0.978923798,
+            0.0705367029, 0.0856499672, -0.00717669912, -0.00616001664,
+            0.000748594, 0.000485997647, -7.83420401e-05, -4.3612039e-05,
+            -0.00162023585, 0.00059899356, -6.0208662e-05, -0.000106520944,
+            7.43736337e-06, 7.18918818e-06,
+        },
+        /* 2494338.5 */ {
+            11.803196, 15.7146111, -4.30186701, -0.837856472,
+            0.0822146088, 0.0185752586, 0.00299693318, -0.000571829034,
+            -0.000257733511, -6.63899482e-06, 1.12100206e-05, 3.05589333e-06,
+            43.7409096, 62.1406975, 1.47071266, 0.0993885174,
+            -0.209330022, -0.0142837409, 0.0078635402, 0.0020127641,
+            3.51634772e-05, -0.000145306069, -2.66620009e-05, 3.79619587e-06,
+            -0.0011855904, 0.00021620722, 0.000266271178, 8.17942964e-06,
+            -3.20701438e-05, -5.54487031e-07,
+        },
+        /* 2494466.5 */ {
+            3.63055253, -21.185791, -1.35698509, 1.00609541,
+            0.0267922245, 0.00132197479, 0.00162725546, -0.000755590561,
+            -5.83866677e-05, 6.55002077e-06, -3.736194e-06, 8.85252064e-07,
+            -192.072067, 59.7532997, -0.323171496, 0.714868784,
+            0.0696676299, -0.0317915529, -0.00029312761, -0.000365513377,
+            -0.000234095249, 5.82385583e-05, 4.60434603e-06, -4.19027799e-07,
+            -0.000640455284, -9.66224543e-05, -9.90500266e-05, 0.000101467704,
+            1.20356608e-05, -6.85236682e-06,
+        },
+        /* 2494594.5 */ {
+            -14.7772942, 9.62673759, 6.04906178, -0.706456006,
+            -0.196513996, 0.0386272669, 0.00384008139, -0.00275045494,
+            6.11056385e-05, 0.000180025498, -2.54790884e-05, -1.04589581e-05,
+            -64.459938, 66.5813675, -1.67194819, -0.631573558,
+            0.246858761, 0.0364277996, -0.0205197763, -0.000120312579,
+            0.00155726948, -0.000196530018, -0.00010458516, 3.30942494e-05,
+            -0.000122720434, 0.000491327432, -0.000204750351, -6.98791191e-05,
+            2.47621647e-05, 4.71523708e-06,
+        },
+        /* 2494722.5 */ {
+            15.0291996, 10.1834173, -5.5039115, -0.574684203,
+            0.140617207, 0.0217807982, -0.00122368871, -0.00142939645,
+            -7.32431581e-05, 7.71150007e-05, 1.29504087e-05, -3.24680786e-06,
+            62.0271187, 63.3471107, 1.2494185, -0.358753949,
+            -0.195807442, 0.0225617364, 0.0128946556, 0.000239829504,
+            -0.000775573368, -0.000123202102, 4.09743443e-05, 1.48728823e-05,
+            0.00032316806, 0.000453933113, 0.0002236937, -5.91251919e-05,
+            -2.70716464e-05, 3.98922657e-06,
+        },
+        /* 2494850.5 */ {
+            -1.78426337, -21.6486759, 0.473647356, 1.0718466,
+            0.0293864775, 0.000812578655, -0.00194105017, -0.000970625144,
+            -3.19032843e-05, 8.70362874e-06, 5.108599e-06, 1.76776541e-06,
+            -173.916428, 60.1317253, 0.90646714, 0.757917941,
+            -0.0312931724, -0.0366508029, -0.00247671292, -0.00058235554,
+            0.000156601818, 9.05579509e-05, 6.7883343e-06, 2.61222226e-07,
+            0.000845158356, -0.000113020738, 6.81772217e-05, 0.000105691957,
+            -8.32382557e-06, -7.13747249e-06,
+        },
+        /* 2494978.5 */ {
+            -11.7760096, 15.5860462, 4.58855534, -1.04039884,
+            -0.0870169997, 0.0371690132, -0.00460953033, -0.00123913027,
+            0.000504378928, -1.50598662e-05, -2.86452869e-05, 7.65091954e-06,
+            -45.489666, 64.7694092, -2.26151896, -0.0529769063,
+            0.270151049, -0.0221834201, -0.0124299871, 0.00370584871,
+            1.84554792e-05, -0.000295044301, 5.7785961e-05, 9.85317183e-06,
+            0.00138088386, 0.000258445798, -0.000266891788, -5.13880786e-06,
+            3.21259577e-05, 3.44541945e-07,
+        },
+        /* 2495106.5 */ {
+            16.7500668, 3.66361928, -6.15334988, -0.199073702,
+            0.184725031, 0.00900495425, -0.00597400125, -0.000782569638,
+            0.000341030158, 6.16495163e-05, -1.9356663e-05, -5.24004008e-06,
+            80.3080521, 64.0685806, 0.427748173, -0.665092707,
+            -0.079942964, 0.0572121069, 0.00659777736, -0.00324342051,
+            -0.000576708233, 0.000203085918, 5.09778838e-05, -1.39785143e-05,
+            0.00180340139, 0.000581278349, 9.10435119e-05, -0.000102657665,
+            -1.11832087e-05, 6.92844105e-06,
+        },
+        /* 2495234.5 */ {
+            -6.97599363, -19.9336891, 2.38545632, 1.1138345,
+            0.0114871291, -0.0125665916, -0.0056129829, -0.000765025092,
+            0.000141313896, 5.96744321e-05, 1.03322318e-05, -7.14335272e-07,
+            -155.56131, 61.6408882, 1.97141981, 0.542048872,
+            -0.149211437, -0.0436546765, -0.00130879495, 0.00127073692,
+            0.000617709942, 6.67275453e-05, -2.18809619e-05, -9.74359591e-06,
+            0.00223557232, -1.2979237e-05, 0.000207761972, 6.73909599e-05,
+            -2.533511e-05, -4.55170448e-06,
+        },
+        /* 2495362.5 */ {
+            -7.48423147, 19.7708721, 2.70940852, -1.15817869,
+            -0.00561086554, 0.0183555484, -0.00591583317, 0.000541476766,
+            0.000227895245, -6.91949826e-05, 6.9928933e-06, 2.38617031e-06,
+            -26.6651592, 62.7184639, -1.97237659, 0.459158838,
+            0.174067423, -0.0449280255, -0.00052157446, 0.00188593415,
+            -0.000658844307, 2.91334109e-05, 3.68987712e-05, -1.14618651e-05,
+            0.00271359715, -9.67182586e-06, -0.000222018381, 6.16584584e-05,
+            2.65668314e-05, -4.16460443e-06,
+        },
+        /* 2495490.5 */ {
+            16.8263092, -3.19035935, -6.13802433, 0.219456181,
+            0.18069014, -0.0117888954, -0.0057308781, 0.000896172831,
+            0.00032165373, -6.80055673e-05, -1.76140038e-05, 5.67887173e-06,
+            98.5666275, 63.955925, -0.625617862, -0.661241531,
+            0.0835692436, 0.0563487932, -0.00708035892, -0.00313239335,
+            0.000619357743, 0.00019154184, -5.40374058e-05, -1.26348295e-05,
+            0.00307710818, 0.000540300505, -7.8693105e-05, -0.000104905463,
+            9.20415368e-06, 7.08065227e-06,
+        },
+        /* 2495618.5 */ {
+            -11.3747845, -16.0917187, 4.24569178, 1.05206633,
+            -0.0557894967, -0.0331185386, -0.00591213722, 0.000700672448,
+            0.000475779991, 5.02197872e-05, -1.83187622e-05, -7.92548963e-06,
+            -136.948517, 63.8305855, 2.43654013, 0.0717038885,
+            -0.255606323, -0.0301672295, 0.00907978229, 0.00366558833,
+            0.000279578962, -0.000219044203, -6.75092015e-05, -6.13950704e-08,
+            0.00337254908, 0.000153624773, 0.000263199123, 1.9724132e-06,
+            -3.21555308e-05, -1.35062081e-07,
+        },
+        /* 2495746.5 */ {
+            -2.33817172, 21.7924938, 0.708210528, -1.14019871,
+            0.0267264713, 0.00325707556, -0.00258727046, 0.00101116614,
+            -7.24523716e-06, -1.96021556e-05, 6.8026493e-06, -1.78441508e-06,
+            -8.05017281, 61.1842613, -1.01730025, 0.722604573,
+            0.0480699241, -0.0410966575, 0.00249057915, -0.000318617269,
+            -0.000242283088, 0.000104089828, -4.57909073e-06, -1.30653734e-06,
+            0.0037183289, -0.000217584427, -8.85159898e-05, 0.000103645361,
+            1.03212051e-05, -6.99840575e-06,
+        },
+        /* 2495874.5 */ {
+            15.2541027, -9.69499016, -5.47092867, 0.57888025,
+            0.13034676, -0.0232745297, -0.000741303375, 0.00143073127,
+            -9.72514099e-05, -7.27366132e-05, 1.42360041e-05, 2.75148022e-06,
+            116.785141, 63.0109367, -1.43914008, -0.35067597,
+            0.196030453, 0.0210253336, -0.0127859516, 0.000401240482,
+            0.000755205343, -0.000131859721, -3.75667369e-05, 1.51622889e-05,
+            0.00398350414, 0.00033248408, -0.000217549707, -6.49616704e-05,
+            2.58894052e-05, 4.38449842e-06,
+        },
+        /* 2496002.5 */ {
+            -14.5268259, -10.424468, 5.78970909, 0.788871825,
+            -0.164444357, -0.0418333523, 0.00106217072, 0.00262500113,
+            0.000265676121, -0.000139460783, -3.7380385e-05, 4.58627255e-06,
+            -118.117737, 65.9527435, 2.03606677, -0.514896989,
+            -0.265050322, 0.0217298288, 0.0201127157, 0.00132509472,
+            -0.00129684736, -0.000303541223, 6.20755891e-05, 3.7111753e-05,
+            0.00411791913, 0.000302412867, 0.000211908206, -6.42467421e-05,
+            -2.60413872e-05, 4.33601735e-06,
+        },
+        /* 2496130.5 */ {
+            3.09678745, 21.5423756, -1.23307753, -1.07062197,
+            0.0333815627, 0.000880971958, 0.00121807028, 0.000819637266,
+            -6.9531794e-05, -9.67701726e-06, -2.90746857e-06, -1.03892535e-06,
+            10.3714657, 60.6705894, 0.165775463, 0.706065595,
+            -0.0643014908, -0.0351536386, 0.000865147565, -0.000339348917,
+            0.00021743057, 6.80117882e-05, -6.97396263e-06, -4.73364054e-07,
+            0.00427324511, -0.000301127351, 7.96684326e-05, 0.000103935708,
+            -1.00760954e-05, -7.01710405e-06,
+        },
+        /* 2496258.5 */ {
+            12.1640968, -15.2184029, -4.28567696, 0.816041052,
+            0.069753617, -0.018553203, 0.00337075326, 0.000524927396,
+            -0.000253825652, 1.16033725e-05, 1.03733119e-05, -3.15162697e-06,
+            -225.055267, 61.5863533, -1.65004754, 0.105260819,
+            0.206775919, -0.0146735944, -0.00732717663, 0.00205728412,
+            -5.8249323e-05, -0.000139031064, 2.75418915e-05, 2.99321164e-06,
+            0.00439952128, 2.01330749e-05, -0.000269879267, 1.10963595e-06,
+            3.21606531e-05, -7.54347127e-08,
+        },
+        /* 2496386.5 */ {
+            -16.1401272, -3.51357412, 6.68947411, 0.306823254,
+            -0.254712969, -0.0212087724, 0.0105590308, 0.0017873788,
+            -0.000624696957, -0.00015555846, 3.81790996e-05, 1.51027698e-05,
+            -99.1542969, 67.2868118, 0.859623194, -0.936380684,
+            -0.11885836, 0.0788543448, 0.012019244, -0.00520914095,
+            -0.00122124574, 0.000362696039, 0.000122558733, -2.66414954e-05,
+            0.00436926587, 0.000350736809, 7.4351854e-05, -0.000104626255,
+            -9.45178454e-06, 7.06305218e-06,
+        },
+        /* 2496514.5 */ {
+            8.21431255, 19.1303844, -3.01849341, -0.970325351,
+            0.0487659797, 0.00933125429, 0.00351101113, 0.000268564472,
+            -0.000172613451, -2.85093192e-05, -1.59825811e-06, 1.59649778e-06,
+            28.6846066, 61.2048073, 1.11546636, 0.445704401,
+            -0.158956394, -0.0294993203, 0.00247288914, 0.00116158836,
+            0.000383205712, -1.4808501e-05, -2.36763517e-05, -4.27339273e-06,
+            0.00430573057, -0.000250670244, 0.000214756888, 6.24161112e-05,
+            -2.64204464e-05, -4.2132433e-06,
+        },
+        /* 2496642.5 */ {
+            7.83257103, -19.247282, -2.7628355, 0.942891896,
+            0.0334539898, -0.00616219034, 0.0035777702, -0.000395891839,
+            -0.000130891131, 2.67571904e-05, -3.77717015e-06, -9.30794272e-07,
+            -206.958633, 60.2822037, -1.15336406, 0.510042191,
+            0.143258452, -0.0294521768, -0.00112765946, 0.000860628497,
+            -0.000388824294, 8.91053423e-06, 1.74358338e-05, -4.31962962e-06,
+            0.00425959565, -0.00029591826, -0.000214713655, 6.6734814e-05,
+            2.54952556e-05, -4.50500602e-06,
+        },
+        /* 2496770.5 */ {
+            -16.0805893, 3.84648299, 6.71003675, -0.278514534,
+            -0.26041162, 0.0172223318, 0.0110887093, -0.00154017995,
+            -0.000676113588, 0.000138858712, 4.33819441e-05, -1.38361274e-05,
+            -80.1321564, 67.4089279, -0.635761797, -0.946160018,
+            0.109634466, 0.0806348845, -0.011009736, -0.00546772685,
+            0.00112281833, 0.000395205367, -0.000114179689, -3.10401592e-05,
+            0.00407713186, 0.000253869657, -9.41758772e-05, -0.000102919214,
+            1.09402263e-05, 6.94896653e-06,
+        },
+        /* 2496898.5 */ {
+            12.4684591, 14.833745, -4.54642487, -0.800222039,
+            0.0918139741, 0.0200888515, 0.00250710826, -0.000772729109,
+            -0.000255295832, 6.03799845e-06, 1.39413914e-05, 2.65721701e-06,
+            46.9690208, 62.3673515, 1.48278856, 0.0166796967,
+            -0.214022934, -0.009020078, 0.00917257369, 0.00196174486,
+            -0.000104789171, -0.000166838639, -2.00661125e-05, 7.08069001e-06,
+            0.00380362966, -0.000111918118, 0.000262416579, -4.20893366e-06,
+            -3.21374282e-05, 2.85415183e-07,
+        },
+        /* 2497026.5 */ {
+            2.68501735, -21.4167747, -1.04198885, 1.01763368,
+            0.0270939637, 0.00211346615, 0.00106738065, -0.000803904841,
+            -5.26381955e-05, 3.46286402e-06, -2.64608207e-06, 1.11274392e-06,
+            -188.877121, 59.7300568, -0.114324749, 0.739586353,
+            0.0528062023, -0.0321974047, -0.000562632224, -0.000530604506,
+            -0.000177480339, 6.34156313e-05, 4.29413876e-06, 3.38130263e-07,
+            0.00357030099, -0.000513713632, -7.4191259e-05, 0.000105519699,
+            8.5744814e-06, -7.12238852e-06,
+        },
+        /* 2497154.5 */ {
+            -14.3531151, 10.7772799, 5.83579636, -0.781534791,
+            -0.177857697, 0.0404895917, 0.0020265542, -0.00266352436,
+            0.000206548299, 0.000152126158, -3.44523905e-05, -6.20840319e-06,
+            -61.1107674, 66.3117828, -1.83537912, -0.537577629,
+            0.262629449, 0.0248522013, -0.0203691758, 0.00100035884,
+            0.00136356987, -0.000283430476, -7.22888508e-05, 3.68747424e-05,
+            0.0032595105, 2.61813111e-05, -0.000225790427, -5.98082624e-05,
+            2.69318098e-05, 4.039543e-06,
+        },
+        /* 2497282.5 */ {
+            15.4441023, 9.08555222, -5.66222858, -0.515249252,
+            0.15067634, 0.0206791125, -0.00220009475, -0.00144936109,
+            -4.10817222e-07, 8.71366428e-05, 8.67407198e-06, -4.73433238e-06,
+            65.2532349, 63.5248871, 1.13891625, -0.429709405,
+            -0.182245985, 0.0299191531, 0.012753617, -0.000393284281,
+            -0.000855768682, -7.61258998e-05, 5.37606684e-05, 1.24444596e-05,
+            0.00282109412, 3.56426135e-05, 0.000203610936, -6.91364912e-05,
+            -2.4927218e-05, 4.66941356e-06,
+        },
+        /* 2497410.5 */ {
+            -2.73224998, -21.4997349, 0.806783736, 1.08196402,
+            0.0287289247, -0.000616941077, -0.00263418863, -0.00098506955,
+            -1.91855015e-05, 1.48687568e-05, 6.96347661e-06, 1.74865875e-06,
+            -170.698318, 60.3196297, 1.1186316, 0.739232123,
+            -0.0508514568, -0.0380797721, -0.0027510561, -0.000411603542,
+            0.000242302704, 9.59697281e-05, 5.84902682e-06, -8.13489123e-07,
+            0.00241494854, -0.000568076619, 9.53378621e-05, 0.000101866193,
+            -1.17952814e-05, -6.87483362e-06,
+        },
+        /* 2497538.5 */ {
+            -11.1009607, 16.4629097, 4.27794695, -1.07501125,
+            -0.0693732277, 0.0344338827, -0.00537480786, -0.000854690443,
+            0.000485240394, -4.01147263e-05, -2.11317347e-05, 7.90719332e-06,
+            -42.1624565, 64.404686, -2.27090549, 0.0492124707,
+            0.259163111, -0.0291146021, -0.00999277085, 0.00367289456,
+            -0.000219972004, -0.000237123939, 6.64762847e-05, 2.05599031e-06,
+            0.0020079806, -0.000261631649, -0.000267338677, 7.36824177e-06,
+            3.20901381e-05, -4.94889321e-07,
+        },
+        /* 2497666.5 */ {
+            16.8806095, 2.45975137, -6.1990509, -0.125321507,
+            0.188006669, 0.00542063778, -0.00639437605, -0.000500899681,
+            0.000384455838, 4.06674262e-05, -2.35713651e-05, -3.57121849e-06,
+            83.5288315, 64.1138153, 0.244452804, -0.689055324,
+            -0.0517500713, 0.0602173731, 0.00429709814, -0.00360009354,
+            -0.000383115781, 0.000243695031, 3.47500209e-05, -1.87423138e-05,
+            0.00147605222, 0.000113586968, 6.22377484e-05, -0.000106246771,
+            -7.68987502e-06, 7.17531066e-06,
+        },
+        /* 2497794.5 */ {
+            -7.82134199, -19.4013081, 2.72160316, 1.11304855,
+            0.0036768287, -0.0160198305, -0.00605185889, -0.000615968835,
+            0.000198789829, 6.81964812e-05, 8.43715588e-06, -1.94017525e-06,
+            -152.303085, 61.992691, 2.10705137, 0.475933999,
+            -0.170512542, -0.0435974859, -0.000173467954, 0.00176707993,
+            0.000655158132, 3.74718365e-05, -3.28354181e-05, -1.1242968e-05,
+            0.0009448934, -0.00045413457, 0.000225954616, 5.72461104e-05,
+            -2.74204576e-05, -3.86200827e-06,
+        },
+        /* 2497922.5 */ {
+            -6.62437296, 20.2857628, 2.35928512, -1.16180837,
+            0.00328670768, 0.0149934376, -0.005514869, 0.000710834051,
+            0.000169255858, -6.1869403e-05, 9.27247402e-06, 1.08613301e-06,
+            -23.3744583, 62.3946648, -1.84051406, 0.525560141,
+            0.151945263, -0.0453356095, 0.000681944657, 0.00138695806,
+            -0.000626150402, 6.19484126e-05, 2.57398442e-05, -1.015824e-05,
+            0.000480867049, -0.00050849648, -0.000201807779, 7.15904607e-05,
+            2.43401882e-05, -4.83026361e-06,
+        },
+        /* 2498050.5 */ {
+            16.6634674, -4.3792429, -6.06389761, 0.289796084,
+            0.174380377, -0.0149205038, -0.0050585093, 0.00112155743,
+            0.000256984087, -8.2369239e-05, -1.16699093e-05, 6.53984807e-06,
+            101.778862, 63.843029, -0.799818099, -0.625431657,
+            0.109596364, 0.0518262796, -0.00901851244, -0.00261182548,
+            0.000761721458, 0.000135143622, -6.3809006e-05, -6.39233122e-06,
+            -6.24850945e-05, 7.83491269e-05, -0.000104514387, -0.000100610188,
+            1.26409668e-05, 6.79503228e-06,
+        },
+        /* 2498178.5 */ {
+            -12.0279961, -15.2106113, 4.54793119, 1.02210689,
+            -0.0729315057, -0.0361700356, -0.00523848459, 0.00108201161,
+            0.000504035677, 2.75293205e-05, -2.60739544e-05, -7.96707354e-06,
+            -133.650482, 64.2277069, 2.43111086, -0.0295147635,
+            -0.266925931, -0.0236997269, 0.0115271304, 0.00374263083,
+            5.42259077e-05, -0.000278726424, -6.09408562e-05, 7.34815148e-06,
+            -0.000642361061, -0.000227287208, 0.000265457376, -1.0391097e-05,
+            -3.20159706e-05, 7.04186675e-07,
+        },
+        /* 2498306.5 */ {
+            -1.3858614, 21.9089317, 0.359388888, -1.13014841,
+            0.028700782, 0.00188872975, -0.00187642721, 0.00100317772,
+            -2.42752449e-05, -1.36888611e-05, 4.9133223e-06, -1.83789393e-06,
+            -4.79916763, 61.0164375, -0.81158036, 0.738972425,
+            0.0270503368, -0.0397793204, 0.00228615059, -0.00048263793,
+            -0.000149210449, 9.95429e-05, -6.07869652e-06, -2.2332982e-07,
+            -0.00111775182, -0.000621910207, -5.52048878e-05, 0.00010702588,
+            6.79940285e-06, -7.22260802e-06,
+        },
+        /* 2498434.5 */ {
+            14.8119392, -10.7523394, -5.29365873, 0.630068183,
+            0.119133815, -0.0235255919, 0.000205209304, 0.00133919902,
+            -0.00015593112, -5.80659071e-05, 1.65264682e-05, 1.14218028e-06,
+            -240.014252, 62.7787781, -1.52706194, -0.274814576,
+            0.205293745, 0.0137349656, -0.012410325, 0.000945250911,
+            0.000631873845, -0.000162379074, -2.27034379e-05, 1.53600813e-05,
+            -0.00159659295, -5.98401493e-05, -0.000229208468, -5.44932955e-05,
+            2.78871503e-05, 3.68146812e-06,
+        },
+        /* 2498562.5 */ {
+            -14.9256134, -9.27808285, 6.00174332, 0.718341827,
+            -0.183753699, -0.0404736437, 0.00286558061, 0.00275580422,
+            0.000129017004, -0.000170531057, -2.97910428e-05, 8.92574371e-06,
+            -114.793015, 66.2578506, 1.87683249, -0.609350979,
+            -0.250451565, 0.0331873372, 0.0204589833, 0.000243991832,
+            -0.00150863861, -0.00022513546, 9.53034032e-05, 3.46740017e-05,
+            -0.00213427749, 2.01794301e-05, 0.000198320675, -7.38384188e-05,
+            -2.37332879e-05, 4.98706595e-06,
+        },
+        /* 2498690.5 */ {
+            4.03540325, 21.2670517, -1.56029534, -1.05586624,
+            0.0346112102, 0.00175923656, 0.00177392003, 0.0007545072,
+            -8.08510449e-05, -1.28607908e-05, -3.81612608e-06, -7.12117412e-07,
+            13.5952864, 60.6995888, 0.361434966, 0.676222563,
+            -0.0823398381, -0.0344728827, 0.000748117396, -0.000143122146,
+            0.000275353552, 5.9518683e-05, -8.20385139e-06, -1.3153458e-06,
+            -0.00256992108, -0.000554369646, 0.000113863571, 9.94203874e-05,
+            -1.34764268e-05, -6.70959298e-06,
+        },
+        /* 2498818.5 */ {
+            11.4807892, -16.0451698, -4.03665161, 0.844842076,
+            0.0609645657, -0.0165545363, 0.00369057339, 0.000328613241,
+            -0.000241690999, 2.06275781e-05, 7.21431934e-06, -3.12259158e-06,
+            -221.868408, 61.3274689, -1.61276817, 0.184967667,
+            0.199392781, -0.0188547894, -0.00597202452, 0.00198731781,
+            -0.000172276807, -0.000111548849, 3.01750388e-05, 1.65362039e-07,
+            -0.0029276018, -0.000240617213, -0.000261327485, 1.35527916e-05,
+            3.19158426e-05, -9.12978805e-07,
+        },
+        /* 2498946.5 */ {
+            -16.2511177, -2.22870946, 6.75941372, 0.206636772,
+            -0.262937576, -0.0148998918, 0.0115437666, 0.0012676632,
+            -0.000736577029, -0.000112869267, 5.0469218e-05, 1.13690667e-05,
+            -95.8164749, 67.3996964, 0.603911936, -0.971590936,
+            -0.0805029646, 0.0843516961, 0.00832949113, -0.00597157609,
+            -0.000869885902, 0.000461765507, 9.0089452e-05, -4.02195001e-05,
+            -0.00333675998, 0.000196334033, 5.18990382e-05, -0.000107575237,
+            -5.90408899e-06, 7.26388635e-06,
+        },
+        /* 2499074.5 */ {
+            9.03732491, 18.500906, -3.30940199, -0.947192311,
+            0.05425689, 0.0113995941, 0.00362467184, 0.000115715935,
+            -0.000197267727, -2.86203249e-05, 4.96536188e-07, 2.15996783e-06,
+            31.8986721, 61.3839569, 1.228894, 0.379215389,
+            -0.172732666, -0.0274187513, 0.0033877145, 0.00144161854,
+            0.000353958632, -4.05810497e-05, -2.73491478e-05, -3.80010442e-06,
+            -0.00367956166, -0.000322695036, 0.000237724627, 5.18319357e-05,
+            -2.83313802e-05, -3.49760035e-06,
+        },
+        /* 2499202.5 */ {
+            6.97216082, -19.7698193, -2.47151232, 0.957895994,
+            0.0304615069, -0.00413770601, 0.0032767076, -0.000498313981,
+            -0.000108566368, 2.28609279e-05, -4.63945389e-06, -4.21855702e-07,
+            -203.781143, 60.1126251, -1.00236607, 0.565238595,
+            0.128350317, -0.0302710682, -0.000601224601, 0.000559875451,
+            -0.000376765471, 2.51392357e-05, 1.3291914e-05, -3.74003434e-06,
+            -0.00388485449, -0.000378313794, -0.00018763628, 7.61548145e-05,
+            2.31065296e-05, -5.14021031e-06,
+        },
+        /* 2499330.5 */ {
+            -15.8954401, 5.11903954, 6.61770868, -0.377595544,
+            -0.251121581, 0.0232335627, 0.00993679836, -0.00200763415,
+            -0.00054484373, 0.000173927445, 2.92072655e-05, -1.64203175e-05,
+            -76.7907791, 67.2974625, -0.883514464, -0.900277317,
+            0.146003142, 0.0737137198, -0.0143258823, -0.00453639636,
+            0.00141130376, 0.000277221116, -0.000137489944, -1.5481919e-05,
+            -0.00410249503, 0.000245705218, -0.000114616822, -9.80330879e-05,
+            1.42998024e-05, 6.61881904e-06,
+        },
+        /* 2499458.5 */ {
+            13.0931463, 13.9143906, -4.77785492, -0.759229243,
+            0.101928234, 0.0212704781, 0.00189242256, -0.000963932485,
+            -0.000240948226, 2.08075526e-05, 1.59850024e-05, 1.90175217e-06,
+            50.1832047, 62.5925827, 1.47273827, -0.0663085878,
+            -0.215991691, -0.00312232599, 0.0103885904, 0.00179997482,
+            -0.000257174834, -0.000180147792, -1.0429304e-05, 1.03334978e-05,
+            -0.00430367561, -2.4571932e-06, 0.000266820978, -1.65994406e-05,
+            -3.1790074e-05, 1.12131715e-06,
+        },
+        /* 2499586.5 */ {
+            1.73540819, -21.5866604, -0.724922776, 1.02917242,
+            0.0276888274, 0.00255671423, 0.0004762155, -0.000847382762,
+            -4.9011378e-05, 1.59537831e-06, -1.31000741e-06, 1.30738533e-06,
+            -185.692429, 59.7430191, 0.0996407643, 0.757352233,
+            0.035713017, -0.0327598937, -0.000926894194, -0.000647189911,
+            -0.000115996314, 6.84454135e-05, 4.6473865e-06, 8.86289286e-07,
+            -0.00434938166, -0.000397917815, -3.75427371e-05, 0.000108128574,
+            5.00275701e-06, -7.29984777e-06,
+        },
+        /* 2499714.5 */ {
+            -13.8863859, 11.8872309, 5.60365009, -0.849774837,
+            -0.158552662, 0.0413778163, 0.000294485566, -0.00247692387,
+            0.000326548994, 0.000117476717, -3.94852541e-05, -1.9342001e-06,
+            -57.7755966, 66.0191345, -1.97462225, -0.438612401,
+            0.273280293, 0.0134814987, -0.0195478108, 0.00196301052,
+            0.00110823684, -0.000339458609, -3.75714699e-05, 3.60755839e-05,
+            -0.0043485309, 0.000169800842, -0.000234045277, -4.90534803e-05,
+            2.87513249e-05, 3.31137426e-06,
+        },
+        /* 2499842.5 */ {
+            15.8139133, 7.96669531, -5.80348778, -0.452794313,
+            0.160055503, 0.0190570224, -0.00316188671, -0.00141290843,
+            7.80279952e-05, 9.24786873e-05, 3.22097753e-06, -5.9113604e-06,
+            68.468689, 63.6850128, 1.01200032, -0.494701624,
+            -0.165564373, 0.0370120779, 0.012198912, -0.001061794,
+            -0.000891658303, -1.92469779e-05, 6.31044095e-05, 8.3279192e-06,
+            -0.00437205704, 0.000300352753, 0.000189612299, -7.83504074e-05,
+            -2.2461265e-05, 5.28916053e-06,
+        },
+        /* 2499970.5 */ {
+            -3.66817355, -21.2901497, 1.14123964, 1.09154058,
+            0.0272676554, -0.00244613481, -0.00332585117, -0.000985730556,
+            -2.73430913e-07, 2.27115015e-05, 8.66436676e-06, 1.60896877e-06,
+            -167.482468, 60.5411186, 1.32302558, 0.712843001,
+            -0.0709621087, -0.0395799018, -0.00287862821, -0.000173024629,
+            0.000330685318, 9.94552684e-05, 3.50425307e-06, -2.29149282e-06,
+            -0.00426833751, -0.00026756947, 0.000128701649, 9.66094158e-05,
+            -1.51133254e-05, -6.5231693e-06,
+        },
+        /* 2500098.5 */ {
+            -10.3926563, 17.2850418, 3.95855355, -1.10340476,
+            -0.0530249327, 0.0313143991, -0.00589419808, -0.000488430029,
+            0.000446995808, -5.80942724e-05, -1.34626634e-05, 7.38262406e-06,
+            -38.8472748, 64.0385208, -2.25402999, 0.14743492,
+            0.245121107, -0.0347400531, -0.00760268327, 0.00347499549,
+            -0.000408903172, -0.0001734088, 6.80859011e-05, -4.20749166e-06,
+            -0.0040611038, 2.39514466e-05, -0.000258264685, 1.96577621e-05,
+            3.16374244e-05, -1.3280029e-06,
+        },
+        /* 2500226.5 */ {
+            16.9650421, 1.25231671, -6.22580194, -0.0509471968,
+            0.189687967, 0.00167352019, -0.00662742276, -0.000195448301,
+            0.000409163971, 1.66709997e-05, -2.60176712e-05, -1.50266544e-06,
+            86.7434464, 64.1337967, 0.0570193455, -0.703048766,
+            -0.022619212, 0.0619487166, 0.00182937738, -0.00380658195,
+            -0.000163995428, 0.000267607131, 1.51529912e-05, -2.16111403e-05,
+            -0.00389228901, 0.00048921007, 3.71945644e-05, -0.000108585271,
+            -4.09753784e-06, 7.32939179e-06,
+        },
+        /* 2500354.5 */ {
+            -8.64081192, -18.8114243, 3.05578327, 1.10897803,
+            -0.00577745959, -0.019658247, -0.00636735372, -0.000421403267,
+            0.000261630135, 7.40291071e-05, 5.17749913e-06, -3.36365679e-06,
+            -149.040604, 62.3620949, 2.22271919, 0.402428567,
+            -0.191334918, -0.0427720174, 0.00128397008, 0.00227169925,
+            0.000661094091, -2.2490899e-06, -4.4337452e-05, -1.18500839e-05,
+            -0.00365868397, -1.42908129e-05, 0.000244219496, 4.62272874e-05,
+            -2.91500837e-05, -3.12254315e-06,
+        },
+        /* 2500482.5 */ {
+            -5.7434783, 20.7393017, 2.00797749, -1.16231263,
+            0.0106623489, 0.01187131, -0.00500717247, 0.00083754072,
+            0.00011713658, -5.27705488e-05, 1.02954955e-05, 2.22129195e-08,
+            -20.0918961, 62.0912666, -1.69094968, 0.583890855,
+            0.129562318, -0.045110371, 0.0015675883, 0.000916857563,
+            -0.00056758913, 8.47127667e-05, 1.58049188e-05, -8.27215263e-06,
+            -0.00328955846, -0.000107989261, -0.000177583905, 8.04578376e-05,
+            2.17973156e-05, -5.43315537e-06,
+        },
+        /* 2500610.5 */ {
+            16.4555454, -5.5552249, -5.97216415, 0.357839763,
+            0.166789576, -0.0176625866, -0.00425693486, 0.00129672675,
+            0.000182538584, -9.09758528e-05, -5.1654556e-06, 6.7279334e-06,
+            104.990166, 63.7071266, -0.964412272, -0.580882728,
+            0.133503363, 0.0463506579, -0.0106088771, -0.00200353959,
+            0.000855635502, 7.21676697e-05, -6.77585995e-05, 1.10881501e-07,
+            -0.00294125918, 0.000512751343, -0.000129216831, -9.51458496e-05,
+            1.59141891e-05, 6.42136592e-06,
+        },
+        /* 2500738.5 */ {
+            -12.6448774, -14.2801409, 4.84062338, 0.985798299,
+            -0.0912804231, -0.038749136, -0.00431668712, 0.00147160236,
+            0.000509509933, -1.91280219e-06, -3.31046685e-05, -7.09559345e-06,
+            -130.344208, 64.6196899, 2.39912987, -0.133409753,
+            -0.274849892, -0.0159520544, 0.0139307817, 0.00363261299,
+            -0.000213717736, -0.00032764065, -4.6720812e-05, 1.57867144e-05,
+            -0.00260124565, 0.000283705827, 0.000262405636, -2.27551463e-05,
+            -3.14611534e-05, 1.5341418e-06,
+        },
+        /* 2500866.5 */ {
+            -0.427208066, 21.9629078, 0.0127598923, -1.11936426,
+            0.0300989524, 0.000931667571, -0.00117153185, 0.00098228117,
+            -3.68493857e-05, -9.61662136e-06, 2.97470933e-06, -1.7878283e-06,
+            -1.54951596, 60.8818474, -0.601486683, 0.747283399,
+            0.00655778125, -0.0385663062, 0.00198878115, -0.000574811478,
+            -5.99888917e-05, 9.37038567e-05, -6.60128262e-06, 4.19566078e-07,
+            -0.00213374174, -0.00015055394, -2.4637442e-05, 0.000108886721,
+            3.18922366e-06, -7.35284539e-06,
+        },
+        /* 2500994.5 */ {
+            14.3276587, -11.7816153, -5.10269976, 0.677561462,
+            0.107869618, -0.0232743323, 0.00108675449, 0.00120731047,
+            -0.000202066803, -4.17786214e-05, 1.73256412e-05, -3.49461118e-07,
+            -236.809494, 62.5350838, -1.59573483, -0.19563517,
+            0.211374909, 0.00667171786, -0.0117091844, 0.00139502657,
+            0.000486915174, -0.000179192211, -7.92746323e-06, 1.40594257e-05,
+            -0.00164779171, 0.000382300583, -0.000242902446, -4.34416215e-05,
+            2.95241935e-05, 2.93042058e-06,
+        },
+        /* 2501122.5 */ {
+            -15.2808332, -8.09705639, 6.19454432, 0.64119786,
+            -0.202195957, -0.0381257161, 0.00470876228, 0.00277741672,
+            -2.87013117e-05, -0.000192607447, -1.84903201e-05, 1.2861281e-05,
+            -111.457199, 66.5374222, 1.69524539, -0.697461784,
+            -0.230858654, 0.0445690155, 0.0200823378, -0.000954182993,
+            -0.00164242741, -0.000119072771, 0.000123102218, 2.747082e-05,
+            -0.0012279388, 0.000525437878, 0.000175688532, -8.25924653e-05,
+            -2.11167953e-05, 5.57364774e-06,
+        },
+        /* 2501250.5 */ {
+            4.96458197, 20.9311924, -1.88395596, -1.04045928,
+            0.0363307782, 0.00295219361, 0.00228014402, 0.000678560289,
+            -9.51505863e-05, -1.67312137e-05, -4.3175869e-06, -3.24249243e-07,
+            16.8259029, 60.760437, 0.548348367, 0.639336228,
+            -0.0999984592, -0.0337933563, 0.000777287001, 9.55367068e-05,
+            0.000324362452, 4.92874387e-05, -1.02993363e-05, -2.24648943e-06,
+            -0.000729525927, -6.99187294e-05, 0.000138762509, 9.35063727e-05,
+            -1.6701857e-05, -6.31485727e-06,
+        },
+        /* 2501378.5 */ {
+            10.7614222, -16.8301773, -3.77831364, 0.870764375,
+            0.0530749112, -0.0143890651, 0.00388373481, 0.000141646058,
+            -0.000222640432, 2.67109608e-05, 4.10183793e-06, -2.84960424e-06,
+            -218.672607, 61.0751457, -1.55416, 0.262349516,
+            0.190062821, -0.0223289169, -0.00467050122, 0.00183628371,
+            -0.00026317616, -8.22544898e-05, 3.01916152e-05, -2.05760512e-06,
+            -0.000172133441, 0.00016460105, -0.000258450484, 2.57269749e-05,
+            3.12580196e-05, -1.73918511e-06,
+        },
+        /* 2501506.5 */ {
+            -16.3138065, -0.930094481, 6.8030262, 0.103757784,
+            -0.268283993, -0.00814088807, 0.012178991, 0.000679901801,
+            -0.00080952479, -6.0613962e-05, 5.86535753e-05, 6.20044648e-06,
+            -92.4650269, 67.4754944, 0.340667605, -0.993267119,
+            -0.0401222035, 0.0877954066, 0.00424539438, -0.00645823404,
+            -0.000451840926, 0.000526446267, 4.76138594e-05, -4.93874468e-05,
+            0.000294786936, 0.000625292014, 1.86076159e-05, -0.000109216679,
+            -2.2780946e-06, 7.37097434e-06,
+        },
+        /* 2501634.5 */ {
+            9.83570862, 17.8156414, -3.59396505, -0.921669781,
+            0.0607462116, 0.0134995123, 0.00362553331, -5.5510307e-05,
+            -0.000220716538, -2.64070277e-05, 3.10742053e-06, 2.65641484e-06,
+            35.1259308, 61.5809097, 1.3234551, 0.307691544,
+            -0.18526572, -0.0247559659, 0.00447434932, 0.00168727117,
+            0.000300546817, -6.92185058e-05, -2.99969033e-05, -2.6479056e-06,
+            0.00076464942, 0.000110284018, 0.000246526586, 4.05019346e-05,
+            -2.98747782e-05, -2.73659566e-06,
+        },
+        /* 2501762.5 */ {
+            6.08631897, -20.2384701, -2.17364788, 0.971884727,
+            0.0283629298, -0.00229391339, 0.00290426752, -0.000585090602,
+            -8.95830017e-05, 1.82911244e-05, -4.98185136e-06, 2.4729907e-08,
+            -200.589569, 59.9684982, -0.835474432, 0.614888728,
+            0.112851322, -0.0308271926, -0.000270369695, 0.000269859767,
+            -0.000350921473, 3.77442884e-05, 9.72404177e-06, -2.90925004e-06,
+            0.00131320336, -4.69270817e-05, -0.000169982406, 8.4536041e-05,
+            2.04184162e-05, -5.70920338e-06,
+        },
+        /* 2501890.5 */ {
+            -15.6597948, 6.38026381, 6.49834108, -0.473559946,
+            -0.239182696, 0.0285845436, 0.00850574858, -0.00237303018,
+            -0.000388666696, 0.000195149361, 1.32401401e-05, -1.70744788e-05,
+            -73.4344254, 67.1493073, -1.11974359, -0.84170711,
+            0.179215252, 0.0650973395, -0.0170248691, -0.00342113269,
+            0.00159875758, 0.000142939432, -0.000146573235, 9.52893686e-07,
+            0.00178415328, 0.000545911316, -0.000146034959, -9.1918555e-05,
+            1.74768538e-05, 6.20316587e-06,
+        },
+        /* 2502018.5 */ {
+            13.6800032, 12.9487257, -4.99736881, -0.714168251,
+            0.112514429, 0.0220600832, 0.00115482858, -0.00113783509,
+            -0.000213066392, 3.70114431e-05, 1.7023709e-05, 7.8803879e-07,
+            53.4135971, 62.8155212, 1.44008696, -0.149412766,
+            -0.214959681, 0.0034038336, 0.0114492606, 0.00151933974,
+            -0.000415357528, -0.000182644901, 2.00825093e-06, 1.31487996e-05,
+            0.00218002801, 0.000317293772, 0.000254920276, -2.88057363e-05,
+            -3.10304968e-05, 1.94268114e-06,
+        },
+        /* 2502146.5 */ {
+            0.776024401, -21.6922474, -0.402408749, 1.0406791,
+            0.0283817835, 0.00263169315, -0.000148918785, -0.00088711112,
+            -4.62275893e-05, 1.17764159e-06, 2.47120482e-07, 1.47749756e-06,
+            -182.488174, 59.7928391, 0.318676442, 0.767922938,
+            0.0181248505, -0.0335190594, -0.00135297747, -0.000711108441,
+            -4.8972197e-05, 7.38399249e-05, 5.40641167e-06, 1.17447917e-06,
+            0.0026393875, -0.000170549349, -1.34671664e-05, 0.000109330373,
+            1.3655681e-06, -7.38283825e-06,
+        },
+        /* 2502274.5 */ {
+            -13.3709297, 12.9599972, 5.35055065, -0.911288321,
+            -0.138805494, 0.041319672, -0.0013098229, -0.00220573833,
+            0.000417017436, 7.92446517e-05, -4.06050858e-05, 1.90152582e-06,
+            -54.4266396, 65.7030945, -2.08826232, -0.335305303,
+            0.278809667, 0.00255240151, -0.0181333851, 0.00273368834,
+            0.000812816026, -0.000363615574, -3.99908458e-06, 3.14393401e-05,
+            0.00305996579, 0.000312844582, -0.000252384925, -3.76554017e-05,
+            3.02015033e-05, 2.54013753e-06,
+        },
+        /* 2502402.5 */ {
+            16.1356869, 6.81727076, -5.92629528, -0.386699677,
+            0.168554977, 0.0168927312, -0.00407945737, -0.00131524203,
+            0.000158547817, 9.21276296e-05, -3.08200197e-06, -6.6002749e-06,
+            71.700386, 63.8248367, 0.868060887, -0.55291611,
+            -0.145622671, 0.0436604843, 0.0111994306, -0.00173711195,
+            -0.00087585469, 4.42523087e-05, 6.76348864e-05, 2.76536753e-06,
+            0.00335046882, 0.000458526396, 0.000160207899, -8.65360053e-05,
+            -1.97037789e-05, 5.84065401e-06,
+        },
+        /* 2502530.5 */ {
+            -4.59465218, -21.0091763, 1.47914064, 1.09981108,
+            0.0247475952, -0.00469183922, -0.00400615716, -0.000965881802,
+            2.64404971e-05, 3.20232684e-05, 1.00389416e-05, 1.2957654e-06,
+            -164.243637, 60.7963715, 1.51823688, 0.677787244,
+            -0.091740489, -0.0410295837, -0.00280683348, 0.00013690874,
+            0.000419312652, 9.92827481e-05, -6.59174987e-07, -4.14115357e-06,
+            0.00365471933, -0.00016864427, 0.000147798477, 9.01382227e-05,
+            -1.82367567e-05, -6.08688424e-06,
+        },
+        /* 2502658.5 */ {
+            -9.64353943, 18.0480423, 3.6277523, -1.12562847,
+            -0.0380558297, 0.0278986599, -0.00617243582, -0.000151198008,
+            0.000394461909, -6.89711305e-05, -6.28896532e-06, 6.2881204e-06,
+            -35.5220375, 63.6721954, -2.20943403, 0.240964606,
+            0.228240445, -0.0390693657, -0.00534119457, 0.00314060063,
+            -0.000544357928, -0.000109337379, 6.38086276e-05, -8.58987642e-06,
+            0.00396394171, 5.12517863e-06, -0.000257975917, 3.17475387e-05,
+            3.07775153e-05, -2.14452484e-06,
+        },
+        /* 2502786.5 */ {
+            16.9951077, 0.0358089171, -6.23003197, 0.0241407901,
+            0.189552233, -0.00216899696, -0.00665146299, 0.000122470577,
+            0.000412531168, -8.81785945e-06, -2.63722504e-05, 7.59669945e-07,
+            89.9720993, 64.1240616, -0.133756682, -0.705976605,
+            0.00714212097, 0.0622566827, -0.000731209584, -0.00384241063,
+            6.83227918e-05, 0.000271918689, -6.13179509e-06, -2.21313949e-05,
+            0.00412822375, 0.000460061565, 2.03207463e-07, -0.00010946369,
+            -4.50677959e-07, 7.38916151e-06,
+        },
+        /* 2502914.5 */ {
+            -9.43136978, -18.1504707, 3.38710475, 1.10021877,
+            -0.0170451552, -0.0234055426, -0.00651929528, -0.000176451897,
+            0.000326730049, 7.56598383e-05, 4.17065621e-07, -4.87974194e-06,
+            -145.756531, 62.7467766, 2.31514668, 0.320970923,
+            -0.211176455, -0.04093346, 0.00306824548, 0.00275501469,
+            0.000625132001, -5.25088326e-05, -5.51050543e-05, -1.10908768e-05,
+            0.00423745997, -6.12233707e-05, 0.000248695142, 3.46820598e-05,
+            -3.05036501e-05, -2.34248159e-06,
+        },
+        /* 2503042.5 */ {
+            -4.83697224, 21.1197834, 1.6536088, -1.15953887,
+            0.0165952872, 0.00904615782, -0.00440958515, 0.00092475611,
+            7.26740182e-05, -4.29009233e-05, 1.024209e-05, -7.80953769e-07,
+            -16.8034744, 61.8115845, -1.52347136, 0.633323133,
+            0.106990576, -0.0443650782, 0.00214710366, 0.00049297011,
+            -0.000489661586, 9.84093567e-05, 7.62995387e-06, -6.14408964e-06,
+            0.00437875791, -0.00027456673, -0.00016077116, 8.83761968e-05,
+            1.89734001e-05, -5.96647214e-06,
+        },
+        /* 2503170.5 */ {
+            16.1919155, -6.71568298, -5.85868311, 0.423081726,
+            0.157884434, -0.0199262239, -0.00334679196, 0.00141286885,
+            0.000102391466, -9.32509574e-05, 1.32573712e-06, 6.24184122e-06,
+            108.211319, 63.5442314, -1.11653197, -0.527165174,
+            0.154750839, 0.0400073007, -0.0117834751, -0.00133639295,
+            0.000894848781, 7.58210308e-06, -6.56154662e-05, 6.11259793e-06,
+            0.00440296484, 0.000298635918, -0.000160905009, -8.83622124e-05,
+            1.89840157e-05, 5.96521204e-06,
+        },
+        /* 2503298.5 */ {
+            -13.216876, -13.2904482, 5.11933661, 0.941823781,
+            -0.11059013, -0.0406724699, -0.00313693099, 0.00184856099,
+            0.000485923869, -3.7028014e-05, -3.83858751e-05, -5.1522029e-06,
+            -127.022362, 65.0007172, 2.33754349, -0.238761976,
+            -0.278467089, -0.00693631032, 0.016143376, 0.00330099813,
+            -0.000511886901, -0.000357776735, -2.4485109e-05, 2.42549468e-05,
+            0.00430918578, 8.46432013e-05, 0.000248505705, -3.47277892e-05,
+            -3.05005451e-05, 2.34434629e-06,
+        },
+        /* 2503426.5 */ {
+            0.536213279, 21.9393177, -0.331766099, -1.10733688,
+            0.0311006606, 0.000406716543, -0.000481140742, 0.000949581037,
+            -4.64562982e-05, -7.44679164e-06, 1.09777648e-06, -1.65691301e-06,
+            1.7032572, 60.783474, -0.38907519, 0.746592522,
+            -0.0134391263, -0.0374654718, 0.0016443152, -0.000594331766,
+            2.42100341e-05, 8.71349039e-05, -6.57412784e-06, 6.3178021e-07,
+            0.00424490822, -0.000438457268, 4.22428243e-08, 0.000109455519,
+            -4.6268255e-07, -7.38849576e-06,
+        },
+        /* 2503554.5 */ {
+            13.792592, -12.7717133, -4.8951602, 0.72065419,
+            0.0967065021, -0.0225108117, 0.00187366677, 0.00104144111,
+            -0.000233873303, -2.51415076e-05, 1.66908503e-05, -1.58461648e-06,
+            -233.600555, 62.2792969, -1.64155495, -0.1138613,
+            0.213997617, 1.19807428e-05, -0.0107181147, 0.00173080317,
+            0.000330323237, -0.000182073069, 5.42485304e-06, 1.15788316e-05,
+            0.00412150845, 1.39297345e-05, -0.00025835319, -3.17158228e-05,
+            3.07824412e-05, 2.14169427e-06,
+        },
+        /* 2503682.5 */ {
+            -15.5810747, -6.88050413, 6.36168814, 0.557312965,
+            -0.21912083, -0.0347328782, 0.00650922721, 0.00267212326,
+            -0.000198466849, -0.000202059091, -4.17440106e-06, 1.5751004e-05,
+            -108.113716, 66.7838364, 1.49143958, -0.776567578,
+            -0.206079438, 0.0553967357, 0.0188924186, -0.00220269896,
+            -0.00167455268, 7.94213429e-06, 0.000141050114, 1.57279828e-05,
+            0.00384767237, 0.000184866483, 0.000147307437, -9.01674648e-05,
+            -1.82283238e-05, 6.08829805e-06,
+        },
+        /* 2503810.5 */ {
+            5.87624693, 20.5220222, -2.20170784, -1.02353573,
+            0.0387066528, 0.00443406822, 0.00272012898, 0.000588299416,
+            -0.00011271859, -2.07977409e-05, -4.31964418e-06, 1.31256712e-07,
+            20.057457, 60.8524818, 0.72248286, 0.594836056,
+            -0.117056213, -0.0329834186, 0.000985052669, 0.000368233566,
+            0.000361317856, 3.63737054e-05, -1.32607147e-05, -3.14115891e-06,
+            0.00357218925, -0.000445840502, 0.000159823743, 8.65098191e-05,
+            -1.97128757e-05, -5.83863903e-06,
+        },
+        /* 2503938.5 */ {
+            10.0031939, -17.5573368, -3.50997305, 0.893309474,
+            0.0462212078, -0.0121172229, 0.00394550664, -3.02071712e-05,
+            -0.000198721173, 2.98057439e-05, 1.2785672e-06, -2.39993597e-06,
+            -215.478256, 60.8330421, -1.47231483, 0.336015344,
+            0.178861693, -0.0250606667, -0.00347747654, 0.00161711953,
+            -0.000328216644, -5.34118008e-05, 2.80517834e-05, -3.55096404e-06,
+            0.0033030936, -0.00030421128, -0.00025285274, 3.7692902e-05,
+            3.01987093e-05, -2.54322208e-06,
+        },
+        /* 2504066.5 */ {
+            -16.3179569, 0.372762352, 6.81493902, -0.000407314656,
+            -0.270308763, -0.0011473815, 0.0124079213, 5.59275031e-05,
+            -0.000835279061, -3.15451121e-06, 6.15473473e-05, 2.30558982e-07,
+            -89.1136475, 67.5083618, 0.0740541816, -0.999575973,
+            0.00123712246, 0.0888693556, -4.02367987e-05, -0.00661616493,
+            1.31931336e-06, 0.000547816686, -2.74984785e-07, -5.24913266e-05,
+            0.00289608189, 0.000175336841, -1.4062447e-05, -0.000109332439,
+            1.37664313e-06, 7.38318386e-06,
+        },
+        /* 2504194.5 */ {
+            10.5975409, 17.0694752, -3.86760521, -0.892925382,
+            0.0681893528, 0.0155325141, 0.0034947372, -0.000241958463,
+            -0.000240149326, -2.13706153e-05, 6.08296386e-06, 3.00189959e-06,
+            38.3504105, 61.7902794, 1.39530575, 0.23184751,
+            -0.195955962, -0.0214033592, 0.00569188595, 0.00187382905,
+            0.000220845614, -9.8994773e-05, -3.08135204e-05, -7.54621624e-07,
+            0.00244230567, -0.000316333637, 0.000254471321, 2.87716048e-05,
+            -3.10339892e-05, -1.9401707e-06,
+        },
+        /* 2504322.5 */ {
+            5.17976522, -20.6378422, -1.87069631, 0.984556973,
+            0.0271256939, -0.000695557857, 0.00246770796, -0.000656994001,
+            -7.45346333e-05, 1.35477785e-05, -4.83846316e-06, 3.98650712e-07,
+            -197.402908, 59.8548851, -0.653981686, 0.65767163,
+            0.096887663, -0.0311908685, -0.000135390103, 3.78238065e-06,
+            -0.00031357471, 4.71039457e-05, 7.00104465e-06, -1.95775328e-06,
+            0.00204433361, -0.000548893295, -0.000146408653, 9.19473023e-05,
+            1.74678371e-05, -6.20504534e-06,
+        },
+        /* 2504450.5 */ {
+            -15.3684597, 7.6135087, 6.35028362, -0.564464629,
+            -0.224828079, 0.0330633223, 0.00686479127, -0.00261487858,
+            -0.000219924274, 0.00020099731, -2.6989967e-06, -1.58099956e-05,
+            -70.0855179, 66.9637375, -1.33877587, -0.771240711,
+            0.208122477, 0.0551181659, -0.0189620126, -0.0022006135,
+            0.00167154253, 6.39077416e-06, -0.000140891105, 1.58658822e-05,
+            0.00156420434, 4.05995379e-05, -0.000170452739, -8.45104732e-05,
+            2.04280313e-05, 5.7080133e-06,
+        },
+        /* 2504578.5 */ {
+            14.2176476, 11.9417915, -5.19973469, -0.664956987,
+            0.123217113, 0.0223644786, 0.000315577141, -0.00128074933,
+            -0.000170978397, 5.33103084e-05, 1.67184917e-05, -6.16323916e-07,
+            56.6359482, 63.0285721, 1.38405907, -0.23054035,
+            -0.21049954, 0.0103839729, 0.0122548733, 0.00112078933,
+            -0.000566858798, -0.000171783002, 1.63429286e-05, 1.49860807e-05,
+            0.00100021274, -0.000119270837, 0.000246183045, -4.05321152e-05,
+            -2.98719278e-05, 2.73894852e-06,
+        },
+        /* 2504706.5 */ {
+            -0.18251425, -21.72439, -0.0776161402, 1.05176091,
+            0.0289896857, 0.00230510416, -0.000798663707, -0.000921982632,
+            -4.29033098e-05, 2.43987438e-06, 1.96989436e-06, 1.61833952e-06,
+            -179.289719, 59.8814278, 0.538706422, 0.770450354,
+            0.00013174834, -0.0344767794, -0.00179770251, -0.000715387287,
+            2.31629929e-05, 7.96861204e-05, 6.23973119e-06, 1.14293721e-06,
+            0.000509793172, -0.000636661018, 1.84594628e-05, 0.000109225832,
+            -2.28915724e-06, -7.3710039e-06,
+        },
+        /* 2504834.5 */ {
+            -12.8088217, 13.9784546, 5.07906532, -0.964991689,
+            -0.119184241, 0.0403673016, -0.00271786121, -0.0018731025,
+            0.000474521454, 4.12521695e-05, -3.82048565e-05, 4.88622391e-06,
+            -51.0923576, 65.3686066, -2.17323017, -0.230266511,
+            0.279196322, -0.00751879439, -0.0162504837, 0.00327749271,
+            0.000505244359, -0.000357397337, 2.47946136e-05, 2.41884409e-05,
+            1.85279077e-05, -0.000177649112, -0.00025863605, -2.56845178e-05,
+            3.12621269e-05, 1.73671481e-06,
+        },
+        /* 2504962.5 */ {
+            16.4027786, 5.65070534, -6.02723742, -0.317999393,
+            0.175786868, 0.0142436819, -0.00490034604, -0.00115755247,
+            0.000235032232, 8.55152539e-05, -9.60980378e-06, -6.64864319e-06,
+            74.9189835, 63.9390068, 0.710360527, -0.602403939,
+            -0.122857511, 0.0495328084, 0.00977262948, -0.00237093796,
+            -0.000805056363, 0.000108529857, 6.6283952e-05, -3.60871604e-06,
+            -0.000565654831, 5.62079404e-05, 0.000138629708, -9.35226562e-05,
+            -1.66937771e-05, 6.31655348e-06,
+        },
+        /* 2505090.5 */ {
+            -5.49953699, -20.6575241, 1.81612062, 1.10620749,
+            0.0210094042, -0.00731574418, -0.00464938534, -0.000919245591,
+            6.15971003e-05, 4.22167541e-05, 1.08504146e-05, 7.64967524e-07,
+            -161.011108, 61.0817528, 1.69957364, 0.634167671,
+            -0.112846695, -0.0422772467, -0.00249023666, 0.000511554012,
+            0.000502637413, 9.35713833e-05, -6.83756025e-06, -6.22531206e-06,
+            -0.00109190459, -0.000539324828, 0.000175784793, 8.2579274e-05,
+            -2.11253282e-05, -5.57223711e-06,
+        },
+        /* 2505218.5 */ {
+            -8.86243629, 18.7413464, 3.29050684, -1.14184856,
+            -0.0247457828, 0.0243534464, -0.00622639107, 0.000143705096,
+            0.00033403351, -7.32542539e-05, -2.15790578e-07, 4.88265277e-06,
+            -32.2174149, 63.3130074, -2.13880491, 0.327754557,
+            0.209259316, -0.0421259664, -0.0033152909, 0.00271258317,
+            -0.000625473622, -5.05980752e-05, 5.54179496e-05, -1.10041083e-05,
+            -0.00153923512, -0.000395886629, -0.000242780327, 4.3482989e-05,
+            2.95209011e-05, -2.9330613e-06,
+        },
+        /* 2505346.5 */ {
+            16.9713058, -1.1733824, -6.21200132, 0.0983801782,
+            0.187605411, -0.00594170997, -0.00646543037, 0.000432872737,
+            0.000394315575, -3.34705946e-05, -2.45946176e-05, 2.92097479e-06,
+            93.1841888, 64.0847168, -0.32276243, -0.697827518,
+            0.0365486592, 0.061133083, -0.00324385194, -0.00370522216,
+            0.000294478086, 0.000256204192, -2.66511579e-05, -2.02273495e-05,
+            -0.00205109944, 0.000138150936, -2.45609244e-05, -0.000108884036,
+            3.19969377e-06, 7.3533738e-06,
+        },
+        /* 2505474.5 */ {
+            -10.1844387, -17.4292068, 3.71114945, 1.08650398,
+            -0.0299845766, -0.0271207821, -0.00647854665, 0.000114488474,
+            0.000389098772, 7.18115116e-05, -5.69430495e-06, -6.3026032e-06,
+            -142.480881, 63.1397247, 2.3821857, 0.233175516,
+            -0.229372472, -0.0379710868, 0.00512293214, 0.00317773223,
+            0.000541012734, -0.00011085975, -6.34363678e-05, -8.61512217e-06,
+            -0.00254196068, -0.000294483645, 0.000262647896, 2.27257588e-05,
+            -3.1464162e-05, -1.53222538e-06,
+        },
+        /* 2505602.5 */ {
+            -3.91698217, 21.4272614, 1.3010726, -1.15420842,
+            0.0211941935, 0.00659002829, -0.00375677808, 0.000978107331,
+            3.67141911e-05, -3.33490425e-05, 9.38102858e-06, -1.32746197e-06,
+            -13.537838, 61.5600548, -1.34286892, 0.673558414,
+            0.0847424343, -0.0432888046, 0.0024515558, 0.000133175388,
+            -0.000401016499, 0.000104717379, 1.52364828e-06, -4.09839595e-06,
+            -0.00290194596, -0.000521872891, -0.000128903761, 9.51687907e-05,
+            1.59050032e-05, -6.42282339e-06,
+        },
+        /* 2505730.5 */ {
+            15.8800392, -7.84797001, -5.72728825, 0.484543949,
+            0.148066133, -0.0216508675, -0.00238055899, 0.00146782235,
+            2.27941218e-05, -8.95919511e-05, 7.1401787e-06, 5.2109126e-06,
+            111.414452, 63.35989, -1.25289392, -0.466214359,
+            0.172881246, 0.0331276841, -0.0125153847, -0.000659219048,
+            0.000880867301, -5.24516909e-05, -5.81999084e-05, 1.08848808e-05,
+            -0.00326631335, 0.000100893572, -0.000177395166, -8.04378287e-05,
+            2.18061487e-05, 5.43219539e-06,
+        },
+        /* 2505858.5 */ {
+            -13.7423763, -12.2584143, 5.38165808, 0.890931129,
+            -0.130368948, -0.0418318883, -0.00173723418, 0.00218839385,
+            0.000431175053, -7.52347405e-05, -4.09870809e-05, -2.19361254e-06,
+            -123.711548, 65.3655624, 2.24867272, -0.343098164,
+            -0.277539849, 0.00306592253, 0.0180184953, 0.00274748402,
+            -0.000818201341, -0.000362941908, 4.35117636e-06, 3.14253957e-05,
+            -0.0036474471, 9.42175484e-06, 0.000244444469, -4.62603639e-05,
+            -2.91469078e-05, 3.12412976e-06,
+        },
+        /* 2505986.5 */ {
+            1.49405646, 21.8483448, -0.670862138, -1.09467053,
+            0.0319083296, 0.000288213021, 0.000180242176, 0.000908297254,
+            -5.47040036e-05, -7.05748198e-06, -6.05805212e-07, -1.46888488e-06,
+            4.93589973, 60.7201767, -0.178738445, 0.737828135,
+            -0.0328030586, -0.0365210511, 0.00130591216, -0.000547897827,
+            0.00010191305, 8.0371472e-05, -6.44621605e-06, 4.66202863e-07,
+            -0.00388908363, -0.000492263993, 3.75048185e-05, 0.000108580884,
+            -4.10840994e-06, -7.32892931e-06,
+        },
+        /* 2506114.5 */ {
+            13.2184734, -13.718771, -4.67643642, 0.759521306,
+            0.0860132203, -0.0213276148, 0.00254321611, 0.000855551101,
+            -0.000251718942, -9.59619229e-06, 1.49350481e-05, -2.47512889e-06,
+            -230.408905, 62.0191879, -1.66521668, -0.0315820239,
+            0.213586822, -0.00605267473, -0.0095363874, 0.00194822974,
+            0.000175221474, -0.000173211316, 1.62582928e-05, 8.45355316e-06,
+            -0.00406229915, -2.54554743e-05, -0.000258100248, -1.96287147e-05,
+            3.16409096e-05, 1.32583841e-06,
+        },
+        /* 2506242.5 */ {
+            -15.8319807, -5.64463091, 6.50452757, 0.468378991,
+            -0.234169006, -0.030426003, 0.00818311982, 0.00244338717,
+            -0.000367946574, -0.000197320551, 1.17327763e-05, 1.71036736e-05,
+            -104.781952, 66.9972534, 1.27068198, -0.84543997,
+            -0.176969036, 0.0652528852, 0.0169400554, -0.00341842556,
+            -0.00159828458, 0.0001440536, 0.000146315695, 8.1289096e-07,
+            -0.00427098013, 0.000267526455, 0.000128765707, -9.66319712e-05,
+            -1.51054837e-05, 6.52389599e-06,
+        },
+};
@@ -2,10 +2,40 @@
 #include "astronomical.h"
 #include "calendrical_helper.h"
 #include "double_utils.h"
+#include "solar_chebyshev.h"
+#include "solar_ephemeris.h"
 #include <math.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 
-solar_coordinates_t new_solar_coordinates(double julian_day) {
+#ifdef ADHAN_SOLAR_CACHE
+/* Enough for the yesterday, today and tomorrow of two consecutive days, with
+ * room for the day after that new_prayer_times() needs for midnight */
+#define SOLAR_CACHE_SIZE 8
+
+typedef struct {
+  double julianDays[SOLAR_CACHE_SIZE];
+  solar_precision_t precisions[SOLAR_CACHE_SIZE];
+  solar_coordinates_t coordinates[SOLAR_CACHE_SIZE];
+  unsigned count;
+  unsigned next;
+  solar_coordinates_cache_stats_t stats;
+} solar_coordinates_cache_t;
+
+static _Thread_local solar_coordinates_cache_t cache;
+static _Thread_local solar_precision_t thread_precision;
+#else
+/* Without thread-local storage the tier is shared by the whole process */
+static _Atomic solar_precision_t thread_precision;
+#endif
+
+static solar_coordinates_t compute_solar_coordinates(double julian_day) {
+#ifdef ADHAN_SOLAR_CHEBYSHEV
+  solar_coordinates_t fitted;
+  if (chebyshev_solar_coordinates(julian_day, &fitted)) {
+    return fitted;
+  }
+#endif
   double T = julian_century(julian_day);
   double L0 = mean_solar_longitude(T);
   double Lp = mean_lunar_longitude(T);
@@ -35,3 +65,99 @@ solar_coordinates_t new_solar_coordinates(double julian_day) {
   return (solar_coordinates_t){declination, rightAscension,
                                apparentSiderealTime};
 }
+
+static solar_coordinates_t
+compute_with_precision(double julian_day, solar_precision_t precision) {
+  switch (precision) {
+  case SOLAR_PRECISION_FAST:
+    return fast_solar_coordinates(julian_day);
+  case SOLAR_PRECISION_HIGH:
+    return vsop87_solar_coordinates(julian_day);
+  default:
+    return compute_solar_coordinates(julian_day);
+  }
+}
+
+solar_coordinates_t solar_coordinates_with_precision(
+    double julian_day, solar_precision_t precision) {
+#ifdef ADHAN_SOLAR_CACHE
+  for (unsigned i = 0; i < cache.count; i++) {
+    if (cache.julianDays[i] == julian_day &&
+        cache.precisions[i] == precision) {
+      cache.stats.hits++;
+      return cache.coordinates[i];
+    }
+  }
+
+  const solar_coordinates_t coordinates =
+      compute_with_precision(julian_day, precision);
+  cache.julianDays[cache.next] = julian_day;
+  cache.precisions[cache.next] = precision;
+  cache.coordinates[cache.next] = coordinates;
+  cache.next = (cache.next + 1) % SOLAR_CACHE_SIZE;
+  if (cache.count < SOLAR_CACHE_SIZE) {
+    cache.count++;
+  }
+  cache.stats.misses++;
+  return coordinates;
+#else
+  return compute_with_precision(julian_day, precision);
+#endif
+}
+
+solar_coordinates_t new_solar_coordinates(double julian_day) {
+  return solar_coordinates_with_precision(julian_day, thread_precision);
+}
+
+solar_precision_t solar_coordinates_set_precision(solar_precision_t precision) {
+#ifdef ADHAN_SOLAR_CACHE
+  const solar_precision_t previous = thread_precision;
+  thread_precision = precision;
+  return previous;
+#else
+  return atomic_exchange(&thread_precision, precision);
+#endif
+}
+
+solar_precision_t solar_coordinates_precision(void) {
+  return thread_precision;
+}
+
+bool solar_coordinates_chebyshev_enabled(void) {
+#ifdef ADHAN_SOLAR_CHEBYSHEV
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool solar_coordinates_cache_enabled(void) {
+#ifdef ADHAN_SOLAR_CACHE
+  return true;
+#else
+  return false;
+#endif
+}
+
+solar_coordinates_cache_stats_t solar_coordinates_cache_stats(void) {
+#ifdef ADHAN_SOLAR_CACHE
+  return cache.stats;
+#else
+  return (solar_coordinates_cache_stats_t){0, 0};
+#endif
+}
+
+double solar_coordinates_cache_hit_rate(void) {
+  const solar_coordinates_cache_stats_t stats =
+      solar_coordinates_cache_stats();
+  const unsigned long lookups = stats.hits + stats.misses;
+  return lookups ? (double)stats.hits / (double)lookups : 0.0;
+}
+
+void solar_coordinates_cache_reset(void) {
+#ifdef ADHAN_SOLAR_CACHE
+  cache.count = 0;
+  cache.next = 0;
+  cache.stats = (solar_coordinates_cache_stats_t){0, 0};
+#endif
+}
@@ -1,12 +1,105 @@
 #ifndef ADHAN_SOLAR_COORDINATES_H
 #define ADHAN_SOLAR_COORDINATES_H
 
+#include <stdbool.h>
+
 typedef struct {
   double declination;
   double rightAscension;
   double apparentSiderealTime;
 } solar_coordinates_t;
 
+/**
+ * @brief Precision tiers of the solar coordinates
+ *
+ * Compared with the high tier from 1950 to 2050, the standard tier is within
+ * 12 arcseconds in declination and 34 in right ascension, and the fast tier
+ * within 20 and 50, which move sunrise, transit and sunset by up to 2 and 4
+ * seconds between 60S and 60N. bench/solar_precision_bench.c reports the
+ * cost and errors of each tier.
+ */
+typedef enum {
+  SOLAR_PRECISION_STANDARD, /**< Astronomical Algorithms chapter 25 */
+  SOLAR_PRECISION_FAST,     /**< fast_solar_coordinates() */
+  SOLAR_PRECISION_HIGH      /**< vsop87_solar_coordinates() */
+} solar_precision_t;
+
+/**
+ * @brief Solar coordinates at a Julian day
+ *
+ * Computed with the precision tier of the calling thread, see
+ * solar_coordinates_set_precision().
+ *
+ * When the library is built with ADHAN_SOLAR_CACHE, the last few results of
+ * each thread are kept in a small ring keyed by the Julian day, so callers
+ * that walk consecutive days reuse yesterday's and today's coordinates.
+ *
+ * When it is built with ADHAN_SOLAR_CHEBYSHEV, standard tier days within the
+ * range of the Chebyshev table are evaluated with
+ * chebyshev_solar_coordinates() instead of the full series, and other days
+ * are computed as usual.
+ */
 solar_coordinates_t new_solar_coordinates(double julian_day);
 
+/**
+ * @brief Solar coordinates at a Julian day with a given precision tier
+ *
+ * Shares the cache of new_solar_coordinates(), keyed by tier.
+ */
+solar_coordinates_t solar_coordinates_with_precision(
+    double julian_day, solar_precision_t precision);
+
+/**
+ * @brief Set the precision tier of the calling thread
+ *
+ * Every computation of the thread that goes through new_solar_coordinates(),
+ * such as new_prayer_times(), uses it from then on. Without ADHAN_SOLAR_CACHE,
+ * which is also the build for targets without thread-local storage, the tier
+ * is a single atomic setting of the whole process, which every thread reads
+ * and sets.
+ *
+ * @return The previous tier, to restore it
+ */
+solar_precision_t solar_coordinates_set_precision(solar_precision_t precision);
+
+/**
+ * @brief Precision tier of the calling thread, SOLAR_PRECISION_STANDARD
+ * unless set
+ */
+solar_precision_t solar_coordinates_precision(void);
+
+/**
+ * @brief Whether the library was built with ADHAN_SOLAR_CHEBYSHEV
+ */
+bool solar_coordinates_chebyshev_enabled(void);
+
+/**
+ * @brief Solar coordinate cache statistics of the calling thread
+ */
+typedef struct {
+  unsigned long hits;
+  unsigned long misses;
+} solar_coordinates_cache_stats_t;
+
+/**
+ * @brief Whether the library was built with ADHAN_SOLAR_CACHE
+ */
+bool solar_coordinates_cache_enabled(void);
+
+/**
+ * @brief Lookups of the calling thread since its last reset
+ */
+solar_coordinates_cache_stats_t solar_coordinates_cache_stats(void);
+
+/**
+ * @brief Fraction of lookups of the calling thread that were hits, 0 when
+ * there were none
+ */
+double solar_coordinates_cache_hit_rate(void);
+
+/**
+ * @brief Empty the cache of the calling thread and reset its statistics
+ */
+void solar_coordinates_cache_reset(void);
+
 #endif // ADHAN_SOLAR_COORDINATES_H
@@ -0,0 +1,371 @@
+#include "solar_ephemeris.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+#include "lunar_coordinates.h"
+#include <math.h>
+#include <stddef.h>
+
+solar_coordinates_t fast_solar_coordinates(double julian_day) {
+  /* Astronomical Almanac, section C, low precision formulas for the sun */
+  const double n = julian_day - 2451545.0;
+  const double L = 280.460 + 0.9856474 * n;
+  const double g = to_radians(357.528 + 0.9856003 * n);
+  const double lambda = to_radians(L + 1.915 * sin(g) + 0.020 * sin(2 * g));
+  const double epsilon = to_radians(23.439 - 0.0000004 * n);
+
+  return (solar_coordinates_t){
+      to_degrees(safe_asin(sin(epsilon) * sin(lambda))),
+      unwind_angle(to_degrees(
+          safe_atan2(cos(epsilon) * sin(lambda), cos(lambda)))),
+      unwind_angle(280.46061837 + 360.98564736629 * n)};
+}
+
+/* Astronomical Algorithms table 22.A: multiples of D, M, M', F and the
+ * longitude of the ascending node, then the coefficients of the sine of the
+ * nutation in longitude and of the cosine of the nutation in obliquity, in
+ * 0.0001 arcseconds, each with its change per Julian century. */
+static const double NUTATION_TERMS[][9] = {
+    {0, 0, 0, 0, 1, -171996, -174.2, 92025, 8.9},
+    {-2, 0, 0, 2, 2, -13187, -1.6, 5736, -3.1},
+    {0, 0, 0, 2, 2, -2274, -0.2, 977, -0.5},
+    {0, 0, 0, 0, 2, 2062, 0.2, -895, 0.5},
+    {0, 1, 0, 0, 0, 1426, -3.4, 54, -0.1},
+    {0, 0, 1, 0, 0, 712, 0.1, -7, 0},
+    {-2, 1, 0, 2, 2, -517, 1.2, 224, -0.6},
+    {0, 0, 0, 2, 1, -386, -0.4, 200, 0},
+    {0, 0, 1, 2, 2, -301, 0, 129, -0.1},
+    {-2, -1, 0, 2, 2, 217, -0.5, -95, 0.3},
+    {-2, 0, 1, 0, 0, -158, 0, 0, 0},
+    {-2, 0, 0, 2, 1, 129, 0.1, -70, 0},
+    {0, 0, -1, 2, 2, 123, 0, -53, 0},
+    {2, 0, 0, 0, 0, 63, 0, 0, 0},
+    {0, 0, 1, 0, 1, 63, 0.1, -33, 0},
+    {2, 0, -1, 2, 2, -59, 0, 26, 0},
+    {0, 0, -1, 0, 1, -58, -0.1, 32, 0},
+    {0, 0, 1, 2, 1, -51, 0, 27, 0},
+    {-2, 0, 2, 0, 0, 48, 0, 0, 0},
+    {0, 0, -2, 2, 1, 46, 0, -24, 0},
+    {2, 0, 0, 2, 2, -38, 0, 16, 0},
+    {0, 0, 2, 2, 2, -31, 0, 13, 0},
+    {0, 0, 2, 0, 0, 29, 0, 0, 0},
+    {-2, 0, 1, 2, 2, 29, 0, -12, 0},
+    {0, 0, 0, 2, 0, 26, 0, 0, 0},
+    {-2, 0, 0, 2, 0, -22, 0, 0, 0},
+    {0, 0, -1, 2, 1, 21, 0, -10, 0},
+    {0, 2, 0, 0, 0, 17, -0.1, 0, 0},
+    {2, 0, -1, 0, 1, 16, 0, -8, 0},
+    {-2, 2, 0, 2, 2, -16, 0.1, 7, 0},
+    {0, 1, 0, 0, 1, -15, 0, 9, 0},
+    {-2, 0, 1, 0, 1, -13, 0, 7, 0},
+    {0, -1, 0, 0, 1, -12, 0, 6, 0},
+    {0, 0, 2, -2, 0, 11, 0, 0, 0},
+    {2, 0, -1, 2, 1, -10, 0, 5, 0},
+    {2, 0, 1, 2, 2, -8, 0, 3, 0},
+    {0, 1, 0, 2, 2, 7, 0, -3, 0},
+    {-2, 1, 1, 0, 0, -7, 0, 0, 0},
+    {0, -1, 0, 2, 2, -7, 0, 3, 0},
+    {2, 0, 0, 2, 1, -7, 0, 3, 0},
+    {2, 0, 1, 0, 0, 6, 0, 0, 0},
+    {-2, 0, 2, 2, 2, 6, 0, -3, 0},
+    {-2, 0, 1, 2, 1, 6, 0, -3, 0},
+    {2, 0, -2, 0, 1, -6, 0, 3, 0},
+    {2, 0, 0, 0, 1, -6, 0, 3, 0},
+    {0, -1, 1, 0, 0, 5, 0, 0, 0},
+    {-2, -1, 0, 2, 1, -5, 0, 3, 0},
+    {-2, 0, 0, 0, 1, -5, 0, 3, 0},
+    {0, 0, 2, 2, 1, -5, 0, 3, 0},
+    {-2, 0, 2, 0, 1, 4, 0, 0, 0},
+    {-2, 1, 0, 2, 1, 4, 0, 0, 0},
+    {0, 0, 1, -2, 0, 4, 0, 0, 0},
+    {-1, 0, 1, 0, 0, -4, 0, 0, 0},
+    {-2, 1, 0, 0, 0, -4, 0, 0, 0},
+    {1, 0, 0, 0, 0, -4, 0, 0, 0},
+    {0, 0, 1, 2, 0, 3, 0, 0, 0},
+    {0, 0, -2, 2, 2, -3, 0, 0, 0},
+    {-1, -1, 1, 0, 0, -3, 0, 0, 0},
+    {0, 1, 1, 0, 0, -3, 0, 0, 0},
+    {0, -1, 1, 2, 2, -3, 0, 0, 0},
+    {2, -1, -1, 2, 2, -3, 0, 0, 0},
+    {0, 0, 3, 2, 2, -3, 0, 0, 0},
+    {2, -1, 0, 2, 2, -3, 0, 0, 0}};
+
+void iau1980_nutation(double T, double *longitude, double *obliquity) {
+  /* Equations from Astronomical Algorithms page 144 */
+  const double D = 297.85036 + 445267.111480 * T - 0.0019142 * T * T +
+                   T * T * T / 189474;
+  const double M = 357.52772 + 35999.050340 * T - 0.0001603 * T * T -
+                   T * T * T / 300000;
+  const double Mp = 134.96298 + 477198.867398 * T + 0.0086972 * T * T +
+                    T * T * T / 56250;
+  const double F = 93.27191 + 483202.017538 * T - 0.0036825 * T * T +
+                   T * T * T / 327270;
+  const double omega = 125.04452 - 1934.136261 * T + 0.0020708 * T * T +
+                       T * T * T / 450000;
+  double psi = 0, epsilon = 0;
+
+  for (size_t i = 0; i < sizeof(NUTATION_TERMS) / sizeof(*NUTATION_TERMS);
+       i++) {
+    const double *t = NUTATION_TERMS[i];
+    const double argument =
+        to_radians(t[0] * D + t[1] * M + t[2] * Mp + t[3] * F + t[4] * omega);
+    psi += (t[5] + t[6] * T) * sin(argument);
+    epsilon += (t[7] + t[8] * T) * cos(argument);
+  }
+  *longitude = psi / 1e4 / 3600;
+  *obliquity = epsilon / 1e4 / 3600;
+}
+
+/* Astronomical Algorithms appendix III, Earth: A, B and C of each
+ * A cos(B + C tau) term, tau in Julian millennia since J2000 */
+static const double L0[][3] = {
+    {175347046, 0, 0},
+    {3341656, 4.6692568, 6283.0758500},
+    {34894, 4.62610, 12566.15170},
+    {3497, 2.7441, 5753.3849},
+    {3418, 2.8289, 3.5231},
+    {3136, 3.6277, 77713.7715},
+    {2676, 4.4181, 7860.4194},
+    {2343, 6.1352, 3930.2097},
+    {1324, 0.7425, 11506.7698},
+    {1273, 2.0371, 529.6910},
+    {1199, 1.1096, 1577.3435},
+    {990, 5.233, 5884.927},
+    {902, 2.045, 26.298},
+    {857, 3.508, 398.149},
+    {780, 1.179, 5223.694},
+    {753, 2.533, 5507.553},
+    {505, 4.583, 18849.228},
+    {492, 4.205, 775.523},
+    {357, 2.920, 0.067},
+    {317, 5.849, 11790.629},
+    {284, 1.899, 796.298},
+    {271, 0.315, 10977.079},
+    {243, 0.345, 5486.778},
+    {206, 4.806, 2544.314},
+    {205, 1.869, 5573.143},
+    {202, 2.458, 6069.777},
+    {156, 0.833, 213.299},
+    {132, 3.411, 2942.463},
+    {126, 1.083, 20.775},
+    {115, 0.645, 0.980},
+    {103, 0.636, 4694.003},
+    {102, 0.976, 15720.839},
+    {102, 4.267, 7.114},
+    {99, 6.21, 2146.17},
+    {98, 0.68, 155.42},
+    {86, 5.98, 161000.69},
+    {85, 1.30, 6275.96},
+    {85, 3.67, 71430.70},
+    {80, 1.81, 17260.15},
+    {79, 3.04, 12036.46},
+    {75, 1.76, 5088.63},
+    {74, 3.50, 3154.69},
+    {74, 4.68, 801.82},
+    {70, 0.83, 9437.76},
+    {62, 3.98, 8827.39},
+    {61, 1.82, 7084.90},
+    {57, 2.78, 6286.60},
+    {56, 4.39, 14143.50},
+    {56, 3.47, 6279.55},
+    {52, 0.19, 12139.55},
+    {52, 1.33, 1748.02},
+    {51, 0.28, 5856.48},
+    {49, 0.49, 1194.45},
+    {41, 5.37, 8429.24},
+    {41, 2.40, 19651.05},
+    {39, 6.17, 10447.39},
+    {37, 6.04, 10213.29},
+    {37, 2.57, 1059.38},
+    {36, 1.71, 2352.87},
+    {36, 1.78, 6812.77},
+    {33, 0.59, 17789.85},
+    {30, 0.44, 83996.85},
+    {30, 2.74, 1349.87},
+    {25, 3.16, 4690.48}};
+
+static const double L1[][3] = {
+    {628331966747, 0, 0},
+    {206059, 2.678235, 6283.075850},
+    {4303, 2.6351, 12566.1517},
+    {425, 1.590, 3.523},
+    {119, 5.796, 26.298},
+    {109, 2.966, 1577.344},
+    {93, 2.59, 18849.23},
+    {72, 1.14, 529.69},
+    {68, 1.87, 398.15},
+    {67, 4.41, 5507.55},
+    {59, 2.89, 5223.69},
+    {56, 2.17, 155.42},
+    {45, 0.40, 796.30},
+    {36, 0.47, 775.52},
+    {29, 2.65, 7.11},
+    {21, 5.34, 0.98},
+    {19, 1.85, 5486.78},
+    {19, 4.97, 213.30},
+    {17, 2.99, 6275.96},
+    {16, 0.03, 2544.31},
+    {16, 1.43, 2146.17},
+    {15, 1.21, 10977.08},
+    {12, 2.83, 1748.02},
+    {12, 3.26, 5088.63},
+    {12, 5.27, 1194.45},
+    {12, 2.08, 4694.00},
+    {11, 0.77, 553.57},
+    {10, 1.30, 6286.60},
+    {10, 4.24, 1349.87},
+    {9, 2.70, 242.73},
+    {9, 5.64, 951.72},
+    {8, 5.30, 2352.87},
+    {6, 2.65, 9437.76},
+    {6, 4.67, 4690.48}};
+
+static const double L2[][3] = {
+    {52919, 0, 0},         {8720, 1.0721, 6283.0758},
+    {309, 0.867, 12566.152}, {27, 0.05, 3.52},
+    {16, 5.19, 26.30},     {16, 3.68, 155.42},
+    {10, 0.76, 18849.23},  {9, 2.06, 77713.77},
+    {7, 0.83, 775.52},     {5, 4.66, 1577.34},
+    {4, 1.03, 7.11},       {4, 3.44, 5573.14},
+    {3, 5.14, 796.30},     {3, 6.05, 5507.55},
+    {3, 1.19, 242.73},     {3, 6.12, 529.69},
+    {3, 0.31, 398.15},     {3, 2.28, 553.57},
+    {2, 4.38, 5223.69},    {2, 3.75, 0.98}};
+
+static const double L3[][3] = {
+    {289, 5.844, 6283.076}, {35, 0, 0},          {17, 5.49, 12566.15},
+    {3, 5.20, 155.42},      {1, 4.72, 3.52},     {1, 5.30, 18849.23},
+    {1, 5.97, 242.73}};
+
+static const double L4[][3] = {
+    {114, 3.142, 0}, {8, 4.13, 6283.08}, {1, 3.84, 12566.15}};
+
+static const double L5[][3] = {{1, 3.14, 0}};
+
+static const double B0[][3] = {
+    {280, 3.199, 84334.662}, {102, 5.422, 5507.553}, {80, 3.88, 5223.69},
+    {44, 3.70, 2352.87},     {32, 4.00, 1577.34}};
+
+static const double B1[][3] = {{9, 3.90, 5507.55}, {6, 1.73, 5223.69}};
+
+static const double R0[][3] = {
+    {100013989, 0, 0},
+    {1670700, 3.0984635, 6283.0758500},
+    {13956, 3.05525, 12566.15170},
+    {3084, 5.1985, 77713.7715},
+    {1628, 1.1739, 5753.3849},
+    {1576, 2.8469, 7860.4194},
+    {925, 5.453, 11506.770},
+    {542, 4.564, 3930.210},
+    {472, 3.661, 5884.927},
+    {346, 0.964, 5507.553},
+    {329, 5.900, 5223.694},
+    {307, 0.299, 5573.143},
+    {243, 4.273, 11790.629},
+    {212, 5.847, 1577.344},
+    {186, 5.022, 10977.079},
+    {175, 3.012, 18849.228},
+    {110, 5.055, 5486.778},
+    {98, 0.89, 6069.78},
+    {86, 5.69, 15720.84},
+    {86, 1.27, 161000.69},
+    {65, 0.27, 17260.15},
+    {63, 0.92, 529.69},
+    {57, 2.01, 83996.85},
+    {56, 5.24, 71430.70},
+    {49, 3.25, 2544.31},
+    {47, 2.58, 775.52},
+    {45, 5.54, 9437.76},
+    {43, 6.01, 6275.96},
+    {39, 5.36, 4694.00},
+    {38, 2.39, 8827.39},
+    {37, 0.83, 19651.05},
+    {37, 4.90, 12139.55},
+    {36, 1.67, 12036.46},
+    {35, 1.84, 2942.46},
+    {33, 0.24, 7084.90},
+    {32, 0.18, 5088.63},
+    {32, 1.78, 398.15},
+    {28, 1.21, 6286.60},
+    {28, 1.90, 6279.55},
+    {26, 4.59, 10447.39}};
+
+static const double R1[][3] = {
+    {103019, 1.107490, 6283.075850}, {1721, 1.0644, 12566.1517},
+    {702, 3.142, 0},                 {32, 1.02, 18849.23},
+    {31, 2.84, 5507.55},             {25, 1.32, 5223.69},
+    {18, 1.42, 1577.34},             {10, 5.91, 10977.08},
+    {9, 1.42, 6275.96},              {9, 0.27, 5486.78}};
+
+static const double R2[][3] = {
+    {4359, 5.7846, 6283.0758}, {124, 5.579, 12566.152}, {12, 3.14, 0},
+    {9, 3.63, 77713.77},       {6, 1.87, 5573.14},      {3, 5.47, 18849.23}};
+
+static const double R3[][3] = {{145, 4.273, 6283.076}, {7, 3.92, 12566.15}};
+
+static const double R4[][3] = {{4, 2.56, 6283.08}};
+
+#define SERIES(terms) terms, sizeof(terms) / sizeof(*terms)
+
+static double series(const double (*terms)[3], size_t count, double tau) {
+  double sum = 0;
+  for (size_t i = 0; i < count; i++) {
+    sum += terms[i][0] * cos(terms[i][1] + terms[i][2] * tau);
+  }
+  return sum;
+}
+
+solar_coordinates_t vsop87_solar_coordinates(double julian_day) {
+  const double jde =
+      julian_day +
+      delta_t(2000 + (julian_day - 2451545) / 365.25) / SECONDS_PER_DAY;
+  const double tau = (jde - 2451545) / 365250;
+  const double T = tau * 10;
+
+  /* Heliocentric coordinates of the earth, radians and astronomical units */
+  const double L =
+      (series(SERIES(L0), tau) +
+       tau * (series(SERIES(L1), tau) +
+              tau * (series(SERIES(L2), tau) +
+                     tau * (series(SERIES(L3), tau) +
+                            tau * (series(SERIES(L4), tau) +
+                                   tau * series(SERIES(L5), tau)))))) /
+      1e8;
+  const double B =
+      (series(SERIES(B0), tau) + tau * series(SERIES(B1), tau)) / 1e8;
+  const double R =
+      (series(SERIES(R0), tau) +
+       tau * (series(SERIES(R1), tau) +
+              tau * (series(SERIES(R2), tau) +
+                     tau * (series(SERIES(R3), tau) +
+                            tau * series(SERIES(R4), tau))))) /
+      1e8;
+
+  /* Geocentric, with the FK5 correction of page 166 */
+  const double theta = to_degrees(L) + 180;
+  const double lambdaPrime = to_radians(theta - 1.397 * T - 0.00031 * T * T);
+  const double beta =
+      -to_degrees(B) + 0.03916 / 3600 * (cos(lambdaPrime) - sin(lambdaPrime));
+
+  double psi, epsilonNutation;
+  iau1980_nutation(T, &psi, &epsilonNutation);
+  const double epsilon0 = mean_obliquity_of_the_ecliptic(T);
+  const double epsilon = to_radians(epsilon0 + epsilonNutation);
+  const double lambda =
+      to_radians(theta - 0.09033 / 3600 + psi - 20.4898 / 3600 / R);
+  const double b = to_radians(beta);
+
+  /* Equations from Astronomical Algorithms page 93 */
+  const double declination = to_degrees(safe_asin(
+      sin(b) * cos(epsilon) + cos(b) * sin(epsilon) * sin(lambda)));
+  const double rightAscension = unwind_angle(to_degrees(safe_atan2(
+      sin(lambda) * cos(epsilon) - tan(b) * sin(epsilon), cos(lambda))));
+
+  /* Equation from Astronomical Algorithms page 88 */
+  const double apparentSiderealTime =
+      mean_sidereal_time(julian_century(julian_day)) +
+      psi * cos(epsilon);
+
+  return (solar_coordinates_t){declination, rightAscension,
+                               unwind_angle(apparentSiderealTime)};
+}
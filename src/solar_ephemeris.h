@@ -0,0 +1,38 @@
+#ifndef ADHAN_SOLAR_EPHEMERIS_H
+#define ADHAN_SOLAR_EPHEMERIS_H
+
+#include "solar_coordinates.h"
+
+/**
+ * @brief Solar coordinates of SOLAR_PRECISION_FAST
+ *
+ * The low precision formulas of the Astronomical Almanac: mean longitude and
+ * anomaly with two terms of the equation of the center, a linear obliquity
+ * and the mean sidereal time. Within 0.01 degrees of the sun from 1950 to
+ * 2050, at a cost of a few trigonometric functions.
+ */
+solar_coordinates_t fast_solar_coordinates(double julian_day);
+
+/**
+ * @brief Solar coordinates of SOLAR_PRECISION_HIGH
+ *
+ * Astronomical Algorithms chapter 25 with the truncated VSOP87 series of
+ * its appendix III, the FK5 correction, the IAU 1980 nutation of chapter 22
+ * and the annual aberration. The position is computed in dynamical time,
+ * from delta_t(), and the sidereal time in universal time. About one
+ * arcsecond from the full theory.
+ */
+solar_coordinates_t vsop87_solar_coordinates(double julian_day);
+
+/**
+ * @brief IAU 1980 nutation in longitude and obliquity, in degrees
+ *
+ * The 63 terms of Astronomical Algorithms table 22.A, which leave out those
+ * under 0.0003 arcseconds.
+ *
+ * @param julian_century Julian centuries of dynamical time since J2000
+ */
+void iau1980_nutation(double julian_century, double *longitude,
+                      double *obliquity);
+
+#endif /* ADHAN_SOLAR_EPHEMERIS_H */
@@ -15,26 +15,66 @@ solar_time_t new_solar_time(const time_t today_time,
   solar_coordinates_t nextSolar =
       new_solar_coordinates(julian_day_from_time_t(tomorrow_time));
 
+  return solar_time_from_coordinates(coordinates, &prevSolar, &solar,
+                                     &nextSolar);
+}
+
+solar_time_t solar_time_from_coordinates(coordinates_t *coordinates,
+                                         const solar_coordinates_t *prevSolar,
+                                         const solar_coordinates_t *solar,
+                                         const solar_coordinates_t *nextSolar) {
   double approximateTransit = get_approximate_transit(
-      coordinates->longitude, solar.apparentSiderealTime, solar.rightAscension);
+      coordinates->longitude, solar->apparentSiderealTime,
+      solar->rightAscension);
   double solarAltitude = -50.0 / 60.0;
 
   double transit = corrected_transit(
-      approximateTransit, coordinates->longitude, solar.apparentSiderealTime,
-      solar.rightAscension, prevSolar.rightAscension, nextSolar.rightAscension);
+      approximateTransit, coordinates->longitude, solar->apparentSiderealTime,
+      solar->rightAscension, prevSolar->rightAscension,
+      nextSolar->rightAscension);
   double sunrise = corrected_hour_angle(
       approximateTransit, solarAltitude, coordinates, false,
-      solar.apparentSiderealTime, solar.rightAscension,
-      prevSolar.rightAscension, nextSolar.rightAscension, solar.declination,
-      prevSolar.declination, nextSolar.declination);
+      solar->apparentSiderealTime, solar->rightAscension,
+      prevSolar->rightAscension, nextSolar->rightAscension, solar->declination,
+      prevSolar->declination, nextSolar->declination);
   double sunset = corrected_hour_angle(
       approximateTransit, solarAltitude, coordinates, true,
-      solar.apparentSiderealTime, solar.rightAscension,
-      prevSolar.rightAscension, nextSolar.rightAscension, solar.declination,
-      prevSolar.declination, nextSolar.declination);
+      solar->apparentSiderealTime, solar->rightAscension,
+      prevSolar->rightAscension, nextSolar->rightAscension, solar->declination,
+      prevSolar->declination, nextSolar->declination);
+
+  return (solar_time_t){transit, sunrise,    sunset,     coordinates,
+                        *solar,  *prevSolar, *nextSolar, approximateTransit};
+}
+
+static solar_coordinates_t solar_coordinates_for_day(time_t start, long day) {
+  return new_solar_coordinates(julian_day_from_time_t(add_days(start, day)));
+}
 
-  return (solar_time_t){transit, sunrise,   sunset,    coordinates,
-                        solar,   prevSolar, nextSolar, approximateTransit};
+void solar_time_days_init(solar_time_days_t *days, coordinates_t *coordinates,
+                          time_t start) {
+  days->coordinates = coordinates;
+  days->start = start;
+  days->day = 0;
+  for (int i = 0; i < 4; i++) {
+    days->window[i] = solar_coordinates_for_day(start, i - 1);
+  }
+  days->today = solar_time_from_coordinates(
+      coordinates, &days->window[0], &days->window[1], &days->window[2]);
+  days->tomorrow = solar_time_from_coordinates(
+      coordinates, &days->window[1], &days->window[2], &days->window[3]);
+}
+
+void solar_time_days_next(solar_time_days_t *days) {
+  days->day++;
+  days->window[0] = days->window[1];
+  days->window[1] = days->window[2];
+  days->window[2] = days->window[3];
+  days->window[3] = solar_coordinates_for_day(days->start, days->day + 2);
+  days->today = days->tomorrow;
+  days->tomorrow =
+      solar_time_from_coordinates(days->coordinates, &days->window[1],
+                                  &days->window[2], &days->window[3]);
 }
 
 double hour_angle(solar_time_t *solar_time, double angle, bool after_transit) {
@@ -46,11 +86,15 @@ double hour_angle(solar_time_t *solar_time, double angle, bool after_transit) {
       solar_time->prevSolar.declination, solar_time->nextSolar.declination);
 }
 
-double afternoon(solar_time_t *solar_time, shadow_length shadow_length) {
+double afternoon_altitude(const solar_time_t *solar_time,
+                          shadow_length shadow_length) {
   double tangent =
       fabs(solar_time->observer->latitude - solar_time->solar.declination);
   double inverse = shadow_length + safe_tan(to_radians(tangent));
-  double angle = to_degrees(safe_atan(1.0 / inverse));
+  return to_degrees(safe_atan(1.0 / inverse));
+}
 
-  return hour_angle(solar_time, angle, true);
+double afternoon(solar_time_t *solar_time, shadow_length shadow_length) {
+  return hour_angle(solar_time, afternoon_altitude(solar_time, shadow_length),
+                    true);
 }
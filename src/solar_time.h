@@ -24,8 +24,53 @@ typedef struct {
 
 solar_time_t new_solar_time(const time_t today, coordinates_t *coordinates);
 
+/**
+ * @brief Build a solar time from already computed solar coordinates
+ *
+ * Same as new_solar_time() for callers that walk consecutive days and can
+ * share the coordinates of yesterday, today and tomorrow between days.
+ */
+solar_time_t solar_time_from_coordinates(coordinates_t *coordinates,
+                                         const solar_coordinates_t *prevSolar,
+                                         const solar_coordinates_t *solar,
+                                         const solar_coordinates_t *nextSolar);
+
+/**
+ * @brief Solar times of consecutive days
+ *
+ * Keeps the solar coordinates of yesterday, today, tomorrow and the day
+ * after, so each step computes one day of solar coordinates and one solar
+ * time instead of the three and two of new_solar_time(). `tomorrow` is
+ * there for the midnight and the high latitude rules of `today`.
+ */
+typedef struct {
+  coordinates_t *coordinates;
+  time_t start;
+  long day;                      /**< Days from `start` to `today` */
+  solar_coordinates_t window[4]; /**< Yesterday to the day after tomorrow */
+  solar_time_t today;
+  solar_time_t tomorrow;
+} solar_time_days_t;
+
+/**
+ * @brief Start at the UTC day of `start`
+ */
+void solar_time_days_init(solar_time_days_t *days, coordinates_t *coordinates,
+                          time_t start);
+
+/**
+ * @brief Move to the next day
+ */
+void solar_time_days_next(solar_time_days_t *days);
+
 double hour_angle(solar_time_t *solar_time, double angle, bool after_transit);
 
+/**
+ * @brief Altitude of the sun when shadows reach the Asr length
+ */
+double afternoon_altitude(const solar_time_t *solar_time,
+                          shadow_length shadow_length);
+
 double afternoon(solar_time_t *solar_time, shadow_length shadow_length);
 
 #endif // ADHAN_SOLAR_TIME_H
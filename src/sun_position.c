@@ -0,0 +1,140 @@
+#include "sun_position.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+#include <math.h>
+
+sun_position_t sun_position(const coordinates_t *coordinates, time_t when) {
+  const time_t day = when - (time_t)normalize_with_bound((double)when,
+                                                         SECONDS_PER_DAY);
+  const solar_coordinates_t solar =
+      new_solar_coordinates(julian_day_from_time_t(day));
+  const solar_coordinates_t prevSolar =
+      new_solar_coordinates(julian_day_from_time_t(add_days(day, -1)));
+  const solar_coordinates_t nextSolar =
+      new_solar_coordinates(julian_day_from_time_t(add_days(day, 1)));
+
+  solar_time_t solar_time = {0};
+  solar_time.observer = coordinates;
+  solar_time.solar = solar;
+  solar_time.prevSolar = prevSolar;
+  solar_time.nextSolar = nextSolar;
+  return solar_time_sun_position(&solar_time, (when - day) / 3600.0);
+}
+
+sun_position_t solar_time_sun_position(const solar_time_t *solar_time,
+                                       double hours) {
+  const double m = hours / 24;
+  const coordinates_t *observer = solar_time->observer;
+  const double theta =
+      unwind_angle(solar_time->solar.apparentSiderealTime + (360.985647 * m));
+  const double alpha = unwind_angle(interpolate_angles(
+      /* value */ solar_time->solar.rightAscension,
+      /* previousValue */ solar_time->prevSolar.rightAscension,
+      /* nextValue */ solar_time->nextSolar.rightAscension, /* factor */ m));
+  const double delta = interpolate_value(
+      /* value */ solar_time->solar.declination,
+      /* previousValue */ solar_time->prevSolar.declination,
+      /* nextValue */ solar_time->nextSolar.declination, /* factor */ m);
+  const double H = theta + observer->longitude - alpha;
+
+  return (sun_position_t){
+      altitude_of_celestial_body(observer->latitude, delta, H),
+      azimuth_of_celestial_body(observer->latitude, delta, H)};
+}
+
+/* Terms of sun_position_curve() shared by every sample */
+typedef struct {
+  double sinPhi, cosPhi;
+  double alpha2, alphaA, alphaB, alphaC;
+  double delta2, deltaA, deltaB, deltaC;
+  double theta0;
+} curve_terms_t;
+
+/* Hour angle in radians and declination terms of the sun `hours` after the
+ * start of the day of the curve */
+static inline void curve_sample(const curve_terms_t *terms, double hours,
+                                double *H, double *sinDelta,
+                                double *cosDelta) {
+  const double radians = M_PI / 180.0;
+  const double m = hours / 24;
+  const double alpha =
+      terms->alpha2 + (m / 2) * (terms->alphaA + terms->alphaB +
+                                 m * terms->alphaC);
+  const double delta =
+      terms->delta2 + (m / 2) * (terms->deltaA + terms->deltaB +
+                                 m * terms->deltaC);
+  *H = (terms->theta0 + 360.985647 * m - alpha) * radians;
+  *sinDelta = sin(delta * radians);
+  *cosDelta = cos(delta * radians);
+}
+
+static inline double curve_altitude(const curve_terms_t *terms, double H,
+                                    double sinDelta, double cosDelta) {
+  double sinAltitude =
+      terms->sinPhi * sinDelta + terms->cosPhi * cosDelta * cos(H);
+  sinAltitude = sinAltitude > 1.0 ? 1.0 : sinAltitude;
+  sinAltitude = sinAltitude < -1.0 ? -1.0 : sinAltitude;
+  return asin(sinAltitude) * (180.0 / M_PI);
+}
+
+/* Same as azimuth_of_celestial_body() with tan(delta) multiplied through by
+ * cos(delta), which keeps the sign of the atan2 terms */
+static inline double curve_azimuth(const curve_terms_t *terms, double H,
+                                   double sinDelta, double cosDelta) {
+  const double azimuth =
+      atan2(sin(H) * cosDelta,
+            cos(H) * terms->sinPhi * cosDelta - sinDelta * terms->cosPhi) *
+          (180.0 / M_PI) +
+      180.0;
+  return azimuth >= 360.0 ? azimuth - 360.0 : azimuth;
+}
+
+void sun_position_curve(const solar_time_t *solar_time, double start_hour,
+                        double step_hours, size_t count, double *altitudes,
+                        double *azimuths) {
+  const double phi = solar_time->observer->latitude * (M_PI / 180.0);
+  curve_terms_t terms;
+  terms.sinPhi = sin(phi);
+  terms.cosPhi = cos(phi);
+
+  /* Interpolation terms of Astronomical Algorithms page 24, as in
+   * interpolate_value() and interpolate_angles() */
+  terms.alpha2 = solar_time->solar.rightAscension;
+  terms.alphaA =
+      unwind_angle(terms.alpha2 - solar_time->prevSolar.rightAscension);
+  terms.alphaB =
+      unwind_angle(solar_time->nextSolar.rightAscension - terms.alpha2);
+  terms.alphaC = terms.alphaB - terms.alphaA;
+  terms.delta2 = solar_time->solar.declination;
+  terms.deltaA = terms.delta2 - solar_time->prevSolar.declination;
+  terms.deltaB = solar_time->nextSolar.declination - terms.delta2;
+  terms.deltaC = terms.deltaB - terms.deltaA;
+  terms.theta0 = solar_time->solar.apparentSiderealTime +
+                 solar_time->observer->longitude;
+
+  /* One loop per set of outputs, so none of them tests which to write */
+  if (altitudes && azimuths) {
+    for (size_t i = 0; i < count; i++) {
+      double H, sinDelta, cosDelta;
+      curve_sample(&terms, start_hour + (double)i * step_hours, &H,
+                   &sinDelta, &cosDelta);
+      altitudes[i] = curve_altitude(&terms, H, sinDelta, cosDelta);
+      azimuths[i] = curve_azimuth(&terms, H, sinDelta, cosDelta);
+    }
+  } else if (altitudes) {
+    for (size_t i = 0; i < count; i++) {
+      double H, sinDelta, cosDelta;
+      curve_sample(&terms, start_hour + (double)i * step_hours, &H,
+                   &sinDelta, &cosDelta);
+      altitudes[i] = curve_altitude(&terms, H, sinDelta, cosDelta);
+    }
+  } else if (azimuths) {
+    for (size_t i = 0; i < count; i++) {
+      double H, sinDelta, cosDelta;
+      curve_sample(&terms, start_hour + (double)i * step_hours, &H,
+                   &sinDelta, &cosDelta);
+      azimuths[i] = curve_azimuth(&terms, H, sinDelta, cosDelta);
+    }
+  }
+}
@@ -0,0 +1,51 @@
+#ifndef ADHAN_SUN_POSITION_H
+#define ADHAN_SUN_POSITION_H
+
+#include "coordinates.h"
+#include "solar_time.h"
+#include <stddef.h>
+#include <time.h>
+
+/**
+ * @brief Horizontal coordinates of the sun
+ *
+ * Geometric position of the sun's center, without refraction. Sunrise and
+ * sunset happen at an altitude of -50/60 degrees.
+ */
+typedef struct {
+  double altitude; /**< Degrees above the horizon */
+  double azimuth;  /**< Degrees from true north, eastward, in [0, 360) */
+} sun_position_t;
+
+/**
+ * @brief Position of the sun at an instant
+ */
+sun_position_t sun_position(const coordinates_t *coordinates, time_t when);
+
+/**
+ * @brief Position of the sun during the day of a solar time
+ *
+ * Interpolates the solar time's yesterday, today and tomorrow coordinates
+ * like corrected_hour_angle() does, without computing a new ephemeris.
+ *
+ * @param[in] hours Hours after the instant the solar time was computed for,
+ * usually 0h UT of the day, in [-24, 24]
+ */
+sun_position_t solar_time_sun_position(const solar_time_t *solar_time,
+                                       double hours);
+
+/**
+ * @brief Sample the sun's path over a day
+ *
+ * Evaluates solar_time_sun_position() at `start_hour + i * step_hours` for
+ * `i` in [0, count), sharing the interpolation and observer terms between
+ * samples.
+ *
+ * @param[out] altitudes Altitudes in degrees, may be NULL
+ * @param[out] azimuths Azimuths in degrees, may be NULL
+ */
+void sun_position_curve(const solar_time_t *solar_time, double start_hour,
+                        double step_hours, size_t count, double *altitudes,
+                        double *azimuths);
+
+#endif /* ADHAN_SUN_POSITION_H */
@@ -0,0 +1,224 @@
+#include "time_format.h"
+#include "calendrical_helper.h"
+#include <stdint.h>
+
+/* Limits of ISO 8601 output, which keep "-999999999-12-31T23:59:59-99:59"
+ * the longest string */
+#define ISO_MAX_YEAR 999999999
+#define ISO_MAX_OFFSET (100 * 3600)
+
+static char *put_2digits(char *out, int value) {
+  out[0] = (char)('0' + value / 10);
+  out[1] = (char)('0' + value % 10);
+  return out + 2;
+}
+
+static char *put_int(char *out, int value) {
+  char digits[12];
+  int length = 0;
+  unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+
+  if (value < 0) {
+    *out++ = '-';
+  }
+  do {
+    digits[length++] = (char)('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude);
+  while (length) {
+    *out++ = digits[--length];
+  }
+  return out;
+}
+
+static size_t write_time(time_t when, int utc_offset, time_format_t format,
+                         char *buffer) {
+  char *out = buffer;
+
+  if (when == 0) {
+    out[0] = out[1] = '-';
+    out[2] = ':';
+    out[3] = out[4] = '-';
+    out[5] = '\0';
+    return 5;
+  }
+
+  const int64_t local = (int64_t)when + utc_offset;
+  const int64_t days = floor_div(local, SECONDS_PER_DAY);
+  const int seconds = (int)(local - days * SECONDS_PER_DAY);
+  const int hour = seconds / 3600;
+  const int minute = (seconds / 60) % 60;
+
+  switch (format) {
+  case TIME_FORMAT_12H: {
+    const int clock_hour = (hour % 12 == 0) ? 12 : hour % 12;
+    out = put_2digits(out, clock_hour);
+    *out++ = ':';
+    out = put_2digits(out, minute);
+    *out++ = ' ';
+    *out++ = hour < 12 ? 'A' : 'P';
+    *out++ = 'M';
+    break;
+  }
+  case TIME_FORMAT_ISO8601: {
+    int year, month, day;
+    /* Nothing is written past the limits; the bound on days keeps the year
+     * of civil_from_days() within an int */
+    if (utc_offset <= -ISO_MAX_OFFSET || utc_offset >= ISO_MAX_OFFSET ||
+        days < -366LL * ISO_MAX_YEAR || days > 366LL * ISO_MAX_YEAR) {
+      break;
+    }
+    civil_from_days((long)days, &year, &month, &day);
+    if (year < -ISO_MAX_YEAR || year > ISO_MAX_YEAR) {
+      break;
+    }
+    if (year < 0 || year > 9999) {
+      out = put_int(out, year);
+    } else {
+      out = put_2digits(out, year / 100);
+      out = put_2digits(out, year % 100);
+    }
+    *out++ = '-';
+    out = put_2digits(out, month);
+    *out++ = '-';
+    out = put_2digits(out, day);
+    *out++ = 'T';
+    out = put_2digits(out, hour);
+    *out++ = ':';
+    out = put_2digits(out, minute);
+    *out++ = ':';
+    out = put_2digits(out, seconds % 60);
+    if (utc_offset == 0) {
+      *out++ = 'Z';
+    } else {
+      const int magnitude = utc_offset < 0 ? -utc_offset : utc_offset;
+      *out++ = utc_offset < 0 ? '-' : '+';
+      out = put_2digits(out, magnitude / 3600);
+      *out++ = ':';
+      out = put_2digits(out, (magnitude / 60) % 60);
+    }
+    break;
+  }
+  case TIME_FORMAT_MINUTES:
+    out = put_int(out, seconds / 60);
+    break;
+  case TIME_FORMAT_24H:
+  default:
+    out = put_2digits(out, hour);
+    *out++ = ':';
+    out = put_2digits(out, minute);
+    break;
+  }
+
+  *out = '\0';
+  return (size_t)(out - buffer);
+}
+
+int utc_offset_at(const utc_offset_table_t *table, time_t when) {
+  if (!table || !table->entries || table->count == 0) {
+    return 0;
+  }
+
+  /* Last entry whose `since` is not after `when` */
+  size_t low = 0;
+  size_t high = table->count;
+  while (high - low > 1) {
+    const size_t mid = low + (high - low) / 2;
+    if (table->entries[mid].since <= when) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return table->entries[low].offset;
+}
+
+int minutes_of_day(time_t when, int utc_offset) {
+  const int64_t local = (int64_t)when + utc_offset;
+  const int64_t days = floor_div(local, SECONDS_PER_DAY);
+  return (int)((local - days * SECONDS_PER_DAY) / 60);
+}
+
+size_t format_time(time_t when, int utc_offset, time_format_t format,
+                   char *buffer, size_t size) {
+  char scratch[TIME_FORMAT_MAX_LENGTH];
+
+  if (!buffer || size == 0) {
+    return 0;
+  }
+  if (size >= TIME_FORMAT_MAX_LENGTH) {
+    return write_time(when, utc_offset, format, buffer);
+  }
+
+  const size_t length = write_time(when, utc_offset, format, scratch);
+  if (length >= size) {
+    buffer[0] = '\0';
+    return 0;
+  }
+  for (size_t i = 0; i <= length; i++) {
+    buffer[i] = scratch[i];
+  }
+  return length;
+}
+
+static void prayer_times_fields(const prayer_times_t *prayer_times,
+                                time_t fields[TIME_FORMAT_FIELDS_PER_DAY]) {
+  fields[0] = prayer_times->fajr;
+  fields[1] = prayer_times->sunrise;
+  fields[2] = prayer_times->dhuhr;
+  fields[3] = prayer_times->asr;
+  fields[4] = prayer_times->maghrib;
+  fields[5] = prayer_times->isha;
+  fields[6] = prayer_times->midnight;
+}
+
+size_t format_prayer_times(const prayer_times_t *prayer_times, int utc_offset,
+                           time_format_t format, char *buffer, size_t stride) {
+  time_t fields[TIME_FORMAT_FIELDS_PER_DAY];
+
+  if (!prayer_times || !buffer || stride < TIME_FORMAT_MAX_LENGTH) {
+    return 0;
+  }
+
+  prayer_times_fields(prayer_times, fields);
+  for (int i = 0; i < TIME_FORMAT_FIELDS_PER_DAY; i++) {
+    write_time(fields[i], utc_offset, format, buffer + i * stride);
+  }
+  return TIME_FORMAT_FIELDS_PER_DAY;
+}
+
+size_t format_timetable(const prayer_times_t *timetable, size_t count,
+                        const utc_offset_table_t *offsets,
+                        time_format_t format, char *buffer, size_t stride) {
+  time_t fields[TIME_FORMAT_FIELDS_PER_DAY];
+  const utc_offset_entry_t *entries = offsets ? offsets->entries : NULL;
+  const size_t entry_count = entries ? offsets->count : 0;
+  size_t current = 0;
+  size_t written = 0;
+
+  if (!timetable || !buffer || stride < TIME_FORMAT_MAX_LENGTH) {
+    return 0;
+  }
+
+  for (size_t day = 0; day < count; day++) {
+    prayer_times_fields(&timetable[day], fields);
+    for (int i = 0; i < TIME_FORMAT_FIELDS_PER_DAY; i++) {
+      int utc_offset = 0;
+      if (entry_count) {
+        /* Times only move forward in a sorted timetable, so the current
+         * entry is almost always still valid or the next one. */
+        if (fields[i] < entries[current].since && current > 0) {
+          current = 0;
+        }
+        while (current + 1 < entry_count &&
+               entries[current + 1].since <= fields[i]) {
+          current++;
+        }
+        utc_offset = entries[current].offset;
+      }
+      write_time(fields[i], utc_offset, format, buffer + written * stride);
+      written++;
+    }
+  }
+  return written;
+}
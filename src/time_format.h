@@ -0,0 +1,101 @@
+#ifndef ADHAN_TIME_FORMAT_H
+#define ADHAN_TIME_FORMAT_H
+
+#include "prayer_times.h"
+#include <stddef.h>
+#include <time.h>
+
+/**
+ * Size of a buffer large enough for any format, including the terminating
+ * NUL ("-999999999-12-31T23:59:59-99:59" is the longest output).
+ */
+#define TIME_FORMAT_MAX_LENGTH 32
+
+/** Number of fields written per day by the prayer times formatters. */
+#define TIME_FORMAT_FIELDS_PER_DAY 7
+
+typedef enum {
+  TIME_FORMAT_24H,     /**< "16:05" */
+  TIME_FORMAT_12H,     /**< "04:05 PM", same as strftime "%I:%M %p" */
+  TIME_FORMAT_ISO8601, /**< "2015-07-12T16:05:00-04:00" */
+  TIME_FORMAT_MINUTES  /**< Minutes since local midnight, "965" */
+} time_format_t;
+
+/**
+ * @brief One entry of a UTC offset table
+ */
+typedef struct {
+  time_t since; /**< First UTC instant at which the offset applies */
+  int offset;   /**< Offset in seconds east of UTC */
+} utc_offset_entry_t;
+
+/**
+ * @brief Precomputed UTC offsets of a time zone, sorted by `since`
+ *
+ * Instants before the first entry use the first entry's offset. A table with
+ * a single entry describes a fixed offset.
+ */
+typedef struct {
+  const utc_offset_entry_t *entries;
+  size_t count;
+} utc_offset_table_t;
+
+/**
+ * @brief Find the UTC offset in seconds that applies at an instant
+ * @return Offset in seconds east of UTC, 0 for an empty table
+ */
+int utc_offset_at(const utc_offset_table_t *table, time_t when);
+
+/**
+ * @brief Minutes elapsed since local midnight
+ * @param[in] when UTC instant
+ * @param[in] utc_offset Offset in seconds east of UTC
+ * @return Minutes in [0, 1439]
+ */
+int minutes_of_day(time_t when, int utc_offset);
+
+/**
+ * @brief Format an instant into a caller provided buffer
+ *
+ * Uses no locale or time zone database. A zero instant, which the library
+ * returns for failed calculations, is written as "--:--". TIME_FORMAT_ISO8601
+ * writes nothing for offsets of 100 hours or more, or years of more than nine
+ * digits.
+ *
+ * @param[in] when UTC instant
+ * @param[in] utc_offset Offset in seconds east of UTC
+ * @param[in] format Output format
+ * @param[out] buffer Destination buffer, always NUL terminated on success
+ * @param[in] size Size of the destination buffer
+ * @return Number of characters written excluding the NUL, 0 if the buffer is
+ * too small or nothing could be written
+ */
+size_t format_time(time_t when, int utc_offset, time_format_t format,
+                   char *buffer, size_t size);
+
+/**
+ * @brief Format the seven times of a day
+ *
+ * Fields are written in prayer order (fajr, sunrise, dhuhr, asr, maghrib,
+ * isha, midnight), each one `stride` bytes after the previous one.
+ *
+ * @return Number of fields written, 0 if `stride` is too small
+ */
+size_t format_prayer_times(const prayer_times_t *prayer_times, int utc_offset,
+                           time_format_t format, char *buffer, size_t stride);
+
+/**
+ * @brief Format a whole timetable in one pass
+ *
+ * Writes TIME_FORMAT_FIELDS_PER_DAY fields per day, `stride` bytes apart, so
+ * `buffer` must hold `count * TIME_FORMAT_FIELDS_PER_DAY * stride` bytes.
+ * Offsets are looked up incrementally, which is linear in the size of the
+ * timetable when it is sorted by date.
+ *
+ * @return Number of fields written, 0 if `stride` is too small
+ */
+size_t format_timetable(const prayer_times_t *timetable, size_t count,
+                        const utc_offset_table_t *offsets,
+                        time_format_t format, char *buffer, size_t stride);
+
+#endif /* ADHAN_TIME_FORMAT_H */
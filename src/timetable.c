@@ -0,0 +1,174 @@
+#include "timetable.h"
+#include "calendrical_helper.h"
+#include "solar_time.h"
+#include <limits.h>
+
+hijri_month_adjustments_t
+umm_al_qura_ramadan_adjustments(const calculation_parameters_t *parameters) {
+  hijri_month_adjustments_t adjustments = {{false}, {{0}}};
+  prayer_adjustments_t ramadan = parameters
+                                     ? parameters->adjustments
+                                     : INIT_PRAYER_ADJUSTMENTS();
+  ramadan.isha += 30;
+  adjustments.has_month[RAMADAN - 1] = true;
+  adjustments.months[RAMADAN - 1] = ramadan;
+  return adjustments;
+}
+
+/* Parameters of each day with the overrides of its Hijri month */
+typedef struct {
+  const hijri_month_adjustments_t *adjustments;
+  calculation_parameters_t *parameters;
+  /* One copy of the parameters per overridden month, so the per day work is
+   * a pointer selection. */
+  calculation_parameters_t months[12];
+  hijri_date_t hijri;
+  long month_end;
+} hijri_parameters_t;
+
+static void
+init_hijri_parameters(hijri_parameters_t *state,
+                      calculation_parameters_t *parameters,
+                      const hijri_month_adjustments_t *adjustments) {
+  state->adjustments = adjustments;
+  state->parameters = parameters;
+  state->hijri = (hijri_date_t){0, 0, 0};
+  state->month_end = LONG_MIN;
+  if (adjustments) {
+    for (int i = 0; i < 12; i++) {
+      state->months[i] = *parameters;
+      if (adjustments->has_month[i]) {
+        state->months[i].adjustments = adjustments->months[i];
+      }
+    }
+  }
+}
+
+/* Parameters of `day`, in days since the epoch, for increasing days */
+static calculation_parameters_t *
+hijri_parameters_for_day(hijri_parameters_t *state, long day) {
+  if (!state->adjustments) {
+    return state->parameters;
+  }
+  if (day >= state->month_end || state->month_end == LONG_MIN) {
+    state->hijri = hijri_from_days(day);
+    state->month_end = day - (state->hijri.day - 1) +
+                       hijri_month_length(state->hijri.year,
+                                          state->hijri.month);
+  }
+  return &state->months[state->hijri.month - 1];
+}
+
+/* Prayer times of consecutive days, with their extended times when
+ * `extended` is not NULL */
+static size_t compute_range(coordinates_t *coordinates, time_t start,
+                            size_t days, calculation_parameters_t *parameters,
+                            const hijri_month_adjustments_t *hijri_adjustments,
+                            const extended_parameters_t *extended,
+                            prayer_times_t *timetable,
+                            extended_times_t *extended_timetable) {
+  hijri_parameters_t hijri;
+  const long first_day = floor_div((int64_t)start, SECONDS_PER_DAY);
+  init_hijri_parameters(&hijri, parameters, hijri_adjustments);
+
+  solar_time_days_t solar;
+  solar_time_days_init(&solar, coordinates, start);
+  prayer_day_t today_date = new_prayer_day(start);
+  prayer_carry_t carry = {false, 0, {0, 0, 0, 0, {0, 0}}};
+
+  for (size_t i = 0; i < days; i++) {
+    const prayer_day_t tomorrow_date =
+        new_prayer_day(add_days(start, (int)i + 1));
+
+    calculation_parameters_t *day_parameters =
+        hijri_parameters_for_day(&hijri, first_day + (long)i);
+    timetable[i] = prayer_times_with_carry(coordinates, &today_date,
+                                           day_parameters, &solar.today,
+                                           &tomorrow_date, &solar.tomorrow,
+                                           &carry);
+    if (extended) {
+      extended_timetable[i] = extended_times_from_solar_time(
+          &solar.today, &today_date, day_parameters, &timetable[i], extended);
+    }
+
+    today_date = tomorrow_date;
+    solar_time_days_next(&solar);
+  }
+  return days;
+}
+
+size_t new_prayer_times_range(
+    coordinates_t *coordinates, time_t start, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    prayer_times_t *timetable) {
+  if (!coordinates || !parameters || !timetable || days == 0) {
+    return 0;
+  }
+  return compute_range(coordinates, start, days, parameters,
+                       hijri_adjustments, NULL, timetable, NULL);
+}
+
+size_t new_extended_times_range(
+    coordinates_t *coordinates, time_t start, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    const extended_parameters_t *extended, prayer_times_t *timetable,
+    extended_times_t *extended_timetable) {
+  if (!coordinates || !parameters || !extended || !timetable ||
+      !extended_timetable || days == 0) {
+    return 0;
+  }
+  return compute_range(coordinates, start, days, parameters,
+                       hijri_adjustments, extended, timetable,
+                       extended_timetable);
+}
+
+size_t new_prayer_base_range(coordinates_t *coordinates, time_t start,
+                             size_t days,
+                             const calculation_parameters_t *parameters,
+                             prayer_base_t *bases) {
+  if (!coordinates || !parameters || !bases || days == 0) {
+    return 0;
+  }
+
+  solar_time_days_t solar;
+  solar_time_days_init(&solar, coordinates, start);
+  prayer_day_t today_date = new_prayer_day(start);
+
+  for (size_t i = 0; i < days; i++) {
+    const prayer_day_t tomorrow_date =
+        new_prayer_day(add_days(start, (int)i + 1));
+
+    if (!prayer_base_from_prayer_day(coordinates, &today_date, parameters,
+                                     &solar.today, &tomorrow_date,
+                                     &solar.tomorrow, &bases[i])) {
+      return 0;
+    }
+
+    today_date = tomorrow_date;
+    solar_time_days_next(&solar);
+  }
+  return days;
+}
+
+size_t prayer_times_from_base_range(
+    const prayer_base_t *bases, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    prayer_times_t *timetable) {
+  if (!bases || !parameters || !timetable || days == 0 ||
+      !prayer_base_matches(&bases[0], parameters)) {
+    return 0;
+  }
+
+  hijri_parameters_t hijri;
+  init_hijri_parameters(&hijri, parameters, hijri_adjustments);
+
+  for (size_t i = 0; i < days; i++) {
+    const long day = floor_div((int64_t)bases[i].date.date, SECONDS_PER_DAY);
+    timetable[i] = prayer_times_from_base(
+        &bases[i], hijri_parameters_for_day(&hijri, day));
+  }
+  return days;
+}
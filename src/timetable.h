@@ -0,0 +1,106 @@
+#ifndef ADHAN_TIMETABLE_H
+#define ADHAN_TIMETABLE_H
+
+#include "calculation_parameters.h"
+#include "coordinates.h"
+#include "extended_times.h"
+#include "hijri_calendar.h"
+#include "prayer_adjustments.h"
+#include "prayer_times.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+/**
+ * @brief Adjustments that replace the parameters' adjustments during given
+ * Hijri months
+ */
+typedef struct {
+  bool has_month[12];              /**< Indexed by hijri_month_t - 1 */
+  prayer_adjustments_t months[12]; /**< Used when has_month is set */
+} hijri_month_adjustments_t;
+
+/**
+ * @brief Adjustments for the Umm al-Qura +30 minute Isha during Ramadan
+ *
+ * Uses the parameters' adjustments for every month, with Isha delayed by 30
+ * more minutes during Ramadan.
+ */
+hijri_month_adjustments_t
+umm_al_qura_ramadan_adjustments(const calculation_parameters_t *parameters);
+
+/**
+ * @brief Compute prayer times for consecutive days
+ *
+ * Produces the same times as calling new_prayer_times() for `start` and each
+ * of the following `days - 1` days, but computes the solar coordinates of
+ * each day only once instead of up to six times.
+ *
+ * When `hijri_adjustments` is not NULL, days that fall in a Hijri month with
+ * an override use that month's adjustments instead of
+ * `parameters->adjustments`. Hijri dates follow the Umm al-Qura calendar for
+ * the UTC date of each day.
+ *
+ * @param[out] timetable Array of at least `days` entries
+ * @return Number of days written, 0 on invalid arguments
+ */
+size_t new_prayer_times_range(
+    coordinates_t *coordinates, time_t start, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    prayer_times_t *timetable);
+
+/**
+ * @brief Compute prayer times and extended times for consecutive days
+ *
+ * Same prayer times as new_prayer_times_range(), with the extended times of
+ * each day from the solar time its prayer times were computed with, so they
+ * only add two hour angles per day.
+ *
+ * @param[out] timetable Array of at least `days` entries
+ * @param[out] extended_timetable Array of at least `days` entries
+ * @return Number of days written, 0 on invalid arguments
+ */
+size_t new_extended_times_range(
+    coordinates_t *coordinates, time_t start, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    const extended_parameters_t *extended, prayer_times_t *timetable,
+    extended_times_t *extended_timetable);
+
+/**
+ * @brief Compute the astronomical stage of consecutive days
+ *
+ * Computes the prayer_base_t of `start` and each of the following
+ * `days - 1` days, with the events of every high latitude rule for the Fajr
+ * and Isha angles of `parameters`, sharing solar coordinates between days
+ * like new_prayer_times_range().
+ *
+ * @param[out] bases Array of at least `days` entries
+ * @return Number of days written, 0 on invalid arguments
+ */
+size_t new_prayer_base_range(coordinates_t *coordinates, time_t start,
+                             size_t days,
+                             const calculation_parameters_t *parameters,
+                             prayer_base_t *bases);
+
+/**
+ * @brief Compute prayer times of consecutive days from their astronomical
+ * stage
+ *
+ * Same result as new_prayer_times_range() for the days of `bases`, applying
+ * only the policy of `parameters` and `hijri_adjustments` to each day. A
+ * year of timetable takes a few microseconds, so settings can be changed
+ * without recomputing the astronomy.
+ *
+ * @param[out] timetable Array of at least `days` entries
+ * @return Number of days written, 0 on invalid arguments or when
+ * prayer_base_matches() is false for `parameters`
+ */
+size_t prayer_times_from_base_range(
+    const prayer_base_t *bases, size_t days,
+    calculation_parameters_t *parameters,
+    const hijri_month_adjustments_t *hijri_adjustments,
+    prayer_times_t *timetable);
+
+#endif /* ADHAN_TIMETABLE_H */
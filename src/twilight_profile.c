@@ -0,0 +1,243 @@
+#include "twilight_profile.h"
+#include "astronomical.h"
+#include "calendrical_helper.h"
+#include "double_utils.h"
+#include "solar_coordinates.h"
+#include "time_format.h"
+#include <math.h>
+
+/* Terms of a day shared by every angle of a sweep */
+typedef struct {
+  double sinPhi, cosPhi;
+  double sinDelta2, cosDelta2;
+  double alpha2, alphaAB, alphaC;
+  double deltaAB, deltaC;
+  double theta0;
+} sweep_terms_t;
+
+/* sin(x) and cos(x) for |x| below 0.2 radians, to double precision. Taylor
+ * series in Horner form with multiplications only, since the divisions are
+ * not folded without -ffast-math. */
+static void small_sincos(double x, double *sine, double *cosine) {
+  const double x2 = x * x;
+  *sine = x * (1 + x2 * (-1.0 / 6 +
+                         x2 * (1.0 / 120 +
+                               x2 * (-1.0 / 5040 + x2 * (1.0 / 362880)))));
+  *cosine =
+      1 + x2 * (-1.0 / 2 +
+                x2 * (1.0 / 24 + x2 * (-1.0 / 720 + x2 * (1.0 / 40320))));
+}
+
+/*
+ * One side of corrected_hour_angle(), `side` being -1 before the transit
+ * and 1 after it, from the hour angle H0 of the altitude h0.
+ *
+ * At the uncorrected time the hour angle is side * H0 plus a few degrees
+ * from the sidereal rate and the motion of the sun, and the altitude is h0
+ * plus the error of the first approximation. Both offsets are small, so
+ * their sines and cosines are expanded as series around the known values
+ * instead of calling sin(), cos() and asin() for every angle.
+ */
+static double corrected_side(const sweep_terms_t *terms, double m0,
+                             double side, double H0, double cosH0,
+                             double sinH0, double h0, double sinh0,
+                             double cosh0) {
+  const double radians = M_PI / 180.0;
+  const double degrees = 180.0 / M_PI;
+  const double m = m0 + side * H0 * (1.0 / 360);
+
+  const double alpha =
+      terms->alpha2 + (m / 2) * (terms->alphaAB + m * terms->alphaC);
+  const double d = (m / 2) * (terms->deltaAB + m * terms->deltaC) * radians;
+  double sinD, cosD;
+  small_sincos(d, &sinD, &cosD);
+  const double sinDelta = terms->sinDelta2 * cosD + terms->cosDelta2 * sinD;
+  const double cosDelta = terms->cosDelta2 * cosD - terms->sinDelta2 * sinD;
+
+  double epsilon = terms->theta0 + 360.985647 * m - alpha - side * H0;
+  epsilon =
+      (epsilon - 360.0 * floor(epsilon * (1.0 / 360) + 0.5)) * radians;
+  double cosH, sinH;
+  if (fabs(epsilon) < 0.2) {
+    double sinE, cosE;
+    small_sincos(epsilon, &sinE, &cosE);
+    cosH = cosH0 * cosE - side * sinH0 * sinE;
+    sinH = side * sinH0 * cosE + cosH0 * sinE;
+  } else {
+    const double H = side * H0 * radians + epsilon;
+    cosH = cos(H);
+    sinH = sin(H);
+  }
+
+  double sinAltitude =
+      terms->sinPhi * sinDelta + terms->cosPhi * cosDelta * cosH;
+  sinAltitude = sinAltitude > 1.0 ? 1.0 : sinAltitude;
+  sinAltitude = sinAltitude < -1.0 ? -1.0 : sinAltitude;
+
+  /* h - h0 from sin(h - h0) */
+  const double x =
+      sinAltitude * cosh0 - sqrt(1 - sinAltitude * sinAltitude) * sinh0;
+  double term3;
+  if (fabs(x) < 0.1) {
+    const double x2 = x * x;
+    term3 = x *
+            (1 + x2 * (1.0 / 6 +
+                       x2 * (3.0 / 40 + x2 * (15.0 / 336 + x2 * (105.0 /
+                                                                 3456))))) *
+            degrees;
+  } else {
+    term3 = asin(sinAltitude) * degrees - h0;
+  }
+
+  const double term4 = 360 * cosDelta * terms->cosPhi * sinH;
+  double deltam = fabs(term4) > 1e-10 ? term3 / term4 : 0.0;
+  deltam = deltam > 0.5 ? 0.5 : deltam;
+  deltam = deltam < -0.5 ? -0.5 : deltam;
+  return (m + deltam) * 24;
+}
+
+void twilight_sweep(const solar_time_t *solar_time, double first_depression,
+                    double step, size_t count, double *morning,
+                    double *evening) {
+  const double radians = M_PI / 180.0;
+  const double degrees = 180.0 / M_PI;
+  const double phi = solar_time->observer->latitude * radians;
+  const double delta2 = solar_time->solar.declination;
+  const double m0 = solar_time->approximateTransit;
+
+  /* Interpolation terms of Astronomical Algorithms page 24, as in
+   * interpolate_value() and interpolate_angles() */
+  const double alpha2 = solar_time->solar.rightAscension;
+  const double alphaA =
+      unwind_angle(alpha2 - solar_time->prevSolar.rightAscension);
+  const double alphaB =
+      unwind_angle(solar_time->nextSolar.rightAscension - alpha2);
+  const double deltaA = delta2 - solar_time->prevSolar.declination;
+  const double deltaB = solar_time->nextSolar.declination - delta2;
+  const sweep_terms_t terms = {
+      .sinPhi = sin(phi),
+      .cosPhi = cos(phi),
+      .sinDelta2 = sin(delta2 * radians),
+      .cosDelta2 = cos(delta2 * radians),
+      .alpha2 = alpha2,
+      .alphaAB = alphaA + alphaB,
+      .alphaC = alphaB - alphaA,
+      .deltaAB = deltaA + deltaB,
+      .deltaC = deltaB - deltaA,
+      .theta0 = solar_time->solar.apparentSiderealTime +
+                solar_time->observer->longitude};
+
+  /* Hour angle terms of corrected_hour_angle() that do not depend on the
+   * altitude */
+  const double term1 = terms.sinPhi * terms.sinDelta2;
+  const double term2 = terms.cosPhi * terms.cosDelta2;
+  const double inverseTerm2 = 1.0 / term2;
+
+  /* sin(h0) for successive altitudes by rotating by -step, resynchronized
+   * every 64 angles to bound the rounding error */
+  const double sinStep = sin(step * radians);
+  const double cosStep = cos(step * radians);
+  double sinh0 = 0.0;
+  double cosh0 = 1.0;
+
+  for (size_t i = 0; i < count; i++) {
+    const double h0 = -(first_depression + (double)i * step);
+    if (i % 64 == 0) {
+      sinh0 = sin(h0 * radians);
+      cosh0 = cos(h0 * radians);
+    } else {
+      const double sinNext = sinh0 * cosStep - cosh0 * sinStep;
+      cosh0 = cosh0 * cosStep + sinh0 * sinStep;
+      sinh0 = sinNext;
+    }
+
+    const double ratio = (sinh0 - term1) * inverseTerm2;
+    const bool reached = fabs(term2) >= 1e-10 && fabs(ratio) <= 1.0;
+    const double cosH0 = reached ? ratio : 0.0;
+    const double sinH0 = sqrt(1 - cosH0 * cosH0);
+    const double H0 = acos(cosH0) * degrees;
+
+    /* Equation from Astronomical Algorithms page 103, one correction for
+     * each side of the transit */
+    if (morning) {
+      morning[i] = reached ? corrected_side(&terms, m0, -1.0, H0, cosH0,
+                                            sinH0, h0, sinh0, cosh0)
+                           : NAN;
+    }
+    if (evening) {
+      evening[i] = reached ? corrected_side(&terms, m0, 1.0, H0, cosH0,
+                                            sinH0, h0, sinh0, cosh0)
+                           : NAN;
+    }
+  }
+}
+
+size_t twilight_profile(coordinates_t *coordinates,
+                        twilight_profile_t *profile) {
+  if (!coordinates || !profile || profile->days == 0 || profile->count == 0 ||
+      (!profile->morning && !profile->evening)) {
+    return 0;
+  }
+
+  solar_time_days_t solar;
+  solar_time_days_init(&solar, coordinates, profile->start);
+
+  for (size_t i = 0; i < profile->days; i++) {
+    const size_t offset = i * profile->count;
+
+    twilight_sweep(&solar.today, profile->first_depression, profile->step,
+                   profile->count,
+                   profile->morning ? profile->morning + offset : NULL,
+                   profile->evening ? profile->evening + offset : NULL);
+    solar_time_days_next(&solar);
+  }
+  return profile->days;
+}
+
+/* Writes a time of the profile, nothing when the sun does not reach the
+ * depression */
+static int write_crossing(FILE *out, time_t day, const double *times,
+                          size_t index, int utc_offset) {
+  char buffer[TIME_FORMAT_MAX_LENGTH];
+
+  if (!times || isnan(times[index])) {
+    return 0;
+  }
+  format_time(day + (time_t)lround(times[index] * 3600), utc_offset,
+              TIME_FORMAT_ISO8601, buffer, sizeof buffer);
+  return fputs(buffer, out);
+}
+
+size_t twilight_profile_csv(const twilight_profile_t *profile, int utc_offset,
+                            FILE *out) {
+  char date[TIME_FORMAT_MAX_LENGTH];
+  size_t rows = 0;
+
+  if (!profile || !out || (!profile->morning && !profile->evening)) {
+    return 0;
+  }
+  if (fputs("date,depression,morning,evening\n", out) < 0) {
+    return 0;
+  }
+
+  const long first_day = floor_div((int64_t)profile->start, SECONDS_PER_DAY);
+  for (size_t i = 0; i < profile->days; i++) {
+    const time_t day = (time_t)(first_day + (long)i) * SECONDS_PER_DAY;
+
+    format_time(day, 0, TIME_FORMAT_ISO8601, date, sizeof date);
+    date[10] = '\0'; /* Keep YYYY-MM-DD */
+    for (size_t j = 0; j < profile->count; j++) {
+      const size_t index = i * profile->count + j;
+      if (fprintf(out, "%s,%g,", date,
+                  profile->first_depression + (double)j * profile->step) < 0 ||
+          write_crossing(out, day, profile->morning, index, utc_offset) < 0 ||
+          fputc(',', out) == EOF ||
+          write_crossing(out, day, profile->evening, index, utc_offset) < 0 ||
+          fputc('\n', out) == EOF) {
+        return 0;
+      }
+      rows++;
+    }
+  }
+  return rows;
+}
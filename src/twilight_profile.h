@@ -0,0 +1,66 @@
+#ifndef ADHAN_TWILIGHT_PROFILE_H
+#define ADHAN_TWILIGHT_PROFILE_H
+
+#include "coordinates.h"
+#include "solar_time.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @brief Times at which the sun crosses a sweep of depression angles
+ *
+ * Row major matrices of `days * count` hours, the `count` depressions of the
+ * first day followed by those of the next days. Hours are counted from 0h UT
+ * of each day, like the fields of solar_time_t, and are NAN on days when the
+ * sun does not reach the depression.
+ */
+typedef struct {
+  time_t start;            /**< First day, at 0h UT */
+  size_t days;             /**< Number of days */
+  double first_depression; /**< First depression below the horizon, degrees */
+  double step;             /**< Depression step in degrees */
+  size_t count;            /**< Number of depressions per day */
+  double *morning;         /**< Crossings before transit, may be NULL */
+  double *evening;         /**< Crossings after transit, may be NULL */
+} twilight_profile_t;
+
+/**
+ * @brief Cross a sweep of depression angles on one day
+ *
+ * Same times as hour_angle() for the altitudes `-first_depression`,
+ * `-(first_depression + step)`, ..., with the terms shared by all angles
+ * computed once, and NAN instead of an estimate when the sun does not reach
+ * an angle.
+ *
+ * @param[out] morning Array of `count` hours before transit, may be NULL
+ * @param[out] evening Array of `count` hours after transit, may be NULL
+ */
+void twilight_sweep(const solar_time_t *solar_time, double first_depression,
+                    double step, size_t count, double *morning,
+                    double *evening);
+
+/**
+ * @brief Fill a twilight profile for consecutive days
+ *
+ * Shares the solar coordinates of each day between the days before and
+ * after it, as new_prayer_times_range() does.
+ *
+ * @return Number of days written, 0 on invalid arguments
+ */
+size_t twilight_profile(coordinates_t *coordinates,
+                        twilight_profile_t *profile);
+
+/**
+ * @brief Write a twilight profile as CSV
+ *
+ * One `date,depression,morning,evening` row per day and depression, with
+ * ISO 8601 times at `utc_offset` seconds from UTC and empty fields where the
+ * sun does not reach the depression.
+ *
+ * @return Number of rows written, not counting the header, 0 on error
+ */
+size_t twilight_profile_csv(const twilight_profile_t *profile, int utc_offset,
+                            FILE *out);
+
+#endif /* ADHAN_TWILIGHT_PROFILE_H */
@@ -0,0 +1,172 @@
+/*
+ * Generated by tools/hijri_table_gen.c, do not edit.
+ *
+ * First day of every Umm al-Qura month from Muharram 1423 to the
+ * month after Dhu al-Hijjah 1500, in days since umm_al_qura_epoch
+ * (1 Muharram 1423, in days since 1970-01-01).
+ */
+#include <stdint.h>
+
+const int umm_al_qura_first_year = 1423;
+const int umm_al_qura_last_year = 1500;
+const long umm_al_qura_epoch = 11761;
+
+const uint16_t umm_al_qura_month_starts[] = {
+    /* 1423 */ 0, 30, 59, 89, 118, 148,
+               177, 206, 236, 265, 295, 324,
+    /* 1424 */ 354, 384, 413, 443, 473, 502,
+               532, 561, 590, 620, 649, 679,
+    /* 1425 */ 708, 738, 767, 797, 827, 856,
+               886, 915, 945, 975, 1004, 1034,
+    /* 1426 */ 1063, 1092, 1122, 1151, 1181, 1210,
+               1240, 1270, 1299, 1329, 1359, 1388,
+    /* 1427 */ 1418, 1447, 1476, 1506, 1535, 1564,
+               1594, 1624, 1654, 1683, 1713, 1743,
+    /* 1428 */ 1772, 1802, 1831, 1860, 1890, 1919,
+               1948, 1978, 2008, 2038, 2067, 2097,
+    /* 1429 */ 2127, 2156, 2186, 2215, 2244, 2274,
+               2303, 2332, 2362, 2392, 2421, 2451,
+    /* 1430 */ 2481, 2510, 2540, 2570, 2599, 2628,
+               2658, 2687, 2717, 2746, 2776, 2805,
+    /* 1431 */ 2835, 2864, 2894, 2924, 2953, 2983,
+               3012, 3042, 3071, 3101, 3130, 3159,
+    /* 1432 */ 3189, 3218, 3248, 3278, 3308, 3337,
+               3367, 3396, 3426, 3455, 3485, 3514,
+    /* 1433 */ 3543, 3573, 3602, 3632, 3662, 3691,
+               3721, 3751, 3780, 3810, 3839, 3869,
+    /* 1434 */ 3898, 3927, 3957, 3986, 4016, 4045,
+               4075, 4105, 4134, 4164, 4194, 4223,
+    /* 1435 */ 4252, 4282, 4311, 4341, 4370, 4400,
+               4429, 4459, 4488, 4518, 4548, 4577,
+    /* 1436 */ 4607, 4636, 4666, 4695, 4725, 4754,
+               4784, 4813, 4843, 4872, 4902, 4931,
+    /* 1437 */ 4961, 4991, 5020, 5050, 5080, 5109,
+               5138, 5168, 5197, 5227, 5256, 5285,
+    /* 1438 */ 5315, 5345, 5374, 5404, 5434, 5464,
+               5493, 5522, 5552, 5581, 5610, 5640,
+    /* 1439 */ 5669, 5699, 5728, 5758, 5788, 5818,
+               5847, 5877, 5906, 5936, 5965, 5994,
+    /* 1440 */ 6024, 6053, 6083, 6112, 6142, 6172,
+               6202, 6231, 6261, 6290, 6320, 6349,
+    /* 1441 */ 6378, 6408, 6437, 6467, 6496, 6526,
+               6556, 6585, 6615, 6645, 6674, 6704,
+    /* 1442 */ 6733, 6762, 6792, 6821, 6851, 6880,
+               6910, 6939, 6969, 6999, 7028, 7058,
+    /* 1443 */ 7087, 7117, 7146, 7176, 7205, 7235,
+               7264, 7294, 7323, 7353, 7382, 7412,
+    /* 1444 */ 7442, 7471, 7501, 7530, 7560, 7590,
+               7619, 7648, 7678, 7707, 7737, 7766,
+    /* 1445 */ 7796, 7825, 7855, 7885, 7915, 7944,
+               7974, 8003, 8032, 8062, 8091, 8120,
+    /* 1446 */ 8150, 8179, 8209, 8239, 8269, 8299,
+               8328, 8358, 8387, 8416, 8446, 8475,
+    /* 1447 */ 8504, 8534, 8563, 8593, 8623, 8653,
+               8682, 8712, 8741, 8771, 8800, 8830,
+    /* 1448 */ 8859, 8888, 8918, 8947, 8977, 9007,
+               9036, 9066, 9096, 9125, 9155, 9184,
+    /* 1449 */ 9214, 9243, 9272, 9302, 9331, 9361,
+               9390, 9420, 9450, 9479, 9509, 9539,
+    /* 1450 */ 9568, 9598, 9627, 9657, 9686, 9715,
+               9745, 9774, 9804, 9833, 9863, 9893,
+    /* 1451 */ 9922, 9952, 9982, 10011, 10041, 10070,
+               10099, 10129, 10158, 10188, 10217, 10247,
+    /* 1452 */ 10276, 10306, 10336, 10366, 10395, 10425,
+               10454, 10483, 10513, 10542, 10572, 10601,
+    /* 1453 */ 10631, 10660, 10690, 10720, 10750, 10779,
+               10808, 10838, 10867, 10897, 10926, 10956,
+    /* 1454 */ 10985, 11014, 11044, 11074, 11104, 11133,
+               11163, 11192, 11222, 11251, 11281, 11310,
+    /* 1455 */ 11340, 11369, 11398, 11428, 11458, 11487,
+               11517, 11546, 11576, 11606, 11635, 11665,
+    /* 1456 */ 11694, 11724, 11753, 11782, 11812, 11841,
+               11871, 11900, 11930, 11960, 11990, 12019,
+    /* 1457 */ 12049, 12078, 12108, 12137, 12166, 12196,
+               12225, 12254, 12284, 12314, 12343, 12373,
+    /* 1458 */ 12403, 12433, 12462, 12492, 12521, 12550,
+               12580, 12609, 12638, 12668, 12698, 12727,
+    /* 1459 */ 12757, 12787, 12817, 12846, 12876, 12905,
+               12934, 12964, 12993, 13022, 13052, 13082,
+    /* 1460 */ 13111, 13141, 13171, 13200, 13230, 13259,
+               13289, 13318, 13348, 13377, 13406, 13436,
+    /* 1461 */ 13466, 13495, 13525, 13554, 13584, 13614,
+               13643, 13673, 13702, 13732, 13761, 13791,
+    /* 1462 */ 13820, 13850, 13879, 13909, 13938, 13968,
+               13997, 14027, 14056, 14086, 14116, 14145,
+    /* 1463 */ 14175, 14204, 14234, 14263, 14292, 14322,
+               14351, 14381, 14411, 14440, 14470, 14500,
+    /* 1464 */ 14529, 14559, 14588, 14618, 14647, 14676,
+               14706, 14735, 14765, 14794, 14824, 14854,
+    /* 1465 */ 14884, 14913, 14943, 14972, 15002, 15031,
+               15060, 15090, 15119, 15148, 15178, 15208,
+    /* 1466 */ 15238, 15268, 15297, 15327, 15356, 15386,
+               15415, 15444, 15474, 15503, 15533, 15562,
+    /* 1467 */ 15592, 15622, 15651, 15681, 15711, 15740,
+               15770, 15799, 15828, 15858, 15887, 15917,
+    /* 1468 */ 15946, 15976, 16005, 16035, 16065, 16094,
+               16124, 16153, 16183, 16212, 16242, 16271,
+    /* 1469 */ 16301, 16330, 16359, 16389, 16419, 16448,
+               16478, 16508, 16537, 16567, 16597, 16626,
+    /* 1470 */ 16655, 16685, 16714, 16743, 16773, 16803,
+               16832, 16862, 16891, 16921, 16951, 16981,
+    /* 1471 */ 17010, 17039, 17069, 17098, 17127, 17157,
+               17186, 17216, 17246, 17275, 17305, 17335,
+    /* 1472 */ 17364, 17394, 17423, 17453, 17482, 17512,
+               17541, 17570, 17600, 17629, 17659, 17689,
+    /* 1473 */ 17718, 17748, 17777, 17807, 17837, 17866,
+               17896, 17925, 17954, 17984, 18013, 18043,
+    /* 1474 */ 18072, 18102, 18132, 18161, 18191, 18221,
+               18250, 18280, 18309, 18338, 18368, 18397,
+    /* 1475 */ 18427, 18456, 18486, 18515, 18545, 18575,
+               18605, 18634, 18664, 18693, 18722, 18752,
+    /* 1476 */ 18781, 18810, 18840, 18869, 18899, 18929,
+               18959, 18988, 19018, 19048, 19077, 19106,
+    /* 1477 */ 19136, 19165, 19194, 19224, 19253, 19283,
+               19313, 19342, 19372, 19402, 19432, 19461,
+    /* 1478 */ 19490, 19520, 19549, 19578, 19608, 19637,
+               19667, 19697, 19726, 19756, 19786, 19815,
+    /* 1479 */ 19845, 19874, 19904, 19933, 19962, 19992,
+               20021, 20051, 20080, 20110, 20140, 20169,
+    /* 1480 */ 20199, 20228, 20258, 20288, 20317, 20346,
+               20376, 20405, 20435, 20464, 20494, 20523,
+    /* 1481 */ 20553, 20582, 20612, 20642, 20671, 20701,
+               20731, 20760, 20790, 20819, 20848, 20878,
+    /* 1482 */ 20907, 20937, 20966, 20996, 21026, 21055,
+               21085, 21115, 21144, 21174, 21203, 21232,
+    /* 1483 */ 21262, 21291, 21320, 21350, 21380, 21409,
+               21439, 21469, 21499, 21528, 21558, 21587,
+    /* 1484 */ 21616, 21646, 21675, 21704, 21734, 21764,
+               21793, 21823, 21853, 21882, 21912, 21942,
+    /* 1485 */ 21971, 22000, 22030, 22059, 22088, 22118,
+               22148, 22177, 22207, 22237, 22266, 22296,
+    /* 1486 */ 22326, 22355, 22384, 22414, 22443, 22473,
+               22502, 22532, 22561, 22591, 22620, 22650,
+    /* 1487 */ 22680, 22709, 22739, 22768, 22798, 22827,
+               22857, 22886, 22915, 22945, 22974, 23004,
+    /* 1488 */ 23034, 23063, 23093, 23123, 23152, 23182,
+               23211, 23241, 23270, 23299, 23329, 23358,
+    /* 1489 */ 23388, 23417, 23447, 23477, 23507, 23536,
+               23566, 23595, 23625, 23654, 23683, 23713,
+    /* 1490 */ 23742, 23772, 23801, 23831, 23861, 23890,
+               23920, 23950, 23979, 24009, 24038, 24067,
+    /* 1491 */ 24097, 24126, 24156, 24185, 24215, 24244,
+               24274, 24304, 24333, 24363, 24392, 24422,
+    /* 1492 */ 24452, 24481, 24510, 24540, 24569, 24599,
+               24628, 24658, 24687, 24717, 24747, 24776,
+    /* 1493 */ 24806, 24836, 24865, 24894, 24924, 24953,
+               24983, 25012, 25041, 25071, 25101, 25130,
+    /* 1494 */ 25160, 25190, 25220, 25249, 25278, 25308,
+               25337, 25366, 25396, 25425, 25455, 25484,
+    /* 1495 */ 25514, 25544, 25574, 25603, 25633, 25662,
+               25692, 25721, 25750, 25780, 25809, 25839,
+    /* 1496 */ 25868, 25898, 25928, 25958, 25987, 26017,
+               26046, 26076, 26105, 26134, 26164, 26193,
+    /* 1497 */ 26223, 26252, 26282, 26312, 26341, 26371,
+               26401, 26430, 26459, 26489, 26518, 26548,
+    /* 1498 */ 26577, 26607, 26636, 26666, 26695, 26725,
+               26755, 26784, 26814, 26843, 26873, 26902,
+    /* 1499 */ 26932, 26961, 26991, 27020, 27050, 27079,
+               27109, 27138, 27168, 27197, 27227, 27257,
+    /* 1500 */ 27286, 27316, 27346, 27375, 27404, 27434,
+               27463, 27492, 27522, 27551, 27581, 27611,
+    /* 1501 */ 27641,
+};
@@ -0,0 +1,401 @@
+#include "world_shards.h"
+#include "calendrical_helper.h"
+#include "calculation_parameters.h"
+#include "timetable.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WORLD_FORMAT_VERSION 1
+#define CHECKSUM_SEED 14695981039346656037ULL
+
+static const char SHARD_MAGIC[8] = {'A', 'D', 'H', 'N', 'S', 'H', 'R', 'D'};
+static const char DATASET_MAGIC[8] = {'A', 'D', 'H', 'N', 'W', 'R', 'L', 'D'};
+
+/* Header of shard and dataset files, 96 bytes without padding */
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t shard; /* 0 for datasets */
+  uint64_t entries;
+  uint64_t checksum;
+  world_spec_t spec;
+} world_header_t;
+
+/* FNV-1a, enough to catch truncated and damaged files */
+static uint64_t checksum_update(uint64_t checksum, const void *data,
+                                size_t size) {
+  const unsigned char *bytes = data;
+  for (size_t i = 0; i < size; i++) {
+    checksum = (checksum ^ bytes[i]) * 1099511628211ULL;
+  }
+  return checksum;
+}
+
+/* First element of part `index` of `count` even parts of `total` */
+static size_t part_start(size_t total, size_t count, size_t index) {
+  return (size_t)((uint64_t)total * index / count);
+}
+
+size_t world_spec_shards(const world_spec_t *spec) {
+  if (!spec || !(spec->step > 0) || spec->latitudes == 0 ||
+      spec->longitudes == 0 || spec->days == 0 || spec->cell_shards == 0 ||
+      spec->day_shards == 0 || spec->method < MUSLIM_WORLD_LEAGUE ||
+      spec->method > OTHER || spec->madhab < SHAFI ||
+      spec->madhab > HANAFI || spec->high_latitude_rule < MIDDLE_OF_THE_NIGHT ||
+      spec->high_latitude_rule > NEAREST_LATITUDE) {
+    return 0;
+  }
+  const uint64_t cells = (uint64_t)spec->latitudes * spec->longitudes;
+  if (spec->cell_shards > cells || spec->day_shards > spec->days) {
+    return 0;
+  }
+
+  coordinates_t coordinates;
+  const double last_latitude =
+      spec->first_latitude + (spec->latitudes - 1) * spec->step;
+  const double last_longitude =
+      spec->first_longitude + (spec->longitudes - 1) * spec->step;
+  if (!init_coordinates(&coordinates, spec->first_latitude,
+                        spec->first_longitude) ||
+      !init_coordinates(&coordinates, last_latitude, last_longitude)) {
+    return 0;
+  }
+  return (size_t)spec->cell_shards * spec->day_shards;
+}
+
+bool world_shard_bounds(const world_spec_t *spec, size_t shard,
+                        world_shard_bounds_t *bounds) {
+  const size_t shards = world_spec_shards(spec);
+  if (shard >= shards || !bounds) {
+    return false;
+  }
+  const size_t cells = (size_t)spec->latitudes * spec->longitudes;
+  const size_t cell_shard = shard / spec->day_shards;
+  const size_t day_shard = shard % spec->day_shards;
+
+  bounds->first_cell = part_start(cells, spec->cell_shards, cell_shard);
+  bounds->cells =
+      part_start(cells, spec->cell_shards, cell_shard + 1) - bounds->first_cell;
+  bounds->first_day = part_start(spec->days, spec->day_shards, day_shard);
+  bounds->days =
+      part_start(spec->days, spec->day_shards, day_shard + 1) -
+      bounds->first_day;
+  return true;
+}
+
+coordinates_t world_cell_coordinates(const world_spec_t *spec, size_t cell) {
+  const size_t row = cell / spec->longitudes;
+  const size_t column = cell % spec->longitudes;
+  return (coordinates_t){spec->first_latitude + (double)row * spec->step,
+                         spec->first_longitude + (double)column * spec->step};
+}
+
+size_t world_shard_path(const char *directory, size_t shard, char *buffer,
+                        size_t size) {
+  const int length =
+      snprintf(buffer, size, "%s/shard-%06zu.bin", directory, shard);
+  return length > 0 && (size_t)length < size ? (size_t)length : 0;
+}
+
+static world_header_t new_header(const char magic[8],
+                                 const world_spec_t *spec, size_t shard,
+                                 uint64_t entries) {
+  world_header_t header;
+  memset(&header, 0, sizeof header);
+  memcpy(header.magic, magic, sizeof header.magic);
+  header.version = WORLD_FORMAT_VERSION;
+  header.shard = (uint32_t)shard;
+  header.entries = entries;
+  header.spec = *spec;
+  return header;
+}
+
+static bool header_matches(const world_header_t *header,
+                           const world_header_t *expected) {
+  return memcmp(header->magic, expected->magic, sizeof header->magic) == 0 &&
+         header->version == expected->version &&
+         header->shard == expected->shard &&
+         header->entries == expected->entries &&
+         memcmp(&header->spec, &expected->spec, sizeof header->spec) == 0;
+}
+
+/* Writes the header with its final checksum and renames the file */
+static bool finish_file(FILE *file, world_header_t *header,
+                        const char *temporary, const char *path) {
+  bool written = fseek(file, 0, SEEK_SET) == 0 &&
+                 fwrite(header, sizeof *header, 1, file) == 1;
+  written = fclose(file) == 0 && written;
+  if (!written || rename(temporary, path) != 0) {
+    remove(temporary);
+    return false;
+  }
+  return true;
+}
+
+static char *temporary_path(const char *path) {
+  const size_t length = strlen(path);
+  char *temporary = malloc(length + 5);
+  if (temporary) {
+    memcpy(temporary, path, length);
+    memcpy(temporary + length, ".tmp", 5);
+  }
+  return temporary;
+}
+
+bool world_shard_write(const world_spec_t *spec, size_t shard,
+                       const char *path) {
+  world_shard_bounds_t bounds;
+  if (!world_shard_bounds(spec, shard, &bounds) || !path) {
+    return false;
+  }
+  calculation_parameters_t parameters =
+      getParameters((calculation_method)spec->method);
+  parameters.madhab = (madhab_t)spec->madhab;
+  parameters.highLatitudeRule = (high_latitude_rule_t)spec->high_latitude_rule;
+  const time_t start =
+      (time_t)spec->start + (time_t)bounds.first_day * SECONDS_PER_DAY;
+
+  const uint64_t entries = (uint64_t)bounds.cells * bounds.days;
+  world_header_t header = new_header(SHARD_MAGIC, spec, shard, entries);
+  char *temporary = temporary_path(path);
+  prayer_times_t *times = malloc(bounds.days * sizeof(*times));
+  packed_prayer_times_t *packed = malloc(bounds.days * sizeof(*packed));
+  FILE *file = temporary ? fopen(temporary, "wb") : NULL;
+  bool written = file && times && packed &&
+                 fwrite(&header, sizeof header, 1, file) == 1;
+
+  /* One cell at a time, so a shard of any size takes a day range of memory */
+  uint64_t checksum = CHECKSUM_SEED;
+  for (size_t i = 0; written && i < bounds.cells; i++) {
+    coordinates_t coordinates =
+        world_cell_coordinates(spec, bounds.first_cell + i);
+    new_prayer_times_range(&coordinates, start, bounds.days, &parameters, NULL,
+                           times);
+    pack_prayer_times_batch(times, bounds.days, packed);
+    checksum = checksum_update(checksum, packed, bounds.days * sizeof(*packed));
+    written = fwrite(packed, sizeof(*packed), bounds.days, file) == bounds.days;
+  }
+  header.checksum = checksum;
+
+  if (written) {
+    written = finish_file(file, &header, temporary, path);
+  } else if (file) {
+    fclose(file);
+    remove(temporary);
+  }
+  free(packed);
+  free(times);
+  free(temporary);
+  return written;
+}
+
+/* Reads the header of `file` and checks it against `expected` */
+static bool read_header(FILE *file, const world_header_t *expected,
+                        world_header_t *header) {
+  return fread(header, sizeof *header, 1, file) == 1 &&
+         header_matches(header, expected);
+}
+
+/* Checksum of the `entries` times after the header of `file` */
+static bool verify_entries(FILE *file, uint64_t entries, uint64_t checksum) {
+  packed_prayer_times_t buffer[512];
+  uint64_t actual = CHECKSUM_SEED;
+  while (entries > 0) {
+    const size_t count = entries < 512 ? (size_t)entries : 512;
+    if (fread(buffer, sizeof(*buffer), count, file) != count) {
+      return false;
+    }
+    actual = checksum_update(actual, buffer, count * sizeof(*buffer));
+    entries -= count;
+  }
+  return actual == checksum && fgetc(file) == EOF;
+}
+
+bool world_shard_valid(const world_spec_t *spec, size_t shard,
+                       const char *path) {
+  world_shard_bounds_t bounds;
+  if (!world_shard_bounds(spec, shard, &bounds) || !path) {
+    return false;
+  }
+  const uint64_t entries = (uint64_t)bounds.cells * bounds.days;
+  const world_header_t expected =
+      new_header(SHARD_MAGIC, spec, shard, entries);
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return false;
+  }
+  world_header_t header;
+  const bool valid = read_header(file, &expected, &header) &&
+                     verify_entries(file, header.entries, header.checksum);
+  fclose(file);
+  return valid;
+}
+
+/* Shard files of one range of cells, one per range of days */
+typedef struct {
+  FILE *file;
+  world_shard_bounds_t bounds;
+  uint64_t expected;
+  uint64_t checksum;
+} merge_input_t;
+
+static bool open_inputs(const world_spec_t *spec, const char *directory,
+                        size_t cell_shard, merge_input_t *inputs) {
+  char path[4096];
+  for (size_t d = 0; d < spec->day_shards; d++) {
+    const size_t shard = cell_shard * spec->day_shards + d;
+    merge_input_t *input = &inputs[d];
+    world_header_t header;
+
+    world_shard_bounds(spec, shard, &input->bounds);
+    const world_header_t expected =
+        new_header(SHARD_MAGIC, spec, shard,
+                   (uint64_t)input->bounds.cells * input->bounds.days);
+    input->file = world_shard_path(directory, shard, path, sizeof path)
+                      ? fopen(path, "rb")
+                      : NULL;
+    if (!input->file || !read_header(input->file, &expected, &header)) {
+      return false;
+    }
+    input->expected = header.checksum;
+    input->checksum = CHECKSUM_SEED;
+  }
+  return true;
+}
+
+static void close_inputs(merge_input_t *inputs, size_t count) {
+  for (size_t d = 0; d < count; d++) {
+    if (inputs[d].file) {
+      fclose(inputs[d].file);
+      inputs[d].file = NULL;
+    }
+  }
+}
+
+/* Copies the cells of one range of cells, interleaving their day ranges */
+static bool merge_cells(const world_spec_t *spec, merge_input_t *inputs,
+                        packed_prayer_times_t *buffer, FILE *out,
+                        uint64_t *checksum) {
+  for (size_t i = 0; i < inputs[0].bounds.cells; i++) {
+    for (size_t d = 0; d < spec->day_shards; d++) {
+      merge_input_t *input = &inputs[d];
+      const size_t days = input->bounds.days;
+      if (fread(buffer, sizeof(*buffer), days, input->file) != days ||
+          fwrite(buffer, sizeof(*buffer), days, out) != days) {
+        return false;
+      }
+      input->checksum =
+          checksum_update(input->checksum, buffer, days * sizeof(*buffer));
+      *checksum = checksum_update(*checksum, buffer, days * sizeof(*buffer));
+    }
+  }
+  for (size_t d = 0; d < spec->day_shards; d++) {
+    if (inputs[d].checksum != inputs[d].expected ||
+        fgetc(inputs[d].file) != EOF) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool world_merge(const world_spec_t *spec, const char *directory,
+                 const char *path) {
+  if (!world_spec_shards(spec) || !directory || !path) {
+    return false;
+  }
+  const uint64_t cells = (uint64_t)spec->latitudes * spec->longitudes;
+  world_header_t header =
+      new_header(DATASET_MAGIC, spec, 0, cells * spec->days);
+  char *temporary = temporary_path(path);
+  merge_input_t *inputs = calloc(spec->day_shards, sizeof(*inputs));
+  packed_prayer_times_t *buffer = malloc(spec->days * sizeof(*buffer));
+  FILE *out = temporary ? fopen(temporary, "wb") : NULL;
+  bool written = out && inputs && buffer &&
+                 fwrite(&header, sizeof header, 1, out) == 1;
+
+  uint64_t checksum = CHECKSUM_SEED;
+  for (size_t c = 0; written && c < spec->cell_shards; c++) {
+    written = open_inputs(spec, directory, c, inputs) &&
+              merge_cells(spec, inputs, buffer, out, &checksum);
+    close_inputs(inputs, spec->day_shards);
+  }
+  header.checksum = checksum;
+
+  if (written) {
+    written = finish_file(out, &header, temporary, path);
+  } else if (out) {
+    fclose(out);
+    remove(temporary);
+  }
+  free(buffer);
+  free(inputs);
+  free(temporary);
+  return written;
+}
+
+bool world_dataset_open(const char *path, bool verify,
+                        world_dataset_t *dataset) {
+  if (!path || !dataset) {
+    return false;
+  }
+  FILE *file = fopen(path, "rb");
+  world_header_t header;
+  if (!file || fread(&header, sizeof header, 1, file) != 1) {
+    if (file) {
+      fclose(file);
+    }
+    return false;
+  }
+  const uint64_t cells =
+      (uint64_t)header.spec.latitudes * header.spec.longitudes;
+  const world_header_t expected =
+      new_header(DATASET_MAGIC, &header.spec, 0, cells * header.spec.days);
+  if (!world_spec_shards(&header.spec) || !header_matches(&header, &expected) ||
+      (verify && !verify_entries(file, header.entries, header.checksum))) {
+    fclose(file);
+    return false;
+  }
+  dataset->file = file;
+  dataset->spec = header.spec;
+  return true;
+}
+
+bool world_dataset_lookup(const world_dataset_t *dataset,
+                          const coordinates_t *coordinates, time_t date,
+                          prayer_times_t *times) {
+  if (!dataset || !dataset->file || !coordinates || !times) {
+    return false;
+  }
+  const world_spec_t *spec = &dataset->spec;
+  const double row =
+      round((coordinates->latitude - spec->first_latitude) / spec->step);
+  const double column =
+      round((coordinates->longitude - spec->first_longitude) / spec->step);
+  const long day = floor_div((int64_t)date, SECONDS_PER_DAY) -
+                   floor_div((int64_t)spec->start, SECONDS_PER_DAY);
+  if (!(row >= 0 && row < spec->latitudes) ||
+      !(column >= 0 && column < spec->longitudes) || day < 0 ||
+      day >= (long)spec->days) {
+    return false;
+  }
+
+  const uint64_t cell = (uint64_t)row * spec->longitudes + (uint64_t)column;
+  const uint64_t entry = cell * spec->days + (uint64_t)day;
+  packed_prayer_times_t packed;
+  if (fseek(dataset->file,
+            (long)(sizeof(world_header_t) + entry * sizeof(packed)),
+            SEEK_SET) != 0 ||
+      fread(&packed, sizeof packed, 1, dataset->file) != 1) {
+    return false;
+  }
+  *times = unpack_prayer_times(&packed);
+  return true;
+}
+
+void world_dataset_close(world_dataset_t *dataset) {
+  if (dataset && dataset->file) {
+    fclose(dataset->file);
+    dataset->file = NULL;
+  }
+}
@@ -0,0 +1,138 @@
+#ifndef ADHAN_WORLD_SHARDS_H
+#define ADHAN_WORLD_SHARDS_H
+
+#include "packed_times.h"
+#include "prayer_times.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * @brief Grid, days and shards of a world precompute
+ *
+ * Cells are numbered row major from the first latitude and longitude, and
+ * split into `cell_shards` contiguous ranges. Days are split the same way
+ * into `day_shards` ranges. Shard `cell_shard * day_shards + day_shard`
+ * holds the days of one range for the cells of another, so every node that
+ * uses the same spec computes the same shards. The spec is stored in every
+ * file as is, with fixed width fields and no padding, which nodes of the
+ * same byte order read back identically.
+ */
+typedef struct {
+  double first_latitude;       /**< Latitude of the first row, degrees */
+  double first_longitude;      /**< Longitude of the first column, degrees */
+  double step;                 /**< Grid step in degrees */
+  int64_t start;               /**< First day, at 0h UTC */
+  uint32_t latitudes;          /**< Rows of the grid */
+  uint32_t longitudes;         /**< Columns of the grid */
+  uint32_t days;               /**< Number of days */
+  int32_t method;              /**< calculation_method */
+  int32_t madhab;              /**< madhab_t */
+  int32_t high_latitude_rule;  /**< high_latitude_rule_t */
+  uint32_t cell_shards;        /**< Ranges of cells */
+  uint32_t day_shards;         /**< Ranges of days */
+} world_spec_t;
+
+/**
+ * @brief Cells and days of one shard
+ */
+typedef struct {
+  size_t first_cell;
+  size_t cells;
+  size_t first_day;
+  size_t days;
+} world_shard_bounds_t;
+
+/**
+ * @brief Number of shards, 0 when the spec is invalid
+ *
+ * Every cell must be a valid coordinate and every shard must hold at least
+ * one cell and one day.
+ */
+size_t world_spec_shards(const world_spec_t *spec);
+
+/**
+ * @brief Cells and days of `shard`
+ * @return false when the spec is invalid or `shard` is out of range
+ */
+bool world_shard_bounds(const world_spec_t *spec, size_t shard,
+                        world_shard_bounds_t *bounds);
+
+/**
+ * @brief Coordinates of a cell
+ */
+coordinates_t world_cell_coordinates(const world_spec_t *spec, size_t cell);
+
+/**
+ * @brief File name of `shard` in `directory`
+ * @return Length of the path, 0 when it does not fit in `size`
+ */
+size_t world_shard_path(const char *directory, size_t shard, char *buffer,
+                        size_t size);
+
+/**
+ * @brief Compute a shard and write it to `path`
+ *
+ * The times of each cell are the same as new_prayer_times() for each day of
+ * the shard, computed with new_prayer_times_range() and stored as
+ * packed_prayer_times_t, cell by cell, after a header with the spec, the
+ * shard and a checksum of the times. The shard is written to `path` with a
+ * `.tmp` suffix and renamed when complete, so an interrupted worker never
+ * leaves a file that passes world_shard_valid().
+ */
+bool world_shard_write(const world_spec_t *spec, size_t shard,
+                       const char *path);
+
+/**
+ * @brief Whether `path` holds `shard` of `spec` with a matching checksum
+ *
+ * Drivers skip valid shards, so rerunning a precompute only computes the
+ * shards that are missing, partial or corrupt.
+ */
+bool world_shard_valid(const world_spec_t *spec, size_t shard,
+                       const char *path);
+
+/**
+ * @brief Merge the shards in `directory` into one dataset at `path`
+ *
+ * The dataset holds the times of every cell for every day, cell by cell,
+ * after a header with the spec and a checksum, so the times of a cell and
+ * day are at a fixed offset. Checksums of the shards are verified while
+ * copying; the dataset is written with a `.tmp` suffix and renamed when
+ * complete.
+ *
+ * @return false when a shard is missing, invalid or cannot be read
+ */
+bool world_merge(const world_spec_t *spec, const char *directory,
+                 const char *path);
+
+/**
+ * @brief Merged dataset opened for lookups
+ */
+typedef struct {
+  FILE *file;
+  world_spec_t spec;
+} world_dataset_t;
+
+/**
+ * @brief Open a dataset written by world_merge()
+ *
+ * Checks the header, and the checksum of the times when `verify` is set.
+ */
+bool world_dataset_open(const char *path, bool verify,
+                        world_dataset_t *dataset);
+
+/**
+ * @brief Times of the cell nearest to `coordinates` on the UTC day of
+ * `date`
+ * @return false outside the grid or the days of the dataset
+ */
+bool world_dataset_lookup(const world_dataset_t *dataset,
+                          const coordinates_t *coordinates, time_t date,
+                          prayer_times_t *times);
+
+void world_dataset_close(world_dataset_t *dataset);
+
+#endif /* ADHAN_WORLD_SHARDS_H */
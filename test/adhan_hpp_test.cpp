@@ -0,0 +1,89 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+#include "../src/adhan.hpp"
+
+extern "C" {
+#include "../src/timetable.h"
+}
+
+using namespace std::chrono;
+
+static_assert(std::ranges::input_range<adhan::DayRange>);
+static_assert(std::ranges::view<adhan::DayRange>);
+
+static void expect_same_times(const adhan::Times &actual,
+                              const prayer_times_t &expected) {
+  EXPECT_EQ(actual.fajr.time_since_epoch().count(), expected.fajr);
+  EXPECT_EQ(actual.sunrise.time_since_epoch().count(), expected.sunrise);
+  EXPECT_EQ(actual.dhuhr.time_since_epoch().count(), expected.dhuhr);
+  EXPECT_EQ(actual.asr.time_since_epoch().count(), expected.asr);
+  EXPECT_EQ(actual.maghrib.time_since_epoch().count(), expected.maghrib);
+  EXPECT_EQ(actual.isha.time_since_epoch().count(), expected.isha);
+  EXPECT_EQ(actual.midnight.time_since_epoch().count(), expected.midnight);
+}
+
+TEST(AdhanHppTest, TimesMatchCApi) {
+  adhan::Observer raleigh{35.7750, -78.6336};
+  adhan::Params params =
+      adhan::Params(NORTH_AMERICA).madhab(HANAFI).high_latitude_rule(
+          MIDDLE_OF_THE_NIGHT);
+  const sys_days date = 2015y / July / 12;
+
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t c_params = getParameters(NORTH_AMERICA);
+  c_params.madhab = HANAFI;
+  c_params.highLatitudeRule = MIDDLE_OF_THE_NIGHT;
+  prayer_times_t expected =
+      new_prayer_times(&coordinates, get_utc_date(2015, 7, 12), &c_params);
+
+  adhan::Times times = adhan::times(raleigh, date, params);
+  expect_same_times(times, expected);
+  EXPECT_TRUE(times.valid());
+  EXPECT_EQ(times[ASR], times.asr);
+  EXPECT_EQ(times[NONE], sys_seconds{});
+}
+
+TEST(AdhanHppTest, DaysMatchesTimetable) {
+  const adhan::Observer observers[] = {
+      {35.7750, -78.6336}, // Raleigh
+      {59.9094, 10.7349},  // Oslo
+      {-33.8688, 151.2093}, // Sydney
+  };
+  const calculation_method methods[] = {MUSLIM_WORLD_LEAGUE,
+                                        MOON_SIGHTING_COMMITTEE, UMM_AL_QURA};
+  const size_t count = 60;
+  prayer_times_t timetable[count];
+
+  for (const adhan::Observer &observer : observers) {
+    for (calculation_method method : methods) {
+      coordinates_t coordinates = observer.coordinates();
+      calculation_parameters_t c_params = getParameters(method);
+      ASSERT_EQ(new_prayer_times_range(&coordinates, get_utc_date(2016, 2, 1),
+                                       count, &c_params, NULL, timetable),
+                count);
+
+      size_t day = 0;
+      for (const adhan::Times &times : adhan::days(
+               observer, adhan::Params(method), 2016y / February / 1, count)) {
+        ASSERT_LT(day, count);
+        expect_same_times(times, timetable[day]);
+        day++;
+      }
+      EXPECT_EQ(day, count);
+    }
+  }
+}
+
+TEST(AdhanHppTest, EmptyAndInvalidDays) {
+  adhan::Observer tromso{69.6492, 18.9553};
+  adhan::DayRange empty =
+      adhan::days(tromso, adhan::Params(MUSLIM_WORLD_LEAGUE),
+                  2020y / June / 21, 0);
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_EQ(empty.size(), 0u);
+
+  /* NULL_PRAYER_TIMES from a failed calculation */
+  EXPECT_FALSE(adhan::Times::from_c(prayer_times_t{}).valid());
+  EXPECT_FALSE(adhan::Observer({91, 0}).valid());
+}
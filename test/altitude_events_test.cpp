@@ -0,0 +1,122 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "../src/altitude_events.h"
+#include "../src/sun_position.h"
+}
+
+static const double SUNRISE_ALTITUDE = -50.0 / 60.0;
+
+TEST(AltitudeEventsTest, SunriseAndSunset) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  solar_time_t solar_time =
+      new_solar_time(get_utc_date(2015, 7, 12), &coordinates);
+  altitude_events_t events =
+      altitude_events(&solar_time, SUNRISE_ALTITUDE, NULL);
+
+  ASSERT_EQ(events.status, ALTITUDE_SOLVER_CONVERGED);
+  ASSERT_EQ(events.count, 2u);
+  EXPECT_TRUE(events.crossings[0].rising);
+  EXPECT_FALSE(events.crossings[1].rising);
+  // The single correction step of hour_angle() is already within seconds at
+  // this latitude
+  EXPECT_NEAR(events.crossings[0].time, solar_time.sunrise, 10.0 / 3600);
+  EXPECT_NEAR(events.crossings[1].time, solar_time.sunset, 10.0 / 3600);
+
+  for (size_t i = 0; i < events.count; i++) {
+    sun_position_t position =
+        solar_time_sun_position(&solar_time, events.crossings[i].time);
+    EXPECT_NEAR(position.altitude, SUNRISE_ALTITUDE, 1e-3);
+  }
+  // Three evaluations to bracket, then a few Newton steps per crossing
+  EXPECT_LE(events.evaluations, 3 + 2 * 4);
+}
+
+TEST(AltitudeEventsTest, Tolerance) {
+  coordinates_t coordinates = {64.1466, -21.9426};
+  solar_time_t solar_time =
+      new_solar_time(get_utc_date(2024, 4, 20), &coordinates);
+  altitude_solver_t loose = {60.0 / 3600, 10};
+  altitude_solver_t tight = {1e-7, 10};
+
+  altitude_events_t coarse = altitude_events(&solar_time, -12, &loose);
+  altitude_events_t fine = altitude_events(&solar_time, -12, &tight);
+  ASSERT_EQ(coarse.status, ALTITUDE_SOLVER_CONVERGED);
+  ASSERT_EQ(fine.status, ALTITUDE_SOLVER_CONVERGED);
+  ASSERT_EQ(coarse.count, 2u);
+  ASSERT_EQ(fine.count, 2u);
+  EXPECT_LE(coarse.evaluations, fine.evaluations);
+  for (size_t i = 0; i < fine.count; i++) {
+    EXPECT_NEAR(coarse.crossings[i].time, fine.crossings[i].time,
+                loose.tolerance);
+    sun_position_t position =
+        solar_time_sun_position(&solar_time, fine.crossings[i].time);
+    EXPECT_NEAR(position.altitude, -12, 1e-5);
+  }
+}
+
+TEST(AltitudeEventsTest, IterationBudget) {
+  coordinates_t coordinates = {64.1466, -21.9426};
+  solar_time_t solar_time =
+      new_solar_time(get_utc_date(2024, 4, 20), &coordinates);
+  altitude_solver_t budget = {1e-9, 1};
+  altitude_solver_t invalid = {0, 10};
+  double time = 0;
+
+  altitude_events_t events = altitude_events(&solar_time, -12, &budget);
+  EXPECT_EQ(events.status, ALTITUDE_SOLVER_NOT_CONVERGED);
+  EXPECT_EQ(events.count, 2u);
+  EXPECT_FALSE(events.crossings[0].converged);
+  EXPECT_EQ(events.crossings[0].iterations, 1);
+
+  EXPECT_EQ(altitude_events(&solar_time, -12, &invalid).status,
+            ALTITUDE_SOLVER_INVALID);
+  EXPECT_EQ(altitude_crossing(&solar_time, -12, true, &budget, &time),
+            ALTITUDE_SOLVER_NOT_CONVERGED);
+  EXPECT_EQ(altitude_crossing(&solar_time, -12, true, NULL, NULL),
+            ALTITUDE_SOLVER_INVALID);
+}
+
+TEST(AltitudeEventsTest, NoCrossings) {
+  coordinates_t tromso = {69.6492, 18.9553};
+  solar_time_t summer = new_solar_time(get_utc_date(2024, 6, 21), &tromso);
+  solar_time_t winter = new_solar_time(get_utc_date(2024, 12, 21), &tromso);
+  double time = 0;
+
+  altitude_events_t midnight_sun =
+      altitude_events(&summer, SUNRISE_ALTITUDE, NULL);
+  EXPECT_EQ(midnight_sun.status, ALTITUDE_SOLVER_NO_CROSSING);
+  EXPECT_EQ(midnight_sun.count, 0u);
+  EXPECT_TRUE(midnight_sun.above);
+
+  altitude_events_t polar_night =
+      altitude_events(&winter, SUNRISE_ALTITUDE, NULL);
+  EXPECT_EQ(polar_night.status, ALTITUDE_SOLVER_NO_CROSSING);
+  EXPECT_EQ(polar_night.count, 0u);
+  EXPECT_FALSE(polar_night.above);
+  EXPECT_EQ(altitude_crossing(&winter, SUNRISE_ALTITUDE, false, NULL, &time),
+            ALTITUDE_SOLVER_NO_CROSSING);
+
+  // Civil twilight still happens around noon during the polar night
+  altitude_events_t twilight = altitude_events(&winter, -6, NULL);
+  EXPECT_EQ(twilight.status, ALTITUDE_SOLVER_CONVERGED);
+  ASSERT_EQ(twilight.count, 2u);
+  EXPECT_LT(twilight.crossings[0].time, winter.transit);
+  EXPECT_GT(twilight.crossings[1].time, winter.transit);
+}
+
+TEST(AltitudeEventsTest, AsrCrossing) {
+  coordinates_t coordinates = {21.4225241, 39.8261818};
+  solar_time_t solar_time =
+      new_solar_time(get_utc_date(2023, 12, 1), &coordinates);
+  const double altitude = afternoon_altitude(&solar_time, SINGLE);
+  double time = 0;
+
+  ASSERT_EQ(altitude_crossing(&solar_time, altitude, true, NULL, &time),
+            ALTITUDE_SOLVER_CONVERGED);
+  EXPECT_NEAR(time, afternoon(&solar_time, SINGLE), 10.0 / 3600);
+  EXPECT_NEAR(solar_time_sun_position(&solar_time, time).altitude, altitude,
+              1e-3);
+}
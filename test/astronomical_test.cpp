@@ -7,6 +7,7 @@ extern "C" {
 #include "../src/astronomical.h"
 #include "../src/calendrical_helper.h"
 #include "../src/double_utils.h"
+#include "../src/solar_coordinates.h"
 #include "../src/solar_time.h"
 }
 
@@ -201,7 +202,12 @@ TEST(AstronomicalTest, testSolarTime) {
   EXPECT_THAT(transit, equalsTime(17, 20));
   EXPECT_THAT(sunset, equalsTime(24, 32));
   EXPECT_THAT(twilightEnd, equalsTime(25, 2));
-  ASSERT_EQ(invalid, 23.335802662595555);
+  if (solar_coordinates_chebyshev_enabled()) {
+    // Fitted coordinates agree to a few milliseconds, not to the last bit
+    ASSERT_NEAR(invalid, 23.335802662595555, 1e-5);
+  } else {
+    ASSERT_EQ(invalid, 23.335802662595555);
+  }
 }
 
 TEST(AstronomicalTest, testCalendricalDate) {
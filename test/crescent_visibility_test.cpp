@@ -0,0 +1,144 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <math.h>
+#include <vector>
+
+extern "C" {
+#include "../src/crescent_visibility.h"
+#include "../src/lunar_coordinates.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_time.h"
+}
+
+TEST(CrescentVisibilityTest, LunarCoordinates) {
+  // Astronomical Algorithms example 47.a, 1992-04-12 0h TD, to the accuracy
+  // of the main terms
+  const lunar_coordinates_t moon = new_lunar_coordinates(2448724.5);
+  EXPECT_NEAR(moon.longitude, 133.162655, 0.01);
+  EXPECT_NEAR(moon.latitude, -3.229126, 0.01);
+  EXPECT_NEAR(moon.rightAscension, 134.688470, 0.01);
+  EXPECT_NEAR(moon.declination, 13.768368, 0.01);
+  EXPECT_NEAR(moon.distance, 368409.7, 100);
+
+  // Example 49.a, the new moon of 1977-02-18
+  EXPECT_NEAR(new_moon_julian_ephemeris_day(-283), 2443192.65118, 1e-4);
+  EXPECT_NEAR(delta_t(1990), 56.9, 0.5);
+}
+
+TEST(CrescentVisibilityTest, MonthOfRamadan1445) {
+  // New moon on 2024-03-10 at 09:00 UT
+  coordinates_t makkah = {21.4225241, 39.8261818};
+  crescent_visibility_t visibility;
+
+  ASSERT_TRUE(crescent_visibility(&makkah, get_utc_date(2024, 3, 9),
+                                  CRESCENT_YALLOP, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_BEFORE_CONJUNCTION);
+  EXPECT_NE(visibility.sunset, 0);
+  EXPECT_EQ(visibility.bestTime, 0);
+  EXPECT_EQ(visibility.value, 0);
+
+  // Six hours old at sunset in Makkah, visible in the Americas
+  ASSERT_TRUE(crescent_visibility(&makkah, get_utc_date(2024, 3, 10),
+                                  CRESCENT_YALLOP, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_ZONE_F);
+  EXPECT_NEAR(visibility.age, 6.5, 0.5);
+  EXPECT_GT(visibility.moonset, visibility.bestTime);
+  EXPECT_GT(visibility.bestTime, visibility.sunset);
+  coordinates_t americas = {10, -100};
+  crescent_visibility_t west;
+  ASSERT_TRUE(crescent_visibility(&americas, get_utc_date(2024, 3, 10),
+                                  CRESCENT_YALLOP, &west));
+  EXPECT_GT(west.value, visibility.value);
+  EXPECT_LE(west.zone, CRESCENT_ZONE_C);
+
+  ASSERT_TRUE(crescent_visibility(&makkah, get_utc_date(2024, 3, 11),
+                                  CRESCENT_ODEH, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_ZONE_A);
+  EXPECT_NEAR(visibility.arcl, 18.4, 0.5);
+  EXPECT_GT(visibility.width, 0.5);
+
+  // The sunset of the prayer times
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  prayer_times_t times =
+      new_prayer_times(&makkah, get_utc_date(2024, 3, 11), &params);
+  EXPECT_EQ(visibility.sunset, times.maghrib);
+}
+
+TEST(CrescentVisibilityTest, SpecialZones) {
+  crescent_visibility_t visibility;
+  // Midnight sun
+  coordinates_t north = {80, 20};
+  ASSERT_TRUE(crescent_visibility(&north, get_utc_date(2024, 6, 6),
+                                  CRESCENT_YALLOP, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_NO_SUNSET);
+  EXPECT_EQ(visibility.sunset, 0);
+
+  // Hours after the new moon, the moon sets first at high latitudes
+  coordinates_t siberia = {60, 90};
+  ASSERT_TRUE(crescent_visibility(&siberia, get_utc_date(2024, 3, 10),
+                                  CRESCENT_YALLOP, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_MOON_SETS_FIRST);
+  EXPECT_NE(visibility.sunset, 0);
+  EXPECT_EQ(visibility.moonset, 0);
+  ASSERT_TRUE(crescent_visibility(&siberia, get_utc_date(2024, 3, 13),
+                                  CRESCENT_YALLOP, &visibility));
+  EXPECT_EQ(visibility.zone, CRESCENT_ZONE_A);
+
+  coordinates_t invalid = {91, 0};
+  EXPECT_FALSE(crescent_visibility(&invalid, get_utc_date(2024, 3, 11),
+                                   CRESCENT_YALLOP, &visibility));
+}
+
+TEST(CrescentVisibilityTest, RasterMatchesLocations) {
+  const crescent_grid_t grid = {-60, -180, 7.5, 17, 48};
+  const time_t date = get_utc_date(2024, 3, 10);
+  const size_t cells = grid.latitudes * grid.longitudes;
+
+  for (int criterion = CRESCENT_YALLOP; criterion <= CRESCENT_ODEH;
+       criterion++) {
+    std::vector<float> values(cells), threaded_values(cells);
+    std::vector<uint8_t> zones(cells), threaded_zones(cells);
+    ASSERT_TRUE(crescent_visibility_raster(
+        date, &grid, (crescent_criterion_t)criterion, 1, values.data(),
+        zones.data()));
+    ASSERT_TRUE(crescent_visibility_raster(
+        date, &grid, (crescent_criterion_t)criterion, 4,
+        threaded_values.data(), threaded_zones.data()));
+
+    bool visible = false, not_visible = false;
+    for (size_t cell = 0; cell < cells; cell++) {
+      coordinates_t coordinates = {
+          grid.first_latitude + (cell / grid.longitudes) * grid.step,
+          grid.first_longitude + (cell % grid.longitudes) * grid.step};
+      crescent_visibility_t visibility;
+      ASSERT_TRUE(crescent_visibility(&coordinates, date,
+                                      (crescent_criterion_t)criterion,
+                                      &visibility));
+      EXPECT_EQ(zones[cell], visibility.zone) << cell;
+      EXPECT_EQ(threaded_zones[cell], zones[cell]) << cell;
+      if (visibility.zone <= CRESCENT_ZONE_F) {
+        EXPECT_FLOAT_EQ(values[cell], (float)visibility.value) << cell;
+        EXPECT_EQ(threaded_values[cell], values[cell]) << cell;
+      } else {
+        EXPECT_TRUE(isnan(values[cell])) << cell;
+      }
+      visible |= visibility.zone <= CRESCENT_ZONE_B;
+      not_visible |= visibility.zone == CRESCENT_MOON_SETS_FIRST;
+    }
+    EXPECT_TRUE(visible);
+    EXPECT_TRUE(not_visible);
+  }
+
+  // Zones only, and grids past the poles
+  std::vector<uint8_t> zones(cells);
+  EXPECT_TRUE(crescent_visibility_raster(date, &grid, CRESCENT_ODEH, 2,
+                                         nullptr, zones.data()));
+  crescent_grid_t invalid = grid;
+  invalid.latitudes = 30;
+  EXPECT_FALSE(crescent_visibility_raster(date, &invalid, CRESCENT_ODEH, 1,
+                                          nullptr, zones.data()));
+  invalid = grid;
+  invalid.step = 0;
+  EXPECT_FALSE(crescent_visibility_raster(date, &invalid, CRESCENT_ODEH, 1,
+                                          nullptr, zones.data()));
+}
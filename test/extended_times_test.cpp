@@ -0,0 +1,156 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/extended_times.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_time.h"
+#include "../src/timetable.h"
+}
+
+static time_t minute_of(const prayer_day_t &day, double hours) {
+  return day.start + (time_t)lround(hours * 60) * 60;
+}
+
+TEST(ExtendedTimesTest, SameSolarTimeAsPrayerTimes) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t params = getParameters(NORTH_AMERICA);
+  const extended_parameters_t extended = default_extended_parameters();
+  const time_t date = get_utc_date(2015, 7, 12);
+
+  prayer_times_t times;
+  const extended_times_t extra =
+      new_extended_times(&coordinates, date, &params, &extended, &times);
+  prayer_times_t expected = new_prayer_times(&coordinates, date, &params);
+  EXPECT_EQ(memcmp(&times, &expected, sizeof times), 0);
+
+  solar_time_t solar = new_solar_time(date, &coordinates);
+  const prayer_day_t day = new_prayer_day(date);
+  EXPECT_EQ(extra.ishraq, minute_of(day, hour_angle(&solar, 4, false)));
+  EXPECT_EQ(extra.duha, minute_of(day, hour_angle(&solar, 15, false)));
+  // From the transit, not the Dhuhr with its 1 minute adjustment
+  EXPECT_EQ(extra.duhaEnd, minute_of(day, solar.transit) - 600);
+  EXPECT_EQ(extra.duhaEnd, times.dhuhr - 660);
+
+  // Sunrise < Ishraq < Duha < end of Duha < Dhuhr
+  EXPECT_GT(extra.ishraq - times.sunrise, 15 * 60);
+  EXPECT_LT(extra.ishraq - times.sunrise, 30 * 60);
+  EXPECT_GT(extra.duha, extra.ishraq);
+  EXPECT_GT(extra.duhaEnd, extra.duha);
+
+  // Two thirds of the night from Maghrib to the next Fajr
+  const time_t next_fajr =
+      new_prayer_times(&coordinates, add_days(date, 1), &params).fajr;
+  EXPECT_NEAR((double)extra.lastThird,
+              times.maghrib + (next_fajr - times.maghrib) * 2.0 / 3, 30);
+  EXPECT_EQ(extra.lastThird % 60, 0);
+}
+
+TEST(ExtendedTimesTest, MidnightAdjustment) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t params = getParameters(NORTH_AMERICA);
+  const extended_parameters_t extended = default_extended_parameters();
+  const time_t date = get_utc_date(2015, 7, 12);
+  const extended_times_t plain =
+      new_extended_times(&coordinates, date, &params, &extended, NULL);
+
+  // Moving midnight does not move the night it halves
+  params.adjustments.midnight = 7;
+  prayer_times_t times;
+  const extended_times_t adjusted =
+      new_extended_times(&coordinates, date, &params, &extended, &times);
+  EXPECT_EQ(adjusted.lastThird, plain.lastThird);
+  EXPECT_EQ(adjusted.lastThird % 60, 0);
+  EXPECT_LT(adjusted.lastThird, times.fajr + 86400);
+
+  // The Maghrib adjustment moves the start of the night
+  params.adjustments.midnight = 0;
+  params.adjustments.maghrib = 9;
+  const extended_times_t later =
+      new_extended_times(&coordinates, date, &params, &extended, NULL);
+  EXPECT_EQ(later.lastThird - plain.lastThird, 3 * 60);
+}
+
+TEST(ExtendedTimesTest, RangeMatchesSingleDays) {
+  coordinates_t locations[] = {
+      {21.4225241, 39.8261818}, // Makkah
+      {-33.8688, 151.2093},     // Sydney
+      {59.9139, 10.7522},       // Oslo
+  };
+  calculation_parameters_t params = getParameters(UMM_AL_QURA);
+  hijri_month_adjustments_t ramadan = umm_al_qura_ramadan_adjustments(&params);
+  const extended_parameters_t extended = default_extended_parameters();
+  const time_t start = get_utc_date(2024, 1, 1);
+  const size_t days = 366;
+  prayer_times_t timetable[days];
+  extended_times_t extended_timetable[days];
+
+  for (coordinates_t &coordinates : locations) {
+    ASSERT_EQ(new_extended_times_range(&coordinates, start, days, &params,
+                                       NULL, &extended, timetable,
+                                       extended_timetable),
+              days);
+    prayer_times_t plain[days];
+    new_prayer_times_range(&coordinates, start, days, &params, NULL, plain);
+    for (size_t i = 0; i < days; i += 5) {
+      const time_t date = add_days(start, (int)i);
+      const extended_times_t expected =
+          new_extended_times(&coordinates, date, &params, &extended, NULL);
+      EXPECT_EQ(memcmp(&timetable[i], &plain[i], sizeof plain[i]), 0);
+      EXPECT_EQ(memcmp(&extended_timetable[i], &expected, sizeof expected),
+                0)
+          << i;
+    }
+
+    // The Ramadan Isha does not move the extended times of the night
+    prayer_times_t ramadan_timetable[days];
+    extended_times_t ramadan_extended[days];
+    new_extended_times_range(&coordinates, start, days, &params, &ramadan,
+                             &extended, ramadan_timetable, ramadan_extended);
+    EXPECT_EQ(memcmp(ramadan_extended, extended_timetable,
+                     sizeof ramadan_extended),
+              0);
+  }
+}
+
+TEST(ExtendedTimesTest, SunBelowDuhaAltitude) {
+  // The sun stays below 7 degrees in Oslo at the winter solstice
+  coordinates_t coordinates = {59.9139, 10.7522};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  const extended_parameters_t extended = default_extended_parameters();
+  const time_t date = get_utc_date(2024, 12, 21);
+
+  prayer_times_t times;
+  const extended_times_t extra =
+      new_extended_times(&coordinates, date, &params, &extended, &times);
+  ASSERT_NE(extra.ishraq, 0);
+  solar_time_t solar = new_solar_time(date, &coordinates);
+  const prayer_day_t day = new_prayer_day(date);
+  const double ishraq = hour_angle(&solar, 4, false);
+  EXPECT_EQ(extra.ishraq, minute_of(day, ishraq));
+  EXPECT_EQ(extra.duha, minute_of(day, (ishraq + solar.transit) / 2));
+  EXPECT_GT(extra.duha, extra.ishraq);
+  EXPECT_LT(extra.duha, times.dhuhr);
+}
+
+TEST(ExtendedTimesTest, InvalidArguments) {
+  coordinates_t invalid = {91, 0};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  const extended_parameters_t extended = default_extended_parameters();
+  prayer_times_t times;
+  const extended_times_t extra = new_extended_times(
+      &invalid, get_utc_date(2024, 1, 1), &params, &extended, &times);
+  EXPECT_EQ(extra.ishraq, 0);
+  EXPECT_EQ(extra.lastThird, 0);
+  EXPECT_EQ(times.fajr, 0);
+
+  coordinates_t coordinates = {21.4225241, 39.8261818};
+  prayer_times_t timetable[1];
+  extended_times_t extended_timetable[1];
+  EXPECT_EQ(new_extended_times_range(&coordinates, get_utc_date(2024, 1, 1),
+                                     1, &params, NULL, NULL, timetable,
+                                     extended_timetable),
+            0u);
+}
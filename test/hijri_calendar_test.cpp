@@ -0,0 +1,99 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calendrical_helper.h"
+#include "../src/hijri_calendar.h"
+}
+
+static void expect_hijri(int year, int month, int day, int hijri_year,
+                         int hijri_month, int hijri_day) {
+  hijri_date_t hijri;
+  ASSERT_TRUE(hijri_from_gregorian(year, month, day, &hijri));
+  EXPECT_EQ(hijri.year, hijri_year);
+  EXPECT_EQ(hijri.month, hijri_month);
+  EXPECT_EQ(hijri.day, hijri_day);
+
+  int gregorian_year, gregorian_month, gregorian_day;
+  ASSERT_TRUE(gregorian_from_hijri(&hijri, &gregorian_year, &gregorian_month,
+                                   &gregorian_day));
+  EXPECT_EQ(gregorian_year, year);
+  EXPECT_EQ(gregorian_month, month);
+  EXPECT_EQ(gregorian_day, day);
+}
+
+TEST(HijriCalendarTest, UmmAlQuraDates) {
+  // Published Umm al-Qura month starts
+  expect_hijri(2002, 3, 15, 1423, MUHARRAM, 1);
+  expect_hijri(2018, 9, 11, 1440, MUHARRAM, 1);
+  expect_hijri(2020, 4, 24, 1441, RAMADAN, 1);
+  expect_hijri(2020, 5, 24, 1441, SHAWWAL, 1);
+  expect_hijri(2023, 3, 23, 1444, RAMADAN, 1);
+  expect_hijri(2023, 4, 21, 1444, SHAWWAL, 1);
+  expect_hijri(2023, 7, 19, 1445, MUHARRAM, 1);
+  expect_hijri(2024, 3, 11, 1445, RAMADAN, 1);
+  expect_hijri(2024, 4, 10, 1445, SHAWWAL, 1);
+  expect_hijri(2024, 7, 7, 1446, MUHARRAM, 1);
+  expect_hijri(2025, 3, 1, 1446, RAMADAN, 1);
+  expect_hijri(2025, 6, 26, 1447, MUHARRAM, 1);
+
+  expect_hijri(2024, 3, 10, 1445, SHABAN, 29);
+  expect_hijri(2023, 4, 20, 1444, RAMADAN, 29);
+  EXPECT_EQ(hijri_month_length(1444, RAMADAN), 29);
+  EXPECT_EQ(hijri_month_length(1445, RAMADAN), 30);
+  EXPECT_TRUE(is_umm_al_qura_year(1445));
+}
+
+TEST(HijriCalendarTest, ArithmeticalFallback) {
+  EXPECT_FALSE(is_umm_al_qura_year(1300));
+  EXPECT_FALSE(is_umm_al_qura_year(1600));
+
+  hijri_date_t epoch = {1, MUHARRAM, 1};
+  EXPECT_EQ(days_from_hijri(&epoch), days_from_civil(622, 7, 19));
+
+  // 30 year cycle: leap years have a 30 day Dhu al-Hijjah
+  EXPECT_EQ(hijri_month_length(1300, DHU_AL_HIJJAH), 30);
+  EXPECT_EQ(hijri_month_length(1301, DHU_AL_HIJJAH), 29);
+  EXPECT_EQ(hijri_month_length(1302, DHU_AL_HIJJAH), 29);
+  EXPECT_EQ(hijri_month_length(1303, DHU_AL_HIJJAH), 30);
+  EXPECT_EQ(hijri_month_length(1300, RAMADAN), 30);
+  EXPECT_EQ(hijri_month_length(1300, SHAWWAL), 29);
+
+  expect_hijri(1900, 1, 1, 1317, SHABAN, 28);
+}
+
+TEST(HijriCalendarTest, RoundTrip) {
+  // Every day from 1950 to 2100, across both ends of the table
+  long first = days_from_civil(1950, 1, 1);
+  long last = days_from_civil(2100, 1, 1);
+  hijri_date_t previous = hijri_from_days(first - 1);
+
+  for (long days = first; days < last; days++) {
+    hijri_date_t hijri = hijri_from_days(days);
+    ASSERT_EQ(days_from_hijri(&hijri), days) << days;
+    ASSERT_GE(hijri.day, 1);
+    ASSERT_LE(hijri.day, hijri_month_length(hijri.year, hijri.month));
+
+    hijri_date_t expected = next_hijri_day(previous);
+    if (is_umm_al_qura_year(hijri.year) ==
+        is_umm_al_qura_year(previous.year)) {
+      ASSERT_EQ(hijri.year, expected.year) << days;
+      ASSERT_EQ(hijri.month, expected.month) << days;
+      ASSERT_EQ(hijri.day, expected.day) << days;
+    }
+    previous = hijri;
+  }
+}
+
+TEST(HijriCalendarTest, FromTime) {
+  hijri_date_t hijri =
+      hijri_date_from_time(get_utc_date(2024, 3, 11) + 23 * 3600);
+  EXPECT_EQ(hijri.year, 1445);
+  EXPECT_EQ(hijri.month, RAMADAN);
+  EXPECT_EQ(hijri.day, 1);
+
+  hijri_date_t invalid = {1445, RAMADAN, 31};
+  int year, month, day;
+  EXPECT_FALSE(gregorian_from_hijri(&invalid, &year, &month, &day));
+  EXPECT_FALSE(hijri_from_gregorian(2024, 13, 1, &hijri));
+}
@@ -0,0 +1,234 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/horizon.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_time.h"
+}
+
+// 1 arcsecond cells around 21.4N 39.8E, about 30 m apart
+static const horizon_grid_t GRID = {21.2, 39.6, 1.0 / 3600, 1441, 1441};
+static const coordinates_t OBSERVER = {21.4, 39.8};
+
+static void write_grid(const char *path,
+                       int16_t (*elevation)(double latitude,
+                                            double longitude)) {
+  std::vector<int16_t> elevations((size_t)GRID.rows * GRID.columns);
+  for (uint32_t row = 0; row < GRID.rows; row++) {
+    for (uint32_t column = 0; column < GRID.columns; column++) {
+      elevations[(size_t)row * GRID.columns + column] =
+          elevation(GRID.south + row * GRID.spacing,
+                    GRID.west + column * GRID.spacing);
+    }
+  }
+  ASSERT_TRUE(horizon_tile_write(path, &GRID, elevations.data()));
+}
+
+static int16_t flat(double, double) { return 300; }
+
+// A 1000 m ridge 0.05 degrees, about 5.2 km, east of the observer
+static int16_t ridge(double, double longitude) {
+  return longitude >= OBSERVER.longitude + 0.05 ? 1300 : 300;
+}
+
+static int16_t rough(double latitude, double longitude) {
+  return (int16_t)(800 * std::sin(latitude * 977) * std::cos(longitude * 613) +
+                   40 * std::sin(latitude * 40000));
+}
+
+TEST(HorizonTest, Dip) {
+  EXPECT_EQ(horizon_dip(0), 0);
+  EXPECT_EQ(horizon_dip(-5), 0);
+  EXPECT_NEAR(horizon_dip(100), 0.347, 1e-9);
+  EXPECT_DOUBLE_EQ(horizon_sunrise_altitude(0), -50.0 / 60.0);
+  // Refraction shrinks above the horizon
+  EXPECT_NEAR(horizon_sunrise_altitude(5), 5 - (9.9 + 16) / 60, 0.01);
+}
+
+TEST(HorizonTest, ObserverHeight) {
+  coordinates_t coordinates = OBSERVER;
+  const time_t date = get_utc_date(2024, 3, 20);
+  const solar_time_t flat_time = new_solar_time(date, &coordinates);
+
+  solar_time_t solar_time = flat_time;
+  horizon_t horizon = {0, nullptr, 0};
+  horizon_solar_time(&solar_time, &horizon);
+  EXPECT_EQ(solar_time.sunrise, flat_time.sunrise);
+  EXPECT_EQ(solar_time.sunset, flat_time.sunset);
+
+  // From a 400 m tower the sun rises and sets 3.7 minutes earlier and later
+  horizon.height = 400;
+  solar_time = flat_time;
+  horizon_solar_time(&solar_time, &horizon);
+  EXPECT_NEAR((flat_time.sunrise - solar_time.sunrise) * 60, 3.7, 0.1);
+  EXPECT_NEAR((solar_time.sunset - flat_time.sunset) * 60, 3.7, 0.1);
+}
+
+TEST(HorizonTest, TileRoundTrip) {
+  const std::string tile_path = testing::TempDir() + "/horizon_test_rough.dem";
+  const char *path = tile_path.c_str();
+  write_grid(path, rough);
+  horizon_tile_t tile;
+  ASSERT_TRUE(horizon_tile_open(path, 0, &tile));
+  EXPECT_EQ(tile.grid.rows, GRID.rows);
+  EXPECT_NEAR(tile.grid.spacing, GRID.spacing, 1e-7);
+
+  for (uint32_t row = 0; row < GRID.rows; row += 37) {
+    for (uint32_t column = 0; column < GRID.columns; column += 41) {
+      const double latitude = tile.grid.south + row * tile.grid.spacing;
+      const double longitude = tile.grid.west + column * tile.grid.spacing;
+      double elevation;
+      ASSERT_TRUE(
+          horizon_tile_elevation(&tile, latitude, longitude, &elevation));
+      EXPECT_NEAR(elevation,
+                  rough(GRID.south + row * GRID.spacing,
+                        GRID.west + column * GRID.spacing),
+                  1e-6)
+          << row << " " << column;
+    }
+  }
+  double elevation;
+  EXPECT_FALSE(horizon_tile_elevation(&tile, 21.1, 39.8, &elevation));
+  EXPECT_FALSE(horizon_tile_elevation(&tile, 21.4, 40.001, &elevation));
+
+  // A small cache evicts more, and returns the same elevations
+  horizon_tile_t small;
+  ASSERT_TRUE(horizon_tile_open(path, 4, &small));
+  tile.hits = 0;
+  tile.misses = 0;
+  for (int i = 0; i < 2000; i++) {
+    const double latitude = 21.2 + 0.4 * ((i * 7919) % 2000) / 2000.0;
+    const double longitude = 39.6 + 0.4 * ((i * 104729) % 2000) / 2000.0;
+    double expected, actual;
+    ASSERT_TRUE(horizon_tile_elevation(&tile, latitude, longitude, &expected));
+    ASSERT_TRUE(horizon_tile_elevation(&small, latitude, longitude, &actual));
+    EXPECT_EQ(actual, expected);
+  }
+  EXPECT_GT(small.misses, tile.misses);
+  EXPECT_GT(tile.hits, 0u);
+  horizon_tile_close(&small);
+  horizon_tile_close(&tile);
+  std::remove(path);
+}
+
+TEST(HorizonTest, RejectsCorruptTiles) {
+  const std::string tile_path =
+      testing::TempDir() + "/horizon_test_corrupt.dem";
+  const char *path = tile_path.c_str();
+  write_grid(path, rough);
+  std::FILE *file = std::fopen(path, "rb");
+  ASSERT_NE(file, nullptr);
+  std::vector<char> data(1 << 24);
+  data.resize(std::fread(data.data(), 1, data.size(), file));
+  std::fclose(file);
+
+  horizon_tile_t tile;
+  file = std::fopen(path, "wb");
+  std::fwrite(data.data(), 1, data.size() - 1, file);
+  std::fclose(file);
+  EXPECT_FALSE(horizon_tile_open(path, 0, &tile));
+
+  // A damaged block fails its lookups only
+  data[data.size() - 100] = (char)0xff;
+  file = std::fopen(path, "wb");
+  std::fwrite(data.data(), 1, data.size(), file);
+  std::fclose(file);
+  ASSERT_TRUE(horizon_tile_open(path, 0, &tile));
+  double elevation;
+  EXPECT_FALSE(horizon_tile_elevation(&tile, 21.6, 40.0, &elevation));
+  EXPECT_TRUE(horizon_tile_elevation(&tile, 21.2, 39.6, &elevation));
+  horizon_tile_close(&tile);
+  std::remove(path);
+
+  const horizon_grid_t invalid = {21.2, 39.6, 0, 2, 2};
+  const int16_t elevations[4] = {0, 0, 0, 0};
+  EXPECT_FALSE(horizon_tile_write(path, &invalid, elevations));
+  EXPECT_FALSE(horizon_tile_open("missing_tile.dem", 0, &tile));
+}
+
+TEST(HorizonTest, Terrain) {
+  const std::string tile_path = testing::TempDir() + "/horizon_test_ridge.dem";
+  const char *path = tile_path.c_str();
+  write_grid(path, ridge);
+  horizon_tile_t tile;
+  ASSERT_TRUE(horizon_tile_open(path, 0, &tile));
+  horizon_t horizon = {0, &tile, 0};
+
+  // The ridge rises atan(1000 / 5175) to the east, less the curvature
+  const double distance = 0.05 * std::cos(OBSERVER.latitude * M_PI / 180) *
+                          6371000 * M_PI / 180;
+  const double ridge_altitude = std::atan2(1000, distance) * 180 / M_PI;
+  EXPECT_NEAR(horizon_altitude(&horizon, &OBSERVER, 90), ridge_altitude,
+              0.1);
+  // Level ground to the west stays at the horizontal
+  EXPECT_NEAR(horizon_altitude(&horizon, &OBSERVER, 90 + 180), 0, 0.01);
+  // Outside the tile only the height counts
+  const coordinates_t outside = {10, 10};
+  horizon.height = 100;
+  EXPECT_EQ(horizon_altitude(&horizon, &outside, 90), -horizon_dip(100));
+  horizon.height = 0;
+
+  // The sun clears the ridge long after the flat sunrise, and sets over the
+  // plain at about the same time
+  coordinates_t coordinates = OBSERVER;
+  const solar_time_t flat_time =
+      new_solar_time(get_utc_date(2024, 3, 20), &coordinates);
+  solar_time_t solar_time = flat_time;
+  horizon_solar_time(&solar_time, &horizon);
+  EXPECT_NEAR((solar_time.sunrise - flat_time.sunrise) * 60,
+              (horizon_sunrise_altitude(ridge_altitude) + 50.0 / 60.0) * 4 /
+                  std::cos(OBSERVER.latitude * M_PI / 180),
+              1.0);
+  EXPECT_NEAR((solar_time.sunset - flat_time.sunset) * 60, 0, 0.5);
+  horizon_tile_close(&tile);
+  std::remove(path);
+
+  // Above a plain, the curvature lowers the horizon about as much as the dip
+  write_grid(path, flat);
+  ASSERT_TRUE(horizon_tile_open(path, 0, &tile));
+  horizon.height = 10;
+  EXPECT_NEAR(horizon_altitude(&horizon, &OBSERVER, 90), -horizon_dip(10),
+              0.02);
+  horizon_tile_close(&tile);
+  std::remove(path);
+}
+
+TEST(HorizonTest, PrayerTimes) {
+  coordinates_t coordinates = OBSERVER;
+  const time_t date = get_utc_date(2024, 3, 20);
+  const horizon_t horizon = {400, nullptr, 0};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+
+  solar_time_t today = new_solar_time(date, &coordinates);
+  solar_time_t tomorrow = new_solar_time(add_days(date, 1), &coordinates);
+  const prayer_times_t flat = prayer_times_from_solar_time(
+      &coordinates, date, &params, &today, &tomorrow);
+  horizon_solar_time(&today, &horizon);
+  horizon_solar_time(&tomorrow, &horizon);
+  const prayer_times_t seen = prayer_times_from_solar_time(
+      &coordinates, date, &params, &today, &tomorrow);
+  EXPECT_NEAR(difftime(flat.sunrise, seen.sunrise), 4 * 60, 60);
+  EXPECT_NEAR(difftime(seen.maghrib, flat.maghrib), 4 * 60, 60);
+  EXPECT_EQ(seen.dhuhr, flat.dhuhr);
+
+  // The nearest day and latitude rules search for the sun at -50/60 degrees
+  for (high_latitude_rule_t rule : {NEAREST_DAY, NEAREST_LATITUDE}) {
+    params.highLatitudeRule = rule;
+    solar_time_t flat_today = new_solar_time(date, &coordinates);
+    solar_time_t flat_tomorrow =
+        new_solar_time(add_days(date, 1), &coordinates);
+    const prayer_times_t expected = prayer_times_from_solar_time(
+        &coordinates, date, &params, &flat_today, &flat_tomorrow);
+    const prayer_times_t actual = prayer_times_from_solar_time(
+        &coordinates, date, &params, &today, &tomorrow);
+    EXPECT_EQ(actual.sunrise, expected.sunrise);
+    EXPECT_EQ(actual.maghrib, expected.maghrib);
+  }
+}
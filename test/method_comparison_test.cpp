@@ -0,0 +1,115 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/method_comparison.h"
+#include "../src/prayer_times.h"
+}
+
+static void expect_same_times(const prayer_times_t &actual,
+                              const prayer_times_t &expected) {
+  EXPECT_EQ(actual.fajr, expected.fajr);
+  EXPECT_EQ(actual.sunrise, expected.sunrise);
+  EXPECT_EQ(actual.dhuhr, expected.dhuhr);
+  EXPECT_EQ(actual.asr, expected.asr);
+  EXPECT_EQ(actual.maghrib, expected.maghrib);
+  EXPECT_EQ(actual.isha, expected.isha);
+  EXPECT_EQ(actual.midnight, expected.midnight);
+}
+
+TEST(MethodComparisonTest, MatchesEveryMethodAndMadhab) {
+  coordinates_t locations[] = {
+      {35.7750, -78.6336},  // Raleigh
+      {59.9094, 10.7349},   // Oslo
+      {-33.8688, 151.2093}, // Sydney
+      {21.4225, 39.8262},   // Makkah
+  };
+  const size_t days = 30;
+  method_comparison_t results[days * COMPARISON_METHODS];
+  const time_t start = get_utc_date(2015, 6, 5);
+
+  for (coordinates_t &coordinates : locations) {
+    ASSERT_EQ(compare_methods_range(&coordinates, start, days, NULL,
+                                    COMPARISON_METHODS, results),
+              days);
+    for (size_t i = 0; i < days; i++) {
+      for (size_t m = 0; m < COMPARISON_METHODS; m++) {
+        calculation_parameters_t params =
+            getParameters((calculation_method)m);
+        const method_comparison_t &result = results[i * COMPARISON_METHODS + m];
+
+        params.madhab = SHAFI;
+        expect_same_times(result.shafi, new_prayer_times(&coordinates,
+                                                         add_days(start, i),
+                                                         &params));
+        params.madhab = HANAFI;
+        expect_same_times(result.hanafi, new_prayer_times(&coordinates,
+                                                          add_days(start, i),
+                                                          &params));
+      }
+    }
+  }
+}
+
+TEST(MethodComparisonTest, KeepsCustomRulesAndAdjustments) {
+  calculation_parameters_t methods[3] = {getParameters(MUSLIM_WORLD_LEAGUE),
+                                         getParameters(NORTH_AMERICA),
+                                         getParameters(UMM_AL_QURA)};
+  methods[0].highLatitudeRule = NEAREST_DAY;
+  methods[1].highLatitudeRule = SEVENTH_OF_THE_NIGHT;
+  methods[1].adjustments.asr = 2;
+  methods[2].madhab = HANAFI;
+  methods[2].adjustments.isha = 30;
+
+  coordinates_t tromso = {69.6492, 18.9553};
+  const size_t days = 10;
+  method_comparison_t results[days * 3];
+  const time_t start = get_utc_date(2024, 11, 20);
+
+  ASSERT_EQ(compare_methods_range(&tromso, start, days, methods, 3, results),
+            days);
+  for (size_t i = 0; i < days; i++) {
+    for (size_t m = 0; m < 3; m++) {
+      calculation_parameters_t params = methods[m];
+      params.madhab = SHAFI;
+      expect_same_times(results[i * 3 + m].shafi,
+                        new_prayer_times(&tromso, add_days(start, i), &params));
+      params.madhab = HANAFI;
+      expect_same_times(results[i * 3 + m].hanafi,
+                        new_prayer_times(&tromso, add_days(start, i), &params));
+    }
+  }
+}
+
+TEST(MethodComparisonTest, RejectsInvalidArguments) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  method_comparison_t results[COMPARISON_METHODS + 1];
+  const time_t start = get_utc_date(2015, 6, 5);
+
+  EXPECT_EQ(compare_methods_range(NULL, start, 1, NULL, 1, results), 0u);
+  EXPECT_EQ(compare_methods_range(&coordinates, start, 1, NULL, 1, NULL), 0u);
+  EXPECT_EQ(compare_methods_range(&coordinates, start, 0, NULL, 1, results),
+            0u);
+  EXPECT_EQ(compare_methods_range(&coordinates, start, 1, NULL, 0, results),
+            0u);
+  EXPECT_EQ(compare_methods_range(&coordinates, start, 1, NULL,
+                                  COMPARISON_METHODS + 1, results),
+            0u);
+}
+
+TEST(MethodComparisonTest, InvalidCoordinatesGiveNullTimes) {
+  coordinates_t coordinates = {95.0, -78.6336};
+  const prayer_times_t null_times = NULL_PRAYER_TIMES;
+  method_comparison_t results[2 * COMPARISON_METHODS];
+  const time_t start = get_utc_date(2015, 6, 5);
+
+  ASSERT_EQ(compare_methods_range(&coordinates, start, 2, NULL,
+                                  COMPARISON_METHODS, results),
+            2u);
+  for (const method_comparison_t &result : results) {
+    expect_same_times(result.shafi, null_times);
+    expect_same_times(result.hanafi, null_times);
+  }
+}
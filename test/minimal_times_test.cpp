@@ -0,0 +1,78 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/minimal_times.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_coordinates.h"
+}
+
+static epoch_minutes_t minutes(time_t when) {
+  return (epoch_minutes_t)(when >= 0 ? when / 60 : (when - 59) / 60);
+}
+
+TEST(MinimalTimesTest, MatchesPrayerTimes) {
+  if (solar_coordinates_chebyshev_enabled()) {
+    GTEST_SKIP() << "new_prayer_times() uses the Chebyshev coordinates";
+  }
+  const coordinates_t locations[] = {{21.4225241, 39.8261818},
+                                     {51.5074, -0.1278},
+                                     {59.9139, 10.7522},
+                                     {-33.8688, 151.2093},
+                                     {40.7128, -74.0060},
+                                     {64.1466, -21.9426},
+                                     {78.2232, 15.6267}};
+  const calculation_method methods[] = {MUSLIM_WORLD_LEAGUE, EGYPTIAN,
+                                        UMM_AL_QURA, MOON_SIGHTING_COMMITTEE,
+                                        NORTH_AMERICA, KARACHI};
+  const high_latitude_rule_t rules[] = {
+      MIDDLE_OF_THE_NIGHT, SEVENTH_OF_THE_NIGHT, TWILIGHT_ANGLE};
+  const int32_t first = (int32_t)(get_utc_date(2024, 1, 1) / 86400);
+
+  int compared = 0;
+  for (const coordinates_t &location : locations) {
+    for (int m = 0; m < 6; m++) {
+      calculation_parameters_t parameters = getParameters(methods[m]);
+      parameters.highLatitudeRule = rules[m % 3];
+      parameters.madhab = m % 2 ? HANAFI : SHAFI;
+      parameters.adjustments.maghrib += m;
+      for (int32_t day = first; day < first + 366; day += 5) {
+        coordinates_t coordinates = location;
+        const prayer_times_t expected =
+            new_prayer_times(&coordinates, (time_t)day * 86400, &parameters);
+        minimal_times_t times;
+        const bool found =
+            minimal_prayer_times(&coordinates, day, &parameters, &times);
+        ASSERT_EQ(found, expected.fajr != 0) << day;
+        if (!found) {
+          continue;
+        }
+        EXPECT_EQ(times.fajr, minutes(expected.fajr)) << day;
+        EXPECT_EQ(times.sunrise, minutes(expected.sunrise)) << day;
+        EXPECT_EQ(times.dhuhr, minutes(expected.dhuhr)) << day;
+        EXPECT_EQ(times.asr, minutes(expected.asr)) << day;
+        EXPECT_EQ(times.maghrib, minutes(expected.maghrib)) << day;
+        EXPECT_EQ(times.isha, minutes(expected.isha)) << day;
+        EXPECT_EQ(times.midnight, minutes(expected.midnight)) << day;
+        compared++;
+      }
+    }
+  }
+  EXPECT_GT(compared, 2000);
+}
+
+TEST(MinimalTimesTest, RejectsUnsupportedInput) {
+  coordinates_t coordinates = {21.4225241, 39.8261818};
+  calculation_parameters_t parameters = getParameters(MUSLIM_WORLD_LEAGUE);
+  minimal_times_t times;
+  EXPECT_TRUE(minimal_prayer_times(&coordinates, 19723, &parameters, &times));
+  EXPECT_FALSE(minimal_prayer_times(nullptr, 19723, &parameters, &times));
+  EXPECT_FALSE(minimal_prayer_times(&coordinates, 19723, nullptr, &times));
+
+  parameters.highLatitudeRule = NEAREST_DAY;
+  EXPECT_FALSE(minimal_prayer_times(&coordinates, 19723, &parameters, &times));
+  parameters.highLatitudeRule = MIDDLE_OF_THE_NIGHT;
+  coordinates.latitude = 91;
+  EXPECT_FALSE(minimal_prayer_times(&coordinates, 19723, &parameters, &times));
+}
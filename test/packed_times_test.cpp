@@ -0,0 +1,113 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/packed_times.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+}
+
+static const time_t *fields(const prayer_times_t &times) {
+  return &times.fajr;
+}
+
+TEST(PackedTimesTest, SixteenBytes) {
+  EXPECT_EQ(sizeof(packed_prayer_times_t), 16u);
+}
+
+TEST(PackedTimesTest, RoundTripsTimetables) {
+  coordinates_t locations[] = {
+      {35.7750, -78.6336},  // Raleigh
+      {-33.8688, 151.2093}, // Sydney
+      {64.1466, -21.9426},  // Reykjavik
+  };
+  calculation_method methods[] = {MUSLIM_WORLD_LEAGUE, MOON_SIGHTING_COMMITTEE,
+                                  UMM_AL_QURA};
+  const size_t days = 366;
+  prayer_times_t timetable[days];
+  packed_prayer_times_t packed[days];
+  prayer_times_t unpacked[days];
+
+  for (coordinates_t &coordinates : locations) {
+    for (calculation_method method : methods) {
+      calculation_parameters_t params = getParameters(method);
+      ASSERT_EQ(new_prayer_times_range(&coordinates, get_utc_date(2024, 1, 1),
+                                       days, &params, NULL, timetable),
+                days);
+      size_t valid = 0;
+      for (size_t i = 0; i < days; i++) {
+        valid += timetable[i].fajr != 0;
+      }
+      EXPECT_EQ(pack_prayer_times_batch(timetable, days, packed), valid);
+      unpack_prayer_times_batch(packed, days, unpacked);
+
+      for (size_t i = 0; i < days; i++) {
+        prayer_times_t single = unpack_prayer_times(&packed[i]);
+        for (int k = 0; k < 7; k++) {
+          const time_t expected = fields(timetable[i])[k];
+          const time_t actual = fields(unpacked[i])[k];
+          EXPECT_EQ(actual, fields(single)[k]);
+          if (expected % PACKED_TIME_UNIT == 0) {
+            EXPECT_EQ(actual, expected) << i << " " << k;
+          } else {
+            EXPECT_LE(llabs((long long)(actual - expected)),
+                      PACKED_TIME_UNIT / 2)
+                << i << " " << k;
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(PackedTimesTest, NullAndOutOfRange) {
+  prayer_times_t null_times = NULL_PRAYER_TIMES;
+  packed_prayer_times_t packed;
+  EXPECT_FALSE(pack_prayer_times(&null_times, &packed));
+  prayer_times_t unpacked = unpack_prayer_times(&packed);
+  EXPECT_EQ(unpacked.fajr, 0);
+  EXPECT_EQ(unpacked.midnight, 0);
+
+  const time_t fajr = get_utc_date(2024, 3, 1) + 5 * 3600;
+  prayer_times_t spread = {fajr,         fajr + 3600,  fajr + 8 * 3600,
+                           fajr + 11 * 3600, fajr + 13 * 3600,
+                           fajr + 15 * 3600, fajr + 12 * 86400};
+  EXPECT_FALSE(pack_prayer_times(&spread, &packed));
+  EXPECT_EQ(packed.fajr, 0);
+
+  prayer_times_t far = {(time_t)1e13, (time_t)1e13, (time_t)1e13,
+                        (time_t)1e13, (time_t)1e13, (time_t)1e13,
+                        (time_t)1e13};
+  EXPECT_FALSE(pack_prayer_times(&far, &packed));
+
+  // Before the epoch and on odd seconds, rounded to the nearest unit
+  prayer_times_t old_times = {-1000000014, -1000000000, -999990000,
+                              -999980000,  -999970000,  -999960000,
+                              -999950000};
+  ASSERT_TRUE(pack_prayer_times(&old_times, &packed));
+  unpacked = unpack_prayer_times(&packed);
+  EXPECT_EQ(unpacked.fajr, -1000000020);
+  EXPECT_EQ(unpacked.sunrise, -999999990);
+  EXPECT_EQ(unpacked.midnight, -999950010);
+}
+
+TEST(PackedTimesTest, CurrentAndNextPrayerMatchUnpacked) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t params = getParameters(NORTH_AMERICA);
+  prayer_times_t times =
+      new_prayer_times(&coordinates, get_utc_date(2015, 7, 12), &params);
+  packed_prayer_times_t packed;
+  ASSERT_TRUE(pack_prayer_times(&times, &packed));
+  prayer_times_t unpacked = unpack_prayer_times(&packed);
+
+  for (time_t when = times.fajr - 3600; when <= times.midnight + 3600;
+       when += 15) {
+    EXPECT_EQ(packed_current_prayer(&packed, when),
+              currentPrayer(&unpacked, when));
+    EXPECT_EQ(packed_next_prayer(&packed, when), next_prayer(&unpacked, when));
+  }
+  EXPECT_EQ(packed_current_prayer(&packed, times.dhuhr), DHUHR);
+  EXPECT_EQ(packed_next_prayer(&packed, times.dhuhr), ASR);
+}
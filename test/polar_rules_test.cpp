@@ -0,0 +1,131 @@
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "../src/polar_rules.h"
+#include "../src/prayer_times.h"
+}
+#include "test_utils.h"
+
+static const double SUNRISE_ALTITUDE = -50.0 / 60.0;
+
+TEST(PolarRulesTest, HourAngleOccurs) {
+  EXPECT_TRUE(hour_angle_occurs(59.9139, 23.44, SUNRISE_ALTITUDE));
+  EXPECT_FALSE(hour_angle_occurs(59.9139, 23.44, -18));
+  EXPECT_FALSE(hour_angle_occurs(69.6492, 23.44, SUNRISE_ALTITUDE));
+  EXPECT_FALSE(hour_angle_occurs(69.6492, -23.44, SUNRISE_ALTITUDE));
+  EXPECT_FALSE(hour_angle_occurs(90, 0, SUNRISE_ALTITUDE));
+}
+
+TEST(PolarRulesTest, NearestLatitude) {
+  // Limited by the lower culmination at the June solstice, 90 + angle - 23.5
+  EXPECT_NEAR(nearest_latitude(59.9139, -18), 48.5, 1e-9);
+  EXPECT_NEAR(nearest_latitude(78.2232, SUNRISE_ALTITUDE), 65.6667, 1e-4);
+  EXPECT_NEAR(nearest_latitude(-60, -18), -48.5, 1e-9);
+  EXPECT_EQ(nearest_latitude(40, -18), 40);
+
+  const double latitude = nearest_latitude(90, -18);
+  EXPECT_TRUE(hour_angle_occurs(latitude, 23.44, -18));
+  EXPECT_TRUE(hour_angle_occurs(latitude, -23.44, -18));
+}
+
+TEST(PolarRulesTest, NearestDay) {
+  const time_t date = get_utc_date(2024, 6, 21);
+  time_t nearest = 0;
+
+  // The midnight sun in Tromso lasts from late May to late July
+  ASSERT_TRUE(nearest_day(date, 69.6492, SUNRISE_ALTITUDE, &nearest));
+  const long days = (long)(nearest - date) / 86400;
+  EXPECT_GT(labs(days), 25);
+  EXPECT_LT(labs(days), 40);
+  EXPECT_EQ((nearest - date) % 86400, 0);
+
+  const solar_coordinates_t found =
+      new_solar_coordinates(julian_day_from_time_t(nearest));
+  const solar_coordinates_t previous = new_solar_coordinates(
+      julian_day_from_time_t(add_days(nearest, days < 0 ? 1 : -1)));
+  EXPECT_TRUE(hour_angle_occurs(69.6492, found.declination, SUNRISE_ALTITUDE));
+  EXPECT_FALSE(
+      hour_angle_occurs(69.6492, previous.declination, SUNRISE_ALTITUDE));
+
+  // Days when the event happens are their own nearest day
+  ASSERT_TRUE(nearest_day(get_utc_date(2024, 9, 1), 69.6492, SUNRISE_ALTITUDE,
+                          &nearest));
+  EXPECT_EQ(nearest, get_utc_date(2024, 9, 1));
+
+  // The altitude of the sun does not change during the day at the pole
+  EXPECT_FALSE(nearest_day(date, 90, -18, &nearest));
+}
+
+TEST(PolarRulesTest, NearestDayPrayerTimes) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  params.highLatitudeRule = NEAREST_DAY;
+  coordinates_t tromso = {69.6492, 18.9553};
+  const time_t date = get_utc_date(2024, 6, 21);
+
+  prayer_times_t times = new_prayer_times(&tromso, date, &params);
+  ASSERT_NE(times.fajr, 0);
+  EXPECT_LT(times.fajr, times.sunrise);
+  EXPECT_LT(times.sunrise, times.dhuhr);
+  EXPECT_LT(times.dhuhr, times.asr);
+  EXPECT_LT(times.asr, times.maghrib);
+  EXPECT_LT(times.maghrib, times.isha);
+
+  // Sunrise is the time of day of the closest day with a sunrise
+  time_t nearest = 0;
+  ASSERT_TRUE(nearest_day(date, tromso.latitude, SUNRISE_ALTITUDE, &nearest));
+  prayer_times_t reference = new_prayer_times(&tromso, nearest, &params);
+  EXPECT_NEAR((double)(times.sunrise - date),
+              (double)(reference.sunrise - nearest), 120);
+  EXPECT_NEAR((double)(times.maghrib - date),
+              (double)(reference.maghrib - nearest), 120);
+}
+
+TEST(PolarRulesTest, NearestLatitudePrayerTimes) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  params.highLatitudeRule = NEAREST_LATITUDE;
+  coordinates_t oslo = {59.9139, 10.7522};
+  const time_t date = get_utc_date(2024, 6, 21);
+
+  prayer_times_t times = new_prayer_times(&oslo, date, &params);
+  ASSERT_NE(times.isha, 0);
+  // Twilight lasts all night, and lasts longer than half the night at 48.5
+  // degrees, so Fajr and Isha are both at the middle of the night
+  EXPECT_LT(times.maghrib, times.isha);
+  EXPECT_LT(times.fajr, times.sunrise);
+  EXPECT_NEAR((double)(add_days(times.fajr, 1) - times.isha), 0, 120);
+
+  // The polar night has a sunrise and sunset at the nearest latitude
+  coordinates_t svalbard = {78.2232, 15.6267};
+  prayer_times_t winter =
+      new_prayer_times(&svalbard, get_utc_date(2024, 12, 21), &params);
+  ASSERT_NE(winter.sunrise, 0);
+  EXPECT_LT(winter.sunrise, winter.dhuhr);
+  EXPECT_LT(winter.dhuhr, winter.maghrib);
+  EXPECT_LT(winter.maghrib, winter.isha);
+}
+
+TEST(PolarRulesTest, UnchangedWhereEventsOccur) {
+  calculation_parameters_t middle = getParameters(MUSLIM_WORLD_LEAGUE);
+  middle.highLatitudeRule = MIDDLE_OF_THE_NIGHT;
+  calculation_parameters_t nearest_day_params = middle;
+  nearest_day_params.highLatitudeRule = NEAREST_DAY;
+  calculation_parameters_t nearest_latitude_params = middle;
+  nearest_latitude_params.highLatitudeRule = NEAREST_LATITUDE;
+  coordinates_t oslo = {59.9139, 10.7522};
+  const time_t date = get_utc_date(2024, 1, 15);
+
+  prayer_times_t expected = new_prayer_times(&oslo, date, &middle);
+  prayer_times_t day = new_prayer_times(&oslo, date, &nearest_day_params);
+  prayer_times_t latitude =
+      new_prayer_times(&oslo, date, &nearest_latitude_params);
+  // The crossings are refined with the solver, so they may round to the
+  // next minute
+  const time_t *reference = &expected.fajr;
+  const time_t *with_day = &day.fajr;
+  const time_t *with_latitude = &latitude.fajr;
+  for (int i = 0; i < 7; i++) {
+    EXPECT_NEAR((double)with_day[i], (double)reference[i], 60);
+    EXPECT_NEAR((double)with_latitude[i], (double)reference[i], 60);
+  }
+}
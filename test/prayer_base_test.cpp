@@ -0,0 +1,124 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+}
+
+static void expect_same_times(const prayer_times_t &actual,
+                              const prayer_times_t &expected) {
+  EXPECT_EQ(actual.fajr, expected.fajr);
+  EXPECT_EQ(actual.sunrise, expected.sunrise);
+  EXPECT_EQ(actual.dhuhr, expected.dhuhr);
+  EXPECT_EQ(actual.asr, expected.asr);
+  EXPECT_EQ(actual.maghrib, expected.maghrib);
+  EXPECT_EQ(actual.isha, expected.isha);
+  EXPECT_EQ(actual.midnight, expected.midnight);
+}
+
+TEST(PrayerBaseTest, PolicyMatchesFullCalculation) {
+  coordinates_t locations[] = {
+      {35.7750, -78.6336}, // Raleigh
+      {59.9094, 10.7349},  // Oslo
+      {69.6492, 18.9553},  // Tromso
+  };
+  calculation_method methods[] = {MUSLIM_WORLD_LEAGUE, MOON_SIGHTING_COMMITTEE,
+                                  UMM_AL_QURA};
+  high_latitude_rule_t rules[] = {MIDDLE_OF_THE_NIGHT, SEVENTH_OF_THE_NIGHT,
+                                  TWILIGHT_ANGLE, NEAREST_DAY,
+                                  NEAREST_LATITUDE};
+  const size_t days = 50;
+  prayer_base_t bases[days];
+  prayer_times_t timetable[days];
+  prayer_times_t expected[days];
+  const time_t start = get_utc_date(2024, 4, 20);
+
+  for (coordinates_t &coordinates : locations) {
+    for (calculation_method method : methods) {
+      const calculation_parameters_t base_params = getParameters(method);
+      ASSERT_EQ(new_prayer_base_range(&coordinates, start, days, &base_params,
+                                      bases),
+                days);
+
+      for (high_latitude_rule_t rule : rules) {
+        for (int variant = 0; variant < 4; variant++) {
+          calculation_parameters_t params = base_params;
+          params.highLatitudeRule = rule;
+          params.madhab = (variant & 1) ? HANAFI : SHAFI;
+          if (variant & 2) {
+            params.ishaInterval = params.ishaInterval ? 0 : 75;
+            params.adjustments = {-2, 1, 3, 4, -1, 2, 5};
+          }
+
+          ASSERT_EQ(new_prayer_times_range(&coordinates, start, days, &params,
+                                           NULL, expected),
+                    days);
+          ASSERT_EQ(prayer_times_from_base_range(bases, days, &params, NULL,
+                                                 timetable),
+                    days);
+          for (size_t i = 0; i < days; i++) {
+            SCOPED_TRACE(testing::Message()
+                         << coordinates.latitude << " " << method << " "
+                         << rule << " " << variant << " day " << i);
+            expect_same_times(timetable[i], expected[i]);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(PrayerBaseTest, SingleDayAndRamadanAdjustments) {
+  coordinates_t makkah = {21.4225241, 39.8261818};
+  calculation_parameters_t params = getParameters(UMM_AL_QURA);
+  hijri_month_adjustments_t ramadan = umm_al_qura_ramadan_adjustments(&params);
+  const time_t start = get_utc_date(2024, 3, 9);
+  const size_t days = 34;
+  prayer_base_t bases[days];
+  prayer_times_t timetable[days];
+  prayer_times_t expected[days];
+
+  ASSERT_EQ(new_prayer_base_range(&makkah, start, days, &params, bases), days);
+  ASSERT_EQ(new_prayer_times_range(&makkah, start, days, &params, &ramadan,
+                                   expected),
+            days);
+  ASSERT_EQ(prayer_times_from_base_range(bases, days, &params, &ramadan,
+                                         timetable),
+            days);
+  for (size_t i = 0; i < days; i++) {
+    expect_same_times(timetable[i], expected[i]);
+  }
+
+  prayer_times_t single = prayer_times_from_base(&bases[5], &params);
+  expect_same_times(single,
+                    new_prayer_times(&makkah, add_days(start, 5), &params));
+}
+
+TEST(PrayerBaseTest, AnglesMustMatch) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  const time_t start = get_utc_date(2015, 12, 10);
+  prayer_base_t bases[2];
+  prayer_times_t timetable[2];
+
+  ASSERT_EQ(new_prayer_base_range(&coordinates, start, 2, &params, bases), 2u);
+  EXPECT_EQ(new_prayer_base_range(NULL, start, 2, &params, bases), 0u);
+  EXPECT_TRUE(prayer_base_matches(&bases[0], &params));
+
+  calculation_parameters_t other = getParameters(NORTH_AMERICA);
+  EXPECT_FALSE(prayer_base_matches(&bases[0], &other));
+  EXPECT_EQ(prayer_times_from_base(&bases[0], &other).fajr, 0);
+  EXPECT_EQ(prayer_times_from_base_range(bases, 2, &other, NULL, timetable),
+            0u);
+
+  // An Isha interval does not need the Isha angle of the base
+  calculation_parameters_t interval = params;
+  interval.ishaAngle = 0;
+  interval.ishaInterval = 90;
+  EXPECT_TRUE(prayer_base_matches(&bases[0], &interval));
+  EXPECT_EQ(prayer_times_from_base(&bases[0], &interval).isha,
+            new_prayer_times(&coordinates, start, &interval).isha);
+}
@@ -0,0 +1,127 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/prayer_classifier.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+}
+
+#define DAYS 60
+
+// currentPrayer() on the day of the latest Fajr, and the next time
+static void expected(std::vector<prayer_times_t> &timetable, time_t when,
+                     prayer_t *label, int32_t *seconds) {
+  size_t day = 0;
+  while (day + 1 < timetable.size() && timetable[day + 1].fajr <= when) {
+    day++;
+  }
+  *label = currentPrayer(&timetable[day], when);
+  const prayer_t next = next_prayer(&timetable[day], when);
+  if (*label == MIDNIGHT) {
+    *seconds = day + 1 < timetable.size()
+                   ? (int32_t)(timetable[day + 1].fajr - when)
+                   : -1;
+  } else {
+    *seconds = (int32_t)(timeForPrayer(&timetable[day], next) - when);
+  }
+}
+
+TEST(PrayerClassifierTest, MatchesCurrentPrayer) {
+  coordinates_t coordinates = {51.5074, -0.1278};
+  calculation_parameters_t params = getParameters(MOON_SIGHTING_COMMITTEE);
+  std::vector<prayer_times_t> timetable(DAYS);
+  const time_t start = get_utc_date(2024, 5, 1);
+  ASSERT_EQ(new_prayer_times_range(&coordinates, start, DAYS, &params,
+                                   nullptr, timetable.data()),
+            (size_t)DAYS);
+
+  prayer_classifier_t classifier;
+  ASSERT_TRUE(prayer_classifier_init(&classifier, timetable.data(), DAYS));
+
+  std::mt19937_64 random(42);
+  std::uniform_int_distribution<time_t> instant(timetable[0].fajr,
+                                                timetable[DAYS - 1].midnight);
+  std::vector<time_t> timestamps(100000);
+  for (time_t &timestamp : timestamps) {
+    timestamp = instant(random);
+  }
+  // Every boundary and the second before it
+  for (const prayer_times_t &times : timetable) {
+    for (time_t event : {times.fajr, times.sunrise, times.dhuhr, times.asr,
+                         times.maghrib, times.isha, times.midnight}) {
+      timestamps.push_back(event);
+      timestamps.push_back(event - 1);
+    }
+  }
+
+  for (bool sorted : {false, true}) {
+    if (sorted) {
+      std::sort(timestamps.begin(), timestamps.end());
+    }
+    std::vector<uint8_t> labels(timestamps.size());
+    std::vector<int32_t> seconds(timestamps.size());
+    prayer_classifier_classify(&classifier, timestamps.data(),
+                               timestamps.size(), sorted, labels.data(),
+                               seconds.data());
+    for (size_t i = 0; i < timestamps.size(); i++) {
+      prayer_t label;
+      int32_t until;
+      expected(timetable, timestamps[i], &label, &until);
+      ASSERT_EQ(labels[i], label) << timestamps[i];
+      ASSERT_EQ(seconds[i], until) << timestamps[i];
+    }
+  }
+  prayer_classifier_free(&classifier);
+  EXPECT_EQ(classifier.days, 0u);
+}
+
+TEST(PrayerClassifierTest, OutsideTheTimetable) {
+  coordinates_t coordinates = {21.4225241, 39.8261818};
+  calculation_parameters_t params = getParameters(UMM_AL_QURA);
+  std::vector<prayer_times_t> timetable(3);
+  new_prayer_times_range(&coordinates, get_utc_date(2024, 1, 1), 3, &params,
+                         nullptr, timetable.data());
+  prayer_classifier_t classifier;
+  ASSERT_TRUE(prayer_classifier_init(&classifier, timetable.data(), 3));
+
+  const time_t last_night =
+      timetable[2].midnight + (timetable[2].midnight - timetable[2].maghrib);
+  const time_t timestamps[] = {timetable[0].fajr - 3600,
+                               (time_t)-4000000000LL,
+                               timetable[2].midnight,
+                               last_night - 1,
+                               last_night,
+                               (time_t)8000000000LL,
+                               // Out of order with sorted set
+                               timetable[1].isha};
+  uint8_t labels[7];
+  int32_t seconds[7];
+  prayer_classifier_classify(&classifier, timestamps, 7, true, labels,
+                             seconds);
+  EXPECT_EQ(labels[0], NONE);
+  EXPECT_EQ(seconds[0], 3600);
+  EXPECT_EQ(labels[1], NONE);
+  EXPECT_EQ(seconds[1], -1);
+  EXPECT_EQ(labels[2], MIDNIGHT);
+  EXPECT_EQ(seconds[2], -1);
+  EXPECT_EQ(labels[3], MIDNIGHT);
+  EXPECT_EQ(labels[4], NONE);
+  EXPECT_EQ(seconds[4], -1);
+  EXPECT_EQ(labels[5], NONE);
+  EXPECT_EQ(labels[6], ISHA);
+  EXPECT_EQ(seconds[6], timetable[1].midnight - timetable[1].isha);
+  prayer_classifier_free(&classifier);
+
+  // Days that cannot be classified
+  prayer_times_t invalid[3] = {timetable[0], {}, timetable[2]};
+  EXPECT_FALSE(prayer_classifier_init(&classifier, invalid, 3));
+  invalid[1] = timetable[2];
+  invalid[2] = timetable[1];
+  EXPECT_FALSE(prayer_classifier_init(&classifier, invalid, 3));
+  EXPECT_EQ(classifier.fajrs, nullptr);
+}
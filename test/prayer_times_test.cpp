@@ -478,3 +478,51 @@ TEST(PrayerTimesTest, testCalculationStability) {
     }
   }
 }
+
+// Consecutive days, which carry their events to the next
+TEST(PrayerTimesTest, CarryMatchesPrayerTimes) {
+  // Into the white nights and polar days of the northern latitudes
+  const time_t start = get_utc_date(2024, 4, 1);
+  const double latitudes[] = {21.4, 51.5, 58.0, 66.0, -33.9};
+  const calculation_method methods[] = {MUSLIM_WORLD_LEAGUE, UMM_AL_QURA,
+                                        MOON_SIGHTING_COMMITTEE};
+  const high_latitude_rule_t rules[] = {MIDDLE_OF_THE_NIGHT,
+                                        SEVENTH_OF_THE_NIGHT, TWILIGHT_ANGLE,
+                                        NEAREST_DAY, NEAREST_LATITUDE};
+  for (double latitude : latitudes) {
+    coordinates_t coordinates = {latitude, 10.75};
+    for (calculation_method method : methods) {
+      for (high_latitude_rule_t rule : rules) {
+        for (int madhab = SHAFI; madhab <= HANAFI; madhab++) {
+          calculation_parameters_t params = getParameters(method);
+          params.highLatitudeRule = rule;
+          params.madhab = (madhab_t)madhab;
+          prayer_carry_t carry = {};
+          for (int day = 0; day < 90; day += day == 40 ? 7 : 1) {
+            // The gap after day 40 leaves a carry of another day
+            const time_t date = add_days(start, day);
+            const prayer_day_t today_date = new_prayer_day(date);
+            const prayer_day_t tomorrow_date =
+                new_prayer_day(add_days(date, 1));
+            solar_time_t today = new_solar_time(date, &coordinates);
+            solar_time_t tomorrow =
+                new_solar_time(add_days(date, 1), &coordinates);
+            const prayer_times_t expected = prayer_times_from_prayer_day(
+                &coordinates, &today_date, &params, &today, &tomorrow_date,
+                &tomorrow);
+            const prayer_times_t times = prayer_times_with_carry(
+                &coordinates, &today_date, &params, &today, &tomorrow_date,
+                &tomorrow, &carry);
+            ASSERT_EQ(times.fajr, expected.fajr) << latitude << " " << day;
+            ASSERT_EQ(times.sunrise, expected.sunrise) << day;
+            ASSERT_EQ(times.dhuhr, expected.dhuhr) << day;
+            ASSERT_EQ(times.asr, expected.asr) << day;
+            ASSERT_EQ(times.maghrib, expected.maghrib) << day;
+            ASSERT_EQ(times.isha, expected.isha) << day;
+            ASSERT_EQ(times.midnight, expected.midnight) << day;
+          }
+        }
+      }
+    }
+  }
+}
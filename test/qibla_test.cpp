@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+#include <math.h>
+#include <vector>
+
+extern "C" {
+#include "../src/qibla.h"
+}
+
+struct QiblaReference {
+  coordinates_t coordinates;
+  double bearing;
+  double distance;
+};
+
+// Bearings from the Adhan reference implementations, distances from the
+// haversine formula on the same sphere
+static const QiblaReference REFERENCES[] = {
+    {{38.9072, -77.0369}, 56.5605, 10632.5},    // Washington DC
+    {{40.7128, -74.0059}, 58.4818, 10306.3},    // New York
+    {{37.7749, -122.4194}, 18.8438, 13175.7},   // San Francisco
+    {{61.2181, -149.9003}, 350.8831, 10784.5},  // Anchorage
+    {{-33.8688, 151.2093}, 277.4996, 13236.3},  // Sydney
+    {{-36.8485, 174.7633}, 261.1973, 15364.6},  // Auckland
+    {{51.5074, -0.1278}, 118.9872, 4793.8},     // London
+    {{48.8566, 2.3522}, 119.1631, 4496.2},      // Paris
+    {{59.9139, 10.7522}, 139.0279, 4850.6},     // Oslo
+    {{33.7294, 73.0931}, 255.8816, 3532.9},     // Islamabad
+    {{35.6895, 139.6917}, 293.0207, 9474.7},    // Tokyo
+};
+
+TEST(QiblaTest, ReferenceValues) {
+  for (const QiblaReference &reference : REFERENCES) {
+    EXPECT_NEAR(qibla(&reference.coordinates), reference.bearing, 0.001);
+    EXPECT_NEAR(qibla_distance(&reference.coordinates), reference.distance,
+                0.1);
+  }
+}
+
+TEST(QiblaTest, Kaaba) {
+  coordinates_t kaaba = {KAABA_LATITUDE, KAABA_LONGITUDE};
+  EXPECT_NEAR(qibla_distance(&kaaba), 0, 1e-9);
+
+  coordinates_t north = {KAABA_LATITUDE + 1, KAABA_LONGITUDE};
+  EXPECT_NEAR(qibla(&north), 180, 1e-9);
+  EXPECT_NEAR(qibla_distance(&north), EARTH_MEAN_RADIUS_KM * M_PI / 180,
+              1e-6);
+
+  coordinates_t antipode = {-KAABA_LATITUDE, KAABA_LONGITUDE - 180};
+  EXPECT_NEAR(qibla_distance(&antipode), EARTH_MEAN_RADIUS_KM * M_PI, 1e-6);
+}
+
+TEST(QiblaTest, BatchMatchesScalar) {
+  const size_t count = 181 * 73;
+  std::vector<double> latitudes(count), longitudes(count);
+  std::vector<double> bearings(count), distances(count);
+
+  for (size_t i = 0; i < count; i++) {
+    latitudes[i] = -90.0 + (double)(i / 73);
+    longitudes[i] = -180.0 + 5.0 * (double)(i % 73);
+  }
+
+  qibla_batch(latitudes.data(), longitudes.data(), count, bearings.data(),
+              distances.data());
+
+  for (size_t i = 0; i < count; i++) {
+    coordinates_t coordinates = {latitudes[i], longitudes[i]};
+    double expected = qibla(&coordinates);
+    double difference = fabs(bearings[i] - expected);
+    EXPECT_LT(fmin(difference, 360 - difference), 1e-9) << i;
+    EXPECT_NEAR(distances[i], qibla_distance(&coordinates), 1e-6) << i;
+  }
+
+  // Either output may be omitted
+  qibla_batch(latitudes.data(), longitudes.data(), count, NULL,
+              distances.data());
+  qibla_batch(latitudes.data(), longitudes.data(), count, bearings.data(),
+              NULL);
+}
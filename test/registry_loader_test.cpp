@@ -0,0 +1,158 @@
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../src/registry_loader.h"
+}
+
+TEST(RegistryLoaderTest, ParsesCsv) {
+  const std::string csv =
+      "latitude,longitude,method,madhab,rule,fajr,sunrise,dhuhr,asr,"
+      "maghrib,isha,midnight\r\n"
+      "# Makkah\r\n"
+      "21.4225241,39.8261818,3,0,0,0,0,0,0,0,30,0\r\n"
+      "\n"
+      " 51.5074 , -0.1278 ,5,1,4,-2,0,0,0,1,0,0\n"
+      "91,0,0,0,0,0,0,0,0,0,0,0\n"
+      "0,181,0,0,0,0,0,0,0,0,0,0\n"
+      "0,0,10,0,0,0,0,0,0,0,0,0\n"
+      "0,0,0,2,0,0,0,0,0,0,0,0\n"
+      "0,0,0,0,5,0,0,0,0,0,0,0\n"
+      "0,0,0,0,0,0,0,0,0,0,0,1441\n"
+      "0,0,0,0,0,0,0,0,0,0,0\n"
+      "0,0,0,0,0,0,0,0,0,0,0,0,0\n"
+      "0,0,0,0,0,0,x,0,0,0,0,0\n"
+      "latitude,0,0,0,0,0,0,0,0,0,0,0\n"
+      "-33.8688,151.2093,0,0,1,0,0,0,0,0,0,0";
+  ASSERT_EQ(registry_rows(csv.data(), csv.size()), 16u);
+
+  std::vector<coordinates_t> coordinates(16);
+  std::vector<calculation_parameters_t> parameters(16);
+  registry_error_t errors[16];
+  size_t error_count = 0;
+  const size_t rows =
+      registry_parse(csv.data(), csv.size(), coordinates.data(),
+                     parameters.data(), 16, errors, 16, &error_count);
+  ASSERT_EQ(rows, 3u);
+  EXPECT_EQ(coordinates[0].latitude, 21.4225241);
+  EXPECT_EQ(coordinates[0].longitude, 39.8261818);
+  EXPECT_EQ(parameters[0].method, UMM_AL_QURA);
+  EXPECT_EQ(parameters[0].ishaInterval, 90);
+  EXPECT_EQ(parameters[0].adjustments.isha, 30);
+  EXPECT_EQ(coordinates[1].longitude, -0.1278);
+  EXPECT_EQ(parameters[1].method, MOON_SIGHTING_COMMITTEE);
+  EXPECT_EQ(parameters[1].madhab, HANAFI);
+  EXPECT_EQ(parameters[1].highLatitudeRule, NEAREST_LATITUDE);
+  // Added to the method's adjustments
+  EXPECT_EQ(parameters[1].adjustments.fajr, -2);
+  EXPECT_EQ(parameters[1].adjustments.dhuhr, 5);
+  EXPECT_EQ(parameters[1].adjustments.maghrib, 4);
+  EXPECT_EQ(coordinates[2].latitude, -33.8688);
+  EXPECT_EQ(parameters[2].highLatitudeRule, SEVENTH_OF_THE_NIGHT);
+
+  const registry_error_t expected[] = {
+      {6, 1, REGISTRY_BAD_COORDINATES}, {7, 2, REGISTRY_BAD_COORDINATES},
+      {8, 3, REGISTRY_BAD_METHOD},      {9, 4, REGISTRY_BAD_MADHAB},
+      {10, 5, REGISTRY_BAD_RULE},       {11, 12, REGISTRY_BAD_ADJUSTMENT},
+      {12, 12, REGISTRY_BAD_COLUMNS},   {13, 12, REGISTRY_BAD_COLUMNS},
+      {14, 7, REGISTRY_BAD_NUMBER},     {15, 1, REGISTRY_BAD_NUMBER}};
+  ASSERT_EQ(error_count, 10u);
+  for (size_t i = 0; i < error_count; i++) {
+    EXPECT_EQ(errors[i].line, expected[i].line) << i;
+    EXPECT_EQ(errors[i].column, expected[i].column) << i;
+    EXPECT_EQ(errors[i].status, expected[i].status) << i;
+  }
+
+  // Stops at the capacity, counts every error past the error capacity
+  EXPECT_EQ(registry_parse(csv.data(), csv.size(), coordinates.data(),
+                           parameters.data(), 1, errors, 1, &error_count),
+            1u);
+  EXPECT_EQ(registry_parse(csv.data(), csv.size(), coordinates.data(),
+                           parameters.data(), 16, nullptr, 0, &error_count),
+            3u);
+  EXPECT_EQ(error_count, 10u);
+}
+
+TEST(RegistryLoaderTest, NumbersMatchStrtod) {
+  std::mt19937_64 random(7);
+  std::uniform_real_distribution<double> degrees(-90, 90);
+  std::string csv;
+  std::vector<double> latitudes;
+  char field[64];
+  for (int i = 0; i < 2000; i++) {
+    // Up to 17 significant digits, and exponents for strtod()
+    if (i % 100 == 0) {
+      std::snprintf(field, sizeof(field), "%.3e", degrees(random));
+    } else {
+      std::snprintf(field, sizeof(field), "%.*f", i % 16, degrees(random));
+    }
+    latitudes.push_back(std::strtod(field, nullptr));
+    csv += std::string(field) + ",0,0,0,0,0,0,0,0,0,0,0\n";
+  }
+  std::vector<coordinates_t> coordinates(latitudes.size());
+  std::vector<calculation_parameters_t> parameters(latitudes.size());
+  ASSERT_EQ(registry_parse(csv.data(), csv.size(), coordinates.data(),
+                           parameters.data(), latitudes.size(), nullptr, 0,
+                           nullptr),
+            latitudes.size());
+  for (size_t i = 0; i < latitudes.size(); i++) {
+    EXPECT_EQ(coordinates[i].latitude, latitudes[i]) << i;
+  }
+}
+
+TEST(RegistryLoaderTest, BinaryRoundTrip) {
+  const coordinates_t coordinates[] = {{21.4225241, 39.8261818},
+                                       {-33.8688, 151.2093},
+                                       {90, -180}};
+  calculation_parameters_t parameters[] = {getParameters(UMM_AL_QURA),
+                                           getParameters(EGYPTIAN),
+                                           getParameters(OTHER)};
+  parameters[0].adjustments.isha = 30;
+  parameters[1].madhab = HANAFI;
+  parameters[2].highLatitudeRule = NEAREST_DAY;
+  const char *path = "registry_loader_test.bin";
+  ASSERT_TRUE(registry_write_binary(path, coordinates, parameters, 3));
+
+  registry_file_t file;
+  ASSERT_TRUE(registry_file_open(path, &file));
+  EXPECT_EQ(registry_rows(file.data, file.size), 3u);
+  coordinates_t loaded[3];
+  calculation_parameters_t loaded_parameters[3];
+  size_t error_count = 1;
+  ASSERT_EQ(registry_parse(file.data, file.size, loaded, loaded_parameters, 3,
+                           nullptr, 0, &error_count),
+            3u);
+  EXPECT_EQ(error_count, 0u);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(loaded[i].latitude, coordinates[i].latitude);
+    EXPECT_EQ(loaded[i].longitude, coordinates[i].longitude);
+    EXPECT_EQ(loaded_parameters[i].method, parameters[i].method);
+    EXPECT_EQ(loaded_parameters[i].fajrAngle, parameters[i].fajrAngle);
+    EXPECT_EQ(loaded_parameters[i].madhab, parameters[i].madhab);
+    EXPECT_EQ(loaded_parameters[i].highLatitudeRule,
+              parameters[i].highLatitudeRule);
+    EXPECT_EQ(loaded_parameters[i].adjustments.dhuhr,
+              parameters[i].adjustments.dhuhr);
+    EXPECT_EQ(loaded_parameters[i].adjustments.isha,
+              parameters[i].adjustments.isha);
+  }
+
+  // A truncated file is rejected as a whole
+  registry_error_t error;
+  EXPECT_EQ(registry_parse(file.data, file.size - 1, loaded,
+                           loaded_parameters, 3, &error, 1, &error_count),
+            0u);
+  EXPECT_EQ(error_count, 1u);
+  EXPECT_EQ(error.line, 0u);
+  EXPECT_EQ(error.status, REGISTRY_BAD_HEADER);
+  registry_file_close(&file);
+  std::remove(path);
+
+  parameters[2].adjustments.fajr = 2000;
+  EXPECT_FALSE(registry_write_binary(path, coordinates, parameters, 3));
+  EXPECT_FALSE(registry_file_open("missing_registry.csv", &file));
+}
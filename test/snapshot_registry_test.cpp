@@ -0,0 +1,170 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/crescent_visibility.h"
+#include "../src/snapshot_registry.h"
+#include "../src/timetable.h"
+}
+
+#define DAY 86400
+
+static std::vector<registry_location_t> locations() {
+  return {{{21.4225241, 39.8261818}, 0},
+          {{51.5074, -0.1278}, 1},
+          {{-33.8688, 151.2093}, 1},
+          {{40.7128, -74.0060}, 0}};
+}
+
+static std::vector<calculation_parameters_t> parameters() {
+  return {getParameters(UMM_AL_QURA),
+          getParameters(MOON_SIGHTING_COMMITTEE)};
+}
+
+static void expect_snapshot(const daily_snapshot_t *snapshot, time_t day) {
+  std::vector<registry_location_t> places = locations();
+  std::vector<calculation_parameters_t> sets = parameters();
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->day, day);
+  for (size_t i = 0; i < places.size(); i++) {
+    prayer_times_t expected[SNAPSHOT_DAYS];
+    new_prayer_times_range(&places[i].coordinates, day, SNAPSHOT_DAYS,
+                           &sets[places[i].parameters], nullptr, expected);
+    for (int d = 0; d < SNAPSHOT_DAYS; d++) {
+      const prayer_times_t *times =
+          daily_snapshot_times(snapshot, i, day + d * DAY + 12 * 3600);
+      ASSERT_NE(times, nullptr);
+      EXPECT_EQ(times->fajr, expected[d].fajr);
+      EXPECT_EQ(times->isha, expected[d].isha);
+      EXPECT_EQ(times->midnight, expected[d].midnight);
+    }
+  }
+}
+
+TEST(SnapshotRegistryTest, PrewarmAndPublish) {
+  std::vector<registry_location_t> places = locations();
+  std::vector<calculation_parameters_t> sets = parameters();
+  const time_t day = get_utc_date(2024, 3, 10);
+  snapshot_registry_t *registry = snapshot_registry_new(
+      places.data(), places.size(), sets.data(), sets.size(), 2,
+      day + 5 * 3600);
+  ASSERT_NE(registry, nullptr);
+
+  const daily_snapshot_t *snapshot = snapshot_registry_acquire(registry, 0);
+  expect_snapshot(snapshot, day);
+  EXPECT_EQ(daily_snapshot_times(snapshot, places.size(), day), nullptr);
+  EXPECT_EQ(daily_snapshot_times(snapshot, 0, day - 1), nullptr);
+  EXPECT_EQ(daily_snapshot_times(snapshot, 0, day + 2 * DAY), nullptr);
+  snapshot_registry_release(registry, 0);
+  EXPECT_EQ(snapshot_registry_acquire(registry, 2), nullptr);
+
+  // Nothing is published until the next snapshot is computed
+  EXPECT_FALSE(snapshot_registry_publish(registry));
+  snapshot_registry_prewarm(registry, day + DAY);
+  expect_snapshot(snapshot_registry_acquire(registry, 1), day);
+  snapshot_registry_release(registry, 1);
+  EXPECT_TRUE(snapshot_registry_publish(registry));
+  expect_snapshot(snapshot_registry_acquire(registry, 1), day + DAY);
+  snapshot_registry_release(registry, 1);
+
+  // A jump of several days computes both days
+  snapshot_registry_prewarm(registry, day + 10 * DAY);
+  EXPECT_TRUE(snapshot_registry_publish(registry));
+  expect_snapshot(snapshot_registry_acquire(registry, 0), day + 10 * DAY);
+  snapshot_registry_release(registry, 0);
+  snapshot_registry_free(registry);
+
+  places[1].parameters = 2;
+  EXPECT_EQ(snapshot_registry_new(places.data(), places.size(), sets.data(),
+                                  sets.size(), 1, day),
+            nullptr);
+}
+
+TEST(SnapshotRegistryTest, PublishWaitsForReaders) {
+  std::vector<registry_location_t> places = locations();
+  std::vector<calculation_parameters_t> sets = parameters();
+  const time_t day = get_utc_date(2024, 6, 1);
+  snapshot_registry_t *registry = snapshot_registry_new(
+      places.data(), places.size(), sets.data(), sets.size(), 4, day);
+  ASSERT_NE(registry, nullptr);
+
+  // Readers check that a snapshot does not change while they hold it
+  std::atomic<bool> done(false);
+  std::atomic<long> reads(0);
+  std::vector<std::thread> readers;
+  for (unsigned reader = 1; reader < 4; reader++) {
+    readers.emplace_back([&, reader] {
+      while (!done) {
+        const daily_snapshot_t *snapshot =
+            snapshot_registry_acquire(registry, reader);
+        const time_t first = snapshot->day;
+        const time_t fajr = snapshot->times[0].fajr;
+        EXPECT_GE(fajr, first);
+        EXPECT_LT(fajr, first + DAY);
+        EXPECT_EQ(snapshot->day, first);
+        EXPECT_EQ(snapshot->times[0].fajr, fajr);
+        snapshot_registry_release(registry, reader);
+        reads++;
+      }
+    });
+  }
+
+  // A held snapshot stays readable until it is released
+  const daily_snapshot_t *held = snapshot_registry_acquire(registry, 0);
+  std::atomic<bool> published(false);
+  snapshot_registry_prewarm(registry, day + DAY);
+  std::thread publisher([&] {
+    published = snapshot_registry_publish(registry);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(published);
+  expect_snapshot(held, day);
+  snapshot_registry_release(registry, 0);
+  publisher.join();
+  EXPECT_TRUE(published);
+
+  for (int i = 2; i < 50; i++) {
+    snapshot_registry_prewarm(registry, day + i * DAY);
+    EXPECT_TRUE(snapshot_registry_publish(registry));
+  }
+  done = true;
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+  EXPECT_GT(reads, 0);
+  expect_snapshot(snapshot_registry_acquire(registry, 0), day + 49 * DAY);
+  snapshot_registry_release(registry, 0);
+  snapshot_registry_free(registry);
+}
+
+TEST(SnapshotRegistryTest, PrewarmerCatchesUp) {
+  if (!crescent_visibility_threads_enabled()) {
+    GTEST_SKIP() << "Built without ADHAN_THREADS";
+  }
+  std::vector<registry_location_t> places = locations();
+  std::vector<calculation_parameters_t> sets = parameters();
+  const time_t now = time(nullptr);
+  const time_t today = now - now % DAY;
+  snapshot_registry_t *registry = snapshot_registry_new(
+      places.data(), places.size(), sets.data(), sets.size(), 1,
+      now - 3 * DAY);
+  ASSERT_NE(registry, nullptr);
+  ASSERT_TRUE(snapshot_registry_start(registry, 3600));
+  EXPECT_FALSE(snapshot_registry_start(registry, 3600));
+
+  time_t day = 0;
+  for (int i = 0; i < 500 && day != today; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    day = snapshot_registry_acquire(registry, 0)->day;
+    snapshot_registry_release(registry, 0);
+  }
+  snapshot_registry_stop(registry);
+  expect_snapshot(snapshot_registry_acquire(registry, 0), today);
+  snapshot_registry_release(registry, 0);
+  snapshot_registry_free(registry);
+}
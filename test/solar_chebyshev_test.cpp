@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "../src/astronomical.h"
+#include "../src/calendrical_helper.h"
+#include "../src/double_utils.h"
+#include "../src/solar_chebyshev.h"
+}
+
+// The full series of compute_solar_coordinates(), which new_solar_coordinates()
+// no longer uses when the library is built with ADHAN_SOLAR_CHEBYSHEV
+static solar_coordinates_t exact_coordinates(double julian_day) {
+  double T = julian_century(julian_day);
+  double L0 = mean_solar_longitude(T);
+  double Lp = mean_lunar_longitude(T);
+  double omega = ascending_lunar_node_longitude(T);
+  double lambda = to_radians(apparent_solar_longitude(T, L0));
+  double delta_psi = nutation_in_longitude(T, L0, Lp, omega);
+  double delta_epsilon = nutation_in_obliquity(T, L0, Lp, omega);
+  double epsilon0 = mean_obliquity_of_the_ecliptic(T);
+  double epsilonapp =
+      to_radians(apparent_obliquity_of_the_ecliptic(T, epsilon0));
+
+  return {to_degrees(safe_asin(sin(epsilonapp) * sin(lambda))),
+          unwind_angle(to_degrees(
+              safe_atan2(cos(epsilonapp) * sin(lambda), cos(lambda)))),
+          mean_sidereal_time(T) +
+              delta_psi * cos(to_radians(epsilon0 + delta_epsilon))};
+}
+
+static double angle_error(double a, double b) {
+  return fabs(remainder(a - b, 360));
+}
+
+TEST(SolarChebyshevTest, MatchesExactCoordinates) {
+  double first, last;
+  chebyshev_solar_range(&first, &last);
+  EXPECT_LE(first, 2433282.5); // 1950-01-01
+  EXPECT_GE(last, 2506331.5);  // 2150-01-01
+
+  double declination = 0, rightAscension = 0, siderealTime = 0;
+  // Fractional steps reach every hour of the day over the range
+  for (double julian_day = first; julian_day <= last; julian_day += 0.29) {
+    solar_coordinates_t fitted;
+    ASSERT_TRUE(chebyshev_solar_coordinates(julian_day, &fitted));
+    solar_coordinates_t exact = exact_coordinates(julian_day);
+    declination =
+        fmax(declination, fabs(fitted.declination - exact.declination));
+    rightAscension =
+        fmax(rightAscension,
+             angle_error(fitted.rightAscension, exact.rightAscension));
+    siderealTime =
+        fmax(siderealTime, angle_error(fitted.apparentSiderealTime,
+                                       exact.apparentSiderealTime));
+    ASSERT_GE(fitted.rightAscension, 0);
+    ASSERT_LT(fitted.rightAscension, 360);
+  }
+  EXPECT_LT(declination, 1e-5);
+  EXPECT_LT(rightAscension, 3e-5);
+  // Bound by the lunar nutation term left out of the fit
+  EXPECT_LT(siderealTime, 7e-5);
+}
+
+TEST(SolarChebyshevTest, ContinuousAtSegmentBoundaries) {
+  double first, last;
+  chebyshev_solar_range(&first, &last);
+  for (double boundary = first + SOLAR_CHEBYSHEV_SEGMENT_DAYS; boundary < last;
+       boundary += SOLAR_CHEBYSHEV_SEGMENT_DAYS) {
+    solar_coordinates_t before, after;
+    ASSERT_TRUE(chebyshev_solar_coordinates(boundary - 1e-6, &before));
+    ASSERT_TRUE(chebyshev_solar_coordinates(boundary, &after));
+    EXPECT_LT(fabs(before.declination - after.declination), 2e-5);
+    EXPECT_LT(angle_error(before.rightAscension, after.rightAscension), 6e-5);
+  }
+}
+
+TEST(SolarChebyshevTest, OutOfRange) {
+  double first, last;
+  chebyshev_solar_range(&first, &last);
+  const solar_coordinates_t untouched = {1, 2, 3};
+  solar_coordinates_t coordinates = untouched;
+
+  EXPECT_FALSE(chebyshev_solar_coordinates(first - 0.5, &coordinates));
+  EXPECT_FALSE(chebyshev_solar_coordinates(last + 0.5, &coordinates));
+  EXPECT_FALSE(chebyshev_solar_coordinates(NAN, &coordinates));
+  EXPECT_EQ(coordinates.declination, untouched.declination);
+  EXPECT_EQ(coordinates.rightAscension, untouched.rightAscension);
+  EXPECT_EQ(coordinates.apparentSiderealTime, untouched.apparentSiderealTime);
+
+  EXPECT_TRUE(chebyshev_solar_coordinates(first, &coordinates));
+  EXPECT_TRUE(chebyshev_solar_coordinates(last, &coordinates));
+}
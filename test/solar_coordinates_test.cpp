@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+#include <string.h>
+#include <thread>
+
+extern "C" {
+#include "../src/lunar_coordinates.h"
+#include "../src/prayer_times.h"
+#include "../src/solar_coordinates.h"
+#include "../src/solar_ephemeris.h"
+#include "../src/solar_time.h"
+}
+#include "test_utils.h"
+
+TEST(SolarCoordinatesCacheTest, ConsecutiveDays) {
+  if (!solar_coordinates_cache_enabled()) {
+    GTEST_SKIP() << "Built without ADHAN_SOLAR_CACHE";
+  }
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  coordinates_t coordinates = {35.7750, -78.6336};
+  const time_t start = get_utc_date(2024, 1, 1);
+
+  solar_coordinates_cache_reset();
+  new_prayer_times(&coordinates, start, &params);
+  solar_coordinates_cache_stats_t first = solar_coordinates_cache_stats();
+  // Today's midnight computes tomorrow's solar time, which shares two days
+  EXPECT_EQ(first.misses, 4u);
+  EXPECT_EQ(first.hits, 2u);
+
+  for (int day = 1; day < 30; day++) {
+    new_prayer_times(&coordinates, add_days(start, day), &params);
+  }
+  solar_coordinates_cache_stats_t month = solar_coordinates_cache_stats();
+  // One new day per day once the loop is running
+  EXPECT_EQ(month.misses, 4u + 29u);
+  EXPECT_GT(solar_coordinates_cache_hit_rate(), 0.8);
+}
+
+TEST(SolarCoordinatesCacheTest, SameResults) {
+  if (!solar_coordinates_cache_enabled()) {
+    GTEST_SKIP() << "Built without ADHAN_SOLAR_CACHE";
+  }
+  const double julian_day = 2460310.5;
+
+  solar_coordinates_cache_reset();
+  solar_coordinates_t computed = new_solar_coordinates(julian_day);
+  // Fill the ring so the first day is evicted and computed again
+  for (int day = 1; day <= 8; day++) {
+    new_solar_coordinates(julian_day + day);
+  }
+  solar_coordinates_t cached = new_solar_coordinates(julian_day + 8);
+  solar_coordinates_t evicted = new_solar_coordinates(julian_day);
+
+  EXPECT_EQ(memcmp(&computed, &evicted, sizeof(computed)), 0);
+  solar_coordinates_cache_stats_t stats = solar_coordinates_cache_stats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 10u);
+  (void)cached;
+
+  solar_coordinates_cache_reset();
+  EXPECT_EQ(solar_coordinates_cache_stats().hits, 0u);
+  EXPECT_EQ(solar_coordinates_cache_hit_rate(), 0.0);
+}
+
+TEST(SolarCoordinatesCacheTest, PerThread) {
+  if (!solar_coordinates_cache_enabled()) {
+    GTEST_SKIP() << "Built without ADHAN_SOLAR_CACHE";
+  }
+  solar_coordinates_cache_reset();
+  new_solar_coordinates(2460310.5);
+  new_solar_coordinates(2460310.5);
+
+  solar_coordinates_cache_stats_t other = {0, 0};
+  std::thread thread([&other]() {
+    new_solar_coordinates(2460310.5);
+    other = solar_coordinates_cache_stats();
+  });
+  thread.join();
+
+  EXPECT_EQ(other.hits, 0u);
+  EXPECT_EQ(other.misses, 1u);
+  EXPECT_EQ(solar_coordinates_cache_stats().hits, 1u);
+}
+
+TEST(SolarCoordinatesPrecisionTest, HighTier) {
+  // Astronomical Algorithms example 22.a, 1987-04-10 0h TD
+  double longitude, obliquity;
+  iau1980_nutation(-0.127296372348, &longitude, &obliquity);
+  EXPECT_NEAR(longitude * 3600, -3.788, 1e-3);
+  EXPECT_NEAR(obliquity * 3600, 9.443, 1e-3);
+
+  // Example 25.b, 1992-10-13 0h TD, within half an arcsecond
+  const double jde = 2448908.5;
+  const double year = 2000 + (jde - 2451545) / 365.25;
+  const solar_coordinates_t high = solar_coordinates_with_precision(
+      jde - delta_t(year) / 86400, SOLAR_PRECISION_HIGH);
+  EXPECT_NEAR(high.rightAscension, 198.378121, 0.5 / 3600);
+  EXPECT_NEAR(high.declination, -7.783817, 0.5 / 3600);
+}
+
+TEST(SolarCoordinatesPrecisionTest, Tiers) {
+  ASSERT_EQ(solar_coordinates_precision(), SOLAR_PRECISION_STANDARD);
+  for (double jd = 2433282.5; jd < 2469807.5; jd += 97.3) {
+    const solar_coordinates_t standard = new_solar_coordinates(jd);
+    const solar_coordinates_t fast =
+        solar_coordinates_with_precision(jd, SOLAR_PRECISION_FAST);
+    const solar_coordinates_t high =
+        solar_coordinates_with_precision(jd, SOLAR_PRECISION_HIGH);
+    EXPECT_NEAR(fast.declination, high.declination, 0.01) << jd;
+    EXPECT_NEAR(remainder(fast.rightAscension - high.rightAscension, 360), 0,
+                0.02)
+        << jd;
+    EXPECT_NEAR(standard.declination, high.declination, 0.005) << jd;
+    EXPECT_NEAR(
+        remainder(standard.rightAscension - high.rightAscension, 360), 0,
+        0.01)
+        << jd;
+  }
+}
+
+TEST(SolarCoordinatesPrecisionTest, PerThreadSetting) {
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  coordinates_t coordinates = {35.7750, -78.6336};
+  const time_t date = get_utc_date(2015, 7, 12);
+  const double jd = 2457215.5;
+
+  const prayer_times_t standard =
+      new_prayer_times(&coordinates, date, &params);
+  const solar_coordinates_t before = new_solar_coordinates(jd);
+
+  EXPECT_EQ(solar_coordinates_set_precision(SOLAR_PRECISION_FAST),
+            SOLAR_PRECISION_STANDARD);
+  // Same day, other tier, so the cache must not answer
+  const solar_coordinates_t fast = new_solar_coordinates(jd);
+  const solar_coordinates_t direct = fast_solar_coordinates(jd);
+  EXPECT_EQ(memcmp(&fast, &direct, sizeof(fast)), 0);
+  const prayer_times_t times = new_prayer_times(&coordinates, date, &params);
+  EXPECT_LE(llabs((long long)(times.dhuhr - standard.dhuhr)), 60);
+  EXPECT_LE(llabs((long long)(times.maghrib - standard.maghrib)), 60);
+
+  // Other threads keep the standard tier
+  solar_precision_t other = SOLAR_PRECISION_HIGH;
+  std::thread thread([&other]() { other = solar_coordinates_precision(); });
+  thread.join();
+  if (solar_coordinates_cache_enabled()) {
+    EXPECT_EQ(other, SOLAR_PRECISION_STANDARD);
+  }
+
+  EXPECT_EQ(solar_coordinates_set_precision(SOLAR_PRECISION_STANDARD),
+            SOLAR_PRECISION_FAST);
+  const solar_coordinates_t after = new_solar_coordinates(jd);
+  EXPECT_EQ(memcmp(&before, &after, sizeof(before)), 0);
+  const prayer_times_t restored =
+      new_prayer_times(&coordinates, date, &params);
+  EXPECT_EQ(memcmp(&restored, &standard, sizeof(standard)), 0);
+}
+
+TEST(SolarTimeDaysTest, MatchesNewSolarTime) {
+  coordinates_t coordinates = {59.9094, 10.7349};
+  const time_t start = get_utc_date(2023, 12, 30);
+  solar_time_days_t days;
+  solar_time_days_init(&days, &coordinates, start);
+
+  for (int day = 0; day < 40; day++) {
+    const solar_time_t today =
+        new_solar_time(start + day * 86400, &coordinates);
+    const solar_time_t tomorrow =
+        new_solar_time(start + (day + 1) * 86400, &coordinates);
+    EXPECT_EQ(days.day, day);
+    EXPECT_EQ(days.today.transit, today.transit) << day;
+    EXPECT_EQ(days.today.sunrise, today.sunrise) << day;
+    EXPECT_EQ(days.today.sunset, today.sunset) << day;
+    EXPECT_EQ(days.tomorrow.sunset, tomorrow.sunset) << day;
+    solar_time_days_next(&days);
+  }
+}
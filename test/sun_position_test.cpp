@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include <math.h>
+
+extern "C" {
+#include "../src/prayer_times.h"
+#include "../src/sun_position.h"
+}
+
+static time_t utc_time(int year, int month, int day, int hour, int minute) {
+  struct tm date = {0};
+  date.tm_year = year - 1900;
+  date.tm_mon = month - 1;
+  date.tm_mday = day;
+  date.tm_hour = hour;
+  date.tm_min = minute;
+  return timegm(&date);
+}
+
+TEST(SunPositionTest, AltitudeAtSunriseAndSunset) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t parameters = getParameters(NORTH_AMERICA);
+  prayer_times_t prayer_times = new_prayer_times(
+      &coordinates, utc_time(2015, 7, 12, 0, 0), &parameters);
+
+  // Times are rounded to the minute, during which the sun moves less than a
+  // quarter of a degree at this latitude
+  sun_position_t sunrise = sun_position(&coordinates, prayer_times.sunrise);
+  sun_position_t sunset = sun_position(&coordinates, prayer_times.maghrib);
+  EXPECT_NEAR(sunrise.altitude, -50.0 / 60.0, 0.25);
+  EXPECT_NEAR(sunset.altitude, -50.0 / 60.0, 0.25);
+  EXPECT_GT(sunrise.azimuth, 45);
+  EXPECT_LT(sunrise.azimuth, 90);
+  EXPECT_GT(sunset.azimuth, 270);
+  EXPECT_LT(sunset.azimuth, 315);
+}
+
+TEST(SunPositionTest, TransitAzimuth) {
+  coordinates_t north = {35.7750, -78.6336};
+  coordinates_t south = {-33.8688, 151.2093};
+  calculation_parameters_t parameters =
+      getParameters(MUSLIM_WORLD_LEAGUE);
+  time_t date = utc_time(2015, 7, 12, 0, 0);
+
+  prayer_times_t north_times = new_prayer_times(&north, date, &parameters);
+  prayer_times_t south_times = new_prayer_times(&south, date, &parameters);
+  sun_position_t north_noon = sun_position(&north, north_times.dhuhr);
+  sun_position_t south_noon = sun_position(&south, south_times.dhuhr);
+
+  // Dhuhr is rounded to the minute and includes a one minute adjustment
+  EXPECT_NEAR(north_noon.azimuth, 180, 3);
+  EXPECT_NEAR(south_noon.azimuth <= 180 ? south_noon.azimuth
+                                        : south_noon.azimuth - 360,
+              0, 3);
+  // 90 - latitude + declination, with a declination of about 22 degrees
+  EXPECT_NEAR(north_noon.altitude, 90 - 35.7750 + 21.9, 0.5);
+  EXPECT_NEAR(south_noon.altitude, 90 - 33.8688 - 21.9, 0.5);
+}
+
+TEST(SunPositionTest, AzimuthOfCelestialBody) {
+  // Astronomical Algorithms example 13.b, with the azimuth measured from the
+  // north instead of the south
+  EXPECT_NEAR(azimuth_of_celestial_body(38.921389, -6.719892, 64.352133),
+              68.0337 + 180, 0.0001);
+  EXPECT_NEAR(altitude_of_celestial_body(38.921389, -6.719892, 64.352133),
+              15.1249, 0.0001);
+}
+
+TEST(SunPositionTest, CurveMatchesScalar) {
+  coordinates_t coordinates = {59.9139, 10.7522};
+  solar_time_t solar_time =
+      new_solar_time(utc_time(2024, 3, 20, 0, 0), &coordinates);
+  const size_t count = 97;
+  double altitudes[count];
+  double azimuths[count];
+
+  sun_position_curve(&solar_time, 0, 0.25, count, altitudes, azimuths);
+  for (size_t i = 0; i < count; i++) {
+    sun_position_t position = solar_time_sun_position(&solar_time, i * 0.25);
+    EXPECT_NEAR(altitudes[i], position.altitude, 1e-9);
+    EXPECT_NEAR(azimuths[i], position.azimuth, 1e-9);
+  }
+
+  // Either output may be omitted
+  double only_altitudes[count];
+  sun_position_curve(&solar_time, 0, 0.25, count, only_altitudes, NULL);
+  EXPECT_EQ(only_altitudes[40], altitudes[40]);
+}
+
+TEST(SunPositionTest, InstantMatchesSolarTime) {
+  coordinates_t coordinates = {21.4225241, 39.8261818};
+  time_t day = utc_time(2023, 12, 1, 0, 0);
+  solar_time_t solar_time = new_solar_time(day, &coordinates);
+
+  for (int hour = 0; hour < 24; hour += 5) {
+    sun_position_t instant =
+        sun_position(&coordinates, day + hour * 3600 + 1800);
+    sun_position_t interpolated =
+        solar_time_sun_position(&solar_time, hour + 0.5);
+    EXPECT_NEAR(instant.altitude, interpolated.altitude, 1e-9);
+    EXPECT_NEAR(instant.azimuth, interpolated.azimuth, 1e-9);
+  }
+}
@@ -0,0 +1,178 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <climits>
+#include <cstdint>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/time_format.h"
+}
+
+static const int NEW_YORK_EDT = -4 * 3600;
+static const int NEW_YORK_EST = -5 * 3600;
+
+TEST(TimeFormatTest, FormatsPrayerTimes) {
+  time_t date = get_utc_date(2015, 7, 12);
+  calculation_parameters_t params = getParameters(NORTH_AMERICA);
+  params.madhab = HANAFI;
+
+  coordinates_t coordinates = {35.7750, -78.6336};
+  prayer_times_t prayerTimes = new_prayer_times(&coordinates, date, &params);
+
+  char buffer[TIME_FORMAT_MAX_LENGTH];
+
+  ASSERT_EQ(format_time(prayerTimes.fajr, NEW_YORK_EDT, TIME_FORMAT_12H,
+                        buffer, sizeof(buffer)),
+            8u);
+  ASSERT_STREQ(buffer, "04:42 AM");
+
+  format_time(prayerTimes.asr, NEW_YORK_EDT, TIME_FORMAT_12H, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "06:22 PM");
+
+  format_time(prayerTimes.asr, NEW_YORK_EDT, TIME_FORMAT_24H, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "18:22");
+
+  format_time(prayerTimes.midnight, NEW_YORK_EDT, TIME_FORMAT_12H, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "12:37 AM");
+
+  format_time(prayerTimes.dhuhr, NEW_YORK_EDT, TIME_FORMAT_ISO8601, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "2015-07-12T13:21:00-04:00");
+
+  format_time(prayerTimes.dhuhr, 0, TIME_FORMAT_ISO8601, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "2015-07-12T17:21:00Z");
+
+  format_time(prayerTimes.maghrib, NEW_YORK_EDT, TIME_FORMAT_MINUTES, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "1232");
+  ASSERT_EQ(minutes_of_day(prayerTimes.maghrib, NEW_YORK_EDT), 20 * 60 + 32);
+}
+
+TEST(TimeFormatTest, EdgeCases) {
+  char buffer[TIME_FORMAT_MAX_LENGTH];
+  time_t noon = get_utc_date(2016, 2, 29) + 12 * 3600;
+
+  format_time(noon, 0, TIME_FORMAT_12H, buffer, sizeof(buffer));
+  ASSERT_STREQ(buffer, "12:00 PM");
+
+  format_time(noon, 5 * 3600 + 30 * 60, TIME_FORMAT_ISO8601, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "2016-02-29T17:30:00+05:30");
+
+  format_time(get_utc_date(1969, 12, 31), 0, TIME_FORMAT_ISO8601, buffer,
+              sizeof(buffer));
+  ASSERT_STREQ(buffer, "1969-12-31T00:00:00Z");
+
+  format_time(0, 0, TIME_FORMAT_24H, buffer, sizeof(buffer));
+  ASSERT_STREQ(buffer, "--:--");
+
+  // Offsets of 100 hours or more have no ISO 8601 form
+  ASSERT_EQ(format_time(noon, 99 * 3600 + 59 * 60, TIME_FORMAT_ISO8601,
+                        buffer, sizeof(buffer)),
+            25u);
+  ASSERT_STREQ(buffer, "2016-03-04T15:59:00+99:59");
+  ASSERT_EQ(format_time(noon, 100 * 3600, TIME_FORMAT_ISO8601, buffer,
+                        sizeof(buffer)),
+            0u);
+  ASSERT_STREQ(buffer, "");
+  ASSERT_EQ(format_time(noon, INT_MIN, TIME_FORMAT_ISO8601, buffer,
+                        sizeof(buffer)),
+            0u);
+  ASSERT_EQ(format_time(noon, INT_MIN, TIME_FORMAT_24H, buffer,
+                        sizeof(buffer)),
+            5u);
+
+  // Years of up to nine digits, the earliest with an offset fills the buffer
+  if (sizeof(time_t) == 8 && sizeof(long) == 8) {
+    const time_t first = (time_t)days_from_civil(-999999999, 1, 1) * 86400;
+    const time_t last = (time_t)days_from_civil(-999999999, 12, 31) * 86400;
+    ASSERT_EQ(format_time(last + 86399 + 99 * 3600 + 59 * 60,
+                          -(99 * 3600 + 59 * 60), TIME_FORMAT_ISO8601,
+                          buffer, sizeof(buffer)),
+              TIME_FORMAT_MAX_LENGTH - 1u);
+    ASSERT_STREQ(buffer, "-999999999-12-31T23:59:59-99:59");
+    ASSERT_EQ(format_time(first - 1, 0, TIME_FORMAT_ISO8601, buffer,
+                          sizeof(buffer)),
+              0u);
+
+    const time_t after = (time_t)days_from_civil(1000000000, 1, 1) * 86400;
+    ASSERT_EQ(format_time(after - 1, 0, TIME_FORMAT_ISO8601, buffer,
+                          sizeof(buffer)),
+              25u);
+    ASSERT_STREQ(buffer, "999999999-12-31T23:59:59Z");
+    ASSERT_EQ(format_time(after, 0, TIME_FORMAT_ISO8601, buffer,
+                          sizeof(buffer)),
+              0u);
+    ASSERT_EQ(format_time(INT64_MAX, 0, TIME_FORMAT_ISO8601, buffer,
+                          sizeof(buffer)),
+              0u);
+  }
+
+  ASSERT_EQ(format_time(noon, 0, TIME_FORMAT_12H, buffer, 8), 0u);
+  ASSERT_STREQ(buffer, "");
+  ASSERT_EQ(format_time(noon, 0, TIME_FORMAT_12H, buffer, 9), 8u);
+  ASSERT_STREQ(buffer, "12:00 PM");
+}
+
+TEST(TimeFormatTest, OffsetTable) {
+  const utc_offset_entry_t entries[] = {
+      {get_utc_date(2015, 1, 1), NEW_YORK_EST},
+      {get_utc_date(2015, 3, 8) + 7 * 3600, NEW_YORK_EDT},
+      {get_utc_date(2015, 11, 1) + 6 * 3600, NEW_YORK_EST},
+  };
+  utc_offset_table_t table = {entries, 3};
+
+  ASSERT_EQ(utc_offset_at(&table, get_utc_date(2014, 6, 1)), NEW_YORK_EST);
+  ASSERT_EQ(utc_offset_at(&table, get_utc_date(2015, 3, 8)), NEW_YORK_EST);
+  ASSERT_EQ(utc_offset_at(&table, get_utc_date(2015, 3, 9)), NEW_YORK_EDT);
+  ASSERT_EQ(utc_offset_at(&table, get_utc_date(2015, 12, 1)), NEW_YORK_EST);
+  ASSERT_EQ(utc_offset_at(NULL, get_utc_date(2015, 12, 1)), 0);
+}
+
+TEST(TimeFormatTest, FormatsTimetable) {
+  const utc_offset_entry_t entries[] = {
+      {get_utc_date(2015, 1, 1), NEW_YORK_EST},
+      {get_utc_date(2015, 3, 8) + 7 * 3600, NEW_YORK_EDT},
+  };
+  utc_offset_table_t table = {entries, 2};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  coordinates_t coordinates = {35.7750, -78.6336};
+
+  prayer_times_t timetable[4];
+  time_t start = get_utc_date(2015, 3, 6);
+  for (int i = 0; i < 4; i++) {
+    timetable[i] =
+        new_prayer_times(&coordinates, add_days(start, i), &params);
+  }
+
+  char buffer[4 * TIME_FORMAT_FIELDS_PER_DAY][TIME_FORMAT_MAX_LENGTH];
+  ASSERT_EQ(format_timetable(timetable, 4, &table, TIME_FORMAT_24H,
+                             &buffer[0][0], TIME_FORMAT_MAX_LENGTH),
+            4u * TIME_FORMAT_FIELDS_PER_DAY);
+
+  for (int day = 0; day < 4; day++) {
+    char expected[TIME_FORMAT_FIELDS_PER_DAY][TIME_FORMAT_MAX_LENGTH];
+    int offset = utc_offset_at(&table, timetable[day].fajr);
+    ASSERT_EQ(format_prayer_times(&timetable[day], offset, TIME_FORMAT_24H,
+                                  &expected[0][0], TIME_FORMAT_MAX_LENGTH),
+              (size_t)TIME_FORMAT_FIELDS_PER_DAY);
+    for (int field = 0; field < TIME_FORMAT_FIELDS_PER_DAY; field++) {
+      ASSERT_STREQ(buffer[day * TIME_FORMAT_FIELDS_PER_DAY + field],
+                   expected[field]);
+    }
+  }
+
+  // Daylight saving time starts on the third day
+  ASSERT_STREQ(buffer[0 * TIME_FORMAT_FIELDS_PER_DAY + 2], "12:27");
+  ASSERT_STREQ(buffer[3 * TIME_FORMAT_FIELDS_PER_DAY + 2], "13:26");
+
+  ASSERT_EQ(format_timetable(timetable, 4, &table, TIME_FORMAT_24H,
+                             &buffer[0][0], 8),
+            0u);
+}
@@ -0,0 +1,97 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/calendrical_helper.h"
+#include "../src/prayer_times.h"
+#include "../src/timetable.h"
+}
+
+static void expect_same_times(const prayer_times_t &actual,
+                              const prayer_times_t &expected) {
+  EXPECT_EQ(actual.fajr, expected.fajr);
+  EXPECT_EQ(actual.sunrise, expected.sunrise);
+  EXPECT_EQ(actual.dhuhr, expected.dhuhr);
+  EXPECT_EQ(actual.asr, expected.asr);
+  EXPECT_EQ(actual.maghrib, expected.maghrib);
+  EXPECT_EQ(actual.isha, expected.isha);
+  EXPECT_EQ(actual.midnight, expected.midnight);
+}
+
+TEST(TimetableTest, MatchesSingleDayCalculation) {
+  coordinates_t locations[] = {
+      {35.7750, -78.6336}, // Raleigh
+      {59.9094, 10.7349},  // Oslo
+      {-33.8688, 151.2093}, // Sydney
+      {21.4225, 39.8262},  // Makkah
+  };
+  calculation_method methods[] = {MUSLIM_WORLD_LEAGUE, MOON_SIGHTING_COMMITTEE,
+                                  UMM_AL_QURA, NORTH_AMERICA};
+  const size_t days = 40;
+  prayer_times_t timetable[days];
+
+  for (coordinates_t &coordinates : locations) {
+    for (calculation_method method : methods) {
+      calculation_parameters_t params = getParameters(method);
+      time_t start = get_utc_date(2015, 12, 10);
+
+      ASSERT_EQ(new_prayer_times_range(&coordinates, start, days, &params,
+                                       NULL, timetable),
+                days);
+      for (size_t i = 0; i < days; i++) {
+        prayer_times_t expected =
+            new_prayer_times(&coordinates, add_days(start, i), &params);
+        expect_same_times(timetable[i], expected);
+      }
+    }
+  }
+}
+
+TEST(TimetableTest, RamadanIshaAdjustment) {
+  coordinates_t makkah = {21.4225241, 39.8261818};
+  calculation_parameters_t params = getParameters(UMM_AL_QURA);
+  hijri_month_adjustments_t ramadan = umm_al_qura_ramadan_adjustments(&params);
+
+  // 28 Shaban 1445 to 2 Shawwal 1445
+  time_t start = get_utc_date(2024, 3, 9);
+  const size_t days = 34;
+  prayer_times_t timetable[days];
+  ASSERT_EQ(new_prayer_times_range(&makkah, start, days, &params, &ramadan,
+                                   timetable),
+            days);
+
+  for (size_t i = 0; i < days; i++) {
+    time_t date = add_days(start, i);
+    prayer_times_t plain = new_prayer_times(&makkah, date, &params);
+    bool in_ramadan = date >= get_utc_date(2024, 3, 11) &&
+                      date < get_utc_date(2024, 4, 10);
+
+    EXPECT_EQ(timetable[i].isha - plain.isha, in_ramadan ? 30 * 60 : 0) << i;
+    EXPECT_EQ(timetable[i].fajr, plain.fajr);
+    EXPECT_EQ(timetable[i].maghrib, plain.maghrib);
+    EXPECT_EQ(timetable[i].midnight, plain.midnight);
+  }
+}
+
+TEST(TimetableTest, InvalidArguments) {
+  coordinates_t coordinates = {35.7750, -78.6336};
+  calculation_parameters_t params = getParameters(MUSLIM_WORLD_LEAGUE);
+  prayer_times_t timetable[1];
+  time_t start = get_utc_date(2015, 12, 10);
+
+  EXPECT_EQ(new_prayer_times_range(NULL, start, 1, &params, NULL, timetable),
+            0u);
+  EXPECT_EQ(new_prayer_times_range(&coordinates, start, 1, NULL, NULL,
+                                   timetable),
+            0u);
+  EXPECT_EQ(new_prayer_times_range(&coordinates, start, 0, &params, NULL,
+                                   timetable),
+            0u);
+
+  coordinates_t invalid = {200.0, 300.0};
+  ASSERT_EQ(new_prayer_times_range(&invalid, start, 1, &params, NULL,
+                                   timetable),
+            1u);
+  EXPECT_EQ(timetable[0].fajr, 0);
+}
@@ -0,0 +1,111 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "../src/calendrical_helper.h"
+#include "../src/solar_time.h"
+#include "../src/twilight_profile.h"
+}
+
+TEST(TwilightProfileTest, SweepMatchesHourAngle) {
+  coordinates_t locations[] = {
+      {35.7750, -78.6336},  // Raleigh
+      {51.5074, -0.1278},   // London
+      {-33.8688, 151.2093}, // Sydney
+  };
+  const size_t count = 81;
+  double morning[count];
+  double evening[count];
+
+  for (coordinates_t &coordinates : locations) {
+    for (int month = 1; month <= 12; month++) {
+      solar_time_t solar_time =
+          new_solar_time(get_utc_date(2024, month, 15), &coordinates);
+      twilight_sweep(&solar_time, 0.0, 0.25, count, morning, evening);
+
+      for (size_t i = 0; i < count; i++) {
+        const double angle = -0.25 * i;
+        if (std::isnan(morning[i])) {
+          EXPECT_TRUE(std::isnan(evening[i]));
+          continue;
+        }
+        EXPECT_NEAR(morning[i], hour_angle(&solar_time, angle, false), 1e-9);
+        EXPECT_NEAR(evening[i], hour_angle(&solar_time, angle, true), 1e-9);
+      }
+    }
+  }
+}
+
+TEST(TwilightProfileTest, MarksDepressionsNeverReached) {
+  // London in June: the sun stays above -18 degrees all night
+  coordinates_t london = {51.5074, -0.1278};
+  solar_time_t solar_time =
+      new_solar_time(get_utc_date(2024, 6, 21), &london);
+  double morning[81];
+  double evening[81];
+
+  twilight_sweep(&solar_time, 0.0, 0.25, 81, morning, evening);
+  EXPECT_FALSE(std::isnan(morning[48])); // 12 degrees
+  EXPECT_FALSE(std::isnan(evening[48]));
+  EXPECT_TRUE(std::isnan(morning[72])); // 18 degrees
+  EXPECT_TRUE(std::isnan(evening[72]));
+  for (size_t i = 1; i < 81; i++) {
+    if (!std::isnan(morning[i])) {
+      EXPECT_LT(morning[i], morning[i - 1]);
+      EXPECT_GT(evening[i], evening[i - 1]);
+    }
+  }
+}
+
+TEST(TwilightProfileTest, RangeMatchesSingleDays) {
+  coordinates_t makkah = {21.4225, 39.8262};
+  const size_t days = 20;
+  const size_t count = 41;
+  double morning[days * count];
+  double evening[days * count];
+  double expected_morning[count];
+  double expected_evening[count];
+  const time_t start = get_utc_date(2024, 3, 1);
+  twilight_profile_t profile = {start, days, 0.0, 0.5, count, morning,
+                                evening};
+
+  ASSERT_EQ(twilight_profile(&makkah, &profile), days);
+  for (size_t i = 0; i < days; i++) {
+    solar_time_t solar_time = new_solar_time(add_days(start, i), &makkah);
+    twilight_sweep(&solar_time, 0.0, 0.5, count, expected_morning,
+                   expected_evening);
+    for (size_t j = 0; j < count; j++) {
+      EXPECT_EQ(morning[i * count + j], expected_morning[j]);
+      EXPECT_EQ(evening[i * count + j], expected_evening[j]);
+    }
+  }
+
+  profile.morning = NULL;
+  profile.evening = NULL;
+  EXPECT_EQ(twilight_profile(&makkah, &profile), 0u);
+}
+
+TEST(TwilightProfileTest, WritesCsv) {
+  coordinates_t london = {51.5074, -0.1278};
+  double morning[2];
+  double evening[2];
+  twilight_profile_t profile = {get_utc_date(2024, 6, 21), 1, 12.0, 6.0, 2,
+                                morning, evening};
+  char text[256] = {0};
+
+  ASSERT_EQ(twilight_profile(&london, &profile), 1u);
+  FILE *out = tmpfile();
+  ASSERT_NE(out, nullptr);
+  EXPECT_EQ(twilight_profile_csv(&profile, 3600, out), 2u);
+  rewind(out);
+  fread(text, 1, sizeof text - 1, out);
+  fclose(out);
+
+  EXPECT_STREQ(text, "date,depression,morning,evening\n"
+                     "2024-06-21,12,2024-06-21T02:40:44+01:00,"
+                     "2024-06-21T23:24:05+01:00\n"
+                     "2024-06-21,18,,\n");
+}
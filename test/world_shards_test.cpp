@@ -0,0 +1,153 @@
+#include "test_utils.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "../src/calculation_parameters.h"
+#include "../src/packed_times.h"
+#include "../src/prayer_times.h"
+#include "../src/world_shards.h"
+}
+
+static world_spec_t small_spec() {
+  world_spec_t spec = {50.5, -10, 2.5, 0, 3, 5, 40, MOON_SIGHTING_COMMITTEE,
+                       HANAFI, SEVENTH_OF_THE_NIGHT, 4, 3};
+  spec.start = get_utc_date(2024, 12, 10);
+  return spec;
+}
+
+static std::string shard_path(const std::string &directory, size_t shard) {
+  char path[1024];
+  EXPECT_GT(world_shard_path(directory.c_str(), shard, path, sizeof path),
+            0u);
+  return path;
+}
+
+TEST(WorldShardsTest, ShardsCoverTheGridOnce) {
+  const world_spec_t spec = small_spec();
+  const size_t cells = spec.latitudes * spec.longitudes;
+  ASSERT_EQ(world_spec_shards(&spec), 12u);
+
+  std::vector<int> covered(cells * spec.days, 0);
+  for (size_t shard = 0; shard < world_spec_shards(&spec); shard++) {
+    world_shard_bounds_t bounds;
+    ASSERT_TRUE(world_shard_bounds(&spec, shard, &bounds));
+    EXPECT_GT(bounds.cells, 0u);
+    EXPECT_GT(bounds.days, 0u);
+    for (size_t i = 0; i < bounds.cells; i++) {
+      for (size_t d = 0; d < bounds.days; d++) {
+        covered[(bounds.first_cell + i) * spec.days + bounds.first_day + d]++;
+      }
+    }
+  }
+  for (int count : covered) {
+    EXPECT_EQ(count, 1);
+  }
+
+  world_shard_bounds_t bounds;
+  EXPECT_FALSE(world_shard_bounds(&spec, 12, &bounds));
+  world_spec_t invalid = spec;
+  invalid.latitudes = 20; // Past the pole
+  EXPECT_EQ(world_spec_shards(&invalid), 0u);
+  invalid = spec;
+  invalid.day_shards = 41;
+  EXPECT_EQ(world_spec_shards(&invalid), 0u);
+}
+
+TEST(WorldShardsTest, MergedDatasetMatchesPrayerTimes) {
+  const world_spec_t spec = small_spec();
+  const std::string directory = testing::TempDir();
+  const std::string dataset_path = directory + "/world_shards_test.bin";
+
+  // Out of order, as independent workers would finish
+  for (size_t shard = world_spec_shards(&spec); shard-- > 0;) {
+    const std::string path = shard_path(directory, shard);
+    ASSERT_TRUE(world_shard_write(&spec, shard, path.c_str()));
+    EXPECT_TRUE(world_shard_valid(&spec, shard, path.c_str()));
+  }
+  ASSERT_TRUE(world_merge(&spec, directory.c_str(), dataset_path.c_str()));
+
+  world_dataset_t dataset;
+  ASSERT_TRUE(world_dataset_open(dataset_path.c_str(), true, &dataset));
+  calculation_parameters_t params = getParameters(MOON_SIGHTING_COMMITTEE);
+  params.madhab = HANAFI;
+  params.highLatitudeRule = SEVENTH_OF_THE_NIGHT;
+  for (size_t cell = 0; cell < spec.latitudes * spec.longitudes; cell++) {
+    coordinates_t coordinates = world_cell_coordinates(&spec, cell);
+    for (size_t day = 0; day < spec.days; day += 3) {
+      const time_t date = spec.start + (time_t)day * 86400;
+      prayer_times_t computed = new_prayer_times(&coordinates, date, &params);
+      packed_prayer_times_t packed;
+      pack_prayer_times(&computed, &packed);
+      prayer_times_t expected = unpack_prayer_times(&packed);
+      prayer_times_t times;
+      // Any time of the UTC day
+      ASSERT_TRUE(world_dataset_lookup(&dataset, &coordinates, date + 43200,
+                                       &times));
+      EXPECT_EQ(times.fajr, expected.fajr) << cell << " " << day;
+      EXPECT_EQ(times.isha, expected.isha) << cell << " " << day;
+      EXPECT_EQ(times.midnight, expected.midnight) << cell << " " << day;
+    }
+  }
+
+  // Nearest cell, and outside the grid or the days
+  coordinates_t near = {51.4, -8.6};
+  coordinates_t cell = {50.5, -7.5};
+  prayer_times_t times, expected;
+  ASSERT_TRUE(world_dataset_lookup(&dataset, &near, spec.start, &times));
+  ASSERT_TRUE(world_dataset_lookup(&dataset, &cell, spec.start, &expected));
+  EXPECT_EQ(times.dhuhr, expected.dhuhr);
+  coordinates_t outside = {60, -10};
+  EXPECT_FALSE(world_dataset_lookup(&dataset, &outside, spec.start, &times));
+  EXPECT_FALSE(world_dataset_lookup(&dataset, &cell, spec.start - 1, &times));
+  EXPECT_FALSE(world_dataset_lookup(&dataset, &cell,
+                                    spec.start + 40 * 86400, &times));
+  world_dataset_close(&dataset);
+}
+
+TEST(WorldShardsTest, RejectsPartialCorruptAndForeignShards) {
+  const world_spec_t spec = small_spec();
+  const std::string directory = testing::TempDir() + "/world_shards_bad";
+  const std::string dataset_path = directory + ".bin";
+  ASSERT_EQ(system(("mkdir -p " + directory).c_str()), 0);
+  remove(dataset_path.c_str());
+  for (size_t shard = 0; shard < world_spec_shards(&spec); shard++) {
+    ASSERT_TRUE(world_shard_write(&spec, shard,
+                                  shard_path(directory, shard).c_str()));
+  }
+
+  // Another spec, such as other options on another node
+  world_spec_t other = spec;
+  other.madhab = SHAFI;
+  EXPECT_FALSE(world_shard_valid(&other, 5, shard_path(directory, 5).c_str()));
+  EXPECT_FALSE(world_shard_valid(&spec, 4, shard_path(directory, 5).c_str()));
+
+  // One damaged byte
+  const std::string path = shard_path(directory, 5);
+  FILE *file = fopen(path.c_str(), "r+b");
+  ASSERT_NE(file, nullptr);
+  fseek(file, -3, SEEK_END);
+  const int byte = fgetc(file);
+  fseek(file, -3, SEEK_END);
+  fputc(byte ^ 1, file);
+  fclose(file);
+  EXPECT_FALSE(world_shard_valid(&spec, 5, path.c_str()));
+  EXPECT_FALSE(world_merge(&spec, directory.c_str(), dataset_path.c_str()));
+
+  // Rewriting the shard makes the precompute complete again
+  ASSERT_TRUE(world_shard_write(&spec, 5, path.c_str()));
+  EXPECT_TRUE(world_shard_valid(&spec, 5, path.c_str()));
+
+  // Missing a shard
+  remove(shard_path(directory, 7).c_str());
+  EXPECT_FALSE(world_shard_valid(&spec, 7, shard_path(directory, 7).c_str()));
+  EXPECT_FALSE(world_merge(&spec, directory.c_str(), dataset_path.c_str()));
+  world_dataset_t dataset;
+  EXPECT_FALSE(world_dataset_open(dataset_path.c_str(), false, &dataset));
+
+  ASSERT_TRUE(world_shard_write(&spec, 7, shard_path(directory, 7).c_str()));
+  EXPECT_TRUE(world_merge(&spec, directory.c_str(), dataset_path.c_str()));
+  EXPECT_TRUE(world_dataset_open(dataset_path.c_str(), true, &dataset));
+  world_dataset_close(&dataset);
+}
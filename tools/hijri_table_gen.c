@@ -0,0 +1,111 @@
+/*
+ * Generates src/umm_al_qura_table.c, the month start table used by
+ * hijri_calendar.c.
+ *
+ * Since 1423 AH the Umm al-Qura calendar starts a month on the day after the
+ * 29th when, seen from Makkah at sunset, the geocentric conjunction has
+ * already happened and the moon sets after the sun. This tool evaluates that
+ * rule for every lunation of the table range with the new moon algorithm of
+ * Astronomical Algorithms chapter 49, a truncated chapter 47 lunar theory and
+ * the library's own sunset.
+ *
+ * Usage: hijri_table_gen > src/umm_al_qura_table.c
+ */
+#include "../src/astronomical.h"
+#include "../src/calendrical_helper.h"
+#include "../src/double_utils.h"
+#include "../src/lunar_coordinates.h"
+#include "../src/solar_time.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FIRST_YEAR 1423
+#define LAST_YEAR 1500
+#define UNIX_EPOCH_JD 2440587.5
+
+/* Hijri month index ((year - 1) * 12 + month - 1) of the lunation k = 0 in
+ * Astronomical Algorithms (new moon of 2000-01-06, Shawwal 1420). */
+#define LUNATION_OFFSET 17037
+
+static const coordinates_t MAKKAH = {21.4225241, 39.8261818};
+static const int MAKKAH_UTC_OFFSET = 3 * 3600;
+
+/* Moon altitude above its setting altitude, in degrees, at a UT instant */
+static double moon_altitude_above_horizon(double jd_ut, double jde,
+                                          const coordinates_t *observer) {
+  const lunar_coordinates_t moon = new_lunar_coordinates(jde);
+
+  const double theta = mean_sidereal_time(julian_century(jd_ut));
+  const double H = theta + observer->longitude - moon.rightAscension;
+  const double h =
+      altitude_of_celestial_body(observer->latitude, moon.declination, H);
+
+  /* Astronomical Algorithms page 102, h0 for the moon */
+  const double parallax = to_degrees(asin(6378.14 / moon.distance));
+  return h - (0.7275 * parallax - 0.5667);
+}
+
+/* Whether the month starts on the day after the Makkah date `day` */
+static int crescent_criterion(long day, double conjunction_jd_ut) {
+  coordinates_t makkah = MAKKAH;
+  solar_time_t solar =
+      new_solar_time((time_t)day * SECONDS_PER_DAY, &makkah);
+  const double sunset_jd = day + UNIX_EPOCH_JD + solar.sunset / 24;
+  if (conjunction_jd_ut >= sunset_jd) {
+    return 0;
+  }
+  const double year = 1970 + day / 365.2425;
+  const double sunset_jde = sunset_jd + delta_t(year) / SECONDS_PER_DAY;
+  return moon_altitude_above_horizon(sunset_jd, sunset_jde, &makkah) > 0;
+}
+
+static long floor_day(double seconds) {
+  return (long)floor(seconds / SECONDS_PER_DAY);
+}
+
+int main(void) {
+  const int first = (FIRST_YEAR - 1) * 12;
+  const int last = LAST_YEAR * 12;
+  long starts[(LAST_YEAR - FIRST_YEAR + 1) * 12 + 1];
+
+  for (int index = first; index <= last; index++) {
+    const double k = index - LUNATION_OFFSET;
+    const double jde = new_moon_julian_ephemeris_day(k);
+    const double year = 2000 + k * 29.530588861 / 365.2425;
+    const double jd_ut = jde - delta_t(year) / SECONDS_PER_DAY;
+    const double unix_seconds = (jd_ut - UNIX_EPOCH_JD) * SECONDS_PER_DAY;
+    const long makkah_day = floor_day(unix_seconds + MAKKAH_UTC_OFFSET);
+
+    starts[index - first] = crescent_criterion(makkah_day, jd_ut)
+                                ? makkah_day + 1
+                                : makkah_day + 2;
+  }
+
+  printf("/*\n"
+         " * Generated by tools/hijri_table_gen.c, do not edit.\n"
+         " *\n"
+         " * First day of every Umm al-Qura month from Muharram %d to the\n"
+         " * month after Dhu al-Hijjah %d, in days since umm_al_qura_epoch\n"
+         " * (1 Muharram %d, in days since 1970-01-01).\n"
+         " */\n",
+         FIRST_YEAR, LAST_YEAR, FIRST_YEAR);
+  printf("#include <stdint.h>\n\n");
+  printf("const int umm_al_qura_first_year = %d;\n", FIRST_YEAR);
+  printf("const int umm_al_qura_last_year = %d;\n", LAST_YEAR);
+  printf("const long umm_al_qura_epoch = %ld;\n\n", starts[0]);
+  printf("const uint16_t umm_al_qura_month_starts[] = {\n");
+  for (int i = 0; i <= last - first; i++) {
+    if (i % 12 == 0) {
+      printf("    /* %d */", FIRST_YEAR + i / 12);
+    } else if (i % 6 == 0) {
+      printf("\n              ");
+    }
+    printf(" %ld,", starts[i] - starts[0]);
+    if (i % 12 == 11) {
+      printf("\n");
+    }
+  }
+  printf("\n};\n");
+  return 0;
+}
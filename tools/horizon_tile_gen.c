@@ -0,0 +1,111 @@
+/*
+ * Writes a synthetic elevation tile for horizon_tile_open(), to try terrain
+ * corrections without a digital elevation model.
+ *
+ * Usage:
+ *   horizon_tile_gen OUTPUT [OPTIONS]
+ *
+ * Options:
+ *   --grid SOUTH,WEST,SPACING,ROWS,COLUMNS  (default 21.2,39.6,0.000277778,
+ *                                            1441,1441, a 0.4 degree square
+ *                                            of 1 arcsecond cells)
+ *   --seed N                                (default 1)
+ *
+ * The terrain is a few octaves of value noise, rolling hills up to about
+ * 2000 m with ridges a few kilometers across, so horizons vary with the
+ * azimuth and the cache sees realistic block sizes.
+ */
+#include "../src/horizon.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OCTAVES 5
+
+/* Pseudo random value in [0, 1) of a lattice point */
+static double lattice(long x, long y, unsigned seed) {
+  uint32_t h = (uint32_t)x * 374761393u + (uint32_t)y * 668265263u +
+               seed * 2246822519u;
+  h = (h ^ (h >> 13)) * 1274126177u;
+  return (h ^ (h >> 16)) / 4294967296.0;
+}
+
+static double smooth(double t) { return t * t * (3 - 2 * t); }
+
+/* Value noise in [0, 1) at a point, in lattice units */
+static double noise(double x, double y, unsigned seed) {
+  const long x0 = (long)floor(x), y0 = (long)floor(y);
+  const double fx = smooth(x - x0), fy = smooth(y - y0);
+  const double south = lattice(x0, y0, seed) +
+                       fx * (lattice(x0 + 1, y0, seed) - lattice(x0, y0, seed));
+  const double north =
+      lattice(x0, y0 + 1, seed) +
+      fx * (lattice(x0 + 1, y0 + 1, seed) - lattice(x0, y0 + 1, seed));
+  return south + fy * (north - south);
+}
+
+static int16_t elevation(double latitude, double longitude, unsigned seed) {
+  double value = 0, amplitude = 1000, scale = 20;
+  for (int octave = 0; octave < OCTAVES; octave++) {
+    value += amplitude * noise(longitude * scale, latitude * scale, seed);
+    amplitude /= 2;
+    scale *= 2;
+  }
+  return (int16_t)lround(value);
+}
+
+int main(int argc, char **argv) {
+  horizon_grid_t grid = {21.2, 39.6, 1.0 / 3600, 1441, 1441};
+  unsigned seed = 1;
+  bool ok = argc >= 2;
+  for (int i = 2; ok && i < argc; i++) {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (value && strcmp(argv[i], "--grid") == 0) {
+      ok = sscanf(value, "%lf,%lf,%lf,%u,%u", &grid.south, &grid.west,
+                  &grid.spacing, &grid.rows, &grid.columns) == 5;
+    } else if (value && strcmp(argv[i], "--seed") == 0) {
+      ok = sscanf(value, "%u", &seed) == 1;
+    } else {
+      ok = false;
+    }
+    i++;
+  }
+  if (!ok) {
+    fprintf(stderr, "usage: horizon_tile_gen OUTPUT "
+                    "[--grid SOUTH,WEST,SPACING,ROWS,COLUMNS] [--seed N]\n");
+    return 1;
+  }
+
+  const size_t cells = (size_t)grid.rows * grid.columns;
+  int16_t *elevations = malloc(cells * sizeof(int16_t));
+  if (!elevations) {
+    perror("horizon_tile_gen");
+    return 1;
+  }
+  for (uint32_t row = 0; row < grid.rows; row++) {
+    for (uint32_t column = 0; column < grid.columns; column++) {
+      elevations[(size_t)row * grid.columns + column] =
+          elevation(grid.south + row * grid.spacing,
+                    grid.west + column * grid.spacing, seed);
+    }
+  }
+  ok = horizon_tile_write(argv[1], &grid, elevations);
+  free(elevations);
+  if (!ok) {
+    fprintf(stderr, "horizon_tile_gen: cannot write %s\n", argv[1]);
+    return 1;
+  }
+
+  FILE *file = fopen(argv[1], "rb");
+  long size = 0;
+  if (file && fseek(file, 0, SEEK_END) == 0) {
+    size = ftell(file);
+  }
+  if (file) {
+    fclose(file);
+  }
+  printf("%s: %u x %u cells, %ld bytes, %.2f bytes a cell\n", argv[1],
+         grid.rows, grid.columns, size, (double)size / cells);
+  return 0;
+}
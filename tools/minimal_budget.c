@@ -0,0 +1,289 @@
+/*
+ * Checks the stack, flash and RAM of the ADHAN_MINIMAL profile against its
+ * budgets.
+ *
+ * Usage:
+ *   minimal_budget --size PROGRAM --linked OBJECT --root FUNCTION
+ *                  --stack BYTES --flash BYTES --ram BYTES OBJECT...
+ *
+ * The stack is the deepest path of the call graph from --root, summing the
+ * frames that GCC writes with -fcallgraph-info=su in a .ci file next to
+ * each OBJECT. Functions without a frame in those files, the math and C
+ * libraries, count as 0 and are listed. Flash is the text and data, and RAM
+ * the data and bss, that PROGRAM, a Berkeley format size(1), reports for
+ * --linked, the objects partially linked with their unused sections
+ * collected.
+ *
+ * It exits with status 1 when a budget is exceeded, the call graph has a
+ * recursion or an unbounded frame, or a file cannot be read.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_NAME 256
+#define MAX_DEPTH 64
+
+typedef struct {
+  char name[MAX_NAME];
+  long frame;   /* -1 when no object defines it */
+  bool bounded; /* false for a dynamic frame */
+  int state;    /* 0 unvisited, 1 on the path, 2 done */
+  long worst;   /* Deepest stack from here */
+  int next;     /* Callee on the deepest path, or -1 */
+} function_t;
+
+typedef struct {
+  int caller;
+  int callee;
+} call_t;
+
+static function_t *functions;
+static size_t function_count;
+static call_t *calls;
+static size_t call_count;
+
+static int find_function(const char *name) {
+  for (size_t i = 0; i < function_count; i++) {
+    if (strcmp(functions[i].name, name) == 0) {
+      return (int)i;
+    }
+  }
+  function_t *grown =
+      realloc(functions, (function_count + 1) * sizeof(function_t));
+  if (!grown) {
+    perror("minimal_budget");
+    exit(1);
+  }
+  functions = grown;
+  function_t *function = &functions[function_count];
+  snprintf(function->name, MAX_NAME, "%s", name);
+  function->frame = -1;
+  function->bounded = true;
+  function->state = 0;
+  function->worst = 0;
+  function->next = -1;
+  return (int)function_count++;
+}
+
+/* Copies the quoted value after `key` in `line` into `value` */
+static bool quoted(const char *line, const char *key, char *value) {
+  const char *start = strstr(line, key);
+  if (!start) {
+    return false;
+  }
+  start += strlen(key);
+  const char *end = strchr(start, '"');
+  if (!end || end - start >= MAX_NAME) {
+    return false;
+  }
+  memcpy(value, start, end - start);
+  value[end - start] = '\0';
+  return true;
+}
+
+/* Reads the nodes and edges of the VCG graph of a .ci file */
+static bool read_call_graph(const char *path) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    perror(path);
+    return false;
+  }
+  char line[4096];
+  char name[MAX_NAME], callee[MAX_NAME];
+  while (fgets(line, sizeof(line), file)) {
+    if (strncmp(line, "node:", 5) == 0 &&
+        quoted(line, "title: \"", name)) {
+      /* The label ends with "N bytes (static)" for a defined function */
+      const char *bytes = strstr(line, " bytes (");
+      if (bytes) {
+        const char *number = bytes;
+        while (number > line && number[-1] >= '0' && number[-1] <= '9') {
+          number--;
+        }
+        const int index = find_function(name);
+        function_t *function = &functions[index];
+        function->frame = strtol(number, NULL, 10);
+        function->bounded = strncmp(bytes, " bytes (dynamic)", 16) != 0;
+      } else {
+        find_function(name);
+      }
+    } else if (strncmp(line, "edge:", 5) == 0 &&
+               quoted(line, "sourcename: \"", name) &&
+               quoted(line, "targetname: \"", callee)) {
+      call_t *grown = realloc(calls, (call_count + 1) * sizeof(call_t));
+      if (!grown) {
+        perror("minimal_budget");
+        exit(1);
+      }
+      calls = grown;
+      const int caller = find_function(name);
+      calls[call_count].callee = find_function(callee);
+      calls[call_count].caller = caller;
+      call_count++;
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+/* Deepest stack from a function; false on a recursion */
+static bool deepest(int index) {
+  function_t *function = &functions[index];
+  if (function->state == 2) {
+    return true;
+  }
+  if (function->state == 1) {
+    fprintf(stderr, "minimal_budget: %s is recursive\n", function->name);
+    return false;
+  }
+  function->state = 1;
+  long worst = 0;
+  for (size_t i = 0; i < call_count; i++) {
+    if (calls[i].caller != index) {
+      continue;
+    }
+    if (!deepest(calls[i].callee)) {
+      return false;
+    }
+    if (functions[calls[i].callee].worst > worst || function->next < 0) {
+      worst = functions[calls[i].callee].worst;
+      function->next = calls[i].callee;
+    }
+  }
+  function->worst = (function->frame > 0 ? function->frame : 0) + worst;
+  function->state = 2;
+  return true;
+}
+
+/* Text, data and bss of the Berkeley output of size(1) */
+static bool section_sizes(const char *size, const char *object, long *text,
+                          long *data, long *bss) {
+  char command[4096];
+  snprintf(command, sizeof(command), "\"%s\" \"%s\"", size, object);
+  FILE *pipe = popen(command, "r");
+  if (!pipe) {
+    perror(size);
+    return false;
+  }
+  char line[1024];
+  bool found = false;
+  while (fgets(line, sizeof(line), pipe)) {
+    if (sscanf(line, "%ld %ld %ld", text, data, bss) == 3) {
+      found = true;
+    }
+  }
+  if (pclose(pipe) != 0 || !found) {
+    fprintf(stderr, "minimal_budget: cannot size %s\n", object);
+    return false;
+  }
+  return true;
+}
+
+static bool check(const char *what, long used, long budget) {
+  const bool fits = used <= budget;
+  printf("%-6s %6ld of %6ld bytes%s\n", what, used, budget,
+         fits ? "" : "  OVER BUDGET");
+  return fits;
+}
+
+int main(int argc, char **argv) {
+  const char *size = "size";
+  const char *linked = NULL;
+  const char *root = NULL;
+  long stack_budget = 0, flash_budget = 0, ram_budget = 0;
+  int first = argc;
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 < argc && strcmp(argv[i], "--size") == 0) {
+      size = argv[++i];
+    } else if (i + 1 < argc && strcmp(argv[i], "--linked") == 0) {
+      linked = argv[++i];
+    } else if (i + 1 < argc && strcmp(argv[i], "--root") == 0) {
+      root = argv[++i];
+    } else if (i + 1 < argc && strcmp(argv[i], "--stack") == 0) {
+      stack_budget = strtol(argv[++i], NULL, 10);
+    } else if (i + 1 < argc && strcmp(argv[i], "--flash") == 0) {
+      flash_budget = strtol(argv[++i], NULL, 10);
+    } else if (i + 1 < argc && strcmp(argv[i], "--ram") == 0) {
+      ram_budget = strtol(argv[++i], NULL, 10);
+    } else {
+      first = i;
+      break;
+    }
+  }
+  if (!linked || !root || first == argc) {
+    fprintf(stderr, "usage: minimal_budget --size PROGRAM --linked OBJECT "
+                    "--root FUNCTION --stack BYTES --flash BYTES --ram BYTES "
+                    "OBJECT...\n");
+    return 1;
+  }
+
+  /* foo.c.o writes foo.c.ci */
+  for (int i = first; i < argc; i++) {
+    char path[4096];
+    const size_t length = strlen(argv[i]);
+    const char *dot = strrchr(argv[i], '.');
+    const size_t stem = dot ? (size_t)(dot - argv[i]) : length;
+    if (stem + 4 > sizeof(path)) {
+      return 1;
+    }
+    memcpy(path, argv[i], stem);
+    memcpy(path + stem, ".ci", 4);
+    if (!read_call_graph(path)) {
+      return 1;
+    }
+  }
+
+  const int start = find_function(root);
+  if (functions[start].frame < 0) {
+    fprintf(stderr, "minimal_budget: no frame for %s\n", root);
+    return 1;
+  }
+  if (!deepest(start)) {
+    return 1;
+  }
+
+  bool fits = true;
+  printf("Deepest call path:\n");
+  int depth = 0;
+  for (int i = start; i >= 0 && depth < MAX_DEPTH; i = functions[i].next) {
+    const function_t *function = &functions[i];
+    const char *name = strrchr(function->name, ':');
+    name = name ? name + 1 : function->name;
+    if (function->frame < 0) {
+      printf("  %*s%s (external)\n", 2 * depth, "", name);
+    } else {
+      printf("  %*s%s %ld bytes%s\n", 2 * depth, "", name, function->frame,
+             function->bounded ? "" : " (unbounded)");
+    }
+    depth++;
+  }
+  printf("Reached without a frame:");
+  for (size_t i = 0; i < function_count; i++) {
+    if (functions[i].state == 2 && functions[i].frame < 0) {
+      printf(" %s", functions[i].name);
+    }
+  }
+  printf("\n");
+  for (size_t i = 0; i < function_count; i++) {
+    if (functions[i].state == 2 && !functions[i].bounded) {
+      fprintf(stderr, "minimal_budget: %s has an unbounded frame\n",
+              functions[i].name);
+      fits = false;
+    }
+  }
+
+  long text, data, bss;
+  if (!section_sizes(size, linked, &text, &data, &bss)) {
+    return 1;
+  }
+  fits = check("stack", functions[start].worst, stack_budget) && fits;
+  fits = check("flash", text + data, flash_budget) && fits;
+  fits = check("ram", data + bss, ram_budget) && fits;
+  free(functions);
+  free(calls);
+  return fits ? 0 : 1;
+}
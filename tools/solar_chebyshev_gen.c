@@ -0,0 +1,175 @@
+/*
+ * Generates src/solar_chebyshev_table.c, the Chebyshev coefficients used by
+ * solar_chebyshev.c.
+ *
+ * For every segment of SOLAR_CHEBYSHEV_SEGMENT_DAYS the declination, the
+ * right ascension, unwrapped from its start taken between -180 and 180
+ * degrees so the constant term keeps float precision, and the
+ * equation of the equinoxes are sampled at the Chebyshev nodes with the
+ * exact functions of astronomical.c, the same way as new_solar_coordinates(),
+ * and turned into coefficients with a discrete cosine transform. The
+ * equation of the equinoxes leaves out the 13.7 day lunar term of the
+ * nutation, which would need several times the coefficients. The largest
+ * error of the stored coefficients against the exact values is reported on
+ * stderr.
+ *
+ * Usage: solar_chebyshev_gen > src/solar_chebyshev_table.c
+ */
+#include "../src/astronomical.h"
+#include "../src/calendrical_helper.h"
+#include "../src/double_utils.h"
+#include "../src/solar_chebyshev.h"
+#include <math.h>
+#include <stdio.h>
+
+/* 1950-01-01 to 2150-01-01 */
+#define FIRST_JULIAN_DAY 2433282.5
+#define LAST_JULIAN_DAY 2506331.5
+#define MAX_ORDER 12
+#define ERROR_STEP 0.125
+
+enum { DECLINATION, RIGHT_ASCENSION, EQUINOXES, QUANTITIES };
+
+static const int ORDERS[QUANTITIES] = {
+    SOLAR_CHEBYSHEV_DECLINATION_ORDER, SOLAR_CHEBYSHEV_RIGHT_ASCENSION_ORDER,
+    SOLAR_CHEBYSHEV_EQUINOXES_ORDER};
+
+static const char *const NAMES[QUANTITIES] = {
+    "declination", "right ascension", "equation of the equinoxes"};
+
+/* Same as compute_solar_coordinates() in solar_coordinates.c, with the
+ * lunar longitude left out of the nutation for the equation of the
+ * equinoxes */
+static void exact_values(double julian_day, double values[QUANTITIES]) {
+  const double T = julian_century(julian_day);
+  const double L0 = mean_solar_longitude(T);
+  const double Lp = mean_lunar_longitude(T);
+  const double omega = ascending_lunar_node_longitude(T);
+  const double lambda = to_radians(apparent_solar_longitude(T, L0));
+  const double epsilon0 = mean_obliquity_of_the_ecliptic(T);
+  const double epsilonapp =
+      to_radians(apparent_obliquity_of_the_ecliptic(T, epsilon0));
+
+  values[DECLINATION] =
+      to_degrees(safe_asin(sin(epsilonapp) * sin(lambda)));
+  values[RIGHT_ASCENSION] = unwind_angle(
+      to_degrees(safe_atan2(cos(epsilonapp) * sin(lambda), cos(lambda))));
+
+  const double delta_psi = nutation_in_longitude(T, L0, 0, omega);
+  const double delta_epsilon = nutation_in_obliquity(T, L0, Lp, omega);
+  values[EQUINOXES] =
+      delta_psi * cos(to_radians(epsilon0 + delta_epsilon));
+}
+
+/* Moves `angle` within 180 degrees of `reference` */
+static double unwrap(double angle, double reference) {
+  while (angle - reference > 180) {
+    angle -= 360;
+  }
+  while (angle - reference < -180) {
+    angle += 360;
+  }
+  return angle;
+}
+
+static void fit_segment(double first_day, float *coefficients) {
+  double samples[QUANTITIES][MAX_ORDER];
+  double first_right_ascension = 0;
+  const int nodes = MAX_ORDER;
+
+  for (int k = 0; k < nodes; k++) {
+    const double x = cos(M_PI * (k + 0.5) / nodes);
+    double values[QUANTITIES];
+    exact_values(first_day + (x + 1) * SOLAR_CHEBYSHEV_SEGMENT_DAYS / 2,
+                 values);
+    if (k == 0) {
+      first_right_ascension = remainder(values[RIGHT_ASCENSION], 360);
+    }
+    values[RIGHT_ASCENSION] =
+        unwrap(values[RIGHT_ASCENSION], first_right_ascension);
+    for (int q = 0; q < QUANTITIES; q++) {
+      samples[q][k] = values[q];
+    }
+  }
+
+  for (int q = 0; q < QUANTITIES; q++) {
+    /* Orders below the number of nodes truncate the same series */
+    for (int j = 0; j < ORDERS[q]; j++) {
+      double sum = 0;
+      for (int k = 0; k < nodes; k++) {
+        sum += samples[q][k] * cos(M_PI * j * (k + 0.5) / nodes);
+      }
+      *coefficients++ = (float)((j ? 2.0 : 1.0) * sum / nodes);
+    }
+  }
+}
+
+static double evaluate(const float *c, int order, double x) {
+  double b1 = 0;
+  double b2 = 0;
+  for (int j = order - 1; j >= 1; j--) {
+    const double b0 = 2 * x * b1 - b2 + c[j];
+    b2 = b1;
+    b1 = b0;
+  }
+  return x * b1 - b2 + c[0];
+}
+
+static void measure_segment(double first_day, const float *coefficients,
+                            double errors[QUANTITIES]) {
+  for (double t = 0; t <= SOLAR_CHEBYSHEV_SEGMENT_DAYS; t += ERROR_STEP) {
+    const double x = 2 * t / SOLAR_CHEBYSHEV_SEGMENT_DAYS - 1;
+    double values[QUANTITIES];
+    exact_values(first_day + t, values);
+    const float *c = coefficients;
+    for (int q = 0; q < QUANTITIES; q++) {
+      const double error =
+          fabs(remainder(evaluate(c, ORDERS[q], x) - values[q], 360));
+      if (error > errors[q]) {
+        errors[q] = error;
+      }
+      c += ORDERS[q];
+    }
+  }
+}
+
+int main(void) {
+  const int segments = (int)ceil((LAST_JULIAN_DAY - FIRST_JULIAN_DAY) /
+                                 SOLAR_CHEBYSHEV_SEGMENT_DAYS);
+  double errors[QUANTITIES] = {0, 0, 0};
+
+  printf("/*\n"
+         " * Generated by tools/solar_chebyshev_gen.c, do not edit.\n"
+         " *\n"
+         " * Chebyshev coefficients of the declination, the unwrapped right\n"
+         " * ascension and the equation of the equinoxes, in degrees, for\n"
+         " * %d segments of %d days from Julian day %.1f.\n"
+         " */\n",
+         segments, SOLAR_CHEBYSHEV_SEGMENT_DAYS, FIRST_JULIAN_DAY);
+  printf("#include \"solar_chebyshev.h\"\n\n");
+  printf("const double solar_chebyshev_first_julian_day = %.1f;\n",
+         FIRST_JULIAN_DAY);
+  printf("const int solar_chebyshev_segments = %d;\n\n", segments);
+  printf("const float\n    solar_chebyshev_coefficients[]"
+         "[SOLAR_CHEBYSHEV_COEFFICIENTS] = {\n");
+  for (int s = 0; s < segments; s++) {
+    const double first_day =
+        FIRST_JULIAN_DAY + (double)s * SOLAR_CHEBYSHEV_SEGMENT_DAYS;
+    float coefficients[SOLAR_CHEBYSHEV_COEFFICIENTS];
+    fit_segment(first_day, coefficients);
+    measure_segment(first_day, coefficients, errors);
+
+    printf("        /* %.1f */ {", first_day);
+    for (int j = 0; j < SOLAR_CHEBYSHEV_COEFFICIENTS; j++) {
+      printf(j % 4 == 0 ? "\n            %.9g," : " %.9g,",
+             coefficients[j]);
+    }
+    printf("\n        },\n");
+  }
+  printf("};\n");
+
+  for (int q = 0; q < QUANTITIES; q++) {
+    fprintf(stderr, "%s: max error %.2e degrees\n", NAMES[q], errors[q]);
+  }
+  return 0;
+}
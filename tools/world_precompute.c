@@ -0,0 +1,204 @@
+/*
+ * Precomputes the prayer times of a latitude/longitude grid in shards, with
+ * local worker processes, and merges the shards into one dataset.
+ *
+ * Usage:
+ *   world_precompute run DIRECTORY [OPTIONS]
+ *   world_precompute merge DIRECTORY OUTPUT [OPTIONS]
+ *
+ * Options, which must be the same for every run and merge of a precompute:
+ *   --grid LATITUDE,LONGITUDE,STEP,ROWS,COLUMNS  (default -60,-180,1,121,360)
+ *   --start YYYY-MM-DD                           (default 2025-01-01)
+ *   --days N                                     (default 365)
+ *   --method N --madhab N --rule N               (calculation_method,
+ *                                                 madhab_t and
+ *                                                 high_latitude_rule_t)
+ *   --shards CELL_SHARDS,DAY_SHARDS              (default 64,1)
+ * Options of run:
+ *   --workers N         Worker processes (default 1)
+ *   --only FIRST-LAST   Shards to compute, to split a precompute between
+ *                       nodes that share DIRECTORY or copy their shards
+ *                       into it before merging
+ *
+ * run forks one process per shard, up to --workers at a time, and skips the
+ * shards that are already valid, so it can be rerun after a failure or an
+ * interruption to compute only what is missing. It exits with status 1 when
+ * a shard failed.
+ */
+#define _POSIX_C_SOURCE 200809L
+
+#include "../src/calendrical_helper.h"
+#include "../src/world_shards.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+typedef struct {
+  world_spec_t spec;
+  unsigned workers;
+  size_t first_shard;
+  size_t last_shard;
+} options_t;
+
+static int usage(void) {
+  fprintf(stderr,
+          "usage: world_precompute run DIRECTORY [OPTIONS]\n"
+          "       world_precompute merge DIRECTORY OUTPUT [OPTIONS]\n"
+          "see tools/world_precompute.c for the options\n");
+  return 2;
+}
+
+static bool parse_options(int argc, char **argv, options_t *options) {
+  world_spec_t *spec = &options->spec;
+  *spec = (world_spec_t){-60, -180, 1, 0, 121, 360, 365, MUSLIM_WORLD_LEAGUE,
+                         SHAFI, MIDDLE_OF_THE_NIGHT, 64, 1};
+  spec->start = (int64_t)days_from_civil(2025, 1, 1) * SECONDS_PER_DAY;
+  options->workers = 1;
+  options->first_shard = 0;
+  options->last_shard = (size_t)-1;
+
+  for (int i = 0; i < argc; i += 2) {
+    const char *name = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    int year, month, day;
+    int count = 0;
+
+    if (!value) {
+      return false;
+    } else if (strcmp(name, "--grid") == 0) {
+      count = sscanf(value, "%lf,%lf,%lf,%u,%u", &spec->first_latitude,
+                     &spec->first_longitude, &spec->step, &spec->latitudes,
+                     &spec->longitudes) == 5;
+    } else if (strcmp(name, "--start") == 0) {
+      count = sscanf(value, "%d-%d-%d", &year, &month, &day) == 3;
+      spec->start =
+          (int64_t)days_from_civil(year, month, day) * SECONDS_PER_DAY;
+    } else if (strcmp(name, "--days") == 0) {
+      count = sscanf(value, "%u", &spec->days);
+    } else if (strcmp(name, "--method") == 0) {
+      count = sscanf(value, "%d", &spec->method);
+    } else if (strcmp(name, "--madhab") == 0) {
+      count = sscanf(value, "%d", &spec->madhab);
+    } else if (strcmp(name, "--rule") == 0) {
+      count = sscanf(value, "%d", &spec->high_latitude_rule);
+    } else if (strcmp(name, "--shards") == 0) {
+      count = sscanf(value, "%u,%u", &spec->cell_shards,
+                     &spec->day_shards) == 2;
+    } else if (strcmp(name, "--workers") == 0) {
+      count = sscanf(value, "%u", &options->workers) && options->workers > 0;
+    } else if (strcmp(name, "--only") == 0) {
+      count = sscanf(value, "%zu-%zu", &options->first_shard,
+                     &options->last_shard) == 2;
+    }
+    if (count != 1) {
+      fprintf(stderr, "world_precompute: invalid option %s\n", name);
+      return false;
+    }
+  }
+  if (!world_spec_shards(spec)) {
+    fprintf(stderr, "world_precompute: invalid grid, days or shards\n");
+    return false;
+  }
+  return true;
+}
+
+/* Computes one shard in a child process, -1 when it cannot be started */
+static pid_t start_worker(const world_spec_t *spec, size_t shard,
+                          const char *path) {
+  const pid_t pid = fork();
+  if (pid == 0) {
+    _exit(world_shard_write(spec, shard, path) ? 0 : 1);
+  }
+  return pid;
+}
+
+static int run(const char *directory, const options_t *options) {
+  const size_t shards = world_spec_shards(&options->spec);
+  const size_t last = options->last_shard < shards ? options->last_shard
+                                                   : shards - 1;
+  pid_t *pids = calloc(options->workers, sizeof(*pids));
+  size_t *running = calloc(options->workers, sizeof(*running));
+  size_t skipped = 0, computed = 0, failed = 0;
+  unsigned busy = 0;
+  char path[4096];
+
+  if (!pids || !running) {
+    return 1;
+  }
+  for (size_t shard = options->first_shard; shard <= last || busy > 0;) {
+    /* Fill the free workers, then wait for one of them */
+    if (shard <= last && busy < options->workers) {
+      if (!world_shard_path(directory, shard, path, sizeof path)) {
+        failed++;
+      } else if (world_shard_valid(&options->spec, shard, path)) {
+        skipped++;
+      } else {
+        unsigned slot = 0;
+        while (pids[slot] > 0) {
+          slot++;
+        }
+        pids[slot] = start_worker(&options->spec, shard, path);
+        if (pids[slot] < 0) {
+          pids[slot] = 0;
+          failed++;
+        } else {
+          running[slot] = shard;
+          busy++;
+        }
+      }
+      shard++;
+      continue;
+    }
+
+    int status;
+    const pid_t pid = wait(&status);
+    for (unsigned slot = 0; pid > 0 && slot < options->workers; slot++) {
+      if (pids[slot] == pid) {
+        pids[slot] = 0;
+        busy--;
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+          computed++;
+        } else {
+          fprintf(stderr, "world_precompute: shard %zu failed\n",
+                  running[slot]);
+          failed++;
+        }
+      }
+    }
+    if (pid < 0) {
+      break;
+    }
+  }
+
+  printf("%zu shards computed, %zu already valid, %zu failed\n", computed,
+         skipped, failed);
+  free(running);
+  free(pids);
+  return failed ? 1 : 0;
+}
+
+int main(int argc, char **argv) {
+  options_t options;
+
+  if (argc >= 3 && strcmp(argv[1], "run") == 0) {
+    if (!parse_options(argc - 3, argv + 3, &options)) {
+      return usage();
+    }
+    return run(argv[2], &options);
+  }
+  if (argc >= 4 && strcmp(argv[1], "merge") == 0) {
+    if (!parse_options(argc - 4, argv + 4, &options)) {
+      return usage();
+    }
+    if (!world_merge(&options.spec, argv[2], argv[3])) {
+      fprintf(stderr, "world_precompute: missing or invalid shards in %s\n",
+              argv[2]);
+      return 1;
+    }
+    return 0;
+  }
+  return usage();
+}